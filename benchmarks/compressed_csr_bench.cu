@@ -0,0 +1,155 @@
+#include <nvbench/nvbench.cuh>
+#include <cxxopts.hpp>
+#include <gunrock/algorithms/algorithms.hxx>
+#include <gunrock/algorithms/host/bfs.hxx>
+#include <gunrock/algorithms/host/pr.hxx>
+
+#include "benchmarks.hxx"
+
+using namespace gunrock;
+using namespace memory;
+
+using vertex_t = int;
+using edge_t = int;
+using weight_t = float;
+
+std::string filename;
+
+struct parameters_t {
+  std::string filename;
+  bool help = false;
+  cxxopts::Options options;
+
+  /**
+   * @brief Construct a new parameters object and parse command line arguments.
+   *
+   * @param argc Number of command line arguments.
+   * @param argv Command line arguments.
+   */
+  parameters_t(int argc, char** argv)
+      : options(argv[0], "Compressed CSR Benchmarking") {
+    options.allow_unrecognised_options();
+    // Add command line options
+    options.add_options()("h,help", "Print help")  // help
+        ("m,market", "Matrix file",
+         cxxopts::value<std::string>());  // mtx
+
+    // Parse command line arguments
+    auto result = options.parse(argc, argv);
+
+    if (result.count("help")) {
+      help = true;
+      std::cout << options.help({""});
+      std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+      // Do not exit so we also print NVBench help.
+    } else {
+      if (result.count("market") == 1) {
+        filename = result["market"].as<std::string>();
+        if (!util::is_market(filename)) {
+          std::cout << options.help({""});
+          std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+          std::exit(0);
+        }
+      } else {
+        std::cout << options.help({""});
+        std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+        std::exit(0);
+      }
+    }
+  }
+};
+
+void compressed_csr_bench(nvbench::state& state) {
+  auto layout = state.get_string("Format");
+  auto kernel = state.get_string("Kernel");
+  auto num_threads = state.get_int64("Threads");
+
+  io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
+  auto [properties, coo] = mm.load(filename);
+
+  format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> csr;
+  csr.from_coo(coo);
+  format::compressed_csr_t<memory_space_t::host, vertex_t, edge_t, weight_t>
+      compressed;
+  compressed.from_csr(csr);
+
+  // Edges/s, and bytes of graph data per format (their ratio is the
+  // compression ratio).
+  bool use_compressed = layout == "compressed";
+  state.add_element_count(csr.number_of_nonzeros, "Edges");
+  state.add_global_memory_reads<nvbench::int8_t>(
+      use_compressed ? compressed.memory_footprint()
+                     : compressed.uncompressed_footprint(),
+      "Graph");
+
+  if (kernel == "pr" && !properties.symmetric) {
+    state.skip("Host PR without a CSC view requires a symmetric matrix.");
+    return;
+  }
+
+  if (num_threads > 0)
+    util::parallel::set_number_of_threads(num_threads);
+
+  // `out`: neighbor lists scanned by the decode kernel.
+  auto run = [&](auto& G, auto const& out) {
+    vertex_t n_vertices = G.get_number_of_vertices();
+    std::vector<vertex_t> distances(n_vertices);
+    std::vector<weight_t> ranks(n_vertices);
+    std::vector<vertex_t> sums(n_vertices);
+
+    state.exec(
+        nvbench::exec_tag::sync | nvbench::exec_tag::timer,
+        [&](nvbench::launch& launch, auto& timer) {
+          timer.start();
+          if (kernel == "decode") {
+            // Plain scan of every neighbor list.
+            util::parallel::for_each(
+                vertex_t(0), n_vertices,
+                [&](vertex_t v) {
+                  vertex_t sum = 0;
+                  out.for_each_neighbor(v,
+                                        [&](vertex_t u, edge_t) { sum += u; });
+                  sums[v] = sum;
+                },
+                vertex_t(256));
+          } else if (kernel == "bfs") {
+            host::bfs::run(G, vertex_t(0), distances.data(),
+                           (vertex_t*)nullptr);
+          } else {
+            host::pr::run(G, ranks.data());
+          }
+          timer.stop();
+        });
+  };
+
+  if (use_compressed) {
+    auto G = graph::build<memory_space_t::host>(properties, compressed);
+    run(G, G);
+  } else {
+    auto G = graph::build<memory_space_t::host>(properties, csr);
+    run(G, host::csr_adjacency_t<vertex_t, edge_t, weight_t>{
+               G.get_row_offsets(), G.get_column_indices(),
+               G.get_nonzero_values()});
+  }
+
+  util::parallel::set_number_of_threads(0);
+}
+
+int main(int argc, char** argv) {
+  parameters_t params(argc, argv);
+  filename = params.filename;
+
+  if (params.help) {
+    // Print NVBench help.
+    const char* args[1] = {"-h"};
+    NVBENCH_MAIN_BODY(1, args);
+  } else {
+    // Remove all gunrock parameters and pass to nvbench.
+    auto args = filtered_argv(argc, argv, "--market", "-m", filename);
+    NVBENCH_BENCH(compressed_csr_bench)
+        .add_string_axis("Format", {"csr", "compressed"})
+        .add_string_axis("Kernel", {"decode", "bfs", "pr"})
+        .add_int64_axis("Threads", {1, 2, 4, 8, 16, 0});
+    NVBENCH_MAIN_BODY(args.size(), args.data());
+  }
+}
@@ -0,0 +1,154 @@
+#include <nvbench/nvbench.cuh>
+#include <cxxopts.hpp>
+#include <gunrock/algorithms/algorithms.hxx>
+
+#include "benchmarks.hxx"
+
+using namespace gunrock;
+using namespace memory;
+
+using vertex_t = int;
+using edge_t = int;
+using weight_t = float;
+
+std::string filename;
+
+struct parameters_t {
+  std::string filename;
+  bool help = false;
+  cxxopts::Options options;
+
+  /**
+   * @brief Construct a new parameters object and parse command line arguments.
+   *
+   * @param argc Number of command line arguments.
+   * @param argv Command line arguments.
+   */
+  parameters_t(int argc, char** argv)
+      : options(argv[0], "COO to CSR Conversion Benchmarking") {
+    options.allow_unrecognised_options();
+    // Add command line options
+    options.add_options()("h,help", "Print help")  // help
+        ("m,market", "Matrix file",
+         cxxopts::value<std::string>());  // mtx
+
+    // Parse command line arguments
+    auto result = options.parse(argc, argv);
+
+    if (result.count("help")) {
+      help = true;
+      std::cout << options.help({""});
+      std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+      // Do not exit so we also print NVBench help.
+    } else {
+      if (result.count("market") == 1) {
+        filename = result["market"].as<std::string>();
+        if (!util::is_market(filename)) {
+          std::cout << options.help({""});
+          std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+          std::exit(0);
+        }
+      } else {
+        std::cout << options.help({""});
+        std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+        std::exit(0);
+      }
+    }
+  }
+};
+
+/**
+ * @brief Serial COO -> CSR conversion (histogram, scan and scatter, rows left
+ * unsorted), the conversion `csr_t::from_coo()` used before the parallel
+ * builder. Kept as the baseline.
+ */
+void serial_from_coo(
+    format::coo_t<memory_space_t::host, vertex_t, edge_t, weight_t> const& coo,
+    format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t>& csr) {
+  csr.number_of_rows = coo.number_of_rows;
+  csr.number_of_columns = coo.number_of_columns;
+  csr.number_of_nonzeros = coo.number_of_nonzeros;
+
+  std::vector<edge_t> Ap(coo.number_of_rows + 1, 0);
+  csr.column_indices.resize(coo.number_of_nonzeros);
+  csr.nonzero_values.resize(coo.number_of_nonzeros);
+
+  for (edge_t n = 0; n < coo.number_of_nonzeros; ++n)
+    ++Ap[coo.row_indices[n]];
+  for (vertex_t i = 0, sum = 0; i < coo.number_of_rows; ++i) {
+    edge_t temp = Ap[i];
+    Ap[i] = sum;
+    sum += temp;
+  }
+  Ap[coo.number_of_rows] = coo.number_of_nonzeros;
+  for (edge_t n = 0; n < coo.number_of_nonzeros; ++n) {
+    edge_t dest = Ap[coo.row_indices[n]]++;
+    csr.column_indices[dest] = coo.column_indices[n];
+    csr.nonzero_values[dest] = coo.nonzero_values[n];
+  }
+  for (vertex_t i = 0, last = 0; i <= coo.number_of_rows; ++i) {
+    edge_t temp = Ap[i];
+    Ap[i] = last;
+    last = temp;
+  }
+  csr.row_offsets.assign(Ap.begin(), Ap.end());
+}
+
+void csr_build_bench(nvbench::state& state) {
+  auto builder = state.get_string("Builder");
+  auto policy_name = state.get_string("Policy");
+  auto num_threads = state.get_int64("Threads");
+
+  if (builder == "serial" && (num_threads != 1 || policy_name != "keep")) {
+    state.skip("The serial conversion is single-threaded and keeps the input.");
+    return;
+  }
+
+  io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
+  auto [properties, coo] = mm.load(filename);
+  state.add_element_count(coo.number_of_nonzeros, "Edges");
+
+  // keep: sorted rows, input kept as is; merge: no self-loops or duplicates;
+  // symmetrize: merge, plus the mirror of every edge.
+  format::build_policy_t policy;
+  if (policy_name != "keep") {
+    policy.remove_self_loops = true;
+    policy.duplicates = format::duplicate_policy_t::first;
+    policy.symmetrize = (policy_name == "symmetrize");
+  }
+
+  if (num_threads > 0)
+    util::parallel::set_number_of_threads(num_threads);
+
+  format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> csr;
+  state.exec(nvbench::exec_tag::sync | nvbench::exec_tag::timer,
+             [&](nvbench::launch& launch, auto& timer) {
+               timer.start();
+               if (builder == "serial")
+                 serial_from_coo(coo, csr);
+               else
+                 csr.from_coo(coo, policy);
+               timer.stop();
+             });
+
+  util::parallel::set_number_of_threads(0);
+}
+
+int main(int argc, char** argv) {
+  parameters_t params(argc, argv);
+  filename = params.filename;
+
+  if (params.help) {
+    // Print NVBench help.
+    const char* args[1] = {"-h"};
+    NVBENCH_MAIN_BODY(1, args);
+  } else {
+    // Remove all gunrock parameters and pass to nvbench.
+    auto args = filtered_argv(argc, argv, "--market", "-m", filename);
+    NVBENCH_BENCH(csr_build_bench)
+        .add_string_axis("Builder", {"parallel", "serial"})
+        .add_string_axis("Policy", {"keep", "merge", "symmetrize"})
+        .add_int64_axis("Threads", {1, 2, 4, 8, 16, 0});
+    NVBENCH_MAIN_BODY(args.size(), args.data());
+  }
+}
@@ -0,0 +1,75 @@
+#include <nvbench/nvbench.cuh>
+#include <gunrock/algorithms/algorithms.hxx>
+#include <gunrock/algorithms/generate/graphs.hxx>
+
+#include "benchmarks.hxx"
+
+using namespace gunrock;
+using namespace memory;
+
+using vertex_t = int;
+using edge_t = int;
+using weight_t = float;
+
+/**
+ * @brief Generation straight into a host CSR. Strong scaling keeps the graph
+ * of `Scale` for every thread count; weak scaling grows it with the threads,
+ * `Scale + log2(Threads)`.
+ */
+void graph_generator_bench(nvbench::state& state) {
+  namespace gen = generate::graphs;
+  auto generator = state.get_string("Generator");
+  auto scaling = state.get_string("Scaling");
+  auto scale = int(state.get_int64("Scale"));
+  auto num_threads = state.get_int64("Threads");
+
+  if (num_threads > 0)
+    util::parallel::set_number_of_threads(num_threads);
+  if (scaling == "weak")
+    for (std::size_t t = util::parallel::number_of_threads(); t > 1; t /= 2)
+      ++scale;
+
+  format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> csr;
+  auto run = [&](auto const& parameters) {
+    state.exec(nvbench::exec_tag::sync | nvbench::exec_tag::timer,
+               [&](nvbench::launch& launch, auto& timer) {
+                 timer.start();
+                 gen::to_csr(parameters, csr);
+                 timer.stop();
+               });
+  };
+
+  // About 16 edges per vertex on 2^scale vertices.
+  if (generator == "rmat") {
+    gen::rmat_t<vertex_t, weight_t> rmat;
+    rmat.scale = scale;
+    state.add_element_count(rmat.size(), "Edges");
+    run(rmat);
+  } else if (generator == "gnp") {
+    gen::gnp_t<vertex_t, weight_t> gnp;
+    gnp.n = vertex_t(1) << scale;
+    gnp.p = 32.0 / gnp.n;
+    state.add_element_count(std::size_t(16) << scale, "Edges");
+    run(gnp);
+  } else {
+    gen::grid_t<vertex_t, weight_t> grid;
+    grid.rows = vertex_t(1) << (scale / 2);
+    grid.columns = vertex_t(1) << (scale - scale / 2);
+    grid.keep = 0.8;
+    grid.min_weight = 1;
+    grid.max_weight = 100;
+    state.add_element_count(2 * grid.size(), "Edges");
+    run(grid);
+  }
+
+  util::parallel::set_number_of_threads(0);
+}
+
+int main(int argc, char** argv) {
+  NVBENCH_BENCH(graph_generator_bench)
+      .add_string_axis("Generator", {"rmat", "gnp", "grid"})
+      .add_string_axis("Scaling", {"strong", "weak"})
+      .add_int64_axis("Scale", {16, 18, 20})
+      .add_int64_axis("Threads", {1, 2, 4, 8, 16, 0});
+  NVBENCH_MAIN_BODY(argc, argv);
+}
@@ -0,0 +1,289 @@
+#include <nvbench/nvbench.cuh>
+#include <cxxopts.hpp>
+#include <gunrock/algorithms/algorithms.hxx>
+#include <gunrock/algorithms/generate/graphs.hxx>
+#include <gunrock/algorithms/host/bfs.hxx>
+#include <gunrock/algorithms/host/incremental.hxx>
+
+#include <random>
+
+#include "benchmarks.hxx"
+
+using namespace gunrock;
+using namespace memory;
+
+using vertex_t = int;
+using edge_t = int;
+using weight_t = float;
+
+using csr_t = format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t>;
+using dynamic_graph_t = host::dynamic_graph_t<vertex_t, edge_t, weight_t>;
+using update_t = dynamic_graph_t::update_type;
+
+std::string filename;
+int scale = 0;
+
+struct parameters_t {
+  std::string filename;
+  std::string scale;
+  bool help = false;
+  cxxopts::Options options;
+
+  /**
+   * @brief Construct a new parameters object and parse command line arguments.
+   *
+   * @param argc Number of command line arguments.
+   * @param argv Command line arguments.
+   */
+  parameters_t(int argc, char** argv)
+      : options(argv[0], "Host Dynamic Graph Benchmarking") {
+    options.allow_unrecognised_options();
+    // Add command line options
+    options.add_options()("h,help", "Print help")  // help
+        ("m,market", "Matrix file",
+         cxxopts::value<std::string>())  // mtx
+        ("s,scale", "Generate an R-MAT graph of this scale instead",
+         cxxopts::value<std::string>());  // R-MAT scale
+
+    // Parse command line arguments
+    auto result = options.parse(argc, argv);
+
+    if (result.count("help")) {
+      help = true;
+      std::cout << options.help({""});
+      std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+      // Do not exit so we also print NVBench help.
+    } else {
+      if (result.count("market") == 1) {
+        filename = result["market"].as<std::string>();
+        if (!util::is_market(filename)) {
+          std::cout << options.help({""});
+          std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+          std::exit(0);
+        }
+      } else if (result.count("scale") == 1) {
+        scale = result["scale"].as<std::string>();
+      } else {
+        std::cout << options.help({""});
+        std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+        std::exit(0);
+      }
+    }
+  }
+};
+
+/**
+ * @brief A CSR with a batch applied, as an entry stream of
+ * `format::builder::compress()`: the insertions (both directions), then the
+ * rows of the CSR without the deletions (both directions, sorted).
+ */
+struct rebuild_t {
+  vertex_t number_of_rows;
+  edge_t const* offsets;
+  vertex_t const* indices;
+  weight_t const* values;
+  std::vector<update_t> const& insertions;
+  std::vector<update_t> const& deletions;
+
+  std::size_t size() const { return insertions.size() + number_of_rows; }
+
+  template <typename emit_t>
+  void operator()(std::size_t first, std::size_t last, emit_t&& emit) const {
+    for (std::size_t k = first; k < last; ++k) {
+      if (k < insertions.size()) {
+        auto const& x = insertions[k];
+        emit(x.source, x.destination, x.weight);
+        if (x.source != x.destination)
+          emit(x.destination, x.source, x.weight);
+        continue;
+      }
+      vertex_t u = vertex_t(k - insertions.size());
+      auto d = std::lower_bound(
+          deletions.begin(), deletions.end(), u,
+          [](update_t const& x, vertex_t row) { return x.source < row; });
+      for (edge_t e = offsets[u]; e < offsets[u + 1]; ++e) {
+        while (d != deletions.end() && d->source == u &&
+               d->destination < indices[e])
+          ++d;
+        if (d == deletions.end() || d->source != u ||
+            d->destination != indices[e])
+          emit(u, indices[e], values[e]);
+      }
+    }
+  }
+};
+
+/**
+ * @brief Time to a fresh BFS, CC or PageRank result after a batch of edge
+ * updates ("none": the update alone). "incremental" applies the batch to a
+ * host::dynamic_graph_t and brings the previous result up to date;
+ * "rebuild" builds a new CSR (the previous one, minus the deletions, plus
+ * the insertions) and recomputes from scratch. Batches of `Batch` random
+ * undirected edges, half of them deletions of input edges with "mixed"; each
+ * repetition applies a new batch. The graph is symmetrized.
+ */
+void host_dynamic_bench(nvbench::state& state) {
+  auto algorithm = state.get_string("Algorithm");
+  auto mode = state.get_string("Mode");
+  auto batch_size = std::size_t(state.get_int64("Batch"));
+  auto mix = state.get_string("Mix");
+  auto num_threads = state.get_int64("Threads");
+
+  if (num_threads > 0)
+    util::parallel::set_number_of_threads(num_threads);
+
+  // --
+  // Build the (symmetric) input CSR.
+  csr_t input;
+  if (scale > 0) {
+    generate::graphs::rmat_t<vertex_t, weight_t> rmat;
+    rmat.scale = scale;
+    generate::graphs::to_csr(rmat, input);
+  } else {
+    io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
+    auto [properties, coo] = mm.load(filename);
+    format::build_policy_t policy;
+    policy.remove_self_loops = true;
+    policy.duplicates = format::duplicate_policy_t::first;
+    policy.symmetrize = true;
+    input.from_coo(coo, policy);
+  }
+  vertex_t n = input.number_of_rows;
+  edge_t const* input_offsets = raw_pointer_cast(input.row_offsets.data());
+  vertex_t const* input_indices =
+      raw_pointer_cast(input.column_indices.data());
+
+  std::mt19937_64 rng(1);
+  std::vector<update_t> insertions, deletions;
+  auto next_batch = [&]() {
+    insertions.clear();
+    deletions.clear();
+    std::size_t removed = (mix == "mixed") ? batch_size / 2 : 0;
+    for (std::size_t i = removed; i < batch_size; ++i)
+      insertions.push_back({vertex_t(rng() % n), vertex_t(rng() % n)});
+    for (std::size_t i = 0; i < removed && input.number_of_nonzeros > 0;
+         ++i) {
+      edge_t e = edge_t(rng() % input.number_of_nonzeros);
+      vertex_t u = vertex_t(
+          std::upper_bound(input_offsets, input_offsets + n + 1, e) -
+          input_offsets - 1);
+      deletions.push_back({u, input_indices[e]});
+    }
+  };
+
+  vertex_t single_source = 0;
+  std::vector<vertex_t> distances(n), labels(n);
+  std::vector<weight_t> ranks(n);
+  host::pr::param_t<weight_t> param;
+
+  state.add_element_count(batch_size, "Updates");
+
+  // --
+  // Run with NVBench (host timer, nothing touches the GPU).
+  if (mode == "incremental") {
+    dynamic_graph_t G(input, true);
+    host::incremental::cc::forest_t<vertex_t> forest;
+    if (algorithm == "bfs") {
+      auto in = G.in();
+      host::bfs::run(n, G.out(), &in, single_source, distances.data(),
+                     (vertex_t*)nullptr);
+    } else if (algorithm == "cc") {
+      host::incremental::cc::run(G, labels.data(), forest);
+    } else if (algorithm == "pr") {
+      host::pr::run(n, G.out(), G.in(), ranks.data(), param);
+    }
+
+    state.exec(
+        nvbench::exec_tag::sync | nvbench::exec_tag::timer,
+        [&](nvbench::launch& launch, auto& timer) {
+          next_batch();
+          timer.start();
+          G.update(insertions, deletions);
+          if (algorithm == "bfs")
+            host::incremental::bfs::update(G, single_source, distances.data(),
+                                           insertions, deletions);
+          else if (algorithm == "cc")
+            host::incremental::cc::update(G, labels.data(), forest,
+                                          insertions, deletions);
+          else if (algorithm == "pr")
+            host::incremental::pr::update(G, ranks.data(), insertions,
+                                          deletions, param);
+          timer.stop();
+        });
+  } else {
+    csr_t buffers[2] = {input, csr_t()};
+    int current = 0;
+    format::build_policy_t policy;
+    policy.duplicates = format::duplicate_policy_t::first;
+
+    state.exec(
+        nvbench::exec_tag::sync | nvbench::exec_tag::timer,
+        [&](nvbench::launch& launch, auto& timer) {
+          next_batch();
+          timer.start();
+          csr_t const& previous = buffers[current];
+          csr_t& csr = buffers[1 - current];
+          std::vector<update_t> removed;
+          for (auto const& x : deletions) {
+            removed.push_back(x);
+            removed.push_back({x.destination, x.source});
+          }
+          util::parallel::sort(removed.begin(), removed.end(),
+                               [](update_t const& a, update_t const& b) {
+                                 return std::make_pair(a.source,
+                                                       a.destination) <
+                                        std::make_pair(b.source,
+                                                       b.destination);
+                               });
+          csr.from_stream(
+              n, n,
+              rebuild_t{n, raw_pointer_cast(previous.row_offsets.data()),
+                        raw_pointer_cast(previous.column_indices.data()),
+                        raw_pointer_cast(previous.nonzero_values.data()),
+                        insertions, removed},
+              policy);
+
+          edge_t const* offsets = raw_pointer_cast(csr.row_offsets.data());
+          vertex_t const* indices =
+              raw_pointer_cast(csr.column_indices.data());
+          weight_t const* values = raw_pointer_cast(csr.nonzero_values.data());
+          if (algorithm == "bfs")
+            host::bfs::run(n, offsets, indices, offsets, indices,
+                           single_source, distances.data(),
+                           (vertex_t*)nullptr);
+          else if (algorithm == "cc")
+            host::cc::run(n, offsets, indices, labels.data());
+          else if (algorithm == "pr")
+            host::pr::run(n, offsets, indices, values, offsets, indices,
+                          values, ranks.data(), param);
+          timer.stop();
+          current = 1 - current;
+        });
+  }
+
+  util::parallel::set_number_of_threads(0);
+}
+
+int main(int argc, char** argv) {
+  parameters_t params(argc, argv);
+  filename = params.filename;
+  if (!params.scale.empty())
+    scale = std::stoi(params.scale);
+
+  if (params.help) {
+    // Print NVBench help.
+    const char* args[1] = {"-h"};
+    NVBENCH_MAIN_BODY(1, args);
+  } else {
+    // Remove all gunrock parameters and pass to nvbench.
+    auto args = filtered_argv(argc, argv, "--market", "-m", filename,
+                              "--scale", "-s", params.scale);
+    NVBENCH_BENCH(host_dynamic_bench)
+        .add_string_axis("Algorithm", {"none", "bfs", "cc", "pr"})
+        .add_string_axis("Mode", {"incremental", "rebuild"})
+        .add_int64_axis("Batch", {1024, 65536})
+        .add_string_axis("Mix", {"insert", "mixed"})
+        .add_int64_axis("Threads", {1, 0});
+    NVBENCH_MAIN_BODY(args.size(), args.data());
+  }
+}
@@ -0,0 +1,131 @@
+#include <nvbench/nvbench.cuh>
+#include <cxxopts.hpp>
+#include <gunrock/algorithms/algorithms.hxx>
+#include <gunrock/algorithms/host/kcore.hxx>
+
+#include "benchmarks.hxx"
+#include "../examples/algorithms/kcore/kcore_cpu.hxx"
+
+using namespace gunrock;
+using namespace memory;
+
+using vertex_t = int;
+using edge_t = int;
+using weight_t = float;
+
+std::string filename;
+
+struct parameters_t {
+  std::string filename;
+  bool help = false;
+  cxxopts::Options options;
+
+  /**
+   * @brief Construct a new parameters object and parse command line arguments.
+   *
+   * @param argc Number of command line arguments.
+   * @param argv Command line arguments.
+   */
+  parameters_t(int argc, char** argv)
+      : options(argv[0], "Host K-Core Benchmarking") {
+    options.allow_unrecognised_options();
+    // Add command line options
+    options.add_options()("h,help", "Print help")  // help
+        ("m,market", "Matrix file",
+         cxxopts::value<std::string>());  // mtx
+
+    // Parse command line arguments
+    auto result = options.parse(argc, argv);
+
+    if (result.count("help")) {
+      help = true;
+      std::cout << options.help({""});
+      std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+      // Do not exit so we also print NVBench help.
+    } else {
+      if (result.count("market") == 1) {
+        filename = result["market"].as<std::string>();
+        if (!util::is_market(filename)) {
+          std::cout << options.help({""});
+          std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+          std::exit(0);
+        }
+      } else {
+        std::cout << options.help({""});
+        std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+        std::exit(0);
+      }
+    }
+  }
+};
+
+void host_kcore_bench(nvbench::state& state) {
+  auto kernel = state.get_string("Kernel");
+  auto num_threads = state.get_int64("Threads");
+
+  if (kernel != "peeling" && num_threads != 1) {
+    state.skip("The reference and the bucket algorithm are serial.");
+    return;
+  }
+
+  // --
+  // Build a host graph
+
+  io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
+  auto [properties, coo] = mm.load(filename);
+
+  using csr_t = format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t>;
+  csr_t csr;
+  csr.from_coo(coo);
+
+  auto G = graph::build<memory_space_t::host>(properties, csr);
+
+  // --
+  // Params and memory allocation
+
+  vertex_t n_vertices = G.get_number_of_vertices();
+  std::vector<int> k_cores(n_vertices);
+  host::kcore::param_t param;
+  param.algorithm = kernel == "bucket" ? host::kcore::algorithm_t::bucket
+                                       : host::kcore::algorithm_t::peeling;
+
+  state.add_element_count(G.get_number_of_edges(), "Edges");
+
+  if (num_threads > 0)
+    util::parallel::set_number_of_threads(num_threads);
+
+  // --
+  // Run K-Core Decomposition with NVBench (host timer)
+  state.exec(nvbench::exec_tag::sync | nvbench::exec_tag::timer,
+             [&](nvbench::launch& launch, auto& timer) {
+               timer.start();
+               if (kernel == "reference")
+                 kcore_cpu::run<csr_t, vertex_t, edge_t, weight_t>(
+                     csr, k_cores.data());
+               else
+                 host::kcore::run(G, k_cores.data(),
+                                  (host::kcore::summary_t<vertex_t>*)nullptr,
+                                  param);
+               timer.stop();
+             });
+
+  util::parallel::set_number_of_threads(0);
+}
+
+int main(int argc, char** argv) {
+  parameters_t params(argc, argv);
+  filename = params.filename;
+
+  if (params.help) {
+    // Print NVBench help.
+    const char* args[1] = {"-h"};
+    NVBENCH_MAIN_BODY(1, args);
+  } else {
+    // Remove all gunrock parameters and pass to nvbench.
+    auto args = filtered_argv(argc, argv, "--market", "-m", filename);
+    NVBENCH_BENCH(host_kcore_bench)
+        .add_string_axis("Kernel", {"reference", "bucket", "peeling"})
+        .add_int64_axis("Threads", {1, 2, 4, 8, 16, 0});
+    NVBENCH_MAIN_BODY(args.size(), args.data());
+  }
+}
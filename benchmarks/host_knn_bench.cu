@@ -0,0 +1,182 @@
+#include <nvbench/nvbench.cuh>
+#include <cxxopts.hpp>
+#include <gunrock/algorithms/algorithms.hxx>
+#include <gunrock/algorithms/geo.hxx>
+#include <gunrock/algorithms/host/knn.hxx>
+#include <gunrock/io/labels.hxx>
+
+#include <random>
+
+#include "benchmarks.hxx"
+
+using namespace gunrock;
+using namespace memory;
+
+using vertex_t = int;
+using edge_t = int;
+using weight_t = float;
+
+std::string coordinates_filename;
+
+struct parameters_t {
+  std::string coordinates_filename;
+  bool help = false;
+  cxxopts::Options options;
+
+  /**
+   * @brief Construct a new parameters object and parse command line arguments.
+   *
+   * @param argc Number of command line arguments.
+   * @param argv Command line arguments.
+   */
+  parameters_t(int argc, char** argv)
+      : options(argv[0], "Host k-NN Graph Benchmarking") {
+    options.allow_unrecognised_options();
+    // Add command line options
+    options.add_options()("h,help", "Print help")  // help
+        ("c,coordinates",
+         "Coordinates (labels) file; uniform random points if omitted",
+         cxxopts::value<std::string>());  // labels
+
+    // Parse command line arguments
+    auto result = options.parse(argc, argv);
+
+    if (result.count("help")) {
+      help = true;
+      std::cout << options.help({""});
+      std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+      // Do not exit so we also print NVBench help.
+    } else if (result.count("coordinates") == 1) {
+      coordinates_filename = result["coordinates"].as<std::string>();
+    }
+  }
+};
+
+/**
+ * @brief Spatial index build time, k-NN queries per second (a sample of the
+ * points) and k-NN graph construction into a CSR, for the k-d tree, the grid
+ * and brute force. Uniform random planar points of `2^Scale` points, or the
+ * latitudes/longitudes of a coordinates file under the haversine distance.
+ */
+void host_knn_bench(nvbench::state& state) {
+  namespace spatial = host::spatial;
+  auto index_type = state.get_string("Index");
+  auto phase = state.get_string("Phase");
+  auto k = std::size_t(state.get_int64("K"));
+  auto scale = state.get_int64("Scale");
+  auto num_threads = state.get_int64("Threads");
+
+  if (index_type == "brute_force" && phase != "query") {
+    state.skip("Brute force has no build, and its graph is quadratic.");
+    return;
+  }
+
+  if (num_threads > 0)
+    util::parallel::set_number_of_threads(num_threads);
+
+  format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> csr;
+  auto run = [&](auto const& positions, auto const& metric) {
+    constexpr std::size_t dimensions =
+        std::decay_t<decltype(metric)>::dimensions;
+    auto measure = [&](auto make) {
+      using index_t = decltype(make());
+      if (phase == "build") {
+        state.add_element_count(positions.size(), "Points");
+        state.exec(nvbench::exec_tag::sync | nvbench::exec_tag::timer,
+                   [&](nvbench::launch& launch, auto& timer) {
+                     timer.start();
+                     index_t index = make();
+                     timer.stop();
+                   });
+        return;
+      }
+
+      index_t index = make();
+      if (phase == "query") {
+        // Every `stride`-th point, 1024 queries at most.
+        std::size_t stride = std::max<std::size_t>(1, index.size() / 1024);
+        std::size_t queries = (index.size() + stride - 1) / stride;
+        state.add_element_count(queries, "Queries");
+        state.exec(
+            nvbench::exec_tag::sync | nvbench::exec_tag::timer,
+            [&](nvbench::launch& launch, auto& timer) {
+              timer.start();
+              util::parallel::for_each_chunk(
+                  std::size_t(0), queries,
+                  [&](std::size_t begin, std::size_t end) {
+                    std::vector<spatial::neighbor_t> out;
+                    for (std::size_t q = begin; q < end; ++q)
+                      if (index.valid(q * stride))
+                        index.nearest(index.position(q * stride), k, out,
+                                      std::uint32_t(q * stride));
+                  },
+                  std::size_t(16));
+              timer.stop();
+            });
+      } else {
+        state.add_element_count(index.size(), "Points");
+        state.exec(nvbench::exec_tag::sync | nvbench::exec_tag::timer,
+                   [&](nvbench::launch& launch, auto& timer) {
+                     timer.start();
+                     spatial::knn_graph(index, metric, k, csr);
+                     timer.stop();
+                   });
+      }
+    };
+
+    if (index_type == "kd_tree")
+      measure([&] { return spatial::kd_tree_t<dimensions>(positions); });
+    else if (index_type == "grid")
+      measure([&] { return spatial::grid_t<dimensions>(positions); });
+    else
+      measure([&] { return spatial::brute_force_t<dimensions>(positions); });
+  };
+
+  if (coordinates_filename.empty()) {
+    struct point_t {
+      double x, y;
+    };
+    std::vector<point_t> points(std::size_t(1) << scale);
+    std::mt19937_64 rng(1);
+    std::uniform_real_distribution<double> uniform(0, 1);
+    for (auto& p : points)
+      p = {uniform(rng), uniform(rng)};
+    spatial::euclidean_t metric;
+    run(spatial::positions(points.data(), points.size(), metric), metric);
+  } else {
+    auto coordinates =
+        io::read_labels<geo::coordinates_t>(coordinates_filename);
+    spatial::haversine_t metric;
+    run(spatial::positions(coordinates.data(), coordinates.size(), metric),
+        metric);
+  }
+
+  util::parallel::set_number_of_threads(0);
+}
+
+int main(int argc, char** argv) {
+  parameters_t params(argc, argv);
+  coordinates_filename = params.coordinates_filename;
+
+  if (params.help) {
+    // Print NVBench help.
+    const char* args[1] = {"-h"};
+    NVBENCH_MAIN_BODY(1, args);
+  } else {
+    // Remove all gunrock parameters and pass to nvbench.
+    auto args = filtered_argv(argc, argv, "--coordinates", "-c",
+                              coordinates_filename);
+    // Scale is the number of random points (log2); a coordinates file
+    // replaces them.
+    std::vector<nvbench::int64_t> scales = {16, 20};
+    if (!coordinates_filename.empty())
+      scales = {0};
+    NVBENCH_BENCH(host_knn_bench)
+        .add_string_axis("Index", {"brute_force", "kd_tree", "grid"})
+        .add_string_axis("Phase", {"build", "query", "graph"})
+        .add_int64_axis("K", {8, 16})
+        .add_int64_axis("Scale", scales)
+        .add_int64_axis("Threads", {1, 4, 0});
+    NVBENCH_MAIN_BODY(args.size(), args.data());
+  }
+}
@@ -0,0 +1,150 @@
+#include <nvbench/nvbench.cuh>
+#include <cxxopts.hpp>
+#include <gunrock/algorithms/algorithms.hxx>
+#include <gunrock/algorithms/host/ppr.hxx>
+
+#include "benchmarks.hxx"
+#include "../examples/algorithms/ppr/ppr_cpu.hxx"
+
+using namespace gunrock;
+using namespace memory;
+
+using vertex_t = int;
+using edge_t = int;
+using weight_t = float;
+
+std::string filename;
+
+struct parameters_t {
+  std::string filename;
+  bool help = false;
+  cxxopts::Options options;
+
+  /**
+   * @brief Construct a new parameters object and parse command line arguments.
+   *
+   * @param argc Number of command line arguments.
+   * @param argv Command line arguments.
+   */
+  parameters_t(int argc, char** argv)
+      : options(argv[0], "Host PPR Benchmarking") {
+    options.allow_unrecognised_options();
+    // Add command line options
+    options.add_options()("h,help", "Print help")  // help
+        ("m,market", "Matrix file",
+         cxxopts::value<std::string>());  // mtx
+
+    // Parse command line arguments
+    auto result = options.parse(argc, argv);
+
+    if (result.count("help")) {
+      help = true;
+      std::cout << options.help({""});
+      std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+      // Do not exit so we also print NVBench help.
+    } else {
+      if (result.count("market") == 1) {
+        filename = result["market"].as<std::string>();
+        if (!util::is_market(filename)) {
+          std::cout << options.help({""});
+          std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+          std::exit(0);
+        }
+      } else {
+        std::cout << options.help({""});
+        std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+        std::exit(0);
+      }
+    }
+  }
+};
+
+/**
+ * @brief Seeds per second of the per-seed loop of the ppr example (serial
+ * push, all state reset between seeds), of the pull engine ranking one seed
+ * at a time, and of the pull engine ranking 16 seeds per sweep.
+ */
+void host_ppr_bench(nvbench::state& state) {
+  auto engine = state.get_string("Engine");
+  auto num_seeds = state.get_int64("Seeds");
+  auto num_threads = state.get_int64("Threads");
+
+  if (engine == "ppr_cpu" && num_threads != 1) {
+    state.skip("The ppr example's CPU loop is serial.");
+    return;
+  }
+
+  // --
+  // Build a host graph with out- (CSR) and in-edges (CSC)
+  io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
+  auto [properties, coo] = mm.load(filename);
+
+  format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> csr;
+  csr.from_coo(coo);
+  format::csc_t<memory_space_t::host, vertex_t, edge_t, weight_t> csc;
+  csc.from_csr(csr);
+
+  auto G = graph::build<memory_space_t::host>(properties, csc, csr);
+
+  // --
+  // Params and memory allocation
+  vertex_t n_vertices = G.get_number_of_vertices();
+  vertex_t n_seeds = vertex_t(std::min<std::int64_t>(num_seeds, n_vertices));
+  std::vector<vertex_t> seeds(n_seeds);
+  for (vertex_t s = 0; s < n_seeds; ++s)
+    seeds[s] = s;
+  std::vector<weight_t> p(std::size_t(n_seeds) * n_vertices);
+
+  host::ppr::param_t<weight_t> param;
+  // The example's push loop takes the teleport probability and a residual
+  // threshold.
+  weight_t teleport = 1 - param.alpha;
+  weight_t epsilon = 1e-6;
+
+  if (num_threads > 0)
+    util::parallel::set_number_of_threads(num_threads);
+
+  state.add_element_count(n_seeds, "Seeds");
+
+  // --
+  // Run PPR with NVBench (host timer)
+  state.exec(nvbench::exec_tag::sync | nvbench::exec_tag::timer,
+             [&](nvbench::launch& launch, auto& timer) {
+               std::fill(p.begin(), p.end(), weight_t(0));
+               timer.start();
+               if (engine == "ppr_cpu") {
+                 ppr_cpu::run<decltype(csr), vertex_t, edge_t, weight_t>(
+                     csr, n_seeds, p.data(), teleport, epsilon);
+               } else if (engine == "per_seed") {
+                 for (vertex_t s = 0; s < n_seeds; ++s)
+                   host::ppr::run(G, seeds[s],
+                                  p.data() + std::size_t(s) * n_vertices,
+                                  param);
+               } else {
+                 host::ppr::run_batch(G, seeds.data(), seeds.size(), p.data(),
+                                      param);
+               }
+               timer.stop();
+             });
+
+  util::parallel::set_number_of_threads(0);
+}
+
+int main(int argc, char** argv) {
+  parameters_t params(argc, argv);
+  filename = params.filename;
+
+  if (params.help) {
+    // Print NVBench help.
+    const char* args[1] = {"-h"};
+    NVBENCH_MAIN_BODY(1, args);
+  } else {
+    // Remove all gunrock parameters and pass to nvbench.
+    auto args = filtered_argv(argc, argv, "--market", "-m", filename);
+    NVBENCH_BENCH(host_ppr_bench)
+        .add_string_axis("Engine", {"ppr_cpu", "per_seed", "batched"})
+        .add_int64_axis("Seeds", {16, 256})
+        .add_int64_axis("Threads", {1, 2, 4, 8, 16, 0});
+    NVBENCH_MAIN_BODY(args.size(), args.data());
+  }
+}
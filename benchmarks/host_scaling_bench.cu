@@ -0,0 +1,172 @@
+#include <nvbench/nvbench.cuh>
+#include <cxxopts.hpp>
+#include <gunrock/algorithms/algorithms.hxx>
+#include <gunrock/algorithms/bfs.hxx>
+#include <gunrock/algorithms/sssp.hxx>
+#include <gunrock/algorithms/pr.hxx>
+#include <gunrock/algorithms/tc.hxx>
+#include <gunrock/algorithms/generate/graphs.hxx>
+
+#include "benchmarks.hxx"
+
+using namespace gunrock;
+using namespace memory;
+
+using vertex_t = int;
+using edge_t = int;
+using weight_t = float;
+
+std::string filename;
+int scale = 0;
+
+struct parameters_t {
+  std::string filename;
+  std::string scale;
+  bool help = false;
+  cxxopts::Options options;
+
+  /**
+   * @brief Construct a new parameters object and parse command line arguments.
+   *
+   * @param argc Number of command line arguments.
+   * @param argv Command line arguments.
+   */
+  parameters_t(int argc, char** argv)
+      : options(argv[0], "Host Backend Scaling Benchmarking") {
+    options.allow_unrecognised_options();
+    // Add command line options
+    options.add_options()("h,help", "Print help")  // help
+        ("m,market", "Matrix file",
+         cxxopts::value<std::string>())  // mtx
+        ("s,scale", "Generate an R-MAT graph of this scale instead",
+         cxxopts::value<std::string>());  // R-MAT scale
+
+    // Parse command line arguments
+    auto result = options.parse(argc, argv);
+
+    if (result.count("help")) {
+      help = true;
+      std::cout << options.help({""});
+      std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+      // Do not exit so we also print NVBench help.
+    } else {
+      if (result.count("market") == 1) {
+        filename = result["market"].as<std::string>();
+        if (!util::is_market(filename)) {
+          std::cout << options.help({""});
+          std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+          std::exit(0);
+        }
+      } else if (result.count("scale") == 1) {
+        scale = result["scale"].as<std::string>();
+      } else {
+        std::cout << options.help({""});
+        std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+        std::exit(0);
+      }
+    }
+  }
+};
+
+void host_scaling_bench(nvbench::state& state) {
+  auto algorithm = state.get_string("Algorithm");
+  auto scaling = state.get_string("Scaling");
+  auto num_threads = state.get_int64("Threads");
+
+  if (scaling == "weak" && scale == 0) {
+    state.skip("Weak scaling needs a generated graph (--scale).");
+    return;
+  }
+
+  if (num_threads > 0)
+    util::parallel::set_number_of_threads(num_threads);
+
+  // --
+  // Build a host graph; all operators run on the host thread pool. Generated
+  // graphs also support weak scaling: `Scale + log2(Threads)`.
+  format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> csr;
+  graph::graph_properties_t properties;
+  if (scale > 0) {
+    generate::graphs::rmat_t<vertex_t, weight_t> rmat;
+    rmat.scale = scale;
+    if (scaling == "weak")
+      for (std::size_t t = util::parallel::number_of_threads(); t > 1; t /= 2)
+        ++rmat.scale;
+    rmat.max_weight = 64;
+    properties = generate::graphs::to_csr(rmat, csr);
+  } else {
+    io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
+    auto [mm_properties, coo] = mm.load(filename);
+    properties = mm_properties;
+    csr.from_coo(coo);
+  }
+
+  if (algorithm == "tc" && !properties.symmetric) {
+    util::parallel::set_number_of_threads(0);
+    state.skip("TC requires a symmetric input matrix.");
+    return;
+  }
+
+  auto G = graph::build<memory_space_t::host>(properties, csr);
+
+  // --
+  // Params and memory allocation
+  vertex_t single_source = 0;
+  vertex_t n_vertices = G.get_number_of_vertices();
+  thrust::host_vector<vertex_t> distances(n_vertices);
+  thrust::host_vector<weight_t> weighted_distances(n_vertices);
+  thrust::host_vector<vertex_t> predecessors(n_vertices);
+  thrust::host_vector<weight_t> p(n_vertices);
+  thrust::host_vector<vertex_t> triangles_count(n_vertices, 0);
+  std::size_t total_triangles = 0;
+
+  state.add_element_count(G.get_number_of_edges(), "Edges");
+
+  // --
+  // Run with NVBench (host timer, graph is never touched by the GPU).
+  state.exec(nvbench::exec_tag::sync | nvbench::exec_tag::timer,
+             [&](nvbench::launch& launch, auto& timer) {
+               timer.start();
+               if (algorithm == "bfs") {
+                 gunrock::bfs::run(G, single_source, distances.data(),
+                                   predecessors.data());
+               } else if (algorithm == "sssp") {
+                 gunrock::sssp::run(G, single_source,
+                                    weighted_distances.data(),
+                                    predecessors.data());
+               } else if (algorithm == "pr") {
+                 gunrock::pr::run(G, weight_t(0.85), weight_t(1e-6), 100,
+                                  p.data());
+               } else {
+                 thrust::fill(triangles_count.begin(), triangles_count.end(),
+                              0);
+                 gunrock::tc::run(G, true, triangles_count.data(),
+                                  &total_triangles);
+               }
+               timer.stop();
+             });
+
+  util::parallel::set_number_of_threads(0);
+}
+
+int main(int argc, char** argv) {
+  parameters_t params(argc, argv);
+  filename = params.filename;
+  if (!params.scale.empty())
+    scale = std::stoi(params.scale);
+
+  if (params.help) {
+    // Print NVBench help.
+    const char* args[1] = {"-h"};
+    NVBENCH_MAIN_BODY(1, args);
+  } else {
+    // Remove all gunrock parameters and pass to nvbench.
+    auto args = filtered_argv(argc, argv, "--market", "-m", filename,
+                              "--scale", "-s", params.scale);
+    NVBENCH_BENCH(host_scaling_bench)
+        .add_string_axis("Algorithm", {"bfs", "sssp", "pr", "tc"})
+        .add_string_axis("Scaling", {"strong", "weak"})
+        .add_int64_axis("Threads", {1, 2, 4, 8, 16, 0});
+    NVBENCH_MAIN_BODY(args.size(), args.data());
+  }
+}
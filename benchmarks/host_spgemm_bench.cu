@@ -0,0 +1,162 @@
+#include <nvbench/nvbench.cuh>
+#include <cxxopts.hpp>
+#include <gunrock/algorithms/algorithms.hxx>
+#include <gunrock/algorithms/generate/graphs.hxx>
+#include <gunrock/algorithms/host/spgemm.hxx>
+
+#include "benchmarks.hxx"
+
+using namespace gunrock;
+using namespace memory;
+
+using vertex_t = int;
+using edge_t = int;
+using weight_t = float;
+
+using csr_t = format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t>;
+
+std::string filename_a;
+std::string filename_b;
+int scale = 16;
+
+struct parameters_t {
+  std::string filename_a;
+  std::string filename_b;
+  std::string scale;
+  bool help = false;
+  cxxopts::Options options;
+
+  /**
+   * @brief Construct a new parameters object and parse command line arguments.
+   *
+   * @param argc Number of command line arguments.
+   * @param argv Command line arguments.
+   */
+  parameters_t(int argc, char** argv)
+      : options(argv[0], "Host SPGEMM Benchmarking") {
+    options.allow_unrecognised_options();
+    // Add command line options
+    options.add_options()("h,help", "Print help")  // help
+        ("a,amatrix", "Matrix A file (R-MAT graph if omitted)",
+         cxxopts::value<std::string>())  // mtx A
+        ("b,bmatrix", "Matrix B file (A if omitted)",
+         cxxopts::value<std::string>())  // mtx B
+        ("s,scale", "Scale of the R-MAT graph squared without --amatrix "
+         "(default 16)",
+         cxxopts::value<std::string>());  // R-MAT scale
+
+    // Parse command line arguments
+    auto result = options.parse(argc, argv);
+
+    if (result.count("help")) {
+      help = true;
+      std::cout << options.help({""});
+      std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+      // Do not exit so we also print NVBench help.
+    } else {
+      if (result.count("amatrix") == 1) {
+        filename_a = result["amatrix"].as<std::string>();
+        filename_b = filename_a;
+      }
+      if (result.count("bmatrix") == 1)
+        filename_b = result["bmatrix"].as<std::string>();
+      if (result.count("scale") == 1)
+        scale = result["scale"].as<std::string>();
+      if ((!filename_a.empty() && !util::is_market(filename_a)) ||
+          (!filename_b.empty() && !util::is_market(filename_b))) {
+        std::cout << options.help({""});
+        std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+        std::exit(0);
+      }
+    }
+  }
+};
+
+/**
+ * @brief Reports the product's rate (2 flops per multiply-add) and its peak
+ * memory: both operands, the engine's temporaries and C.
+ */
+void host_spgemm_bench(nvbench::state& state) {
+  auto accumulator = state.get_string("Accumulator");
+  auto output = state.get_string("Output");
+  auto num_threads = state.get_int64("Threads");
+
+  // --
+  // Build the operands
+
+  csr_t A, B, C;
+  if (filename_a.empty()) {
+    generate::graphs::rmat_t<vertex_t, weight_t> rmat;
+    rmat.scale = scale;
+    rmat.edge_factor = 8;
+    generate::graphs::to_csr(rmat, A);
+    B = A;
+  } else {
+    io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
+    A.from_coo(std::get<1>(mm.load(filename_a)));
+    B.from_coo(std::get<1>(mm.load(filename_b)));
+  }
+
+  host::spgemm::param_t param;
+  param.accumulator = (accumulator == "hash")
+                          ? host::spgemm::accumulator_t::hash
+                          : (accumulator == "dense")
+                                ? host::spgemm::accumulator_t::dense
+                                : host::spgemm::accumulator_t::automatic;
+  param.sorted = output == "sorted";
+
+  if (num_threads > 0)
+    util::parallel::set_number_of_threads(num_threads);
+
+  host::spgemm::summary_t summary;
+  host::spgemm::run(A, B, C, &summary, param);
+  state.add_element_count(2 * summary.flops, "FLOP");
+
+  std::size_t operands = 0;
+  for (auto const* M : {&A, &B})
+    operands += M->row_offsets.size() * sizeof(edge_t) +
+                M->column_indices.size() * sizeof(vertex_t) +
+                M->nonzero_values.size() * sizeof(weight_t);
+  auto& peak = state.add_summary("gunrock/host_spgemm/peak_memory");
+  peak.set_string("name", "Peak Mem");
+  peak.set_string("hint", "bytes");
+  peak.set_string("description",
+                  "Operands, engine temporaries and result, in bytes");
+  peak.set_int64("value", operands + summary.workspace_bytes +
+                              summary.output_bytes);
+
+  // --
+  // Run SPGEMM with NVBench (host timer)
+  state.exec(nvbench::exec_tag::sync | nvbench::exec_tag::timer,
+             [&](nvbench::launch& launch, auto& timer) {
+               timer.start();
+               host::spgemm::run(A, B, C, nullptr, param);
+               timer.stop();
+             });
+
+  util::parallel::set_number_of_threads(0);
+}
+
+int main(int argc, char** argv) {
+  parameters_t params(argc, argv);
+  filename_a = params.filename_a;
+  filename_b = params.filename_b;
+  if (!params.scale.empty())
+    scale = std::stoi(params.scale);
+
+  if (params.help) {
+    // Print NVBench help.
+    const char* args[1] = {"-h"};
+    NVBENCH_MAIN_BODY(1, args);
+  } else {
+    // Remove all gunrock parameters and pass to nvbench.
+    auto args = filtered_argv(argc, argv, "--amatrix", "-a", "--bmatrix", "-b",
+                              "--scale", "-s", filename_a, filename_b,
+                              params.scale);
+    NVBENCH_BENCH(host_spgemm_bench)
+        .add_string_axis("Accumulator", {"automatic", "hash", "dense"})
+        .add_string_axis("Output", {"sorted", "unsorted"})
+        .add_int64_axis("Threads", {1, 2, 4, 8, 16, 0});
+    NVBENCH_MAIN_BODY(args.size(), args.data());
+  }
+}
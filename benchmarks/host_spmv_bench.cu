@@ -0,0 +1,173 @@
+#include <nvbench/nvbench.cuh>
+#include <cxxopts.hpp>
+#include <gunrock/algorithms/algorithms.hxx>
+#include <gunrock/algorithms/host/spmv.hxx>
+#include <gunrock/io/smtx.hxx>
+
+#include "benchmarks.hxx"
+
+using namespace gunrock;
+using namespace memory;
+
+using vertex_t = int;
+using edge_t = int;
+using weight_t = float;
+
+using csr_t = format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t>;
+
+std::string filename;
+
+static bool is_smtx(std::string const& filename) {
+  return filename.size() >= 5 &&
+         filename.substr(filename.size() - 5) == ".smtx";
+}
+
+struct parameters_t {
+  std::string filename;
+  bool help = false;
+  cxxopts::Options options;
+
+  /**
+   * @brief Construct a new parameters object and parse command line arguments.
+   *
+   * @param argc Number of command line arguments.
+   * @param argv Command line arguments.
+   */
+  parameters_t(int argc, char** argv)
+      : options(argv[0], "Host SPMV Benchmarking") {
+    options.allow_unrecognised_options();
+    // Add command line options
+    options.add_options()("h,help", "Print help")  // help
+        ("m,market", "Matrix file (.mtx or .smtx)",
+         cxxopts::value<std::string>());  // mtx or smtx
+
+    // Parse command line arguments
+    auto result = options.parse(argc, argv);
+
+    if (result.count("help")) {
+      help = true;
+      std::cout << options.help({""});
+      std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+      // Do not exit so we also print NVBench help.
+    } else {
+      if (result.count("market") == 1) {
+        filename = result["market"].as<std::string>();
+        if (!util::is_market(filename) && !is_smtx(filename)) {
+          std::cout << options.help({""});
+          std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+          std::exit(0);
+        }
+      } else {
+        std::cout << options.help({""});
+        std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+        std::exit(0);
+      }
+    }
+  }
+};
+
+/**
+ * @brief The current layout (serial CSR loop of the spmv example, and the
+ * row-parallel CSR kernel) against merge-path and SELL-C-sigma, for one
+ * vector and for batches of right-hand sides. The layout is built once,
+ * outside of the timed region; its build time and padding are reported.
+ */
+void host_spmv_bench(nvbench::state& state) {
+  auto kernel = state.get_string("Kernel");
+  auto num_vectors = std::size_t(state.get_int64("Vectors"));
+  auto num_threads = state.get_int64("Threads");
+
+  if (kernel == "reference" && (num_threads != 1 || num_vectors != 1)) {
+    state.skip("The reference (the spmv example's CPU loop) is serial SpMV.");
+    return;
+  }
+
+  // --
+  // Load the matrix
+
+  csr_t csr;
+  if (is_smtx(filename)) {
+    io::smtx_t<vertex_t, edge_t, weight_t> smtx;
+    csr = smtx.load(filename);
+  } else {
+    io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
+    csr.from_coo(std::get<1>(mm.load(filename)));
+  }
+
+  thrust::host_vector<weight_t> x(std::size_t(csr.number_of_columns) *
+                                  num_vectors);
+  thrust::host_vector<weight_t> y(std::size_t(csr.number_of_rows) *
+                                  num_vectors);
+  for (std::size_t i = 0; i < x.size(); ++i)
+    x[i] = weight_t(i % 17) / 16;
+
+  if (num_threads > 0)
+    util::parallel::set_number_of_threads(num_threads);
+
+  host::spmv::param_t param;
+  if (kernel == "csr")
+    param.kernel = host::spmv::kernel_t::csr;
+  else if (kernel == "merge_path")
+    param.kernel = host::spmv::kernel_t::merge_path;
+  else if (kernel == "sell")
+    param.kernel = host::spmv::kernel_t::sell;
+  host::spmv::matrix_t<vertex_t, edge_t, weight_t> A(csr, param);
+
+  auto const& summary = A.get_summary();
+  state.add_element_count(summary.nonzeros * num_vectors, "NNZ");
+  state.add_global_memory_reads<nvbench::int8_t>(
+      summary.nonzeros * (sizeof(vertex_t) + sizeof(weight_t)),
+      "Matrix Size");
+  if (kernel != "reference") {
+    auto& preprocessing = state.add_summary("gunrock/host_spmv/preprocessing");
+    preprocessing.set_string("name", "Prep (ms)");
+    preprocessing.set_string("description", "Layout build time");
+    preprocessing.set_float64("value", summary.preprocessing_time);
+    auto& padding = state.add_summary("gunrock/host_spmv/padding");
+    padding.set_string("name", "Padding");
+    padding.set_string("description", "SELL padding over the nonzeros");
+    padding.set_float64("value", summary.padding_ratio);
+  }
+
+  // --
+  // Run SPMV with NVBench (host timer)
+  state.exec(nvbench::exec_tag::sync | nvbench::exec_tag::timer,
+             [&](nvbench::launch& launch, auto& timer) {
+               timer.start();
+               if (kernel == "reference") {
+                 for (vertex_t row = 0; row < csr.number_of_rows; ++row) {
+                   weight_t sum = 0;
+                   for (edge_t nz = csr.row_offsets[row];
+                        nz < csr.row_offsets[row + 1]; ++nz)
+                     sum += csr.nonzero_values[nz] *
+                            x[csr.column_indices[nz]];
+                   y[row] = sum;
+                 }
+               } else {
+                 A.multiply(x.data(), y.data(), num_vectors);
+               }
+               timer.stop();
+             });
+
+  util::parallel::set_number_of_threads(0);
+}
+
+int main(int argc, char** argv) {
+  parameters_t params(argc, argv);
+  filename = params.filename;
+
+  if (params.help) {
+    // Print NVBench help.
+    const char* args[1] = {"-h"};
+    NVBENCH_MAIN_BODY(1, args);
+  } else {
+    // Remove all gunrock parameters and pass to nvbench.
+    auto args = filtered_argv(argc, argv, "--market", "-m", filename);
+    NVBENCH_BENCH(host_spmv_bench)
+        .add_string_axis("Kernel", {"reference", "csr", "merge_path", "sell",
+                                    "automatic"})
+        .add_int64_axis("Vectors", {1, 8})
+        .add_int64_axis("Threads", {1, 2, 4, 8, 16, 0});
+    NVBENCH_MAIN_BODY(args.size(), args.data());
+  }
+}
@@ -0,0 +1,124 @@
+#include <nvbench/nvbench.cuh>
+#include <cxxopts.hpp>
+#include <gunrock/algorithms/algorithms.hxx>
+#include <gunrock/algorithms/host/sssp.hxx>
+
+#include "benchmarks.hxx"
+
+using namespace gunrock;
+using namespace memory;
+
+using vertex_t = int;
+using edge_t = int;
+using weight_t = float;
+
+std::string filename;
+
+struct parameters_t {
+  std::string filename;
+  bool help = false;
+  cxxopts::Options options;
+
+  /**
+   * @brief Construct a new parameters object and parse command line arguments.
+   *
+   * @param argc Number of command line arguments.
+   * @param argv Command line arguments.
+   */
+  parameters_t(int argc, char** argv)
+      : options(argv[0], "Host SSSP Benchmarking") {
+    options.allow_unrecognised_options();
+    // Add command line options
+    options.add_options()("h,help", "Print help")  // help
+        ("m,market", "Matrix file",
+         cxxopts::value<std::string>());  // mtx
+
+    // Parse command line arguments
+    auto result = options.parse(argc, argv);
+
+    if (result.count("help")) {
+      help = true;
+      std::cout << options.help({""});
+      std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+      // Do not exit so we also print NVBench help.
+    } else {
+      if (result.count("market") == 1) {
+        filename = result["market"].as<std::string>();
+        if (!util::is_market(filename)) {
+          std::cout << options.help({""});
+          std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+          std::exit(0);
+        }
+      } else {
+        std::cout << options.help({""});
+        std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+        std::exit(0);
+      }
+    }
+  }
+};
+
+void host_sssp_bench(nvbench::state& state) {
+  auto delta_scale = state.get_float64("DeltaScale");
+  auto num_threads = state.get_int64("Threads");
+
+  // --
+  // Build a host graph
+  io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
+  auto [properties, coo] = mm.load(filename);
+
+  format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> csr;
+  csr.from_coo(coo);
+
+  auto G = graph::build<memory_space_t::host>(properties, csr);
+
+  // --
+  // Params and memory allocation
+  vertex_t single_source = 0;
+  vertex_t n_vertices = G.get_number_of_vertices();
+  std::vector<weight_t> distances(n_vertices);
+  std::vector<vertex_t> predecessors(n_vertices);
+
+  // Bucket width relative to the auto-tuned one; road graphs (long paths,
+  // many buckets) and scale-free graphs (few, crowded buckets) react very
+  // differently to it.
+  host::sssp::param_t<weight_t> param;
+  param.delta = host::sssp::default_delta(n_vertices, G.get_row_offsets(),
+                                          G.get_nonzero_values()) *
+                weight_t(delta_scale);
+
+  state.add_element_count(G.get_number_of_edges(), "Edges");
+
+  if (num_threads > 0)
+    util::parallel::set_number_of_threads(num_threads);
+
+  // --
+  // Run SSSP with NVBench (host timer)
+  state.exec(nvbench::exec_tag::sync | nvbench::exec_tag::timer,
+             [&](nvbench::launch& launch, auto& timer) {
+               timer.start();
+               host::sssp::run(G, single_source, distances.data(),
+                               predecessors.data(), param);
+               timer.stop();
+             });
+
+  util::parallel::set_number_of_threads(0);
+}
+
+int main(int argc, char** argv) {
+  parameters_t params(argc, argv);
+  filename = params.filename;
+
+  if (params.help) {
+    // Print NVBench help.
+    const char* args[1] = {"-h"};
+    NVBENCH_MAIN_BODY(1, args);
+  } else {
+    // Remove all gunrock parameters and pass to nvbench.
+    auto args = filtered_argv(argc, argv, "--market", "-m", filename);
+    NVBENCH_BENCH(host_sssp_bench)
+        .add_float64_axis("DeltaScale", {0.25, 1, 4})
+        .add_int64_axis("Threads", {1, 2, 4, 8, 16, 0});
+    NVBENCH_MAIN_BODY(args.size(), args.data());
+  }
+}
@@ -0,0 +1,137 @@
+#include <nvbench/nvbench.cuh>
+#include <cxxopts.hpp>
+#include <gunrock/algorithms/algorithms.hxx>
+#include <gunrock/algorithms/host/tc.hxx>
+
+#include "benchmarks.hxx"
+#include "../examples/algorithms/tc/tc_cpu.hxx"
+
+using namespace gunrock;
+using namespace memory;
+
+using vertex_t = uint32_t;
+using edge_t = uint32_t;
+using weight_t = float;
+
+std::string filename;
+
+struct parameters_t {
+  std::string filename;
+  bool help = false;
+  cxxopts::Options options;
+
+  /**
+   * @brief Construct a new parameters object and parse command line arguments.
+   *
+   * @param argc Number of command line arguments.
+   * @param argv Command line arguments.
+   */
+  parameters_t(int argc, char** argv)
+      : options(argv[0], "Host TC Benchmarking") {
+    options.allow_unrecognised_options();
+    // Add command line options
+    options.add_options()("h,help", "Print help")  // help
+        ("m,market", "Matrix file",
+         cxxopts::value<std::string>());  // mtx
+
+    // Parse command line arguments
+    auto result = options.parse(argc, argv);
+
+    if (result.count("help")) {
+      help = true;
+      std::cout << options.help({""});
+      std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+      // Do not exit so we also print NVBench help.
+    } else {
+      if (result.count("market") == 1) {
+        filename = result["market"].as<std::string>();
+        if (!util::is_market(filename)) {
+          std::cout << options.help({""});
+          std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+          std::exit(0);
+        }
+      } else {
+        std::cout << options.help({""});
+        std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+        std::exit(0);
+      }
+    }
+  }
+};
+
+void host_tc_bench(nvbench::state& state) {
+  auto kernel = state.get_string("Kernel");
+  auto num_threads = state.get_int64("Threads");
+
+  if (kernel == "reference" && num_threads != 1) {
+    state.skip("The reference (tc example's CPU validation) is serial.");
+    return;
+  }
+
+  // --
+  // Build a host graph
+
+  io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
+  auto [properties, coo] = mm.load(filename);
+
+  if (!properties.symmetric) {
+    state.skip("Requires a symmetric matrix.");
+    return;
+  }
+
+  format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> csr;
+  csr.from_coo(coo);
+
+  auto G = graph::build<memory_space_t::host>(properties, csr);
+
+  // --
+  // Params and memory allocation
+
+  vertex_t n_vertices = G.get_number_of_vertices();
+  std::vector<vertex_t> triangles_count(n_vertices);
+  std::size_t total_triangles = 0;
+  host::tc::param_t param;
+  param.simd = kernel == "simd";
+
+  state.add_element_count(G.get_number_of_edges(), "Edges");
+
+  if (num_threads > 0)
+    util::parallel::set_number_of_threads(num_threads);
+
+  // --
+  // Run TC with NVBench (host timer)
+  state.exec(nvbench::exec_tag::sync | nvbench::exec_tag::timer,
+             [&](nvbench::launch& launch, auto& timer) {
+               if (kernel == "reference") {
+                 std::fill(triangles_count.begin(), triangles_count.end(), 0);
+                 total_triangles = 0;
+                 timer.start();
+                 tc_cpu::run(csr, triangles_count, total_triangles);
+               } else {
+                 timer.start();
+                 host::tc::run(G, triangles_count.data(), &total_triangles,
+                               param);
+               }
+               timer.stop();
+             });
+
+  util::parallel::set_number_of_threads(0);
+}
+
+int main(int argc, char** argv) {
+  parameters_t params(argc, argv);
+  filename = params.filename;
+
+  if (params.help) {
+    // Print NVBench help.
+    const char* args[1] = {"-h"};
+    NVBENCH_MAIN_BODY(1, args);
+  } else {
+    // Remove all gunrock parameters and pass to nvbench.
+    auto args = filtered_argv(argc, argv, "--market", "-m", filename);
+    NVBENCH_BENCH(host_tc_bench)
+        .add_string_axis("Kernel", {"reference", "scalar", "simd"})
+        .add_int64_axis("Threads", {1, 2, 4, 8, 16, 0});
+    NVBENCH_MAIN_BODY(args.size(), args.data());
+  }
+}
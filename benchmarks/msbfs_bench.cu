@@ -0,0 +1,159 @@
+#include <nvbench/nvbench.cuh>
+#include <random>
+#include <cxxopts.hpp>
+#include <gunrock/algorithms/algorithms.hxx>
+#include <gunrock/algorithms/host/bc.hxx>
+#include <gunrock/algorithms/host/bfs.hxx>
+#include <gunrock/algorithms/host/msbfs.hxx>
+
+#include "benchmarks.hxx"
+
+using namespace gunrock;
+using namespace memory;
+
+using vertex_t = int;
+using edge_t = int;
+using weight_t = float;
+
+std::string filename;
+
+struct parameters_t {
+  std::string filename;
+  bool help = false;
+  cxxopts::Options options;
+
+  /**
+   * @brief Construct a new parameters object and parse command line arguments.
+   *
+   * @param argc Number of command line arguments.
+   * @param argv Command line arguments.
+   */
+  parameters_t(int argc, char** argv)
+      : options(argv[0], "Multi-Source BFS Benchmarking") {
+    options.allow_unrecognised_options();
+    // Add command line options
+    options.add_options()("h,help", "Print help")  // help
+        ("m,market", "Matrix file",
+         cxxopts::value<std::string>());  // mtx
+
+    // Parse command line arguments
+    auto result = options.parse(argc, argv);
+
+    if (result.count("help")) {
+      help = true;
+      std::cout << options.help({""});
+      std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+      // Do not exit so we also print NVBench help.
+    } else {
+      if (result.count("market") == 1) {
+        filename = result["market"].as<std::string>();
+        if (!util::is_market(filename)) {
+          std::cout << options.help({""});
+          std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+          std::exit(0);
+        }
+      } else {
+        std::cout << options.help({""});
+        std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+        std::exit(0);
+      }
+    }
+  }
+};
+
+void msbfs_bench(nvbench::state& state) {
+  auto kernel = state.get_string("Kernel");
+  auto mode = state.get_string("Mode");
+  auto num_sources = state.get_int64("Sources");
+  auto num_threads = state.get_int64("Threads");
+
+  if (kernel == "bc" && mode == "batched_vertex_major") {
+    state.skip("Batched BC always keeps its results in rows per vertex.");
+    return;
+  }
+
+  // --
+  // Build a host graph
+
+  io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
+  auto [properties, coo] = mm.load(filename);
+
+  if (!properties.symmetric) {
+    state.skip("Requires a symmetric matrix (in-edges for bottom-up steps).");
+    return;
+  }
+
+  format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> csr;
+  csr.from_coo(coo);
+
+  auto G = graph::build<memory_space_t::host>(properties, csr);
+
+  // --
+  // Params and memory allocation
+
+  vertex_t n_vertices = G.get_number_of_vertices();
+  std::vector<vertex_t> sources(num_sources);
+  std::mt19937 engine(0);
+  std::uniform_int_distribution<vertex_t> pick(0, n_vertices - 1);
+  for (auto& source : sources)
+    source = pick(engine);
+
+  // Aggregate throughput: edges of the graph times the number of sources.
+  state.add_element_count(std::size_t(G.get_number_of_edges()) * num_sources,
+                          "Edges");
+
+  std::vector<vertex_t> distances;
+  std::vector<weight_t> bc_values(n_vertices);
+  host::msbfs::param_t param;
+  param.source_major = mode != "batched_vertex_major";
+  host::bc::param_t bc_param;
+  bc_param.batch_size = mode == "one_by_one" ? 1 : num_sources;
+
+  if (kernel == "bfs")
+    distances.resize((mode == "one_by_one" ? 1 : num_sources) * n_vertices);
+
+  if (num_threads > 0)
+    util::parallel::set_number_of_threads(num_threads);
+
+  // --
+  // Run the sources one by one or batched with NVBench (host timer)
+  state.exec(
+      nvbench::exec_tag::sync | nvbench::exec_tag::timer,
+      [&](nvbench::launch& launch, auto& timer) {
+        timer.start();
+        if (kernel == "bc") {
+          host::bc::run(G, sources.data(), sources.size(), bc_values.data(),
+                        bc_param);
+        } else if (mode == "one_by_one") {
+          for (auto source : sources)
+            host::bfs::run(G, source, distances.data(), (vertex_t*)nullptr);
+        } else {
+          host::msbfs::run(G, sources.data(), sources.size(),
+                           distances.data(), (double*)nullptr, param);
+        }
+        timer.stop();
+      });
+
+  util::parallel::set_number_of_threads(0);
+}
+
+int main(int argc, char** argv) {
+  parameters_t params(argc, argv);
+  filename = params.filename;
+
+  if (params.help) {
+    // Print NVBench help.
+    const char* args[1] = {"-h"};
+    NVBENCH_MAIN_BODY(1, args);
+  } else {
+    // Remove all gunrock parameters and pass to nvbench.
+    auto args = filtered_argv(argc, argv, "--market", "-m", filename);
+    NVBENCH_BENCH(msbfs_bench)
+        .add_string_axis("Kernel", {"bfs", "bc"})
+        .add_string_axis("Mode",
+                         {"one_by_one", "batched", "batched_vertex_major"})
+        .add_int64_axis("Sources", {64, 128, 256, 512})
+        .add_int64_axis("Threads", {1, 2, 4, 8, 16, 0});
+    NVBENCH_MAIN_BODY(args.size(), args.data());
+  }
+}
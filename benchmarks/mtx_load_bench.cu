@@ -0,0 +1,111 @@
+#include <nvbench/nvbench.cuh>
+#include <cxxopts.hpp>
+#include <filesystem>
+#include <gunrock/algorithms/algorithms.hxx>
+
+#include "benchmarks.hxx"
+
+using namespace gunrock;
+using namespace memory;
+
+using vertex_t = int;
+using edge_t = int;
+using weight_t = float;
+
+std::string filename;
+
+struct parameters_t {
+  std::string filename;
+  bool help = false;
+  cxxopts::Options options;
+
+  /**
+   * @brief Construct a new parameters object and parse command line arguments.
+   *
+   * @param argc Number of command line arguments.
+   * @param argv Command line arguments.
+   */
+  parameters_t(int argc, char** argv)
+      : options(argv[0], "Matrix Market Loader Benchmarking") {
+    options.allow_unrecognised_options();
+    // Add command line options
+    options.add_options()("h,help", "Print help")  // help
+        ("m,market", "Matrix file",
+         cxxopts::value<std::string>());  // mtx
+
+    // Parse command line arguments
+    auto result = options.parse(argc, argv);
+
+    if (result.count("help")) {
+      help = true;
+      std::cout << options.help({""});
+      std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+      // Do not exit so we also print NVBench help.
+    } else {
+      if (result.count("market") == 1) {
+        filename = result["market"].as<std::string>();
+        if (!util::is_market(filename)) {
+          std::cout << options.help({""});
+          std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+          std::exit(0);
+        }
+      } else {
+        std::cout << options.help({""});
+        std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+        std::exit(0);
+      }
+    }
+  }
+};
+
+void mtx_load_bench(nvbench::state& state) {
+  auto loader = state.get_string("Loader");
+  auto num_threads = state.get_int64("Threads");
+
+  io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
+
+  // --
+  // Throughput in MB/s (file bytes) and edges/s (entries in the returned COO).
+  auto [properties, coo] = mm.load(filename);
+  state.add_element_count(coo.number_of_nonzeros, "Edges");
+  state.add_global_memory_reads<nvbench::int8_t>(
+      std::filesystem::file_size(filename), "File");
+
+  if (loader == "serial" && num_threads != 1) {
+    state.skip("The fscanf loader is single-threaded.");
+    return;
+  }
+
+  if (num_threads > 0)
+    util::parallel::set_number_of_threads(num_threads);
+
+  state.exec(nvbench::exec_tag::sync | nvbench::exec_tag::timer,
+             [&](nvbench::launch& launch, auto& timer) {
+               timer.start();
+               if (loader == "serial")
+                 mm.load_serial(filename);
+               else
+                 mm.load(filename);
+               timer.stop();
+             });
+
+  util::parallel::set_number_of_threads(0);
+}
+
+int main(int argc, char** argv) {
+  parameters_t params(argc, argv);
+  filename = params.filename;
+
+  if (params.help) {
+    // Print NVBench help.
+    const char* args[1] = {"-h"};
+    NVBENCH_MAIN_BODY(1, args);
+  } else {
+    // Remove all gunrock parameters and pass to nvbench.
+    auto args = filtered_argv(argc, argv, "--market", "-m", filename);
+    NVBENCH_BENCH(mtx_load_bench)
+        .add_string_axis("Loader", {"mmap", "serial"})
+        .add_int64_axis("Threads", {1, 2, 4, 8, 16, 0});
+    NVBENCH_MAIN_BODY(args.size(), args.data());
+  }
+}
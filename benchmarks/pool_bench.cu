@@ -0,0 +1,140 @@
+#include <nvbench/nvbench.cuh>
+#include <cxxopts.hpp>
+#include <gunrock/algorithms/algorithms.hxx>
+#include <gunrock/algorithms/bfs.hxx>
+#include <gunrock/algorithms/sssp.hxx>
+
+#include "benchmarks.hxx"
+
+using namespace gunrock;
+using namespace memory;
+
+using vertex_t = int;
+using edge_t = int;
+using weight_t = float;
+
+std::string filename;
+
+struct parameters_t {
+  std::string filename;
+  bool help = false;
+  cxxopts::Options options;
+
+  /**
+   * @brief Construct a new parameters object and parse command line arguments.
+   *
+   * @param argc Number of command line arguments.
+   * @param argv Command line arguments.
+   */
+  parameters_t(int argc, char** argv) : options(argv[0], "Pool Benchmarking") {
+    options.allow_unrecognised_options();
+    // Add command line options
+    options.add_options()("h,help", "Print help")  // help
+        ("m,market", "Matrix file",
+         cxxopts::value<std::string>());  // mtx
+
+    // Parse command line arguments
+    auto result = options.parse(argc, argv);
+
+    if (result.count("help")) {
+      help = true;
+      std::cout << options.help({""});
+      std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+      // Do not exit so we also print NVBench help.
+    } else {
+      if (result.count("market") == 1) {
+        filename = result["market"].as<std::string>();
+        if (!util::is_market(filename)) {
+          std::cout << options.help({""});
+          std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+          std::exit(0);
+        }
+      } else {
+        std::cout << options.help({""});
+        std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+        std::exit(0);
+      }
+    }
+  }
+};
+
+
+/**
+ * @brief Per-query latency of repeated BFS and SSSP runs, whose frontiers and
+ * per-run buffers are allocated anew by every query, with the device memory
+ * pool caching freed blocks ("on") or handing them back to the driver
+ * ("off"). The pool's hits, misses and high-water mark over the runs are
+ * reported with the timings.
+ */
+void pool_bench(nvbench::state& state) {
+  auto algorithm = state.get_string("Algorithm");
+  bool pooled = state.get_string("Pool") == "on";
+
+  // --
+  // IO
+  io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
+  auto [properties, coo] = mm.load(filename);
+
+  format::csr_t<memory_space_t::device, vertex_t, edge_t, weight_t> csr;
+  csr.from_coo(coo);
+
+  // --
+  // Build graph
+
+  auto G = graph::build<memory_space_t::device>(properties, csr);
+
+  // --
+  // Params and memory allocation
+  vertex_t n_vertices = G.get_number_of_vertices();
+  thrust::device_vector<vertex_t> distances(n_vertices);
+  thrust::device_vector<weight_t> weighted_distances(n_vertices);
+  thrust::device_vector<vertex_t> predecessors(n_vertices);
+
+  auto& pool = memory::pool<memory_space_t::device>();
+  pool.set_enabled(pooled);
+  pool.reset_stats();
+
+  // --
+  // Run one query per launch, cycling through the sources
+  vertex_t query = 0;
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    vertex_t source = vertex_t((std::int64_t(query++) * 7919) % n_vertices);
+    if (algorithm == "bfs")
+      gunrock::bfs::run(G, source, distances.data().get(),
+                        predecessors.data().get());
+    else
+      gunrock::sssp::run(G, source, weighted_distances.data().get(),
+                         predecessors.data().get());
+  });
+
+  auto stats = pool.stats();
+  auto& hits = state.add_summary("nv/gunrock/pool/hits");
+  hits.set_string("name", "Hits");
+  hits.set_int64("value", stats.hits);
+  auto& misses = state.add_summary("nv/gunrock/pool/misses");
+  misses.set_string("name", "Misses");
+  misses.set_int64("value", stats.misses);
+  auto& high_water = state.add_summary("nv/gunrock/pool/high_water");
+  high_water.set_string("name", "High Water (B)");
+  high_water.set_int64("value", stats.high_water_bytes);
+
+  pool.set_enabled(true);
+}
+
+int main(int argc, char** argv) {
+  parameters_t params(argc, argv);
+  filename = params.filename;
+
+  if (params.help) {
+    // Print NVBench help.
+    const char* args[1] = {"-h"};
+    NVBENCH_MAIN_BODY(1, args);
+  } else {
+    // Remove all gunrock parameters and pass to nvbench.
+    auto args = filtered_argv(argc, argv, "--market", "-m", filename);
+    NVBENCH_BENCH(pool_bench)
+        .add_string_axis("Algorithm", {"bfs", "sssp"})
+        .add_string_axis("Pool", {"off", "on"});
+    NVBENCH_MAIN_BODY(args.size(), args.data());
+  }
+}
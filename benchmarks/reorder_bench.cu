@@ -0,0 +1,160 @@
+#include <nvbench/nvbench.cuh>
+#include <cxxopts.hpp>
+#include <gunrock/algorithms/algorithms.hxx>
+#include <gunrock/algorithms/host/bfs.hxx>
+#include <gunrock/algorithms/pr.hxx>
+#include <gunrock/algorithms/tc.hxx>
+#include <gunrock/graph/reorder.hxx>
+
+#include "benchmarks.hxx"
+
+using namespace gunrock;
+using namespace memory;
+
+using vertex_t = int;
+using edge_t = int;
+using weight_t = float;
+
+std::string filename;
+
+struct parameters_t {
+  std::string filename;
+  bool help = false;
+  cxxopts::Options options;
+
+  /**
+   * @brief Construct a new parameters object and parse command line arguments.
+   *
+   * @param argc Number of command line arguments.
+   * @param argv Command line arguments.
+   */
+  parameters_t(int argc, char** argv)
+      : options(argv[0], "Vertex Reordering Benchmarking") {
+    options.allow_unrecognised_options();
+    // Add command line options
+    options.add_options()("h,help", "Print help")  // help
+        ("m,market", "Matrix file",
+         cxxopts::value<std::string>());  // mtx
+
+    // Parse command line arguments
+    auto result = options.parse(argc, argv);
+
+    if (result.count("help")) {
+      help = true;
+      std::cout << options.help({""});
+      std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+      // Do not exit so we also print NVBench help.
+    } else {
+      if (result.count("market") == 1) {
+        filename = result["market"].as<std::string>();
+        if (!util::is_market(filename)) {
+          std::cout << options.help({""});
+          std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+          std::exit(0);
+        }
+      } else {
+        std::cout << options.help({""});
+        std::cout << "  [optional nvbench args]" << std::endl << std::endl;
+        std::exit(0);
+      }
+    }
+  }
+};
+
+void reorder_bench(nvbench::state& state) {
+  auto ordering = graph::reorder::from_string(state.get_string("Ordering"));
+  auto kernel = state.get_string("Kernel");
+
+  io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
+  auto [properties, coo] = mm.load(filename);
+
+  if (kernel == "tc" && !properties.symmetric) {
+    state.skip("TC requires a symmetric input matrix.");
+    return;
+  }
+
+  using csr_t = format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t>;
+  csr_t csr;
+  csr.from_coo(coo);
+  state.add_element_count(csr.number_of_nonzeros, "Edges");
+
+  // --
+  // Reorder cost: computing the permutation and renaming the CSR.
+  if (kernel == "reorder") {
+    state.exec(nvbench::exec_tag::sync | nvbench::exec_tag::timer,
+               [&](nvbench::launch& launch, auto& timer) {
+                 csr_t reordered(csr);
+                 timer.start();
+                 auto permutation = graph::reorder::compute(
+                     ordering, reordered, properties.symmetric);
+                 graph::reorder::apply(permutation, reordered);
+                 timer.stop();
+               });
+    return;
+  }
+
+  // --
+  // CPU reference kernels on the reordered graph (compare against `none`).
+  auto permutation =
+      graph::reorder::compute(ordering, csr, properties.symmetric);
+  auto G = graph::build<memory_space_t::host>(properties, csr, permutation);
+
+  vertex_t n_vertices = G.get_number_of_vertices();
+  vertex_t single_source = permutation.to_new(0);
+  std::vector<vertex_t> distances(n_vertices);
+  thrust::host_vector<weight_t> x(n_vertices, 1), y(n_vertices);
+  thrust::host_vector<vertex_t> triangles_count(n_vertices, 0);
+  std::size_t total_triangles = 0;
+
+  auto row_offsets = G.get_row_offsets();
+  auto column_indices = G.get_column_indices();
+  auto values = G.get_nonzero_values();
+
+  state.exec(nvbench::exec_tag::sync | nvbench::exec_tag::timer,
+             [&](nvbench::launch& launch, auto& timer) {
+               timer.start();
+               if (kernel == "bfs") {
+                 host::bfs::run(G, single_source, distances.data(),
+                                (vertex_t*)nullptr);
+               } else if (kernel == "pr") {
+                 gunrock::pr::run(G, weight_t(0.85), weight_t(1e-6), 100,
+                                  y.data());
+               } else if (kernel == "spmv") {
+                 util::parallel::for_each(
+                     vertex_t(0), n_vertices,
+                     [&](vertex_t row) {
+                       weight_t sum = 0;
+                       for (edge_t e = row_offsets[row];
+                            e < row_offsets[row + 1]; ++e)
+                         sum += values[e] * x[column_indices[e]];
+                       y[row] = sum;
+                     },
+                     vertex_t(256));
+               } else {
+                 thrust::fill(triangles_count.begin(), triangles_count.end(),
+                              0);
+                 gunrock::tc::run(G, true, triangles_count.data(),
+                                  &total_triangles);
+               }
+               timer.stop();
+             });
+}
+
+int main(int argc, char** argv) {
+  parameters_t params(argc, argv);
+  filename = params.filename;
+
+  if (params.help) {
+    // Print NVBench help.
+    const char* args[1] = {"-h"};
+    NVBENCH_MAIN_BODY(1, args);
+  } else {
+    // Remove all gunrock parameters and pass to nvbench.
+    auto args = filtered_argv(argc, argv, "--market", "-m", filename);
+    NVBENCH_BENCH(reorder_bench)
+        .add_string_axis("Ordering", {"none", "degree", "rcm", "hub_sort",
+                                      "hub_cluster", "gorder"})
+        .add_string_axis("Kernel", {"reorder", "bfs", "pr", "spmv", "tc"});
+    NVBENCH_MAIN_BODY(args.size(), args.data());
+  }
+}
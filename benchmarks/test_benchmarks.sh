@@ -16,9 +16,21 @@ JSON_DIR="json"
 # Used for all algorithms except SPGEMM
 MATRIX_FILE="${DATASET_DIR}/chesapeake/chesapeake.mtx"
 
-# Used for Geo
+# Used for host SSSP, MS-BFS and k-core, the CSR builder, compressed CSR, the
+# memory pool and reordering
+# (road and scale-free graphs, fetched with `make` in the dataset directories)
+ROAD_MATRIX_FILE="${DATASET_DIR}/belgium_osm/belgium_osm.mtx"
+SCALE_FREE_MATRIX_FILE="${DATASET_DIR}/kron_g500-logn21/kron_g500-logn21.mtx"
+
+# Used for host TC (large, skewed social network)
+SOCIAL_MATRIX_FILE="${DATASET_DIR}/soc-sinaweibo/soc-sinaweibo.mtx"
+
+# Used for Geo and host k-NN
 COORDINATES_FILE="${DATASET_DIR}/geolocation/sample.labels"
 
+# Used for host SPMV (pruned transformer layer)
+SMTX_FILE="${DATASET_DIR}/layers.0.blocks.0.attn.proj_swin_tiny_unstructured_50.smtx"
+
 # Used for SPGEMM
 A_MATRIX="${DATASET_DIR}/spgemm/a.mtx"
 B_MATRIX="${DATASET_DIR}/spgemm/b.mtx"
@@ -26,12 +38,29 @@ B_MATRIX="${DATASET_DIR}/spgemm/b.mtx"
 make bc_bench
 make bfs_bench
 make color_bench
+make compressed_csr_bench
+make csr_build_bench
 make geo_bench
+make graph_generator_bench
 make hits_bench
+make host_bfs_bench
+make host_dynamic_bench
+make host_kcore_bench
+make host_knn_bench
+make host_ppr_bench
+make host_scaling_bench
+make host_spgemm_bench
+make host_spmv_bench
+make host_sssp_bench
+make host_tc_bench
 make kcore_bench
+make msbfs_bench
 make mst_bench
+make mtx_load_bench
+make pool_bench
 make ppr_bench
 make pr_bench
+make reorder_bench
 make spgemm_bench
 make spmv_bench
 make sssp_bench
@@ -40,12 +69,42 @@ make tc_bench
 ${BIN_DIR}/bc_bench -m ${MATRIX_FILE}  --json ${JSON_DIR}/bc.json
 ${BIN_DIR}/bfs_bench -m ${MATRIX_FILE} --json ${JSON_DIR}/bfs.json
 ${BIN_DIR}/color_bench -m ${MATRIX_FILE} --json ${JSON_DIR}/color.json
+${BIN_DIR}/compressed_csr_bench -m ${ROAD_MATRIX_FILE} --json ${JSON_DIR}/compressed_csr_road.json
+${BIN_DIR}/compressed_csr_bench -m ${SCALE_FREE_MATRIX_FILE} --json ${JSON_DIR}/compressed_csr_scale_free.json
+${BIN_DIR}/csr_build_bench -m ${SCALE_FREE_MATRIX_FILE} --json ${JSON_DIR}/csr_build.json
 ${BIN_DIR}/geo_bench -m ${MATRIX_FILE} -c ${COORDINATES_FILE} --json ${JSON_DIR}/geo.json
+${BIN_DIR}/graph_generator_bench --json ${JSON_DIR}/graph_generator.json
 ${BIN_DIR}/hits_bench -m ${MATRIX_FILE} --json ${JSON_DIR}/hits.json
+${BIN_DIR}/host_bfs_bench -m ${MATRIX_FILE} --json ${JSON_DIR}/host_bfs.json
+${BIN_DIR}/host_dynamic_bench -m ${MATRIX_FILE} --json ${JSON_DIR}/host_dynamic.json
+${BIN_DIR}/host_dynamic_bench -s 20 --json ${JSON_DIR}/host_dynamic_rmat.json
+${BIN_DIR}/host_kcore_bench -m ${ROAD_MATRIX_FILE} --json ${JSON_DIR}/host_kcore_road.json
+${BIN_DIR}/host_knn_bench --json ${JSON_DIR}/host_knn.json
+${BIN_DIR}/host_knn_bench -c ${COORDINATES_FILE} --json ${JSON_DIR}/host_knn_geo.json
+${BIN_DIR}/host_kcore_bench -m ${SCALE_FREE_MATRIX_FILE} --json ${JSON_DIR}/host_kcore_scale_free.json
+${BIN_DIR}/host_ppr_bench -m ${MATRIX_FILE} --json ${JSON_DIR}/host_ppr.json
+${BIN_DIR}/host_ppr_bench -m ${SCALE_FREE_MATRIX_FILE} --json ${JSON_DIR}/host_ppr_scale_free.json
+${BIN_DIR}/host_scaling_bench -m ${MATRIX_FILE} --json ${JSON_DIR}/host_scaling.json
+${BIN_DIR}/host_scaling_bench -s 20 --json ${JSON_DIR}/host_scaling_rmat.json
+${BIN_DIR}/host_spgemm_bench -a ${A_MATRIX} -b ${B_MATRIX} --json ${JSON_DIR}/host_spgemm.json
+${BIN_DIR}/host_spgemm_bench -s 16 --json ${JSON_DIR}/host_spgemm_rmat.json
+${BIN_DIR}/host_spmv_bench -m ${MATRIX_FILE} --json ${JSON_DIR}/host_spmv.json
+${BIN_DIR}/host_spmv_bench -m ${ROAD_MATRIX_FILE} --json ${JSON_DIR}/host_spmv_road.json
+${BIN_DIR}/host_spmv_bench -m ${SCALE_FREE_MATRIX_FILE} --json ${JSON_DIR}/host_spmv_scale_free.json
+${BIN_DIR}/host_spmv_bench -m ${SMTX_FILE} --json ${JSON_DIR}/host_spmv_smtx.json
+${BIN_DIR}/host_sssp_bench -m ${ROAD_MATRIX_FILE} --json ${JSON_DIR}/host_sssp_road.json
+${BIN_DIR}/host_sssp_bench -m ${SCALE_FREE_MATRIX_FILE} --json ${JSON_DIR}/host_sssp_scale_free.json
+${BIN_DIR}/host_tc_bench -m ${SCALE_FREE_MATRIX_FILE} --json ${JSON_DIR}/host_tc_scale_free.json
+${BIN_DIR}/host_tc_bench -m ${SOCIAL_MATRIX_FILE} --json ${JSON_DIR}/host_tc_social.json
 ${BIN_DIR}/kcore_bench -m ${MATRIX_FILE} --json ${JSON_DIR}/kcore.json
+${BIN_DIR}/msbfs_bench -m ${SCALE_FREE_MATRIX_FILE} --json ${JSON_DIR}/msbfs.json
 ${BIN_DIR}/mst_bench -m ${MATRIX_FILE} --json ${JSON_DIR}/mst.json
+${BIN_DIR}/mtx_load_bench -m ${MATRIX_FILE} --json ${JSON_DIR}/mtx_load.json
+${BIN_DIR}/pool_bench -m ${MATRIX_FILE} --json ${JSON_DIR}/pool.json
+${BIN_DIR}/pool_bench -m ${ROAD_MATRIX_FILE} --json ${JSON_DIR}/pool_road.json
 ${BIN_DIR}/ppr_bench -m ${MATRIX_FILE} --json ${JSON_DIR}/ppr.json
 ${BIN_DIR}/pr_bench -m ${MATRIX_FILE} --json ${JSON_DIR}/pr.json
+${BIN_DIR}/reorder_bench -m ${SCALE_FREE_MATRIX_FILE} --json ${JSON_DIR}/reorder.json
 ${BIN_DIR}/spgemm_bench -a ${A_MATRIX} -b ${B_MATRIX} --json ${JSON_DIR}/spgemm.json
 ${BIN_DIR}/spmv_bench -m ${MATRIX_FILE} --json ${JSON_DIR}/spmv.json
 ${BIN_DIR}/sssp_bench -m ${MATRIX_FILE} --json ${JSON_DIR}/sssp.json
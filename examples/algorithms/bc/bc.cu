@@ -1,4 +1,5 @@
 #include <gunrock/algorithms/bc.hxx>
+#include <gunrock/algorithms/host/bc.hxx>
 #include <gunrock/util/performance.hxx>
 #include <gunrock/io/parameters.hxx>
 
@@ -19,21 +20,25 @@ void test_bc(int num_arguments, char** argument_array) {
   gunrock::io::cli::parameters_t params(num_arguments, argument_array,
                                         "Betweenness Centrality");
 
-  io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
-  auto [properties, coo] = mm.load(params.filename);
+  graph::graph_properties_t properties;
 
   format::csr_t<memory_space_t::device, vertex_t, edge_t, weight_t> csr;
 
   if (params.binary) {
-    csr.read_binary(params.filename);
+    properties = csr.read_binary(params.filename);
   } else {
+    io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
+    auto [mm_properties, coo] = mm.load(params.filename);
+    properties = mm_properties;
     csr.from_coo(coo);
   }
 
   // --
-  // Build graph
+  // Build graph (vertices renamed if reordering; results are mapped back)
 
-  auto G = graph::build<memory_space_t::device>(properties, csr);
+  auto permutation =
+      graph::reorder::compute(params.reorder, csr, properties.symmetric);
+  auto G = graph::build<memory_space_t::device>(properties, csr, permutation);
 
   // --
   // Params and memory allocation
@@ -51,23 +56,56 @@ void test_bc(int num_arguments, char** argument_array) {
   gunrock::io::cli::parse_tag_string(params.tag_string, &tag_vect);
 
   // --
-  // GPU Run
+  // Run problem: a single source on the GPU, several sources (or repeated
+  // runs) as one batch sharing multi-source BFS traversals on the host. The
+  // values are summed over the sources.
 
   size_t n_runs = source_vect.size();
+  bool batched = gunrock::io::cli::has_multiple_sources(source_vect);
   std::vector<float> run_times;
 
-  auto benchmark_metrics = std::vector<benchmark::host_benchmark_t>(n_runs);
-  for (int i = 0; i < n_runs; i++) {
-    benchmark::INIT_BENCH();
+  std::vector<vertex_t> sources(n_runs);
+  for (size_t i = 0; i < n_runs; i++)
+    sources[i] = permutation.to_new(source_vect[i]);
+
+  using h_csr_t =
+      format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t>;
+  using h_csc_t =
+      format::csc_t<memory_space_t::host, vertex_t, edge_t, weight_t>;
+  h_csr_t h_csr;
+  h_csc_t h_csc;
+  if (batched || params.validate) {
+    h_csr = h_csr_t(csr);
+    if (!properties.symmetric)
+      h_csc.from_csr(h_csr);
+  }
 
+  // Host engine; dependencies need in-edges: a CSC unless the graph is
+  // symmetric.
+  auto run_host = [&](vertex_t const* sources, size_t num_sources,
+                      weight_t* values) {
+    if (properties.symmetric) {
+      auto H = graph::build<memory_space_t::host>(properties, h_csr);
+      return host::bc::run(H, sources, num_sources, values);
+    }
+    auto H = graph::build<memory_space_t::host>(properties, h_csc, h_csr);
+    return host::bc::run(H, sources, num_sources, values);
+  };
+
+  thrust::host_vector<weight_t> h_bc_values(n_vertices);
+
+  auto benchmark_metrics = std::vector<benchmark::host_benchmark_t>(1);
+  benchmark::INIT_BENCH();
+  if (batched) {
+    run_times.push_back(run_host(sources.data(), n_runs, h_bc_values.data()));
+  } else {
     run_times.push_back(
-        gunrock::bc::run(G, source_vect[i], bc_values.data().get()));
-
-    benchmark::host_benchmark_t metrics = benchmark::EXTRACT();
-    benchmark_metrics[i] = metrics;
-
-    benchmark::DESTROY_BENCH();
+        gunrock::bc::run(G, sources[0], bc_values.data().get()));
+    h_bc_values = bc_values;
   }
+  benchmark_metrics[0] = benchmark::EXTRACT();
+  benchmark::DESTROY_BENCH();
+  permutation.unpermute(h_bc_values);
 
   // Export metrics
   if (params.export_metrics) {
@@ -80,10 +118,44 @@ void test_bc(int num_arguments, char** argument_array) {
   // --
   // Log
 
-  std::cout << "Single source : " << source_vect.back() << "\n";
-  print::head(bc_values, 40, "GPU bc values");
-  std::cout << "GPU Elapsed Time : " << run_times[params.num_runs - 1]
-            << " (ms)" << std::endl;
+  if (batched) {
+    std::cout << "Batched Sources : " << n_runs << std::endl;
+    print::head(h_bc_values, 40, "Host batched bc values");
+    std::cout << "Host Batched BC Elapsed Time : " << run_times[0] << " (ms)"
+              << std::endl;
+  } else {
+    std::cout << "Single source : " << source_vect.back() << "\n";
+    print::head(h_bc_values, 40, "GPU bc values");
+    std::cout << "GPU Elapsed Time : " << run_times[0] << " (ms)"
+              << std::endl;
+  }
+
+  // --
+  // Validation, against the other engine: the GPU one source at a time for
+  // a batch (every source adds to the sums), the host for a single source.
+
+  if (params.validate) {
+    thrust::host_vector<weight_t> reference(n_vertices);
+    float reference_elapsed = 0;
+    if (batched) {
+      for (size_t i = 0; i < n_runs; i++)
+        reference_elapsed +=
+            gunrock::bc::run(G, sources[i], bc_values.data().get());
+      reference = bc_values;
+    } else {
+      reference_elapsed = run_host(sources.data(), 1, reference.data());
+    }
+    permutation.unpermute(reference);
+
+    size_t n_errors = 0;
+    for (size_t v = 0; v < n_vertices; v++)
+      n_errors += std::abs(h_bc_values[v] - reference[v]) >
+                  1e-3f * std::max(weight_t(1), std::abs(reference[v]));
+
+    std::cout << (batched ? "GPU" : "Host") << " Elapsed Time : "
+              << reference_elapsed << " (ms)" << std::endl;
+    std::cout << "Number of errors : " << n_errors << std::endl;
+  }
 }
 
 int main(int argc, char** argv) {
@@ -1,27 +1,25 @@
 #pragma once
 
-#include <chrono>
-#include <vector>
-#include <queue>
+#include <gunrock/algorithms/host/bfs.hxx>
 
-namespace bfs_cpu {
-
-using namespace std;
-using namespace std::chrono;
+#include <thrust/host_vector.h>
 
-template <typename vertex_t>
-class prioritize {
- public:
-  bool operator()(pair<vertex_t, vertex_t>& p1, pair<vertex_t, vertex_t>& p2) {
-    return p1.second > p2.second;
-  }
-};
+namespace bfs_cpu {
 
+/**
+ * @brief Reference BFS on the CPU, runs the direction-optimizing host BFS
+ * (`gunrock::host::bfs`) on a host copy of `csr`.
+ *
+ * @param symmetric true if `csr` is symmetric, which lets the BFS take
+ * bottom-up steps over the same arrays; directed inputs are traversed
+ * top-down only.
+ */
 template <typename csr_t, typename vertex_t, typename edge_t>
 float run(csr_t& csr,
           vertex_t& single_source,
           vertex_t* distances,
-          vertex_t* predecessors) {
+          vertex_t* predecessors,
+          bool symmetric = false) {
   thrust::host_vector<edge_t> _row_offsets(
       csr.row_offsets);  // Copy data to CPU
   thrust::host_vector<vertex_t> _column_indices(csr.column_indices);
@@ -29,42 +27,10 @@ float run(csr_t& csr,
   edge_t* row_offsets = _row_offsets.data();
   vertex_t* column_indices = _column_indices.data();
 
-  for (vertex_t i = 0; i < csr.number_of_rows; i++)
-    distances[i] = std::numeric_limits<vertex_t>::max();
-
-  auto t_start = high_resolution_clock::now();
-
-  distances[single_source] = 0;
-
-  priority_queue<pair<vertex_t, vertex_t>,
-                 std::vector<pair<vertex_t, vertex_t>>, prioritize<vertex_t>>
-      pq;
-
-  pq.push(make_pair(single_source, 0.0));
-
-  while (!pq.empty()) {
-    pair<vertex_t, vertex_t> curr = pq.top();
-    pq.pop();
-
-    vertex_t curr_node = curr.first;
-    vertex_t curr_dist = curr.second;
-
-    vertex_t start = row_offsets[curr_node];
-    vertex_t end = row_offsets[curr_node + 1];
-
-    for (vertex_t offset = start; offset < end; offset++) {
-      vertex_t neib = column_indices[offset];
-      vertex_t new_dist = curr_dist + 1;
-      if (new_dist < distances[neib]) {
-        distances[neib] = new_dist;
-        pq.push(make_pair(neib, new_dist));
-      }
-    }
-  }
-
-  auto t_stop = high_resolution_clock::now();
-  auto elapsed = duration_cast<microseconds>(t_stop - t_start).count();
-  return (float)elapsed / 1000;
+  return gunrock::host::bfs::run(
+      vertex_t(csr.number_of_rows), row_offsets, column_indices,
+      symmetric ? row_offsets : nullptr, symmetric ? column_indices : nullptr,
+      single_source, distances, predecessors);
 }
 
-}  // namespace bfs_cpu
\ No newline at end of file
+}  // namespace bfs_cpu
@@ -1,4 +1,5 @@
 #include <gunrock/algorithms/dawn.hxx>
+#include <gunrock/algorithms/host/msbfs.hxx>
 #include <gunrock/util/performance.hxx>
 #include <gunrock/io/parameters.hxx>
 #include <gunrock/framework/benchmark.hxx>
@@ -24,21 +25,25 @@ void test_dawn_bfs(int num_arguments, char** argument_array) {
 
   gunrock::io::cli::parameters_t params(num_arguments, argument_array, "DAWN");
 
-  io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
-  auto [properties, coo] = mm.load(params.filename);
+  graph::graph_properties_t properties;
 
   csr_t csr;
 
   if (params.binary) {
-    csr.read_binary(params.filename);
+    properties = csr.read_binary(params.filename);
   } else {
+    io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
+    auto [mm_properties, coo] = mm.load(params.filename);
+    properties = mm_properties;
     csr.from_coo(coo);
   }
 
   // --
-  // Build graph
+  // Build graph (vertices renamed if reordering; results are mapped back)
 
-  auto G = graph::build<memory_space_t::device>(properties, csr);
+  auto permutation =
+      graph::reorder::compute(params.reorder, csr, properties.symmetric);
+  auto G = graph::build<memory_space_t::device>(properties, csr, permutation);
 
   // --
   // Params and memory allocation
@@ -57,37 +62,69 @@ void test_dawn_bfs(int num_arguments, char** argument_array) {
   gunrock::io::cli::parse_tag_string(params.tag_string, &tag_vect);
 
   // --
-  // Run problem
+  // Run problem: a single source on the GPU, several sources (or repeated
+  // runs) traversed together as one batch (host multi-source BFS).
 
   size_t n_runs = source_vect.size();
+  bool batched = gunrock::io::cli::has_multiple_sources(source_vect);
   std::vector<float> run_times;
 
-  auto benchmark_metrics = std::vector<benchmark::host_benchmark_t>(n_runs);
-  for (int i = 0; i < n_runs; i++) {
-    benchmark::INIT_BENCH();
-
+  // Distances in the original IDs, one row of `n_vertices` per source.
+  thrust::host_vector<vertex_t> all_distances(n_runs * n_vertices);
+
+  auto benchmark_metrics = std::vector<benchmark::host_benchmark_t>(1);
+  benchmark::INIT_BENCH();
+  if (batched) {
+    format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> h_csr(csr);
+    auto H = graph::build<memory_space_t::host>(properties, h_csr);
+
+    std::vector<vertex_t> batch_sources(n_runs);
+    for (size_t i = 0; i < n_runs; i++)
+      batch_sources[i] = permutation.to_new(source_vect[i]);
+    thrust::host_vector<vertex_t> batch_distances(n_runs * n_vertices);
+    run_times.push_back(host::msbfs::run(H, batch_sources.data(), n_runs,
+                                         batch_distances.data()));
+
+    all_distances = batch_distances;
+    if (!permutation.is_identity())
+      for (size_t i = 0; i < n_runs; i++)
+        permutation.unpermute(batch_distances.data() + i * n_vertices,
+                              all_distances.data() + i * n_vertices);
+  } else {
+    vertex_t source = permutation.to_new(source_vect[0]);
     run_times.push_back(gunrock::dawn_bfs::run(
-        G, source_vect[i], distances.data().get(), predecessors.data().get()));
+        G, source, distances.data().get(), predecessors.data().get()));
 
-    benchmark::host_benchmark_t metrics = benchmark::EXTRACT();
-    benchmark_metrics[i] = metrics;
-
-    benchmark::DESTROY_BENCH();
+    permutation.unpermute(distances);
+    permutation.unpermute_ids(predecessors);
+    all_distances = distances;
   }
+  benchmark_metrics[0] = benchmark::EXTRACT();
+  benchmark::DESTROY_BENCH();
 
   // Export metrics
   if (params.export_metrics) {
     gunrock::util::stats::export_performance_stats(
-        benchmark_metrics, n_edges, n_vertices, run_times, "dawn_bfs",
-        params.filename, "market", params.json_dir, params.json_file,
-        source_vect, tag_vect, num_arguments, argument_array);
+        benchmark_metrics, n_edges, n_vertices, run_times,
+        batched ? "msbfs" : "dawn_bfs", params.filename, "market",
+        params.json_dir, params.json_file, source_vect, tag_vect,
+        num_arguments, argument_array);
   }
 
-  // Print info for last run
+  // Print info for the last source
+  thrust::host_vector<vertex_t> last_distances(
+      all_distances.end() - n_vertices, all_distances.end());
   std::cout << "Source : " << source_vect.back() << "\n";
-  print::head(distances, 40, "GPU distances");
-  std::cout << "[DAWN BFS] GPU Elapsed Time : " << run_times[n_runs - 1]
-            << " (ms)" << std::endl;
+  if (batched) {
+    print::head(last_distances, 40, "Host MS-BFS distances");
+    std::cout << "Batched Sources : " << n_runs << std::endl;
+    std::cout << "[DAWN BFS] Host MS-BFS Elapsed Time : " << run_times[0]
+              << " (ms)" << std::endl;
+  } else {
+    print::head(last_distances, 40, "GPU distances");
+    std::cout << "[DAWN BFS] GPU Elapsed Time : " << run_times[0] << " (ms)"
+              << std::endl;
+  }
 
   // --
   // CPU Run
@@ -96,12 +133,17 @@ void test_dawn_bfs(int num_arguments, char** argument_array) {
     thrust::host_vector<vertex_t> h_distances(n_vertices);
     thrust::host_vector<vertex_t> h_predecessors(n_vertices);
 
-    // Validate with last source in source vector
-    float cpu_elapsed = dawn_bfs_cpu::run<csr_t, vertex_t, edge_t>(
-        csr, source_vect.back(), h_distances.data(), h_predecessors.data());
-
-    int n_errors =
-        util::compare(distances.data().get(), h_distances.data(), n_vertices);
+    // Validate every source
+    float cpu_elapsed = 0;
+    size_t n_errors = 0;
+    for (size_t i = 0; i < n_runs; i++) {
+      vertex_t source = permutation.to_new(source_vect[i]);
+      cpu_elapsed += dawn_bfs_cpu::run<csr_t, vertex_t, edge_t>(
+          csr, source, h_distances.data(), h_predecessors.data());
+      permutation.unpermute(h_distances);
+      for (size_t v = 0; v < n_vertices; v++)
+        n_errors += all_distances[i * n_vertices + v] != h_distances[v];
+    }
     print::head(h_distances, 40, "CPU Distances");
 
     std::cout << "CPU Elapsed Time : " << cpu_elapsed << " (ms)" << std::endl;
@@ -125,21 +167,25 @@ void test_dawn_sssp(int num_arguments, char** argument_array) {
 
   gunrock::io::cli::parameters_t params(num_arguments, argument_array, "DAWN");
 
-  io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
-  auto [properties, coo] = mm.load(params.filename);
+  graph::graph_properties_t properties;
 
   csr_t csr;
 
   if (params.binary) {
-    csr.read_binary(params.filename);
+    properties = csr.read_binary(params.filename);
   } else {
+    io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
+    auto [mm_properties, coo] = mm.load(params.filename);
+    properties = mm_properties;
     csr.from_coo(coo);
   }
 
   // --
-  // Build graph
+  // Build graph (vertices renamed if reordering; results are mapped back)
 
-  auto G = graph::build<memory_space_t::device>(properties, csr);
+  auto permutation =
+      graph::reorder::compute(params.reorder, csr, properties.symmetric);
+  auto G = graph::build<memory_space_t::device>(properties, csr, permutation);
 
   // --
   // Params and memory allocation
@@ -182,8 +228,9 @@ void test_dawn_sssp(int num_arguments, char** argument_array) {
   for (int i = 0; i < n_runs; i++) {
     benchmark::INIT_BENCH();
 
+    vertex_t source = permutation.to_new(source_vect[i]);
     run_times.push_back(gunrock::dawn_sssp::run(
-        G, source_vect[i], distances.data().get(), predecessors.data().get()));
+        G, source, distances.data().get(), predecessors.data().get()));
 
     benchmark::host_benchmark_t metrics = benchmark::EXTRACT();
     benchmark_metrics[i] = metrics;
@@ -199,6 +246,9 @@ void test_dawn_sssp(int num_arguments, char** argument_array) {
         source_vect, tag_vect, num_arguments, argument_array);
   }
 
+  permutation.unpermute(distances);
+  permutation.unpermute_ids(predecessors);
+
   // --
   // Log
 
@@ -213,8 +263,10 @@ void test_dawn_sssp(int num_arguments, char** argument_array) {
     thrust::host_vector<weight_t> h_distances(n_vertices);
     thrust::host_vector<vertex_t> h_predecessors(n_vertices);
 
+    vertex_t source = permutation.to_new(source_vect.back());
     float cpu_elapsed = dawn_sssp_cpu::run<csr_t, vertex_t, edge_t, weight_t>(
-        csr, source_vect.back(), h_distances.data(), h_predecessors.data());
+        csr, source, h_distances.data(), h_predecessors.data());
+    permutation.unpermute(h_distances);
 
     int n_errors =
         util::compare(distances.data().get(), h_distances.data(), n_vertices);
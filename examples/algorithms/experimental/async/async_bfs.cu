@@ -57,8 +57,8 @@ void test_async_bfs(int num_arguments, char** argument_array) {
 
   thrust::host_vector<vertex_t> h_depth(n_vertices);
 
-  float cpu_elapsed =
-      bfs_cpu::run<csr_t, vertex_t, edge_t>(csr, single_source, h_depth.data());
+  float cpu_elapsed = bfs_cpu::run<csr_t, vertex_t, edge_t>(
+      csr, single_source, h_depth.data(), properties.symmetric);
 
   int n_errors = util::compare(depth.data().get(), h_depth.data(), n_vertices);
 
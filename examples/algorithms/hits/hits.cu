@@ -1,4 +1,5 @@
 #include <gunrock/algorithms/hits.hxx>
+#include <gunrock/algorithms/host/hits.hxx>
 #include <gunrock/io/parameters.hxx>
 
 using namespace gunrock;
@@ -18,21 +19,25 @@ void test_hits(int num_arguments, char** argument_array) {
   gunrock::io::cli::parameters_t params(num_arguments, argument_array,
                                         "Hyperlink-Induced Topic Search");
 
-  io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
-  auto [properties, coo] = mm.load(params.filename);
+  graph::graph_properties_t properties;
 
   format::csr_t<memory_space_t::device, vertex_t, edge_t, weight_t> csr;
 
   if (params.binary) {
-    csr.read_binary(params.filename);
+    properties = csr.read_binary(params.filename);
   } else {
+    io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
+    auto [mm_properties, coo] = mm.load(params.filename);
+    properties = mm_properties;
     csr.from_coo(coo);
   }
 
   // --
-  // Build graph
+  // Build graph (vertices renamed if reordering; results are mapped back)
 
-  auto G = graph::build<memory_space_t::device>(properties, csr);
+  auto permutation =
+      graph::reorder::compute(params.reorder, csr, properties.symmetric);
+  auto G = graph::build<memory_space_t::device>(properties, csr, permutation);
 
   hits::result_c<vertex_t, weight_t> result;
   unsigned int max_iter = 20;
@@ -41,7 +46,31 @@ void test_hits(int num_arguments, char** argument_array) {
   // GPU Run
 
   auto time = gunrock::hits::run(G, max_iter, result);
+  permutation.unpermute(result.auth);
+  permutation.unpermute(result.hub);
   result.print_result();
+
+  // --
+  // Host Run
+
+  format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> csr_h(csr);
+  format::csc_t<memory_space_t::host, vertex_t, edge_t, weight_t> csc_h;
+  csc_h.from_csr(csr_h);
+  auto G_h = graph::build<memory_space_t::host>(properties, csc_h, csr_h);
+
+  vertex_t n_vertices = G_h.get_number_of_vertices();
+  thrust::host_vector<weight_t> authority(n_vertices), hub(n_vertices);
+  host::hits::param_t host_param;
+  host_param.max_iterations = max_iter;
+  float host_time =
+      host::hits::run(G_h, authority.data(), hub.data(), host_param);
+  permutation.unpermute(authority);
+  permutation.unpermute(hub);
+
+  print::head(authority, 20, "Host Authority");
+  print::head(hub, 20, "Host Hub");
+  std::cout << "GPU Elapsed Time : " << time << " (ms)" << std::endl;
+  std::cout << "Host Elapsed Time : " << host_time << " (ms)" << std::endl;
 }
 
 int main(int argc, char** argv) {
@@ -1,5 +1,6 @@
 #include <gunrock/algorithms/algorithms.hxx>
 #include <gunrock/algorithms/kcore.hxx>
+#include <gunrock/algorithms/host/kcore.hxx>
 #include "kcore_cpu.hxx"
 
 using namespace gunrock;
@@ -71,6 +72,29 @@ void test_kcore(int num_arguments, char** argument_array) {
   int n_errors =
       util::compare(k_cores.data().get(), h_k_cores.data(), n_vertices);
 
+  // --
+  // Host Runs (bucket and parallel peeling), checked against the CPU run
+
+  format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> h_csr(csr);
+  auto H = graph::build<memory_space_t::host>(properties, h_csr);
+  std::vector<int> host_k_cores(n_vertices);
+  host::kcore::summary_t<vertex_t> summary;
+
+  host::kcore::param_t param;
+  param.algorithm = host::kcore::algorithm_t::bucket;
+  float bucket_elapsed =
+      host::kcore::run(H, host_k_cores.data(), &summary, param);
+  int n_bucket_errors = 0;
+  for (vertex_t v = 0; v < n_vertices; v++)
+    n_bucket_errors += host_k_cores[v] != h_k_cores[v];
+
+  param.algorithm = host::kcore::algorithm_t::peeling;
+  float peeling_elapsed =
+      host::kcore::run(H, host_k_cores.data(), &summary, param);
+  int n_peeling_errors = 0;
+  for (vertex_t v = 0; v < n_vertices; v++)
+    n_peeling_errors += host_k_cores[v] != h_k_cores[v];
+
   // --
   // Log + Validate
 
@@ -83,6 +107,13 @@ void test_kcore(int num_arguments, char** argument_array) {
   std::cout << "GPU Elapsed Time : " << gpu_elapsed << " (ms)" << std::endl;
   std::cout << "CPU Elapsed Time : " << cpu_elapsed << " (ms)" << std::endl;
   std::cout << "Number of errors : " << n_errors << std::endl;
+  std::cout << "Max core : " << summary.max_core << std::endl;
+  std::cout << "Host Bucket Elapsed Time : " << bucket_elapsed << " (ms)"
+            << std::endl;
+  std::cout << "Host Peeling Elapsed Time : " << peeling_elapsed << " (ms)"
+            << std::endl;
+  std::cout << "Number of errors (host bucket, peeling) : " << n_bucket_errors
+            << ", " << n_peeling_errors << std::endl;
 }
 
 // Main method, wrapping test function
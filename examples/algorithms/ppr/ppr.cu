@@ -1,4 +1,5 @@
 #include <gunrock/algorithms/ppr.hxx>
+#include <gunrock/algorithms/host/ppr.hxx>
 #include "ppr_cpu.hxx"
 
 using namespace gunrock;
@@ -29,14 +30,15 @@ void test_ppr(int num_arguments, char** argument_array) {
   vertex_t n_seeds = 10;
 
   std::string filename = argument_array[1];
-  io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
-  auto [properties, coo] = mm.load(filename);
+  graph::graph_properties_t properties;
 
   if (util::is_market(filename)) {
     io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
+    auto [mm_properties, coo] = mm.load(filename);
+    properties = mm_properties;
     csr.from_coo(coo);
   } else if (util::is_binary_csr(filename)) {
-    csr.read_binary(filename);
+    properties = csr.read_binary(filename);
   } else {
     std::cerr << "Unknown file format: " << filename << std::endl;
     exit(1);
@@ -68,6 +70,24 @@ void test_ppr(int num_arguments, char** argument_array) {
   float cpu_elapsed = ppr_cpu::run<csr_t, vertex_t, edge_t, weight_t>(
       csr, n_seeds, h_p.data(), alpha, epsilon);
 
+  // --
+  // Host Run (pull power iteration, 16 seeds per sweep; `alpha` above is the
+  // teleport probability, the host engine takes the damping factor)
+
+  format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> csr_h(csr);
+  format::csc_t<memory_space_t::host, vertex_t, edge_t, weight_t> csc_h;
+  csc_h.from_csr(csr_h);
+  auto G_h = graph::build<memory_space_t::host>(properties, csc_h, csr_h);
+
+  std::vector<vertex_t> seeds(n_seeds);
+  for (vertex_t s = 0; s < n_seeds; ++s)
+    seeds[s] = s;
+  thrust::host_vector<weight_t> host_p(n_seeds * n_vertices);
+  host::ppr::param_t<weight_t> host_param;
+  host_param.alpha = 1 - alpha;
+  float host_elapsed = host::ppr::run_batch(G_h, seeds.data(), seeds.size(),
+                                            host_p.data(), host_param);
+
   int n_errors = util::compare(p.data().get(), h_p.data(), n_seeds * n_vertices,
                                [epsilon](const weight_t a, const weight_t b) {
                                  return std::abs(a - b) > epsilon;
@@ -78,9 +98,12 @@ void test_ppr(int num_arguments, char** argument_array) {
 
   print::head(p, 40, "GPU rank");
   print::head(h_p, 40, "CPU rank");
+  print::head(host_p, 40, "Host rank");
 
   std::cout << "GPU Elapsed Time : " << gpu_elapsed << " (ms)" << std::endl;
   std::cout << "CPU Elapsed Time : " << cpu_elapsed << " (ms)" << std::endl;
+  std::cout << "Host Elapsed Time : " << host_elapsed << " (ms), "
+            << 1e3 * n_seeds / host_elapsed << " seeds/s" << std::endl;
   std::cout << "Number of errors : " << n_errors << std::endl;
 }
 
@@ -22,21 +22,25 @@ void test_pr(int num_arguments, char** argument_array) {
   gunrock::io::cli::parameters_t params(num_arguments, argument_array,
                                         "Page Rank");
 
-  io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
-  auto [properties, coo] = mm.load(params.filename);
+  graph::graph_properties_t properties;
 
   csr_t csr;
 
   if (params.binary) {
-    csr.read_binary(params.filename);
+    properties = csr.read_binary(params.filename);
   } else {
+    io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
+    auto [mm_properties, coo] = mm.load(params.filename);
+    properties = mm_properties;
     csr.from_coo(coo);
   }
 
   // --
-  // Build graph
+  // Build graph (vertices renamed if reordering; results are mapped back)
 
-  auto G = graph::build<memory_space_t::device>(properties, csr);
+  auto permutation =
+      graph::reorder::compute(params.reorder, csr, properties.symmetric);
+  auto G = graph::build<memory_space_t::device>(properties, csr, permutation);
 
   // --
   // Params and memory allocation
@@ -85,6 +89,7 @@ void test_pr(int num_arguments, char** argument_array) {
 
   // Log
 
+  permutation.unpermute(p);
   print::head(p, 40, "GPU rank");
 
   std::cout << "GPU Elapsed Time : " << run_times[params.num_runs - 1]
@@ -1,4 +1,5 @@
 #include <gunrock/algorithms/spgemm.hxx>
+#include <gunrock/algorithms/host/spgemm.hxx>
 
 using namespace gunrock;
 using namespace memory;
@@ -75,6 +76,26 @@ void test_spmv(int num_arguments, char** argument_array) {
   print::head(C.nonzero_values, 10, "nonzero_values");
 
   std::cout << "GPU Elapsed Time : " << gpu_elapsed << " (ms)" << std::endl;
+
+  // --
+  // Host run (symbolic + numeric Gustavson)
+  using host_csr_t =
+      format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t>;
+  host_csr_t a_host, b_host, c_host;
+  a_host.from_coo(a_coo);
+  b_host.from_coo(b_coo);
+
+  host::spgemm::summary_t summary;
+  float host_elapsed = host::spgemm::run(a_host, b_host, c_host, &summary);
+
+  std::cout << "Host number of nonzeros: " << c_host.number_of_nonzeros
+            << std::endl;
+  print::head(c_host.row_offsets, 10, "host row_offsets");
+  print::head(c_host.column_indices, 10, "host column_indices");
+  print::head(c_host.nonzero_values, 10, "host nonzero_values");
+
+  std::cout << "Host Elapsed Time : " << host_elapsed << " (ms), "
+            << 2e-6 * summary.flops / host_elapsed << " GFLOPS" << std::endl;
 }
 
 // Main method, wrapping test function
@@ -1,5 +1,6 @@
 #include <gunrock/algorithms/spmv.hxx>
 #include <gunrock/algorithms/generate/random.hxx>
+#include <gunrock/algorithms/host/spmv.hxx>
 #include "spmv_cpu.hxx"
 
 using namespace gunrock;
@@ -63,6 +64,22 @@ void test_spmv(int num_arguments, char** argument_array) {
   thrust::host_vector<weight_t> y_h(n_vertices);
   float cpu_elapsed = spmv_cpu::run(csr, x, y_h);
 
+  // --
+  // Host Run (layout built once, then reused by every multiply)
+  using host_csr_t =
+      format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t>;
+  host_csr_t csr_h;
+  csr_h.from_coo(coo);
+  thrust::host_vector<weight_t> x_h = x;
+  thrust::host_vector<weight_t> y_host(n_vertices);
+
+  host::spmv::matrix_t<vertex_t, edge_t, weight_t> A(csr_h);
+  float host_elapsed = A.multiply(x_h.data(), y_host.data());
+
+  int n_host_errors = 0;
+  for (vertex_t i = 0; i < n_vertices; ++i)
+    n_host_errors += std::abs(y_host[i] - y_h[i]) > 1e-2;
+
   // --
   // Log + Validate
   int n_errors = util::compare(
@@ -79,6 +96,12 @@ void test_spmv(int num_arguments, char** argument_array) {
   std::cout << "GPU Elapsed Time : " << gpu_elapsed << " (ms)" << std::endl;
   std::cout << "CPU Elapsed Time : " << cpu_elapsed << " (ms)" << std::endl;
   std::cout << "Number of errors : " << n_errors << std::endl;
+  std::cout << "Host Elapsed Time : " << host_elapsed << " (ms), "
+            << (A.kernel() == host::spmv::kernel_t::sell ? "SELL-C-sigma"
+                                                          : "merge-path")
+            << " kernel, prep " << A.get_summary().preprocessing_time
+            << " (ms)" << std::endl;
+  std::cout << "Number of host errors : " << n_host_errors << std::endl;
 }
 
 // Main method, wrapping test function
@@ -26,21 +26,25 @@ void test_sssp(int num_arguments, char** argument_array) {
   gunrock::io::cli::parameters_t params(num_arguments, argument_array,
                                         DEFAULT_SSSP_ALGORITHMS);
 
-  io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
-  auto [properties, coo] = mm.load(params.filename);
+  graph::graph_properties_t properties;
 
   csr_t csr;
 
   if (params.binary) {
-    csr.read_binary(params.filename);
+    properties = csr.read_binary(params.filename);
   } else {
+    io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
+    auto [mm_properties, coo] = mm.load(params.filename);
+    properties = mm_properties;
     csr.from_coo(coo);
   }
 
   // --
-  // Build graph
+  // Build graph (vertices renamed if reordering; results are mapped back)
 
-  auto G = graph::build<memory_space_t::device>(properties, csr);
+  auto permutation =
+      graph::reorder::compute(params.reorder, csr, properties.symmetric);
+  auto G = graph::build<memory_space_t::device>(properties, csr, permutation);
 
   // --
   // Params and memory allocation
@@ -82,14 +86,13 @@ void test_sssp(int num_arguments, char** argument_array) {
   auto benchmark_metrics = std::vector<benchmark::host_benchmark_t>(n_runs);
   for (int i = 0; i < n_runs; i++) {
     benchmark::INIT_BENCH();
+    vertex_t source = permutation.to_new(source_vect[i]);
     if (DEFAULT_SSSP_ALGORITHMS == "DAWN")
-      run_times.push_back(gunrock::dawn_sssp::run(G, source_vect[i],
-                                                  distances.data().get(),
-                                                  predecessors.data().get()));
+      run_times.push_back(gunrock::dawn_sssp::run(
+          G, source, distances.data().get(), predecessors.data().get()));
     else
-      run_times.push_back(gunrock::sssp::run(G, source_vect[i],
-                                             distances.data().get(),
-                                             predecessors.data().get()));
+      run_times.push_back(gunrock::sssp::run(
+          G, source, distances.data().get(), predecessors.data().get()));
 
     benchmark::host_benchmark_t metrics = benchmark::EXTRACT();
     benchmark_metrics[i] = metrics;
@@ -111,6 +114,9 @@ void test_sssp(int num_arguments, char** argument_array) {
           source_vect, tag_vect, num_arguments, argument_array);
   }
 
+  permutation.unpermute(distances);
+  permutation.unpermute_ids(predecessors);
+
   // --
   // Log
 
@@ -125,8 +131,10 @@ void test_sssp(int num_arguments, char** argument_array) {
     thrust::host_vector<weight_t> h_distances(n_vertices);
     thrust::host_vector<vertex_t> h_predecessors(n_vertices);
 
+    vertex_t source = permutation.to_new(source_vect.back());
     float cpu_elapsed = sssp_cpu::run<csr_t, vertex_t, edge_t, weight_t>(
-        csr, source_vect.back(), h_distances.data(), h_predecessors.data());
+        csr, source, h_distances.data(), h_predecessors.data());
+    permutation.unpermute(h_distances);
 
     int n_errors =
         util::compare(distances.data().get(), h_distances.data(), n_vertices);
@@ -1,6 +1,7 @@
 #include <vector>
 
 #include <gunrock/algorithms/tc.hxx>
+#include <gunrock/algorithms/host/tc.hxx>
 #include "tc_cpu.hxx"
 
 #include <cxxopts.hpp>
@@ -66,19 +67,21 @@ void test_tc(int num_arguments, char** argument_array) {
 
   if (util::is_market(params.filename)) {
     io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
-    auto [properties, coo] = mm.load(params.filename);
-    if (!properties.symmetric) {
-      std::cerr << "Error: input matrix must be symmetric" << std::endl;
-      exit(1);
-    }
+    auto [mm_properties, coo] = mm.load(params.filename);
+    properties = mm_properties;
     csr.from_coo(coo);
   } else if (util::is_binary_csr(params.filename)) {
-    csr.read_binary(params.filename);
+    properties = csr.read_binary(params.filename);
   } else {
     std::cerr << "Unknown file format: " << params.filename << std::endl;
     exit(1);
   }
 
+  if (!properties.symmetric) {
+    std::cerr << "Error: input matrix must be symmetric" << std::endl;
+    exit(1);
+  }
+
   // --
   // Build graph
 
@@ -125,6 +128,22 @@ void test_tc(int num_arguments, char** argument_array) {
         n_vertices, [](const auto x, const auto y) { return x != y; }, true);
     std::cout << "CPU Elapsed Time : " << cpu_elapsed << " (ms)" << std::endl;
     std::cout << "Number of errors : " << n_errors << std::endl;
+
+    // Parallel host engine, checked against the same reference.
+    format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> h_csr(csr);
+    auto H = graph::build<memory_space_t::host>(properties, h_csr);
+    std::vector<count_t> host_triangles_count(n_vertices);
+    std::size_t host_total_triangles = 0;
+    float host_elapsed = host::tc::run(H, host_triangles_count.data(),
+                                       &host_total_triangles);
+    uint32_t n_host_errors =
+        host_total_triangles != reference_total_triangles;
+    for (vertex_t v = 0; v < n_vertices; v++)
+      n_host_errors += host_triangles_count[v] != reference_triangles_count[v];
+    std::cout << "Host TC Elapsed Time : " << host_elapsed << " (ms)"
+              << std::endl;
+    std::cout << "Number of errors (host TC) : " << n_host_errors
+              << std::endl;
   }
 }
 
@@ -4,10 +4,13 @@ using namespace gunrock;
 using namespace memory;
 
 void mtx2bin(int num_arguments, char** argument_array) {
-  if (num_arguments != 2) {
-    std::cerr << "usage: " << argument_array[0] << " <inpath>" << std::endl;
+  if (num_arguments < 2 || num_arguments > 3) {
+    std::cerr << "usage: " << argument_array[0] << " <inpath> [--no-checksum]"
+              << std::endl;
     exit(1);
   }
+  bool checksum =
+      !(num_arguments == 3 && std::string(argument_array[2]) == "--no-checksum");
 
   // --
   // Define types
@@ -33,9 +36,11 @@ void mtx2bin(int num_arguments, char** argument_array) {
             << std::endl;
   std::cout << "csr.number_of_nonzeros = " << csr.number_of_nonzeros
             << std::endl;
+  std::cout << "symmetric / directed   = " << properties.symmetric << " / "
+            << properties.directed << std::endl;
   std::cout << "writing to             = " << outpath << std::endl;
 
-  csr.write_binary(outpath);
+  csr.write_binary(outpath, properties, checksum);
 }
 
 int main(int argc, char** argv) {
@@ -0,0 +1,169 @@
+#include <chrono>
+#include <cxxopts.hpp>
+#include <fstream>
+#include <iomanip>
+
+#include <gunrock/algorithms/algorithms.hxx>
+#include <gunrock/algorithms/generate/graphs.hxx>
+#include <gunrock/util/filepath.hxx>
+
+using namespace gunrock;
+using namespace memory;
+
+// --
+// Define types
+
+using vertex_t = int;
+using edge_t = int;
+using weight_t = float;
+
+using csr_t = format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t>;
+
+/**
+ * @brief Writes a host CSR as a general coordinate Matrix Market file.
+ */
+void write_market(std::string const& filename, csr_t const& csr) {
+  std::ofstream file(filename);
+  error::throw_if_exception(!file, "cannot open " + filename);
+  file << "%%MatrixMarket matrix coordinate real general\n"
+       << csr.number_of_rows << " " << csr.number_of_columns << " "
+       << csr.number_of_nonzeros << "\n"
+       << std::setprecision(9);
+  for (vertex_t u = 0; u < csr.number_of_rows; ++u)
+    for (edge_t e = csr.row_offsets[u]; e < csr.row_offsets[u + 1]; ++e)
+      file << u + 1 << " " << csr.column_indices[e] + 1 << " "
+           << csr.nonzero_values[e] << "\n";
+}
+
+void generate_graph(int argc, char** argv) {
+  cxxopts::Options options(argv[0], "Synthetic graph generator");
+  options.add_options()  // Allows to add options.
+      ("g,generator", "Generator: rmat, gnp, gnm or grid",
+       cxxopts::value<std::string>()->default_value("rmat"))  // Generator
+      ("s,scale", "R-MAT: log2 of the number of vertices",
+       cxxopts::value<int>()->default_value("16"))  // Scale
+      ("e,edgefactor", "R-MAT: edges per vertex",
+       cxxopts::value<std::size_t>()->default_value("16"))  // Edge factor
+      ("a", "R-MAT: probability a",
+       cxxopts::value<double>()->default_value("0.57"))  // a
+      ("b", "R-MAT: probability b",
+       cxxopts::value<double>()->default_value("0.19"))  // b
+      ("c", "R-MAT: probability c",
+       cxxopts::value<double>()->default_value("0.19"))  // c
+      ("no-scramble", "R-MAT: keep the unscrambled vertex ids",
+       cxxopts::value<bool>()->default_value("false"))  // Scramble
+      ("n,vertices", "G(n, p), G(n, m): number of vertices",
+       cxxopts::value<vertex_t>()->default_value("65536"))  // n
+      ("p,probability", "G(n, p): edge probability",
+       cxxopts::value<double>()->default_value("0.0001"))  // p
+      ("m,edges", "G(n, m): number of edges",
+       cxxopts::value<std::size_t>()->default_value("1048576"))  // m
+      ("rows", "Grid: rows",
+       cxxopts::value<vertex_t>()->default_value("1024"))  // Rows
+      ("columns", "Grid: columns",
+       cxxopts::value<vertex_t>()->default_value("1024"))  // Columns
+      ("keep", "Grid: probability of keeping each edge (road-like if < 1)",
+       cxxopts::value<double>()->default_value("1"))  // Keep
+      ("diagonals", "Grid: link the diagonal neighbors",
+       cxxopts::value<bool>()->default_value("false"))  // Diagonals
+      ("directed", "Keep the edges directed (rmat, gnp, gnm)",
+       cxxopts::value<bool>()->default_value("false"))  // Directed
+      ("min-weight", "Smallest edge weight",
+       cxxopts::value<double>()->default_value("1"))  // Min weight
+      ("max-weight", "Largest edge weight (uniform in [min, max))",
+       cxxopts::value<double>()->default_value("1"))  // Max weight
+      ("seed", "Random seed",
+       cxxopts::value<std::uint64_t>()->default_value("1"))  // Seed
+      ("t,threads", "Host threads (0 = default)",
+       cxxopts::value<std::size_t>()->default_value("0"))  // Threads
+      ("o,output", "Output file: Matrix Market if it ends in .mtx, binary "
+       "CSR otherwise", cxxopts::value<std::string>())  // Output
+      ("no-checksum", "Do not store a checksum in the binary CSR",
+       cxxopts::value<bool>()->default_value("false"))  // Checksum
+      ("h,help", "Print help");                         // Help
+
+  auto result = options.parse(argc, argv);
+  if (result.count("help") || result.count("output") == 0) {
+    std::cout << options.help({""}) << std::endl;
+    std::exit(0);
+  }
+
+  util::parallel::set_number_of_threads(result["threads"].as<std::size_t>());
+  std::string generator = result["generator"].as<std::string>();
+  std::string outpath = result["output"].as<std::string>();
+  std::uint64_t seed = result["seed"].as<std::uint64_t>();
+  bool directed = result["directed"].as<bool>();
+  double min_weight = result["min-weight"].as<double>();
+  double max_weight = result["max-weight"].as<double>();
+
+  // --
+  // Generate
+
+  namespace gen = generate::graphs;
+  csr_t csr;
+  graph::graph_properties_t properties;
+  auto run = [&](auto parameters) {
+    parameters.seed = seed;
+    parameters.min_weight = min_weight;
+    parameters.max_weight = max_weight;
+    auto t_start = std::chrono::high_resolution_clock::now();
+    properties = gen::to_csr(parameters, csr);
+    auto t_stop = std::chrono::high_resolution_clock::now();
+    std::cout << "generation time (ms)   = "
+              << std::chrono::duration<float, std::milli>(t_stop - t_start)
+                     .count()
+              << std::endl;
+  };
+
+  if (generator == "rmat") {
+    gen::rmat_t<vertex_t, weight_t> rmat;
+    rmat.scale = result["scale"].as<int>();
+    rmat.edge_factor = result["edgefactor"].as<std::size_t>();
+    rmat.a = result["a"].as<double>();
+    rmat.b = result["b"].as<double>();
+    rmat.c = result["c"].as<double>();
+    rmat.scramble = !result["no-scramble"].as<bool>();
+    rmat.directed = directed;
+    run(rmat);
+  } else if (generator == "gnp") {
+    gen::gnp_t<vertex_t, weight_t> gnp;
+    gnp.n = result["vertices"].as<vertex_t>();
+    gnp.p = result["probability"].as<double>();
+    gnp.directed = directed;
+    run(gnp);
+  } else if (generator == "gnm") {
+    gen::gnm_t<vertex_t, weight_t> gnm;
+    gnm.n = result["vertices"].as<vertex_t>();
+    gnm.m = result["edges"].as<std::size_t>();
+    gnm.directed = directed;
+    run(gnm);
+  } else if (generator == "grid") {
+    gen::grid_t<vertex_t, weight_t> grid;
+    grid.rows = result["rows"].as<vertex_t>();
+    grid.columns = result["columns"].as<vertex_t>();
+    grid.keep = result["keep"].as<double>();
+    grid.diagonals = result["diagonals"].as<bool>();
+    run(grid);
+  } else {
+    std::cout << options.help({""}) << std::endl;
+    std::exit(1);
+  }
+
+  std::cout << "csr.number_of_rows     = " << csr.number_of_rows << std::endl;
+  std::cout << "csr.number_of_columns  = " << csr.number_of_columns
+            << std::endl;
+  std::cout << "csr.number_of_nonzeros = " << csr.number_of_nonzeros
+            << std::endl;
+  std::cout << "symmetric / directed   = " << properties.symmetric << " / "
+            << properties.directed << std::endl;
+  std::cout << "writing to             = " << outpath << std::endl;
+
+  if (outpath.size() >= 5 && util::is_market(outpath))
+    write_market(outpath, csr);
+  else
+    csr.write_binary(outpath, properties, !result["no-checksum"].as<bool>());
+}
+
+int main(int argc, char** argv) {
+  generate_graph(argc, argv);
+}
@@ -8,6 +8,7 @@
  *
  */
 
+#include <gunrock/algorithms/host/knn.hxx>
 #include <gunrock/io/points.hxx>
 
 using namespace gunrock;
@@ -28,4 +29,20 @@ int main() {
   copy(points_set.begin(), points_set.end(), points.begin());
   draw(points, dim1, dim2, n);
   write(points);
+
+  // k-NN graph of the points (k from an optional fourth input, default 4),
+  // with the 1-based IDs `write()` printed.
+  int k = 4;
+  if (std::scanf("%d", &k) != 1 || k < 1)
+    k = 4;
+  format::csr_t<memory::memory_space_t::host, int, int, float> knn;
+  host::spatial::knn_graph(points.data(), points.size(),
+                           host::spatial::euclidean_t(), k, knn);
+  for (int u = 0; u < knn.number_of_rows; ++u) {
+    fprintf(stderr, "%d:", u + 1);
+    for (int e = knn.row_offsets[u]; e < knn.row_offsets[u + 1]; ++e)
+      fprintf(stderr, " %d (%.2f)", knn.column_indices[e] + 1,
+              knn.nonzero_values[e]);
+    fprintf(stderr, "\n");
+  }
 }
\ No newline at end of file
@@ -45,17 +45,18 @@ struct problem_t : gunrock::problem_t<graph_t> {
   using edge_t = typename graph_t::edge_type;
   using weight_t = typename graph_t::weight_type;
 
-  thrust::device_vector<vertex_t> visited;  /// @todo not used.
+  vector_t<vertex_t, graph_t::memory_space_v> visited;  /// @todo not used.
 
   void init() override {}
 
   void reset() override {
     auto n_vertices = this->get_graph().get_number_of_vertices();
-    auto d_distances = thrust::device_pointer_cast(this->result.distances);
-    thrust::fill(thrust::device, d_distances + 0, d_distances + n_vertices,
+    auto policy = this->execution_policy();
+    auto distances = this->result.distances;
+    thrust::fill(policy, distances + 0, distances + n_vertices,
                  std::numeric_limits<vertex_t>::max());
-    thrust::fill(thrust::device, d_distances + this->param.single_source,
-                 d_distances + this->param.single_source + 1, 0);
+    thrust::fill(policy, distances + this->param.single_source,
+                 distances + this->param.single_source + 1, 0);
   }
 };
 
@@ -84,7 +85,7 @@ struct enactor_t : gunrock::enactor_t<problem_t> {
 
     auto single_source = P->param.single_source;
     auto distances = P->result.distances;
-    auto visited = P->visited.data().get();
+    auto visited = raw_pointer_cast(P->visited.data());
 
     auto iteration = this->iteration;
 
@@ -0,0 +1,392 @@
+/**
+ * @file graphs.hxx
+ * @brief Deterministic, seedable synthetic graph generators (R-MAT/Kronecker,
+ * Erdős–Rényi G(n, p) and G(n, m), 2D grid/road-like meshes) streaming their
+ * edges in parallel straight into the CSR or COO formats.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include <gunrock/error.hxx>
+#include <gunrock/formats/builder.hxx>
+#include <gunrock/formats/formats.hxx>
+#include <gunrock/graph/properties.hxx>
+#include <gunrock/memory.hxx>
+#include <gunrock/util/parallel.hxx>
+
+namespace gunrock {
+namespace generate {
+namespace graphs {
+
+// Every generator is an entry stream of `format::builder::compress()`: its
+// edges are cut into work units (an edge, or the edges of a vertex) and any
+// range of units can be produced on its own, from any thread. The random
+// numbers of a unit come from a counter-based generator keyed by the seed and
+// the unit index, so a graph only depends on its parameters and seed, never on
+// the number of threads or the order the units are produced in. Undirected
+// generators emit each edge once; `to_csr()` mirrors them.
+
+namespace detail {
+
+/// SplitMix64 finalizer, a bijective 64-bit mix.
+inline std::uint64_t mix(std::uint64_t x) {
+  x += 0x9e3779b97f4a7c15ull;
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+  return x ^ (x >> 31);
+}
+
+/**
+ * @brief SplitMix64 stream of one work unit, keyed by the seed and the unit
+ * index.
+ */
+struct random_t {
+  std::uint64_t state;
+
+  random_t(std::uint64_t seed, std::uint64_t unit)
+      : state(mix(seed ^ mix(unit))) {}
+
+  std::uint64_t next() {
+    state += 0x9e3779b97f4a7c15ull;
+    return mix(state);
+  }
+
+  /// Uniform in [0, 1).
+  double uniform() { return double(next() >> 11) * 0x1.0p-53; }
+
+  /// Uniform in [0, bound) (multiply-shift, bias below 2^-64 * bound).
+  std::uint64_t below(std::uint64_t bound) {
+    return std::uint64_t((unsigned __int128)next() * bound >> 64);
+  }
+};
+
+/// Uniform weight in [min, max); `min` if they are equal.
+template <typename weight_t>
+weight_t weight(random_t& rng, double min, double max) {
+  return min == max ? weight_t(min)
+                    : weight_t(min + (max - min) * rng.uniform());
+}
+
+}  // namespace detail
+
+/**
+ * @brief R-MAT/Kronecker graph with the Graph500 parameters: `edge_factor *
+ * 2^scale` edges, each placed by recursively choosing one of the four
+ * quadrants of the adjacency matrix with probabilities `a`, `b`, `c` and
+ * `d = 1 - a - b - c`. The vertex ids are scrambled by a seeded bijection so
+ * that the high-degree vertices are not clustered at low ids.
+ */
+template <typename vertex_t, typename weight_t>
+struct rmat_t {
+  static_assert(sizeof(vertex_t) <= 8, "rmat_t: unsupported vertex type.");
+
+  /// log2 of the number of vertices.
+  int scale = 16;
+  /// Edges per vertex.
+  std::size_t edge_factor = 16;
+  double a = 0.57;
+  double b = 0.19;
+  double c = 0.19;
+  /// Scramble the vertex ids.
+  bool scramble = true;
+  /// Keep the edges directed instead of mirroring them.
+  bool directed = false;
+  std::uint64_t seed = 1;
+  /// Edge weights, uniform in [min_weight, max_weight).
+  double min_weight = 1;
+  double max_weight = 1;
+
+  vertex_t number_of_vertices() const { return vertex_t(1) << scale; }
+
+  /// Number of edges (throws if `scale` does not fit `vertex_t`).
+  std::size_t size() const {
+    error::throw_if_exception(
+        scale < 1 || scale >= int(8 * sizeof(vertex_t)) - 1,
+        "rmat_t: scale out of range for the vertex type.");
+    return edge_factor << scale;
+  }
+
+  template <typename emit_t>
+  void operator()(std::size_t first, std::size_t last, emit_t&& emit) const {
+    // Quadrant thresholds on 32-bit draws: [0, ta) top-left, [ta, tab)
+    // top-right, [tab, tabc) bottom-left, the rest bottom-right.
+    const double unit = 4294967296.0;
+    const std::uint64_t ta = std::uint64_t(a * unit);
+    const std::uint64_t tab = std::uint64_t((a + b) * unit);
+    const std::uint64_t tabc = std::uint64_t((a + b + c) * unit);
+    const std::uint64_t mask = (std::uint64_t(1) << scale) - 1;
+    const std::uint64_t key = detail::mix(seed);
+
+    for (std::size_t k = first; k < last; ++k) {
+      detail::random_t rng(seed, k);
+      std::uint64_t u = 0, v = 0;
+      for (int level = 0; level < scale; level += 2) {
+        std::uint64_t bits = rng.next();
+        for (int half = 0; half < 2 && level + half < scale; ++half) {
+          std::uint64_t r = (bits >> (32 * half)) & 0xffffffffull;
+          u = (u << 1) | std::uint64_t(r >= tab);
+          v = (v << 1) | std::uint64_t((r >= ta && r < tab) || r >= tabc);
+        }
+      }
+      if (scramble) {
+        u = permute(u, mask, key);
+        v = permute(v, mask, key);
+      }
+      emit(vertex_t(u), vertex_t(v),
+           detail::weight<weight_t>(rng, min_weight, max_weight));
+    }
+  }
+
+ private:
+  /// Bijection of [0, mask]: odd multiplications and xor-shifts mod 2^scale.
+  std::uint64_t permute(std::uint64_t x,
+                        std::uint64_t mask,
+                        std::uint64_t key) const {
+    const int shift = scale / 2 + 1;
+    x = (x * (key | 1) + (key >> 32)) & mask;
+    x ^= x >> shift;
+    x = (x * 0x9e3779b97f4a7c15ull) & mask;
+    x ^= x >> shift;
+    return x;
+  }
+};
+
+/**
+ * @brief Erdős–Rényi G(n, p) graph: every pair of distinct vertices is an
+ * edge with probability `p`. One unit per vertex, which draws the gaps
+ * between its neighbors from a geometric distribution (expected work
+ * proportional to its degree, not to `n`).
+ */
+template <typename vertex_t, typename weight_t>
+struct gnp_t {
+  vertex_t n = 0;
+  double p = 0;
+  /// Draw every ordered pair instead of every unordered one.
+  bool directed = false;
+  std::uint64_t seed = 1;
+  double min_weight = 1;
+  double max_weight = 1;
+
+  vertex_t number_of_vertices() const { return n; }
+  std::size_t size() const { return std::size_t(n); }
+
+  template <typename emit_t>
+  void operator()(std::size_t first, std::size_t last, emit_t&& emit) const {
+    if (p <= 0)
+      return;
+    const double log_q = p < 1 ? std::log1p(-p) : 0;
+    for (std::size_t u = first; u < last; ++u) {
+      detail::random_t rng(seed, u);
+      // Candidates: the vertices after u, or all the others if directed.
+      std::uint64_t begin = directed ? 0 : u + 1;
+      std::uint64_t end = directed ? std::uint64_t(n) - 1 : std::uint64_t(n);
+      for (std::uint64_t i = begin;; ++i) {
+        if (p < 1) {
+          double skip = std::floor(std::log1p(-rng.uniform()) / log_q);
+          if (skip >= double(end - i))
+            break;
+          i += std::uint64_t(skip);
+        }
+        if (i >= end)
+          break;
+        std::uint64_t v = directed ? i + (i >= u) : i;
+        emit(vertex_t(u), vertex_t(v),
+             detail::weight<weight_t>(rng, min_weight, max_weight));
+      }
+    }
+  }
+};
+
+/**
+ * @brief Erdős–Rényi G(n, m) graph: `m` edges between uniformly drawn pairs
+ * of distinct vertices, one unit per edge. Pairs drawn twice become parallel
+ * edges, which the default policy of `to_csr()` merges, so the graph has
+ * slightly fewer than `m` edges when `m` is a large fraction of `n^2`.
+ */
+template <typename vertex_t, typename weight_t>
+struct gnm_t {
+  vertex_t n = 0;
+  std::size_t m = 0;
+  bool directed = false;
+  std::uint64_t seed = 1;
+  double min_weight = 1;
+  double max_weight = 1;
+
+  vertex_t number_of_vertices() const { return n; }
+  std::size_t size() const { return n > 1 ? m : 0; }
+
+  template <typename emit_t>
+  void operator()(std::size_t first, std::size_t last, emit_t&& emit) const {
+    for (std::size_t k = first; k < last; ++k) {
+      detail::random_t rng(seed, k);
+      std::uint64_t u = rng.below(std::uint64_t(n));
+      std::uint64_t v = (u + 1 + rng.below(std::uint64_t(n) - 1)) % n;
+      emit(vertex_t(u), vertex_t(v),
+           detail::weight<weight_t>(rng, min_weight, max_weight));
+    }
+  }
+};
+
+/**
+ * @brief 2D grid mesh of `rows * columns` vertices (vertex `r * columns + c`
+ * at row `r`, column `c`) linked to their horizontal and vertical neighbors,
+ * and optionally to their diagonal ones. Keeping each edge with probability
+ * `keep` and drawing its weight gives a road-like network: planar-ish, low
+ * degree, large diameter. One unit per vertex, which emits its edges to the
+ * right and downwards.
+ */
+template <typename vertex_t, typename weight_t>
+struct grid_t {
+  vertex_t rows = 0;
+  vertex_t columns = 0;
+  /// Probability of keeping each edge of the mesh.
+  double keep = 1;
+  /// Also link the diagonal neighbors (down-left and down-right).
+  bool diagonals = false;
+  static constexpr bool directed = false;
+  std::uint64_t seed = 1;
+  double min_weight = 1;
+  double max_weight = 1;
+
+  vertex_t number_of_vertices() const { return rows * columns; }
+  std::size_t size() const { return std::size_t(rows) * columns; }
+
+  template <typename emit_t>
+  void operator()(std::size_t first, std::size_t last, emit_t&& emit) const {
+    const std::size_t width = columns;
+    const std::size_t height = rows;
+    for (std::size_t u = first; u < last; ++u) {
+      detail::random_t rng(seed, u);
+      std::size_t r = u / width, c = u % width;
+      auto link = [&](bool exists, std::size_t v) {
+        if (!exists)
+          return;
+        // Always draw both numbers, so that an edge of the mesh gets the same
+        // weight whatever `keep` is.
+        bool kept = rng.uniform() < keep;
+        weight_t w = detail::weight<weight_t>(rng, min_weight, max_weight);
+        if (kept)
+          emit(vertex_t(u), vertex_t(v), w);
+      };
+      bool below = r + 1 < height;
+      link(c + 1 < width, u + 1);
+      link(below, u + width);
+      if (diagonals) {
+        link(below && c > 0, u + width - 1);
+        link(below && c + 1 < width, u + width + 1);
+      }
+    }
+  }
+};
+
+/**
+ * @brief Build policy of a simple graph: self-loops dropped, parallel edges
+ * merged and, unless `directed`, every edge mirrored. Merged edges keep the
+ * smallest weight, which preserves the shortest paths and gives an edge and
+ * its mirror the same weight.
+ */
+inline format::build_policy_t simple_graph_policy(bool directed) {
+  format::build_policy_t policy;
+  policy.remove_self_loops = true;
+  policy.duplicates = format::duplicate_policy_t::min;
+  policy.symmetrize = !directed;
+  return policy;
+}
+
+/**
+ * @brief Generates a graph straight into a CSR, in parallel (see
+ * `format::csr_t::from_stream()`).
+ *
+ * @tparam generator_t one of the generators above.
+ * @param generator generator and its parameters.
+ * @param csr output CSR (host or device).
+ * @param policy cleanup policies, a simple graph by default.
+ * @return graph::graph_properties_t properties of the generated graph.
+ */
+template <typename generator_t, typename csr_t>
+graph::graph_properties_t to_csr(generator_t const& generator,
+                                 csr_t& csr,
+                                 format::build_policy_t policy) {
+  csr.from_stream(generator.number_of_vertices(),
+                  generator.number_of_vertices(), generator, policy);
+  graph::graph_properties_t properties;
+  properties.directed = generator.directed;
+  properties.symmetric = policy.symmetrize;
+  return properties;
+}
+
+template <typename generator_t, typename csr_t>
+graph::graph_properties_t to_csr(generator_t const& generator, csr_t& csr) {
+  return to_csr(generator, csr, simple_graph_policy(generator.directed));
+}
+
+/**
+ * @brief Generates the raw edges of a graph straight into a host COO, in
+ * parallel and in unit order: undirected edges appear once, self-loops and
+ * parallel edges are kept. Each block of units is produced twice, to count
+ * and then to write its edges.
+ *
+ * @tparam generator_t one of the generators above.
+ * @param generator generator and its parameters.
+ * @param coo output COO.
+ */
+template <typename generator_t, typename coo_t>
+void to_coo(generator_t const& generator, coo_t& coo) {
+  using index_t = typename std::decay_t<decltype(coo.row_indices)>::value_type;
+  using value_t =
+      typename std::decay_t<decltype(coo.nonzero_values)>::value_type;
+
+  const std::size_t units = generator.size();
+  const std::size_t num_blocks = std::max<std::size_t>(
+      1, std::min(4 * util::parallel::number_of_threads(),
+                  (units + format::builder::detail::entries_per_block - 1) /
+                      format::builder::detail::entries_per_block));
+  auto block_begin = [=](std::size_t b) { return units * b / num_blocks; };
+
+  std::vector<std::size_t> counts(num_blocks), positions(num_blocks + 1);
+  util::parallel::for_each_chunk_id(num_blocks, [&](std::size_t,
+                                                    std::size_t b) {
+    std::size_t count = 0;
+    generator(block_begin(b), block_begin(b + 1),
+              [&](index_t, index_t, value_t const&) { ++count; });
+    counts[b] = count;
+  });
+  std::size_t nnz = util::parallel::transform_exclusive_scan<std::size_t>(
+      num_blocks, [&](std::size_t b) { return counts[b]; }, positions.data());
+
+  coo.number_of_rows = generator.number_of_vertices();
+  coo.number_of_columns = generator.number_of_vertices();
+  coo.number_of_nonzeros = nnz;
+  coo.row_indices.resize(nnz);
+  coo.column_indices.resize(nnz);
+  coo.nonzero_values.resize(nnz);
+  index_t* I = memory::raw_pointer_cast(coo.row_indices.data());
+  index_t* J = memory::raw_pointer_cast(coo.column_indices.data());
+  value_t* V = memory::raw_pointer_cast(coo.nonzero_values.data());
+
+  util::parallel::for_each_chunk_id(num_blocks, [&](std::size_t,
+                                                    std::size_t b) {
+    std::size_t p = positions[b];
+    generator(block_begin(b), block_begin(b + 1),
+              [&](index_t u, index_t v, value_t const& w) {
+                I[p] = u;
+                J[p] = v;
+                V[p] = w;
+                ++p;
+              });
+  });
+}
+
+}  // namespace graphs
+}  // namespace generate
+}  // namespace gunrock
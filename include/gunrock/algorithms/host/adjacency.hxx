@@ -0,0 +1,126 @@
+/**
+ * @file adjacency.hxx
+ * @brief Neighbor-list interface the host engines are written against, and
+ * its implementations over raw CSR (or CSC) arrays and over CSR arrays with
+ * free slots after every list.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+namespace gunrock {
+namespace host {
+
+/**
+ * @brief Neighbor lists stored as raw CSR arrays (or CSC arrays, for
+ * in-neighbors).
+ *
+ * @par Overview
+ * Host engines scan neighbors only through `get_starting_edge()`,
+ * `get_number_of_neighbors()`, `get_edge_weight()`, `for_each_neighbor()` and
+ * `any_neighbor()` (positions are relative to the start of the list, callbacks
+ * receive `(neighbor, edge)`), so they run unchanged on any type providing
+ * them: this one, slotted_adjacency_t (the lists of host::dynamic_graph_t),
+ * or graph::graph_compressed_csr_t, which decodes the lists on the fly.
+ *
+ * @tparam vertex_t vertex type.
+ * @tparam edge_t edge type.
+ * @tparam weight_t weight type.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t = float>
+struct csr_adjacency_t {
+  edge_t const* offsets;
+  vertex_t const* indices;
+  /// `nullptr`: every edge weighs 1.
+  weight_t const* values = nullptr;
+
+  edge_t get_starting_edge(vertex_t v) const { return offsets[v]; }
+
+  edge_t get_number_of_neighbors(vertex_t v) const {
+    return offsets[v + 1] - offsets[v];
+  }
+
+  weight_t get_edge_weight(edge_t e) const {
+    return values ? values[e] : weight_t(1);
+  }
+
+  template <typename operator_t>
+  void for_each_neighbor(vertex_t v, operator_t op) const {
+    for (edge_t e = offsets[v]; e < offsets[v + 1]; ++e)
+      op(indices[e], e);
+  }
+
+  template <typename operator_t>
+  void for_each_neighbor(vertex_t v,
+                         edge_t first,
+                         edge_t last,
+                         operator_t op) const {
+    for (edge_t e = offsets[v] + first; e < offsets[v] + last; ++e)
+      op(indices[e], e);
+  }
+
+  template <typename predicate_t>
+  bool any_neighbor(vertex_t v, predicate_t pred) const {
+    for (edge_t e = offsets[v]; e < offsets[v + 1]; ++e)
+      if (pred(indices[e], e))
+        return true;
+    return false;
+  }
+};
+
+/**
+ * @brief Neighbor lists stored as CSR arrays with free slots: the list of `v`
+ * starts at `starts[v]` and holds `degrees[v]` entries, followed by unused
+ * slots up to `starts[v + 1]`. Edge positions count the free slots, so
+ * `get_starting_edge(n) - get_starting_edge(0)` bounds the number of edges
+ * from above.
+ *
+ * @tparam vertex_t vertex type.
+ * @tparam edge_t edge type.
+ * @tparam weight_t weight type.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t = float>
+struct slotted_adjacency_t {
+  edge_t const* starts;
+  edge_t const* degrees;
+  vertex_t const* indices;
+  /// `nullptr`: every edge weighs 1.
+  weight_t const* values = nullptr;
+
+  edge_t get_starting_edge(vertex_t v) const { return starts[v]; }
+
+  edge_t get_number_of_neighbors(vertex_t v) const { return degrees[v]; }
+
+  weight_t get_edge_weight(edge_t e) const {
+    return values ? values[e] : weight_t(1);
+  }
+
+  template <typename operator_t>
+  void for_each_neighbor(vertex_t v, operator_t op) const {
+    for (edge_t e = starts[v]; e < starts[v] + degrees[v]; ++e)
+      op(indices[e], e);
+  }
+
+  template <typename operator_t>
+  void for_each_neighbor(vertex_t v,
+                         edge_t first,
+                         edge_t last,
+                         operator_t op) const {
+    for (edge_t e = starts[v] + first; e < starts[v] + last; ++e)
+      op(indices[e], e);
+  }
+
+  template <typename predicate_t>
+  bool any_neighbor(vertex_t v, predicate_t pred) const {
+    for (edge_t e = starts[v]; e < starts[v] + degrees[v]; ++e)
+      if (pred(indices[e], e))
+        return true;
+    return false;
+  }
+};
+
+}  // namespace host
+}  // namespace gunrock
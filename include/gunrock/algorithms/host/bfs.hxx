@@ -0,0 +1,397 @@
+/**
+ * @file bfs.hxx
+ * @brief Direction-optimizing, multithreaded Breadth-First Search on the host
+ * (CPU). Used as the reference implementation for validation and as a
+ * host-side BFS.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <gunrock/algorithms/host/adjacency.hxx>
+#include <gunrock/graph/graph.hxx>
+#include <gunrock/util/parallel.hxx>
+#include <gunrock/util/type_limits.hxx>
+
+namespace gunrock {
+namespace host {
+namespace bfs {
+
+/**
+ * @brief Tuning parameters of the direction-optimizing BFS (Beamer et al.,
+ * "Direction-Optimizing Breadth-First Search", SC'12).
+ */
+struct param_t {
+  /// Switch top-down -> bottom-up once the frontier's edges exceed the
+  /// unexplored edges divided by `alpha`.
+  float alpha = 15;
+  /// Switch bottom-up -> top-down once the frontier shrinks below
+  /// `number_of_vertices / beta` vertices.
+  float beta = 18;
+  /// Allow bottom-up steps (needs in-edges, see `run()`).
+  bool direction_optimizing = true;
+};
+
+namespace detail {
+
+/// Work items (edges) per chunk of a top-down step.
+constexpr std::size_t edges_per_chunk = 4096;
+/// Bitmap words (64 vertices each) per chunk of a bottom-up step.
+constexpr std::size_t words_per_chunk = 64;
+
+/**
+ * @brief Dense bitmap over the vertices, one bit per vertex.
+ */
+class bitmap_t {
+ public:
+  explicit bitmap_t(std::size_t n) : words((n + 63) / 64, 0) {}
+
+  std::size_t size() const { return words.size(); }
+  std::uint64_t* data() { return words.data(); }
+
+  bool test(std::size_t i) const {
+    return (__atomic_load_n(&words[i >> 6], __ATOMIC_RELAXED) >> (i & 63)) & 1;
+  }
+
+  /// Atomically sets bit `i`; returns true if this call set it.
+  bool test_and_set(std::size_t i) {
+    std::uint64_t mask = std::uint64_t(1) << (i & 63);
+    return !(__atomic_fetch_or(&words[i >> 6], mask, __ATOMIC_RELAXED) & mask);
+  }
+
+  void clear() {
+    std::uint64_t* w = words.data();
+    util::parallel::for_each(
+        std::size_t(0), words.size(), [=](std::size_t i) { w[i] = 0; },
+        std::size_t(1) << 14);
+  }
+
+ private:
+  std::vector<std::uint64_t> words;
+};
+
+}  // namespace detail
+
+/**
+ * @brief Direction-optimizing BFS over neighbor lists (see
+ * host::csr_adjacency_t for the interface `out` and `in` provide).
+ *
+ * @par Overview
+ * Level-synchronous BFS. Top-down steps expand a queue frontier: the edge
+ * space of the frontier (degree scan) is cut into equal chunks scheduled with
+ * work stealing, and newly discovered vertices are claimed with an atomic
+ * test-and-set on a visited bitmap. When the frontier's out-edges exceed the
+ * unexplored edges divided by `alpha`, the search switches to bottom-up steps:
+ * every unvisited vertex scans its in-neighbors and stops at the first one in
+ * the (bitmap) frontier. Threads own whole bitmap words, so bottom-up steps
+ * need no atomics. The search returns to top-down once the frontier shrinks
+ * below `n / beta` vertices.
+ *
+ * @tparam out_adjacency_t out-neighbor lists type.
+ * @tparam in_adjacency_t in-neighbor lists type.
+ * @param n number of vertices.
+ * @param out out-neighbor lists.
+ * @param in in-neighbor lists, e.g. the CSC, or `&out` for a symmetric graph.
+ * `nullptr` disables bottom-up steps.
+ * @param single_source source vertex.
+ * @param distances output, depth of each vertex
+ * (`std::numeric_limits<vertex_t>::max()` if unreachable).
+ * @param predecessors output, BFS-tree parent of each vertex (invalid for the
+ * source and unreachable vertices). May be `nullptr`.
+ * @param param tuning parameters.
+ * @return float elapsed time in milliseconds (excluding initialization).
+ */
+template <typename vertex_t, typename out_adjacency_t, typename in_adjacency_t>
+float run(vertex_t n,
+          out_adjacency_t const& out,
+          in_adjacency_t const* in,
+          vertex_t single_source,
+          vertex_t* distances,
+          vertex_t* predecessors,
+          param_t param = param_t()) {
+  using edge_t = std::decay_t<decltype(out.get_starting_edge(n))>;
+  using namespace std::chrono;
+  constexpr vertex_t unreached = std::numeric_limits<vertex_t>::max();
+  const vertex_t invalid = gunrock::numeric_limits<vertex_t>::invalid();
+  const std::size_t num_vertices = n;
+  if (num_vertices == 0)
+    return 0;
+
+  util::parallel::for_each(
+      std::size_t(0), num_vertices,
+      [=](std::size_t v) {
+        distances[v] = unreached;
+        if (predecessors)
+          predecessors[v] = invalid;
+      },
+      std::size_t(1) << 14);
+
+  detail::bitmap_t visited(num_vertices);
+  detail::bitmap_t front(num_vertices);
+  detail::bitmap_t next(num_vertices);
+  std::vector<vertex_t> frontier;
+  std::vector<vertex_t> next_frontier;
+  std::vector<std::size_t> offsets;
+
+  auto t_start = high_resolution_clock::now();
+
+  const bool bottom_up_enabled = param.direction_optimizing && in;
+  std::size_t edges_to_check =
+      out.get_starting_edge(n) - out.get_starting_edge(0);
+  vertex_t level = 0;
+
+  distances[single_source] = 0;
+  visited.test_and_set(single_source);
+  frontier.push_back(single_source);
+
+  auto degree = [&](vertex_t v) {
+    return std::size_t(out.get_number_of_neighbors(v));
+  };
+
+  // Top-down step: expands `frontier` into `next_frontier`.
+  auto top_down = [&](std::size_t frontier_edges) {
+    vertex_t depth = level + 1;
+    util::parallel::collect<vertex_t>(
+        std::size_t(0), frontier_edges,
+        [&](std::size_t first, std::size_t last, std::vector<vertex_t>& local) {
+          std::size_t i =
+              std::upper_bound(offsets.begin(), offsets.end(), first) -
+              offsets.begin() - 1;
+          for (std::size_t item = first; item < last; ++i) {
+            std::size_t segment_end = std::min(offsets[i + 1], last);
+            vertex_t u = frontier[i];
+            out.for_each_neighbor(
+                u, edge_t(item - offsets[i]), edge_t(segment_end - offsets[i]),
+                [&](vertex_t v, edge_t) {
+                  if (!visited.test(v) && visited.test_and_set(v)) {
+                    distances[v] = depth;
+                    if (predecessors)
+                      predecessors[v] = u;
+                    local.push_back(v);
+                  }
+                });
+            item = segment_end;
+          }
+        },
+        [&](std::size_t size) {
+          next_frontier.resize(size);
+          return next_frontier.data();
+        },
+        detail::edges_per_chunk);
+  };
+
+  // Bottom-up step: unvisited vertices look for a parent in `front`, the
+  // vertices found are marked in `next`. Returns their number and the sum of
+  // their out-degrees.
+  auto bottom_up = [&]() {
+    vertex_t depth = level + 1;
+    std::size_t awake = 0;
+    std::size_t awake_edges = 0;
+    std::uint64_t* visited_words = visited.data();
+    std::uint64_t* next_words = next.data();
+    util::parallel::for_each_chunk(
+        std::size_t(0), visited.size(),
+        [&](std::size_t first_word, std::size_t last_word) {
+          std::size_t found = 0;
+          std::size_t found_edges = 0;
+          for (std::size_t w = first_word; w < last_word; ++w) {
+            std::uint64_t seen = visited_words[w];
+            if (seen == ~std::uint64_t(0)) {
+              next_words[w] = 0;
+              continue;
+            }
+            std::uint64_t discovered = 0;
+            std::size_t last_vertex = std::min(num_vertices, (w + 1) * 64);
+            for (std::size_t v = w * 64; v < last_vertex; ++v) {
+              if ((seen >> (v & 63)) & 1)
+                continue;
+              bool reached = in->any_neighbor(
+                  vertex_t(v), [&](vertex_t u, auto) {
+                    if (!front.test(u))
+                      return false;
+                    distances[v] = depth;
+                    if (predecessors)
+                      predecessors[v] = u;
+                    return true;
+                  });
+              if (reached) {
+                discovered |= std::uint64_t(1) << (v & 63);
+                ++found;
+                found_edges += degree(vertex_t(v));
+              }
+            }
+            visited_words[w] = seen | discovered;
+            next_words[w] = discovered;
+          }
+          __atomic_fetch_add(&awake, found, __ATOMIC_RELAXED);
+          __atomic_fetch_add(&awake_edges, found_edges, __ATOMIC_RELAXED);
+        },
+        detail::words_per_chunk);
+    return std::make_pair(awake, awake_edges);
+  };
+
+  while (!frontier.empty()) {
+    // Degree scan of the frontier: frontier[i] owns work items
+    // [offsets[i], offsets[i + 1]).
+    offsets.resize(frontier.size() + 1);
+    std::size_t frontier_edges = util::parallel::transform_exclusive_scan(
+        frontier.size(), [&](std::size_t i) { return degree(frontier[i]); },
+        offsets.data());
+
+    bool switch_to_bottom_up =
+        bottom_up_enabled &&
+        frontier_edges > std::size_t(edges_to_check / param.alpha);
+    // The frontier's edges are explored at this level, in either direction.
+    edges_to_check -= std::min(edges_to_check, frontier_edges);
+
+    if (switch_to_bottom_up) {
+      // Queue -> bitmap.
+      front.clear();
+      util::parallel::for_each(
+          std::size_t(0), frontier.size(),
+          [&](std::size_t i) { front.test_and_set(frontier[i]); },
+          std::size_t(1) << 12);
+
+      std::size_t awake = frontier.size();
+      for (;;) {
+        std::size_t previous = awake;
+        auto [found, found_edges] = bottom_up();
+        awake = found;
+        std::swap(front, next);
+        ++level;
+        if (awake == 0 ||
+            (awake < previous && awake <= num_vertices / param.beta))
+          break;
+        // The next bottom-up step explores the edges of the vertices found.
+        edges_to_check -= std::min(edges_to_check, found_edges);
+      }
+
+      // Bitmap -> queue.
+      std::uint64_t* front_words = front.data();
+      util::parallel::collect<vertex_t>(
+          std::size_t(0), front.size(),
+          [&](std::size_t first, std::size_t last,
+              std::vector<vertex_t>& local) {
+            for (std::size_t w = first; w < last; ++w)
+              for (std::uint64_t bits = front_words[w]; bits; bits &= bits - 1)
+                local.push_back(vertex_t(w * 64 + __builtin_ctzll(bits)));
+          },
+          [&](std::size_t size) {
+            frontier.resize(size);
+            return frontier.data();
+          },
+          detail::words_per_chunk);
+    } else {
+      top_down(frontier_edges);
+      std::swap(frontier, next_frontier);
+      ++level;
+    }
+  }
+
+  auto t_stop = high_resolution_clock::now();
+  return duration<float, std::milli>(t_stop - t_start).count();
+}
+
+/**
+ * @brief Direction-optimizing BFS over raw CSR arrays.
+ *
+ * @tparam vertex_t vertex type.
+ * @tparam edge_t edge type.
+ * @param n number of vertices.
+ * @param row_offsets out-edge offsets (size `n + 1`).
+ * @param column_indices out-neighbors.
+ * @param in_offsets in-edge offsets (size `n + 1`), e.g. CSC column offsets,
+ * or the CSR offsets of a symmetric graph. `nullptr` disables bottom-up steps.
+ * @param in_indices in-neighbors (`nullptr` if `in_offsets` is).
+ * @param single_source source vertex.
+ * @param distances output, depth of each vertex
+ * (`std::numeric_limits<vertex_t>::max()` if unreachable).
+ * @param predecessors output, BFS-tree parent of each vertex (invalid for the
+ * source and unreachable vertices). May be `nullptr`.
+ * @param param tuning parameters.
+ * @return float elapsed time in milliseconds (excluding initialization).
+ */
+template <typename vertex_t, typename edge_t>
+float run(vertex_t n,
+          edge_t const* row_offsets,
+          vertex_t const* column_indices,
+          edge_t const* in_offsets,
+          vertex_t const* in_indices,
+          vertex_t single_source,
+          vertex_t* distances,
+          vertex_t* predecessors,
+          param_t param = param_t()) {
+  using adjacency_t = csr_adjacency_t<vertex_t, edge_t>;
+  adjacency_t out{row_offsets, column_indices};
+  adjacency_t in{in_offsets, in_indices};
+  return run(n, out, (in_offsets && in_indices) ? &in : nullptr,
+             single_source, distances, predecessors, param);
+}
+
+/**
+ * @brief Direction-optimizing BFS on a host graph. Out-neighbors come from
+ * the graph's CSR view, or from its compressed CSR view if it has no CSR
+ * view. Bottom-up steps use the graph's CSC view when it has one, or its
+ * out-neighbors when the graph is symmetric; otherwise the search is top-down
+ * only.
+ *
+ * @tparam graph_t graph type, must live in `memory_space_t::host` and contain
+ * a CSR or a compressed CSR view.
+ * @param G input graph.
+ * @param single_source source vertex.
+ * @param distances output, depth of each vertex.
+ * @param predecessors output, BFS-tree parent of each vertex (may be
+ * `nullptr`).
+ * @param param tuning parameters.
+ * @return float elapsed time in milliseconds.
+ */
+template <typename graph_t>
+float run(graph_t& G,
+          typename graph_t::vertex_type single_source,
+          typename graph_t::vertex_type* distances,
+          typename graph_t::vertex_type* predecessors,
+          param_t param = param_t()) {
+  static_assert(graph_t::memory_space_v == memory_space_t::host,
+                "host::bfs requires a graph in host memory.");
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t = typename graph_t::edge_type;
+  using csr_view_t = typename graph_t::graph_csr_view_t;
+  using csc_view_t = typename graph_t::graph_csc_view_t;
+  using compressed_view_t = typename graph_t::graph_compressed_csr_view_t;
+  using adjacency_t = csr_adjacency_t<vertex_t, edge_t>;
+
+  auto search = [&](auto const& out) {
+    if constexpr (std::is_base_of_v<csc_view_t, graph_t>) {
+      auto& csc = static_cast<csc_view_t&>(G);
+      adjacency_t in{csc.get_column_offsets(), csc.get_row_indices()};
+      return run(G.get_number_of_vertices(), out, &in, single_source,
+                 distances, predecessors, param);
+    } else {
+      return run(G.get_number_of_vertices(), out,
+                 G.is_symmetric() ? &out : nullptr, single_source, distances,
+                 predecessors, param);
+    }
+  };
+
+  if constexpr (std::is_base_of_v<csr_view_t, graph_t>) {
+    auto& csr = static_cast<csr_view_t&>(G);
+    return search(adjacency_t{csr.get_row_offsets(), csr.get_column_indices()});
+  } else {
+    return search(static_cast<compressed_view_t const&>(G));
+  }
+}
+
+}  // namespace bfs
+}  // namespace host
+}  // namespace gunrock
@@ -0,0 +1,610 @@
+/**
+ * @file dynamic_graph.hxx
+ * @brief Mutable host (CPU) graph: CSR with free slots after every neighbor
+ * list, updated by batches of edge insertions and deletions in parallel.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <gunrock/algorithms/host/adjacency.hxx>
+#include <gunrock/error.hxx>
+#include <gunrock/util/parallel.hxx>
+#include <gunrock/util/type_limits.hxx>
+
+namespace gunrock {
+namespace host {
+
+/**
+ * @brief One edge of an update batch (the weight is ignored by deletions).
+ */
+template <typename vertex_t, typename weight_t>
+struct update_t {
+  vertex_t source;
+  vertex_t destination;
+  weight_t weight = 1;
+};
+
+namespace detail {
+
+/// Batch entries per chunk.
+constexpr std::size_t entries_per_chunk = 4096;
+/// Neighbor lists per chunk of the merges.
+constexpr std::size_t lists_per_chunk = 64;
+
+/**
+ * @brief Batch entry of one direction: the edge `key -> other` (or the
+ * in-edge `other -> key`). `sequence` orders repeated edges, the last one
+ * wins.
+ */
+template <typename vertex_t, typename weight_t>
+struct entry_t {
+  vertex_t key;
+  vertex_t other;
+  weight_t weight;
+  std::size_t sequence;
+
+  bool operator<(entry_t const& b) const {
+    if (key != b.key)
+      return key < b.key;
+    if (other != b.other)
+      return other < b.other;
+    return sequence < b.sequence;
+  }
+};
+
+/**
+ * @brief Neighbor lists of one direction, sorted, in vertex order in one
+ * array with free slots after every list (see slotted_adjacency_t).
+ *
+ * @par Overview
+ * A batch is sorted by (vertex, neighbor) and cut into one run per vertex. A
+ * first parallel pass merges every run with its list to count the list's new
+ * degree; the runs then merge in place (insertions from the back, deletions
+ * by compaction), in parallel. Lists that outgrow their slots are rebalanced
+ * as in a packed-memory array: the vertices are the leaves of an implicit
+ * tree, and the smallest aligned window of vertices around the list whose
+ * density `(sum of (degree + 1)) / slots` is below the window's threshold
+ * (1 at a single list, 3/4 at the root) spreads its slots over its lists in
+ * proportion to `degree + 1`. Disjoint windows rebalance in parallel. When a
+ * window would span an eighth of the vertices, or more than 1/64 of the lists
+ * overflow, or deletions leave the array less than 1/8 full, the whole array
+ * is laid out again at density 1/2.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+class slotted_lists_t {
+ public:
+  using adjacency_t = slotted_adjacency_t<vertex_t, edge_t, weight_t>;
+  using batch_t = std::vector<entry_t<vertex_t, weight_t>>;
+
+  explicit slotted_lists_t(vertex_t n = 0)
+      : starts(std::size_t(n) + 1),
+        degrees(n, 0),
+        targets(n, 0),
+        indices(2 * std::size_t(n)),
+        values(2 * std::size_t(n)),
+        edges(0) {
+    for (std::size_t v = 0; v <= std::size_t(n); ++v)
+      starts[v] = edge_t(2 * v);
+  }
+
+  vertex_t size() const { return vertex_t(degrees.size()); }
+  edge_t number_of_edges() const { return edges; }
+
+  adjacency_t view() const {
+    return {starts.data(), degrees.data(), indices.data(), values.data()};
+  }
+
+  /**
+   * @brief Inserts (or, if `erase`, deletes) the edges of `batch`, sorted by
+   * (key, other) with no repeated edge. Inserting an edge that exists sets
+   * its weight; deleting one that does not exist does nothing.
+   *
+   * @return edge_t number of edges added (or removed).
+   */
+  edge_t apply(batch_t const& batch, bool erase) {
+    const std::size_t n = degrees.size();
+    if (batch.empty())
+      return 0;
+
+    // Run of vertex `batch[heads[g]].key`: batch[heads[g]] to
+    // batch[heads[g + 1]].
+    std::vector<std::size_t> heads;
+    util::parallel::collect<std::size_t>(
+        std::size_t(0), batch.size(),
+        [&](std::size_t first, std::size_t last,
+            std::vector<std::size_t>& local) {
+          for (std::size_t i = first; i < last; ++i)
+            if (i == 0 || batch[i].key != batch[i - 1].key)
+              local.push_back(i);
+        },
+        [&](std::size_t total) {
+          heads.resize(total + 1);
+          return heads.data();
+        },
+        entries_per_chunk);
+    heads.back() = batch.size();
+    const std::size_t runs = heads.size() - 1;
+
+    // New degrees, and the lists they overflow.
+    std::size_t changed = 0;
+    std::vector<vertex_t> overflows;
+    util::parallel::collect<vertex_t>(
+        std::size_t(0), runs,
+        [&](std::size_t first, std::size_t last,
+            std::vector<vertex_t>& local) {
+          std::size_t count = 0;
+          for (std::size_t r = first; r < last; ++r) {
+            vertex_t v = batch[heads[r]].key;
+            std::size_t found = matches(v, heads[r], heads[r + 1], batch);
+            std::size_t moved = erase ? found : heads[r + 1] - heads[r] - found;
+            targets[v] = erase ? degrees[v] - edge_t(moved)
+                               : degrees[v] + edge_t(moved);
+            count += moved;
+            if (targets[v] > starts[v + 1] - starts[v])
+              local.push_back(v);
+          }
+          __atomic_fetch_add(&changed, count, __ATOMIC_RELAXED);
+        },
+        [&](std::size_t total) {
+          overflows.resize(total);
+          return overflows.data();
+        },
+        lists_per_chunk);
+
+    if (!overflows.empty())
+      rebalance(overflows);
+
+    util::parallel::for_each(
+        std::size_t(0), runs,
+        [&](std::size_t r) {
+          vertex_t v = batch[heads[r]].key;
+          if (erase)
+            remove(v, heads[r], heads[r + 1], batch);
+          else
+            merge(v, heads[r], heads[r + 1], batch);
+          degrees[v] = targets[v];
+        },
+        lists_per_chunk);
+
+    edges = erase ? edges - edge_t(changed) : edges + edge_t(changed);
+    if (erase && (std::size_t(edges) + n) * 8 < indices.size())
+      relayout();
+    return edge_t(changed);
+  }
+
+ private:
+  /// Entries of batch[first, last) (all of vertex `v`) found in `v`'s list.
+  std::size_t matches(vertex_t v,
+                      std::size_t first,
+                      std::size_t last,
+                      batch_t const& batch) const {
+    vertex_t const* list = indices.data() + starts[v];
+    std::size_t i = 0, d = degrees[v], found = 0;
+    for (std::size_t j = first; j < last && i < d; ++j) {
+      while (i < d && list[i] < batch[j].other)
+        ++i;
+      if (i < d && list[i] == batch[j].other) {
+        ++found;
+        ++i;
+      }
+    }
+    return found;
+  }
+
+  /// Merges batch[first, last) into `v`'s list, from the back.
+  void merge(vertex_t v,
+             std::size_t first,
+             std::size_t last,
+             batch_t const& batch) {
+    vertex_t* list = indices.data() + starts[v];
+    weight_t* weights = values.data() + starts[v];
+    std::size_t i = degrees[v], j = last, out = targets[v];
+    while (j > first) {
+      auto const& x = batch[j - 1];
+      --out;
+      if (i > 0 && list[i - 1] > x.other) {
+        --i;
+        list[out] = list[i];
+        weights[out] = weights[i];
+        continue;
+      }
+      if (i > 0 && list[i - 1] == x.other)
+        --i;
+      list[out] = x.other;
+      weights[out] = x.weight;
+      --j;
+    }
+  }
+
+  /// Removes the entries of batch[first, last) from `v`'s list.
+  void remove(vertex_t v,
+              std::size_t first,
+              std::size_t last,
+              batch_t const& batch) {
+    vertex_t* list = indices.data() + starts[v];
+    weight_t* weights = values.data() + starts[v];
+    std::size_t d = degrees[v], out = 0;
+    for (std::size_t i = 0, j = first; i < d; ++i) {
+      while (j < last && batch[j].other < list[i])
+        ++j;
+      if (j < last && batch[j].other == list[i])
+        continue;
+      list[out] = list[i];
+      weights[out++] = weights[i];
+    }
+  }
+
+  /// Rebalances windows around the overflowing lists (see the overview).
+  void rebalance(std::vector<vertex_t> const& overflows) {
+    const std::size_t n = degrees.size();
+    std::size_t height = 1;
+    while ((std::size_t(1) << height) < n)
+      ++height;
+
+    using window_t = std::pair<std::size_t, std::size_t>;
+    std::vector<window_t> windows(overflows.size());
+    bool global = overflows.size() * 64 > n;
+    // Overflows are sorted: each chunk skips the vertices its last window
+    // covers, which bounds the search when many lists overflow side by side.
+    util::parallel::for_each_chunk(
+        std::size_t(0), global ? std::size_t(0) : overflows.size(),
+        [&](std::size_t first, std::size_t last) {
+          window_t covered = {0, 0};
+          for (std::size_t i = first; i < last; ++i) {
+            std::size_t v = overflows[i];
+            if (v < covered.second) {
+              windows[i] = covered;
+              continue;
+            }
+            std::size_t lo = v, hi = v + 1;
+            double weight = double(targets[v]) + 1;
+            for (std::size_t level = 1;; ++level) {
+              std::size_t width = std::size_t(1) << level;
+              std::size_t next_lo = v & ~(width - 1);
+              std::size_t next_hi = std::min(next_lo + width, n);
+              for (std::size_t x = next_lo; x < lo; ++x)
+                weight += double(targets[x]) + 1;
+              for (std::size_t x = hi; x < next_hi; ++x)
+                weight += double(targets[x]) + 1;
+              lo = next_lo;
+              hi = next_hi;
+              if ((hi - lo) * 8 >= n) {
+                __atomic_store_n(&global, true, __ATOMIC_RELAXED);
+                return;
+              }
+              double slots = double(starts[hi] - starts[lo]);
+              double threshold = 1 - 0.25 * double(level) / double(height);
+              if (weight <= threshold * slots)
+                break;
+            }
+            windows[i] = covered = {lo, hi};
+          }
+        },
+        std::size_t(64));
+
+    if (global) {
+      relayout();
+      return;
+    }
+
+    // Aligned windows are nested or disjoint: keep the outermost ones.
+    std::sort(windows.begin(), windows.end(),
+              [](window_t const& a, window_t const& b) {
+                return a.first != b.first ? a.first < b.first
+                                          : a.second > b.second;
+              });
+    std::size_t kept = 0;
+    for (auto const& w : windows)
+      if (kept == 0 || w.first >= windows[kept - 1].second)
+        windows[kept++] = w;
+    windows.resize(kept);
+
+    util::parallel::for_each(
+        std::size_t(0), windows.size(),
+        [&](std::size_t i) {
+          auto [lo, hi] = windows[i];
+          std::vector<vertex_t> list;
+          std::vector<weight_t> weights;
+          double total = 0;
+          for (std::size_t x = lo; x < hi; ++x) {
+            list.insert(list.end(), indices.begin() + starts[x],
+                        indices.begin() + starts[x] + degrees[x]);
+            weights.insert(weights.end(), values.begin() + starts[x],
+                           values.begin() + starts[x] + degrees[x]);
+            total += double(targets[x]) + 1;
+          }
+
+          // The boundaries `starts[lo]` and `starts[hi]` do not move, and
+          // neighbouring windows share them: only the starts inside the
+          // window are written.
+          edge_t base = starts[lo];
+          double ratio = double(starts[hi] - base) / total;
+          double weight = double(targets[lo]) + 1;
+          for (std::size_t x = lo + 1; x < hi; ++x) {
+            starts[x] = base + edge_t(weight * ratio);
+            weight += double(targets[x]) + 1;
+          }
+          std::size_t from = 0;
+          for (std::size_t x = lo; x < hi; ++x) {
+            std::copy_n(list.begin() + from, degrees[x],
+                        indices.begin() + starts[x]);
+            std::copy_n(weights.begin() + from, degrees[x],
+                        values.begin() + starts[x]);
+            from += degrees[x];
+          }
+        },
+        std::size_t(1));
+  }
+
+  /// Lays out every list again with `2 * (target + 1)` slots.
+  void relayout() {
+    const std::size_t n = degrees.size();
+    std::vector<edge_t> next_starts(n + 1);
+    next_starts[n] = util::parallel::transform_exclusive_scan(
+        n, [&](std::size_t v) { return edge_t(2 * (targets[v] + 1)); },
+        next_starts.data());
+
+    std::vector<vertex_t> next_indices(next_starts[n]);
+    std::vector<weight_t> next_values(next_starts[n]);
+    util::parallel::for_each(
+        std::size_t(0), n,
+        [&](std::size_t v) {
+          std::copy_n(indices.begin() + starts[v], degrees[v],
+                      next_indices.begin() + next_starts[v]);
+          std::copy_n(values.begin() + starts[v], degrees[v],
+                      next_values.begin() + next_starts[v]);
+        },
+        std::size_t(1) << 10);
+
+    starts.swap(next_starts);
+    indices.swap(next_indices);
+    values.swap(next_values);
+  }
+
+  std::vector<edge_t> starts;
+  std::vector<edge_t> degrees;
+  /// Degrees after the batch being applied (equal to `degrees` otherwise).
+  std::vector<edge_t> targets;
+  std::vector<vertex_t> indices;
+  std::vector<weight_t> values;
+  edge_t edges;
+};
+
+}  // namespace detail
+
+/**
+ * @brief Host graph that takes batches of edge insertions and deletions.
+ *
+ * @par Overview
+ * graph_t's CSR view costs O(m + n) per inserted or deleted edge. This graph
+ * keeps its neighbor lists sorted in one CSR-like array with free slots after
+ * every list (see detail::slotted_lists_t), so a batch of `b` updates costs
+ * a parallel sort of the batch and O(b + d) per touched list of degree `d`,
+ * plus an occasional rebalance of the slots. The lists provide the neighbor
+ * interface of graph_csr_t and of the host engines (see
+ * host::csr_adjacency_t), so host::bfs, host::pr, etc. run on `out()` and
+ * `in()` directly, and `snapshot()` copies them into a static CSR.
+ *
+ * A symmetric graph stores every edge both ways (inserting or deleting
+ * `u -> v` also inserts or deletes `v -> u`); a directed graph also keeps its
+ * in-edges. Edge positions (e.g. `get_starting_edge()`) are only valid until
+ * the next update.
+ *
+ * @tparam vertex_t vertex type.
+ * @tparam edge_t edge type.
+ * @tparam weight_t weight type.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+class dynamic_graph_t {
+  using lists_t = detail::slotted_lists_t<vertex_t, edge_t, weight_t>;
+  using entry_t = detail::entry_t<vertex_t, weight_t>;
+
+ public:
+  using vertex_type = vertex_t;
+  using edge_type = edge_t;
+  using weight_type = weight_t;
+  using update_type = update_t<vertex_t, weight_t>;
+  using adjacency_type = slotted_adjacency_t<vertex_t, edge_t, weight_t>;
+
+  /**
+   * @brief Empty graph of `n` vertices.
+   */
+  explicit dynamic_graph_t(vertex_t n = 0, bool symmetric = false)
+      : out_lists(n), in_lists(symmetric ? 0 : n), symmetric(symmetric) {}
+
+  /**
+   * @brief Graph of the edges of a host CSR.
+   *
+   * @param csr input graph (square).
+   * @param symmetric if true, every edge is also inserted in reverse.
+   */
+  template <typename csr_t>
+  explicit dynamic_graph_t(csr_t const& csr, bool symmetric = false)
+      : dynamic_graph_t(vertex_t(csr.number_of_rows), symmetric) {
+    std::vector<update_type> batch(csr.number_of_nonzeros);
+    util::parallel::for_each(
+        std::size_t(0), std::size_t(csr.number_of_rows),
+        [&](std::size_t u) {
+          for (auto e = csr.row_offsets[u]; e < csr.row_offsets[u + 1]; ++e)
+            batch[e] = {vertex_t(u), csr.column_indices[e],
+                        csr.nonzero_values[e]};
+        },
+        std::size_t(1) << 10);
+    insert(batch);
+  }
+
+  vertex_t get_number_of_vertices() const { return out_lists.size(); }
+
+  /// Number of stored edges (both directions of a symmetric edge count).
+  edge_t get_number_of_edges() const { return out_lists.number_of_edges(); }
+
+  bool is_symmetric() const { return symmetric; }
+
+  /// Out-neighbor lists.
+  adjacency_type out() const { return out_lists.view(); }
+
+  /// In-neighbor lists (the out-neighbor lists if the graph is symmetric).
+  adjacency_type in() const {
+    return symmetric ? out_lists.view() : in_lists.view();
+  }
+
+  edge_t get_number_of_neighbors(vertex_t v) const {
+    return out().get_number_of_neighbors(v);
+  }
+
+  edge_t get_starting_edge(vertex_t v) const {
+    return out().get_starting_edge(v);
+  }
+
+  vertex_t get_destination_vertex(edge_t e) const {
+    return out().indices[e];
+  }
+
+  weight_t get_edge_weight(edge_t e) const { return out().get_edge_weight(e); }
+
+  /**
+   * @brief Position of the edge `source -> destination`, or
+   * `gunrock::numeric_limits<edge_t>::invalid()` if there is none.
+   */
+  edge_t get_edge(vertex_t source, vertex_t destination) const {
+    auto view = out();
+    vertex_t const* first = view.indices + view.starts[source];
+    vertex_t const* last = first + view.degrees[source];
+    vertex_t const* it = std::lower_bound(first, last, destination);
+    return (it != last && *it == destination)
+               ? edge_t(it - view.indices)
+               : gunrock::numeric_limits<edge_t>::invalid();
+  }
+
+  template <typename operator_t>
+  void for_each_neighbor(vertex_t v, operator_t op) const {
+    out().for_each_neighbor(v, op);
+  }
+
+  template <typename predicate_t>
+  bool any_neighbor(vertex_t v, predicate_t pred) const {
+    return out().any_neighbor(v, pred);
+  }
+
+  /**
+   * @brief Inserts a batch of edges, in parallel. The batch may be in any
+   * order (a batch sorted by source and destination skips the sort); an edge
+   * that already exists, or repeats in the batch, takes the last weight.
+   *
+   * @return edge_t number of edges added.
+   */
+  edge_t insert(std::vector<update_type> const& batch) {
+    return apply(batch, false);
+  }
+
+  /**
+   * @brief Deletes a batch of edges, in parallel. Edges that do not exist
+   * are ignored.
+   *
+   * @return edge_t number of edges removed.
+   */
+  edge_t erase(std::vector<update_type> const& batch) {
+    return apply(batch, true);
+  }
+
+  /**
+   * @brief Deletes `deletions`, then inserts `insertions` (an edge in both
+   * is present afterwards).
+   */
+  void update(std::vector<update_type> const& insertions,
+              std::vector<update_type> const& deletions) {
+    erase(deletions);
+    insert(insertions);
+  }
+
+  /**
+   * @brief Copies the graph into a static host CSR (rows sorted).
+   */
+  template <typename csr_t>
+  void snapshot(csr_t& csr) const {
+    auto view = out();
+    const std::size_t n = get_number_of_vertices();
+    csr.number_of_rows = n;
+    csr.number_of_columns = n;
+    csr.number_of_nonzeros = get_number_of_edges();
+    csr.row_offsets.resize(n + 1);
+    csr.column_indices.resize(csr.number_of_nonzeros);
+    csr.nonzero_values.resize(csr.number_of_nonzeros);
+
+    auto* offsets = csr.row_offsets.data();
+    auto* indices = csr.column_indices.data();
+    auto* values = csr.nonzero_values.data();
+    offsets[n] = util::parallel::transform_exclusive_scan(
+        n, [&](std::size_t v) { return view.degrees[v]; }, offsets);
+    util::parallel::for_each(
+        std::size_t(0), n,
+        [&](std::size_t v) {
+          std::copy_n(view.indices + view.starts[v], view.degrees[v],
+                      indices + offsets[v]);
+          std::copy_n(view.values + view.starts[v], view.degrees[v],
+                      values + offsets[v]);
+        },
+        std::size_t(1) << 10);
+  }
+
+ private:
+  /// Sorted batch of one direction, with the last of repeated edges.
+  std::vector<entry_t> prepare(std::vector<update_type> const& batch,
+                               bool reverse,
+                               bool both) const {
+    const std::size_t b = batch.size();
+    const vertex_t n = get_number_of_vertices();
+    std::vector<entry_t> entries(both ? 2 * b : b);
+    bool invalid = false;
+    util::parallel::for_each(
+        std::size_t(0), b,
+        [&](std::size_t i) {
+          auto const& x = batch[i];
+          if (x.source < 0 || x.source >= n || x.destination < 0 ||
+              x.destination >= n)
+            __atomic_store_n(&invalid, true, __ATOMIC_RELAXED);
+          entries[i] = reverse ? entry_t{x.destination, x.source, x.weight, i}
+                               : entry_t{x.source, x.destination, x.weight, i};
+          if (both)
+            entries[b + i] = {x.destination, x.source, x.weight, i};
+        },
+        detail::entries_per_chunk);
+    error::throw_if_exception(invalid,
+                              "dynamic_graph_t: update out of range.");
+
+    if (!std::is_sorted(entries.begin(), entries.end()))
+      util::parallel::sort(entries.begin(), entries.end());
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < entries.size(); ++i)
+      if (i + 1 == entries.size() || entries[i].key != entries[i + 1].key ||
+          entries[i].other != entries[i + 1].other)
+        entries[kept++] = entries[i];
+    entries.resize(kept);
+    return entries;
+  }
+
+  edge_t apply(std::vector<update_type> const& batch, bool erase) {
+    edge_t changed = out_lists.apply(prepare(batch, false, symmetric), erase);
+    if (!symmetric)
+      in_lists.apply(prepare(batch, true, false), erase);
+    return changed;
+  }
+
+  lists_t out_lists;
+  /// In-edges of a directed graph (empty if symmetric).
+  lists_t in_lists;
+  bool symmetric;
+};
+
+}  // namespace host
+}  // namespace gunrock
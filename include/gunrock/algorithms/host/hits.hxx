@@ -0,0 +1,137 @@
+/**
+ * @file hits.hxx
+ * @brief Pull-based, multithreaded Hyperlink-Induced Topic Search on the host
+ * (CPU).
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <gunrock/algorithms/host/pr.hxx>
+
+namespace gunrock {
+namespace host {
+namespace hits {
+
+/**
+ * @brief Same meaning as gunrock::hits::param_t, plus a tolerance.
+ */
+struct param_t {
+  /// Upper bound on the number of iterations.
+  unsigned int max_iterations = 50;
+  /// Stop once no score moves by more than `tol` (0: at a fixed point).
+  double tol = 0;
+};
+
+/**
+ * @brief HITS over neighbor lists (see host::csr_adjacency_t for the
+ * interface `out` and `in` provide).
+ *
+ * @par Overview
+ * Same update as gunrock::hits: from the scores of the previous iteration,
+ * the authority of `v` is the sum of the hub scores of its in-neighbors, and
+ * its hub score the sum of the authorities of its out-neighbors; both vectors
+ * are then scaled to unit L2 norm. Both sums are pulls (host::pr's sweep), so
+ * no atomics are needed. Edge weights are ignored, as on the GPU.
+ *
+ * @param n number of vertices.
+ * @param out out-neighbor lists.
+ * @param in in-neighbor lists, e.g. the CSC, or `out` for a symmetric graph.
+ * @param authority output, authority score of each vertex.
+ * @param hub output, hub score of each vertex.
+ * @param param iteration bound and tolerance.
+ * @return float elapsed time in milliseconds.
+ */
+template <typename vertex_t,
+          typename weight_t,
+          typename out_adjacency_t,
+          typename in_adjacency_t>
+float run(vertex_t n,
+          out_adjacency_t const& out,
+          in_adjacency_t const& in,
+          weight_t* authority,
+          weight_t* hub,
+          param_t param = param_t()) {
+  using namespace std::chrono;
+  using lanes_t = std::array<weight_t, 1>;
+  const std::size_t num_vertices = n;
+  if (num_vertices == 0)
+    return 0;
+
+  std::vector<weight_t> authority_last(num_vertices);
+  std::vector<weight_t> hub_last(num_vertices);
+
+  auto t_start = high_resolution_clock::now();
+
+  std::fill_n(authority, num_vertices, weight_t(1));
+  std::fill_n(hub, num_vertices, weight_t(1));
+
+  auto one = [](vertex_t, auto) { return weight_t(1); };
+  auto plus = [](weight_t a, weight_t b) { return a + b; };
+  auto maximum = [](weight_t a, weight_t b) { return std::max(a, b); };
+
+  // Scales `x` to unit L2 norm; returns the largest change from `last`.
+  auto normalize = [&](weight_t* x, weight_t const* last) {
+    weight_t sum = pr::detail::reduce<weight_t>(
+        num_vertices, [&](std::size_t v) { return x[v] * x[v]; }, plus);
+    weight_t scale = sum > 0 ? weight_t(1) / std::sqrt(sum) : weight_t(0);
+    util::parallel::for_each(
+        std::size_t(0), num_vertices, [&](std::size_t v) { x[v] *= scale; },
+        std::size_t(1) << 12);
+    return pr::detail::reduce<weight_t>(
+        num_vertices, [&](std::size_t v) { return std::abs(x[v] - last[v]); },
+        maximum);
+  };
+
+  for (unsigned int iteration = 0; iteration < param.max_iterations;) {
+    std::copy_n(authority, num_vertices, authority_last.data());
+    std::copy_n(hub, num_vertices, hub_last.data());
+
+    pr::detail::pull<1, vertex_t>(
+        num_vertices, in, hub_last.data(), one,
+        [&](std::size_t v, lanes_t const& sum) { authority[v] = sum[0]; });
+    pr::detail::pull<1, vertex_t>(
+        num_vertices, out, authority_last.data(), one,
+        [&](std::size_t v, lanes_t const& sum) { hub[v] = sum[0]; });
+    ++iteration;
+
+    weight_t err = std::max(normalize(authority, authority_last.data()),
+                            normalize(hub, hub_last.data()));
+    if (err <= param.tol)
+      break;
+  }
+
+  auto t_stop = high_resolution_clock::now();
+  return duration<float, std::milli>(t_stop - t_start).count();
+}
+
+/**
+ * @brief HITS on a host graph. Out-edges come from the graph's CSR view, or
+ * from its compressed CSR view if it has no CSR view; in-edges from its CSC
+ * view, or from the out-edges if the graph is symmetric.
+ *
+ * @tparam graph_t graph type, must live in `memory_space_t::host` and contain
+ * a CSR or a compressed CSR view.
+ * @param G input graph.
+ * @param authority output, authority score of each vertex.
+ * @param hub output, hub score of each vertex.
+ * @param param iteration bound and tolerance.
+ * @return float elapsed time in milliseconds.
+ */
+template <typename graph_t>
+float run(graph_t& G,
+          typename graph_t::weight_type* authority,
+          typename graph_t::weight_type* hub,
+          param_t param = param_t()) {
+  return pr::detail::with_adjacency(G, "host::hits", [&](auto const& out,
+                                                         auto const& in) {
+    return run(G.get_number_of_vertices(), out, in, authority, hub, param);
+  });
+}
+
+}  // namespace hits
+}  // namespace host
+}  // namespace gunrock
@@ -0,0 +1,714 @@
+/**
+ * @file incremental.hxx
+ * @brief Incremental BFS, Connected Components and PageRank on the host
+ * (CPU): results of a host::dynamic_graph_t brought up to date after a batch
+ * of edge insertions and deletions, instead of recomputed.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <gunrock/algorithms/host/cc.hxx>
+#include <gunrock/algorithms/host/dynamic_graph.hxx>
+#include <gunrock/algorithms/host/pr.hxx>
+#include <gunrock/error.hxx>
+#include <gunrock/util/parallel.hxx>
+#include <gunrock/util/type_limits.hxx>
+
+namespace gunrock {
+namespace host {
+namespace incremental {
+
+namespace detail {
+
+/// Updates per chunk.
+constexpr std::size_t updates_per_chunk = 256;
+/// Frontier vertices per chunk.
+constexpr std::size_t vertices_per_chunk = 64;
+
+/**
+ * @brief Calls `op(u, v)` for the edge of update `x`, and `op(v, u)` too if
+ * the graph is symmetric.
+ */
+template <typename update_t, typename op_t>
+void for_each_direction(update_t const& x, bool symmetric, op_t op) {
+  op(x.source, x.destination);
+  if (symmetric && x.source != x.destination)
+    op(x.destination, x.source);
+}
+
+/**
+ * @brief Calls `op(w)` for the neighbors of `v` in either direction (the
+ * out-lists of a symmetric graph hold both).
+ */
+template <typename graph_t, typename vertex_t, typename op_t>
+void for_each_undirected_neighbor(graph_t const& G, vertex_t v, op_t op) {
+  using edge_t = typename graph_t::edge_type;
+  G.out().for_each_neighbor(v, [&](vertex_t w, edge_t) { op(w); });
+  if (!G.is_symmetric())
+    G.in().for_each_neighbor(v, [&](vertex_t w, edge_t) { op(w); });
+}
+
+template <typename vertex_t>
+vertex_t load(vertex_t const* x) {
+  return __atomic_load_n(x, __ATOMIC_RELAXED);
+}
+
+template <typename vertex_t>
+void store(vertex_t* x, vertex_t value) {
+  __atomic_store_n(x, value, __ATOMIC_RELAXED);
+}
+
+/// Atomically lowers `*x` to `value`; returns true if this call lowered it.
+template <typename vertex_t>
+bool lower(vertex_t* x, vertex_t value) {
+  vertex_t current = load(x);
+  while (value < current)
+    if (__atomic_compare_exchange_n(x, &current, value, false,
+                                    __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+      return true;
+  return false;
+}
+
+/**
+ * @brief Level-synchronous walk over buckets of vertices: `seeds` are
+ * (level, vertex) pairs; the vertices of each level, from the lowest one, go
+ * through `step(vertex, level, next)` in parallel, and `next` (the vertices
+ * it adds) joins the seeds of the following level.
+ *
+ * @param visited if not `nullptr`, receives every vertex stepped through.
+ */
+template <typename vertex_t, typename step_t>
+void by_level(std::vector<std::pair<vertex_t, vertex_t>>& seeds,
+              step_t step,
+              std::vector<vertex_t>* visited = nullptr) {
+  util::parallel::sort(seeds.begin(), seeds.end());
+  std::vector<vertex_t> frontier, next;
+  std::size_t c = 0;
+  vertex_t level = 0;
+  while (true) {
+    if (frontier.empty()) {
+      if (c == seeds.size())
+        break;
+      level = seeds[c].first;
+    }
+    for (; c < seeds.size() && seeds[c].first == level; ++c)
+      frontier.push_back(seeds[c].second);
+    std::sort(frontier.begin(), frontier.end());
+    frontier.erase(std::unique(frontier.begin(), frontier.end()),
+                   frontier.end());
+    if (visited)
+      visited->insert(visited->end(), frontier.begin(), frontier.end());
+
+    util::parallel::collect<vertex_t>(
+        std::size_t(0), frontier.size(),
+        [&](std::size_t first, std::size_t last,
+            std::vector<vertex_t>& local) {
+          for (std::size_t i = first; i < last; ++i)
+            step(frontier[i], level, local);
+        },
+        [&](std::size_t total) {
+          next.resize(total);
+          return next.data();
+        },
+        vertices_per_chunk);
+    std::swap(frontier, next);
+    ++level;
+  }
+}
+
+}  // namespace detail
+
+namespace bfs {
+
+/**
+ * @brief Brings BFS distances from `single_source` up to date after
+ * `G.update(insertions, deletions)`.
+ *
+ * @par Overview
+ * Deletions can only lengthen paths, insertions only shorten them. A deleted
+ * tree edge `u -> v` (`d[v] == d[u] + 1`) invalidates `v` unless another
+ * in-neighbor of `v` sits at `d[v] - 1`; invalidation then spreads down the
+ * levels, in increasing order, to the out-neighbors one level deeper that
+ * lose their last valid parent, and invalidated vertices become unreached.
+ * Every vertex left whose distance exceeds an in-neighbor's plus one (an
+ * invalidated vertex next to a valid one, or the head of an inserted edge)
+ * then seeds a bucketed, level-synchronous relaxation that lowers distances
+ * along out-edges. Only the vertices whose distance changes, and their
+ * neighbors, are visited.
+ *
+ * @tparam graph_t host::dynamic_graph_t.
+ * @param G graph, after the batch.
+ * @param single_source source vertex.
+ * @param distances in: distances before the batch (e.g. from host::bfs::run
+ * or a previous update); out: distances after it
+ * (`std::numeric_limits<vertex_t>::max()` if unreachable).
+ * @param insertions edges inserted by the batch.
+ * @param deletions edges deleted by the batch.
+ * @return float elapsed time in milliseconds.
+ */
+template <typename graph_t>
+float update(graph_t const& G,
+             typename graph_t::vertex_type single_source,
+             typename graph_t::vertex_type* distances,
+             std::vector<typename graph_t::update_type> const& insertions,
+             std::vector<typename graph_t::update_type> const& deletions) {
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t = typename graph_t::edge_type;
+  using seed_t = std::pair<vertex_t, vertex_t>;
+  using namespace std::chrono;
+  using detail::load;
+  constexpr vertex_t unreached = std::numeric_limits<vertex_t>::max();
+  auto t_start = high_resolution_clock::now();
+
+  auto out = G.out();
+  auto in = G.in();
+  const bool symmetric = G.is_symmetric();
+
+  // Heads of deleted tree edges.
+  std::vector<seed_t> suspects;
+  util::parallel::collect<seed_t>(
+      std::size_t(0), deletions.size(),
+      [&](std::size_t first, std::size_t last, std::vector<seed_t>& local) {
+        for (std::size_t i = first; i < last; ++i)
+          detail::for_each_direction(
+              deletions[i], symmetric, [&](vertex_t u, vertex_t v) {
+                if (v != single_source && distances[u] != unreached &&
+                    distances[v] == distances[u] + 1)
+                  local.push_back({distances[v], v});
+              });
+      },
+      [&](std::size_t total) {
+        suspects.resize(total);
+        return suspects.data();
+      },
+      detail::updates_per_chunk);
+
+  // Invalidation, level by level: a vertex with no in-neighbor one level up
+  // becomes unreached, and its children one level down become suspects.
+  std::vector<vertex_t> invalid;
+  detail::by_level(
+      suspects,
+      [&](vertex_t x, vertex_t level, auto& next) {
+        if (load(&distances[x]) != level)
+          return;
+        bool parent = in.any_neighbor(x, [&](vertex_t w, edge_t) {
+          return load(&distances[w]) == level - 1;
+        });
+        if (parent)
+          return;
+        detail::store(&distances[x], unreached);
+        out.for_each_neighbor(x, [&](vertex_t z, edge_t) {
+          if (load(&distances[z]) == level + 1)
+            next.push_back(z);
+        });
+      },
+      &invalid);
+  invalid.erase(std::remove_if(invalid.begin(), invalid.end(),
+                               [&](vertex_t x) {
+                                 return distances[x] != unreached;
+                               }),
+                invalid.end());
+
+  // Seeds: invalidated vertices next to reached ones, and heads of inserted
+  // edges that shorten a path.
+  std::vector<seed_t> seeds;
+  util::parallel::collect<seed_t>(
+      std::size_t(0), invalid.size(),
+      [&](std::size_t first, std::size_t last, std::vector<seed_t>& local) {
+        for (std::size_t i = first; i < last; ++i) {
+          vertex_t x = invalid[i];
+          vertex_t best = unreached;
+          in.for_each_neighbor(x, [&](vertex_t w, edge_t) {
+            vertex_t d = load(&distances[w]);
+            if (d != unreached)
+              best = std::min(best, vertex_t(d + 1));
+          });
+          if (best != unreached && detail::lower(&distances[x], best))
+            local.push_back({best, x});
+        }
+      },
+      [&](std::size_t total) {
+        seeds.resize(total);
+        return seeds.data();
+      },
+      detail::vertices_per_chunk);
+  for (auto const& x : insertions)
+    detail::for_each_direction(x, symmetric, [&](vertex_t u, vertex_t v) {
+      if (distances[u] == unreached)
+        return;
+      vertex_t d = distances[u] + 1;
+      if (detail::lower(&distances[v], d))
+        seeds.push_back({d, v});
+    });
+
+  // Relaxation, level by level.
+  detail::by_level(seeds, [&](vertex_t x, vertex_t level, auto& next) {
+    if (load(&distances[x]) != level)
+      return;
+    out.for_each_neighbor(x, [&](vertex_t z, edge_t) {
+      if (detail::lower(&distances[z], vertex_t(level + 1)))
+        next.push_back(z);
+    });
+  });
+
+  auto t_stop = high_resolution_clock::now();
+  return duration<float, std::milli>(t_stop - t_start).count();
+}
+
+}  // namespace bfs
+
+namespace cc {
+
+/**
+ * @brief Tuning parameters of the incremental connected components.
+ */
+struct param_t {
+  /// Vertices the two sides of a cut spanning tree may reach before the
+  /// search for a replacement edge gives up and the component is recomputed.
+  std::size_t search_budget = std::size_t(1) << 16;
+};
+
+/**
+ * @brief Spanning forest of the graph, one tree per component, as forest
+ * neighbor lists.
+ */
+template <typename vertex_t>
+struct forest_t {
+  std::vector<std::vector<vertex_t>> neighbors;
+
+  void link(vertex_t u, vertex_t v) {
+    neighbors[u].push_back(v);
+    neighbors[v].push_back(u);
+  }
+
+  /// Removes the tree edge `u - v`; returns false if it is not one.
+  bool cut(vertex_t u, vertex_t v) {
+    auto remove = [&](std::vector<vertex_t>& list, vertex_t x) {
+      auto it = std::find(list.begin(), list.end(), x);
+      if (it == list.end())
+        return false;
+      *it = list.back();
+      list.pop_back();
+      return true;
+    };
+    return remove(neighbors[u], v) && remove(neighbors[v], u);
+  }
+};
+
+namespace detail {
+
+/**
+ * @brief Unites, in parallel, the endpoints of the edges `u - w` that
+ * `edges(i, op)` passes to `op(u, w)` for `i` in [0, count); the edges that
+ * join two trees of the union-find forest `labels` join `forest` too.
+ *
+ * @return true if any edge joined two trees.
+ */
+template <typename vertex_t, typename edges_t>
+bool unite(std::size_t count,
+           edges_t edges,
+           vertex_t* labels,
+           forest_t<vertex_t>& forest,
+           std::size_t grain) {
+  using link_t = std::pair<vertex_t, vertex_t>;
+  std::vector<link_t> links;
+  util::parallel::collect<link_t>(
+      std::size_t(0), count,
+      [&](std::size_t first, std::size_t last, std::vector<link_t>& local) {
+        for (std::size_t i = first; i < last; ++i)
+          edges(i, [&](vertex_t u, vertex_t w) {
+            if (host::cc::detail::unite(labels, u, w))
+              local.push_back({u, w});
+          });
+      },
+      [&](std::size_t total) {
+        links.resize(total);
+        return links.data();
+      },
+      grain);
+  for (auto const& [u, w] : links)
+    forest.link(u, w);
+  return !links.empty();
+}
+
+}  // namespace detail
+
+/**
+ * @brief Connected components (as host::cc::run) and a spanning forest, the
+ * starting point of `update()`.
+ *
+ * @tparam graph_t host::dynamic_graph_t.
+ * @param G input graph, taken as undirected.
+ * @param labels output, smallest vertex of each vertex's component.
+ * @param forest output, spanning forest.
+ * @return float elapsed time in milliseconds.
+ */
+template <typename graph_t>
+float run(graph_t const& G,
+          typename graph_t::vertex_type* labels,
+          forest_t<typename graph_t::vertex_type>& forest) {
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t = typename graph_t::edge_type;
+  using namespace std::chrono;
+  auto t_start = high_resolution_clock::now();
+
+  const std::size_t n = G.get_number_of_vertices();
+  auto out = G.out();
+  std::iota(labels, labels + n, vertex_t(0));
+  forest.neighbors.assign(n, {});
+  detail::unite(
+      n,
+      [&](std::size_t u, auto&& op) {
+        out.for_each_neighbor(vertex_t(u),
+                              [&](vertex_t w, edge_t) { op(vertex_t(u), w); });
+      },
+      labels, forest, host::cc::detail::vertices_per_chunk);
+  host::cc::detail::compress(n, labels);
+
+  auto t_stop = high_resolution_clock::now();
+  return duration<float, std::milli>(t_stop - t_start).count();
+}
+
+/**
+ * @brief Brings connected-component labels and their spanning forest (see
+ * `run()`) up to date after `G.update(insertions, deletions)`.
+ *
+ * @par Overview
+ * The labels are a union-find forest whose roots are the smallest vertices
+ * of their components, alongside a spanning forest of the graph. Deleting an
+ * edge outside the spanning forest changes nothing. Deleting a tree edge
+ * cuts its tree in two: both sides grow breadth-first over the tree, one
+ * vertex at a time, until the smaller one is complete, and the edges of that
+ * side are scanned for a replacement that reconnects it to the rest of its
+ * component. Without one, the side becomes a component of its own. A search
+ * that reaches `search_budget` vertices gives up, and the component is
+ * recomputed (its vertices become singletons again and unite along their
+ * edges). Inserted edges then unite their endpoints' trees (in parallel,
+ * lock-free), the edges that join two trees join the spanning forest, and a
+ * pass flattens the labels. The graph is taken as undirected.
+ *
+ * @tparam graph_t host::dynamic_graph_t.
+ * @param G graph, after the batch.
+ * @param labels in: labels before the batch; out: labels after it.
+ * @param forest in: spanning forest before the batch; out: after it.
+ * @param insertions edges inserted by the batch.
+ * @param deletions edges deleted by the batch.
+ * @param param tuning parameters.
+ * @return float elapsed time in milliseconds.
+ */
+template <typename graph_t>
+float update(graph_t const& G,
+             typename graph_t::vertex_type* labels,
+             forest_t<typename graph_t::vertex_type>& forest,
+             std::vector<typename graph_t::update_type> const& insertions,
+             std::vector<typename graph_t::update_type> const& deletions,
+             param_t param = param_t()) {
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t = typename graph_t::edge_type;
+  using namespace std::chrono;
+  const edge_t missing = gunrock::numeric_limits<edge_t>::invalid();
+  auto t_start = high_resolution_clock::now();
+
+  const std::size_t n = G.get_number_of_vertices();
+  std::vector<vertex_t> broken;
+  std::vector<vertex_t> sides[2];
+  std::unordered_set<vertex_t> seen[2];
+  for (auto const& x : deletions) {
+    vertex_t u = x.source, v = x.destination;
+    if (u == v || G.get_edge(u, v) != missing ||
+        G.get_edge(v, u) != missing || !forest.cut(u, v))
+      continue;
+
+    // Grow both sides of the cut tree until one is complete.
+    int small = -1;
+    std::size_t heads[2] = {0, 0};
+    for (int s = 0; s < 2; ++s) {
+      sides[s].assign(1, s ? v : u);
+      seen[s] = {s ? v : u};
+    }
+    while (small < 0 && seen[0].size() + seen[1].size() <= param.search_budget)
+      for (int s = 0; s < 2 && small < 0; ++s) {
+        if (heads[s] == sides[s].size()) {
+          small = s;
+          break;
+        }
+        for (vertex_t y : forest.neighbors[sides[s][heads[s]++]])
+          if (seen[s].insert(y).second)
+            sides[s].push_back(y);
+      }
+    if (small < 0) {
+      broken.push_back(labels[u]);
+      continue;
+    }
+
+    // A replacement edge from the small side to the rest of the component.
+    auto const& side = sides[small];
+    auto const& inside = seen[small];
+    bool replaced = false;
+    for (std::size_t i = 0; i < side.size() && !replaced; ++i)
+      incremental::detail::for_each_undirected_neighbor(
+          G, side[i], [&](vertex_t y) {
+            if (!replaced && labels[y] == labels[side[i]] && !inside.count(y)) {
+              forest.link(side[i], y);
+              replaced = true;
+            }
+          });
+    if (replaced)
+      continue;
+
+    // The small side splits off. If it holds the component's label, the
+    // rest needs a new one: recompute the component.
+    vertex_t label = labels[u];
+    if (inside.count(label)) {
+      broken.push_back(label);
+      continue;
+    }
+    vertex_t smallest = *std::min_element(side.begin(), side.end());
+    for (vertex_t y : side)
+      labels[y] = smallest;
+  }
+
+  bool changed = !broken.empty();
+  if (changed) {
+    std::vector<char> split(n, 0);
+    for (vertex_t c : broken)
+      split[c] = 1;
+    std::vector<vertex_t> members;
+    util::parallel::collect<vertex_t>(
+        std::size_t(0), n,
+        [&](std::size_t first, std::size_t last,
+            std::vector<vertex_t>& local) {
+          for (std::size_t v = first; v < last; ++v)
+            if (split[labels[v]])
+              local.push_back(vertex_t(v));
+        },
+        [&](std::size_t total) {
+          members.resize(total);
+          return members.data();
+        },
+        std::size_t(1) << 12);
+    // Labels of split components point at their root, which is a member
+    // too: reset all members before any union.
+    util::parallel::for_each(
+        std::size_t(0), members.size(),
+        [&](std::size_t i) {
+          labels[members[i]] = members[i];
+          forest.neighbors[members[i]].clear();
+        },
+        std::size_t(1) << 12);
+    detail::unite(
+        members.size(),
+        [&](std::size_t i, auto&& op) {
+          incremental::detail::for_each_undirected_neighbor(
+              G, members[i], [&](vertex_t w) { op(members[i], w); });
+        },
+        labels, forest, host::cc::detail::vertices_per_chunk);
+  }
+
+  changed = detail::unite(
+                insertions.size(),
+                [&](std::size_t i, auto&& op) {
+                  op(insertions[i].source, insertions[i].destination);
+                },
+                labels, forest, incremental::detail::updates_per_chunk) ||
+            changed;
+  if (changed)
+    host::cc::detail::compress(n, labels);
+
+  auto t_stop = high_resolution_clock::now();
+  return duration<float, std::milli>(t_stop - t_start).count();
+}
+
+}  // namespace cc
+
+namespace pr {
+
+/**
+ * @brief Brings PageRank up to date after `G.update(insertions, deletions)`.
+ *
+ * @par Overview
+ * Same iteration and stopping test as host::pr::run, started from the
+ * previous ranks, with a dynamic frontier first. The batch changes the
+ * in-sums of the heads of its edges and of the out-neighbors of its sources
+ * (whose out-weight changed): these vertices form the frontier. Each frontier
+ * step pulls new ranks for the frontier vertices only (from the previous
+ * step's ranks, so the result does not depend on the number of threads), and
+ * the out-neighbors of the vertices whose rank moved by `tol` or more form
+ * the next frontier. Once the frontier empties (or grows past a sixteenth of
+ * the vertices, or the batch touches a sixteenth of the edges: the frontier
+ * would cost as much as the sweeps), full iterations run until no rank moves
+ * by `tol` or more, which usually takes one or two: after a small batch, the
+ * update touches the neighborhood of the batch plus a sweep or two instead of
+ * the whole convergence.
+ *
+ * @tparam graph_t host::dynamic_graph_t.
+ * @param G graph, after the batch.
+ * @param p in: ranks before the batch; out: ranks after it.
+ * @param insertions edges inserted by the batch.
+ * @param deletions edges deleted by the batch.
+ * @param param damping factor and convergence parameters.
+ * @return float elapsed time in milliseconds.
+ */
+template <typename graph_t>
+float update(graph_t const& G,
+             typename graph_t::weight_type* p,
+             std::vector<typename graph_t::update_type> const& insertions,
+             std::vector<typename graph_t::update_type> const& deletions,
+             host::pr::param_t<typename graph_t::weight_type> param =
+                 host::pr::param_t<typename graph_t::weight_type>()) {
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t = typename graph_t::edge_type;
+  using weight_t = typename graph_t::weight_type;
+  using namespace std::chrono;
+  namespace power = host::pr::detail;
+  auto t_start = high_resolution_clock::now();
+
+  const vertex_t n = G.get_number_of_vertices();
+  const std::size_t num_vertices = n;
+  if (num_vertices == 0)
+    return 0;
+
+  auto out = G.out();
+  auto in = G.in();
+  const weight_t alpha = param.alpha;
+  std::vector<weight_t> iweights(num_vertices);
+  power::inverse_weights<vertex_t>(num_vertices, out, alpha, iweights.data());
+
+  // Sets `found` to the vertices `visit(i, add)` passes to `add(v)` for `i`
+  // in [0, count), once each, sorted (so the order of the frontier does not
+  // depend on the number of threads).
+  std::vector<char> queued(num_vertices, 0);
+  auto gather = [&](std::size_t count, auto visit,
+                    std::vector<vertex_t>& found) {
+    util::parallel::collect<vertex_t>(
+        std::size_t(0), count,
+        [&](std::size_t first, std::size_t last,
+            std::vector<vertex_t>& local) {
+          for (std::size_t i = first; i < last; ++i)
+            visit(i, [&](vertex_t v) {
+              if (!__atomic_exchange_n(&queued[v], 1, __ATOMIC_RELAXED))
+                local.push_back(v);
+            });
+        },
+        [&](std::size_t total) {
+          found.resize(total);
+          return found.data();
+        },
+        detail::vertices_per_chunk);
+    for (vertex_t v : found)
+      queued[v] = 0;
+    util::parallel::sort(found.begin(), found.end());
+  };
+
+  // The heads of the batch, then the out-neighbors of its (distinct)
+  // sources.
+  std::vector<vertex_t> frontier, next, sources;
+  auto visit_batch = [&](std::size_t i, auto op) {
+    auto const& x = i < insertions.size()
+                        ? insertions[i]
+                        : deletions[i - insertions.size()];
+    detail::for_each_direction(x, G.is_symmetric(), op);
+  };
+  const std::size_t batch_size = insertions.size() + deletions.size();
+  gather(
+      batch_size,
+      [&](std::size_t i, auto&& add) {
+        visit_batch(i, [&](vertex_t u, vertex_t) { add(u); });
+      },
+      sources);
+  std::size_t volume = 0;
+  for (vertex_t u : sources)
+    volume += out.get_number_of_neighbors(u);
+  if ((batch_size + volume) * 16 < std::size_t(G.get_number_of_edges())) {
+    gather(
+        batch_size,
+        [&](std::size_t i, auto&& add) {
+          visit_batch(i, [&](vertex_t, vertex_t v) { add(v); });
+        },
+        frontier);
+    gather(
+        sources.size(),
+        [&](std::size_t i, auto&& add) {
+          out.for_each_neighbor(sources[i],
+                                [&](vertex_t w, edge_t) { add(w); });
+        },
+        next);
+    std::size_t heads = frontier.size();
+    frontier.insert(frontier.end(), next.begin(), next.end());
+    std::inplace_merge(frontier.begin(), frontier.begin() + heads,
+                       frontier.end());
+    frontier.erase(std::unique(frontier.begin(), frontier.end()),
+                   frontier.end());
+  }
+
+  // Teleport mass, updated as dangling vertices move.
+  weight_t dangling = power::reduce<weight_t>(
+      num_vertices,
+      [&](std::size_t v) { return iweights[v] == 0 ? alpha * p[v] : 0; },
+      [](weight_t a, weight_t b) { return a + b; });
+
+  std::vector<weight_t> ranks;
+  unsigned int iteration = 0;
+  for (; !frontier.empty() && frontier.size() * 16 < num_vertices &&
+         iteration < param.total_iterations;
+       ++iteration) {
+    weight_t mass = 1 - alpha + dangling;
+    ranks.resize(frontier.size());
+    util::parallel::for_each(
+        std::size_t(0), frontier.size(),
+        [&](std::size_t i) {
+          weight_t sum = 0;
+          in.for_each_neighbor(frontier[i], [&](vertex_t u, edge_t e) {
+            sum += iweights[u] * in.get_edge_weight(e) * p[u];
+          });
+          ranks[i] = mass / weight_t(n) + sum;
+        },
+        detail::vertices_per_chunk);
+    for (std::size_t i = 0; i < frontier.size(); ++i)
+      if (iweights[frontier[i]] == 0)
+        dangling += alpha * (ranks[i] - p[frontier[i]]);
+    gather(
+        frontier.size(),
+        [&](std::size_t i, auto&& add) {
+          if (std::abs(ranks[i] - p[frontier[i]]) >= param.tol)
+            out.for_each_neighbor(frontier[i],
+                                  [&](vertex_t w, edge_t) { add(w); });
+        },
+        next);
+    for (std::size_t i = 0; i < frontier.size(); ++i)
+      p[frontier[i]] = ranks[i];
+    std::swap(frontier, next);
+  }
+
+  std::vector<weight_t> plast(num_vertices);
+  weight_t* current = p;
+  weight_t* previous = plast.data();
+  power::iterate<1, vertex_t>(
+      num_vertices, in, iweights.data(),
+      [n](vertex_t, std::size_t, weight_t mass) { return mass / weight_t(n); },
+      param, current, previous);
+  if (current != p)
+    std::copy_n(current, num_vertices, p);
+
+  auto t_stop = high_resolution_clock::now();
+  return duration<float, std::milli>(t_stop - t_start).count();
+}
+
+}  // namespace pr
+
+}  // namespace incremental
+}  // namespace host
+}  // namespace gunrock
@@ -0,0 +1,386 @@
+/**
+ * @file kcore.hxx
+ * @brief Vertex k-core decomposition on the host (CPU): linear-time bucket
+ * algorithm and parallel level-synchronous peeling.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <gunrock/algorithms/host/adjacency.hxx>
+#include <gunrock/graph/graph.hxx>
+#include <gunrock/util/parallel.hxx>
+
+namespace gunrock {
+namespace host {
+namespace kcore {
+
+enum class algorithm_t {
+  /// Batagelj-Zaversnik: vertices bucketed by degree, O(n + m), serial.
+  bucket,
+  /// All the vertices of the current level peeled concurrently, with atomic
+  /// degree decrements.
+  peeling
+};
+
+struct param_t {
+  algorithm_t algorithm = algorithm_t::peeling;
+};
+
+/**
+ * @brief Shape of the decomposition, filled by `run()` on request.
+ */
+template <typename vertex_t>
+struct summary_t {
+  /// Largest core number.
+  int max_core = 0;
+  /// Number of vertices of each core number (size `max_core + 1`).
+  std::vector<vertex_t> histogram;
+};
+
+namespace detail {
+
+/// Vertices per chunk of the peeling loops.
+constexpr std::size_t vertices_per_chunk = 1024;
+
+/**
+ * @brief Batagelj-Zaversnik. The vertices are kept sorted by current degree
+ * in `order`, `bins[d]` being the start of degree `d`; the lowest-degree
+ * vertex is removed next, and each remaining neighbor of higher degree moves
+ * down one bin by swapping with the first vertex of its bin.
+ */
+template <typename vertex_t, typename adjacency_t, typename degree_t>
+void bucket(vertex_t n,
+            adjacency_t const& G,
+            std::vector<degree_t>& degrees,
+            int* k_cores) {
+  const std::size_t num_vertices = n;
+  degree_t max_degree = 0;
+  for (auto d : degrees)
+    max_degree = std::max(max_degree, d);
+
+  std::vector<vertex_t> bins(std::size_t(max_degree) + 1, 0);
+  for (auto d : degrees)
+    ++bins[d];
+  vertex_t start = 0;
+  for (auto& bin : bins) {
+    vertex_t count = bin;
+    bin = start;
+    start += count;
+  }
+
+  std::vector<vertex_t> order(num_vertices);
+  std::vector<vertex_t> positions(num_vertices);
+  for (std::size_t v = 0; v < num_vertices; ++v) {
+    positions[v] = bins[degrees[v]]++;
+    order[positions[v]] = vertex_t(v);
+  }
+  for (std::size_t d = bins.size() - 1; d > 0; --d)
+    bins[d] = bins[d - 1];
+  bins[0] = 0;
+
+  for (std::size_t i = 0; i < num_vertices; ++i) {
+    vertex_t v = order[i];
+    degree_t level = degrees[v];
+    k_cores[v] = int(level);
+    G.for_each_neighbor(v, [&](vertex_t u, auto) {
+      degree_t du = degrees[u];
+      if (du <= level)
+        return;
+      vertex_t pu = positions[u];
+      vertex_t pw = bins[du];
+      vertex_t w = order[pw];
+      if (u != w) {
+        order[pu] = w;
+        positions[w] = pu;
+        order[pw] = u;
+        positions[u] = pw;
+      }
+      ++bins[du];
+      degrees[u] = du - 1;
+    });
+  }
+}
+
+/**
+ * @brief Level-synchronous peeling. Level `k` is the smallest degree left;
+ * its vertices are removed together, each decrementing the degrees of its
+ * neighbors still above `k`. A neighbor whose degree falls to `k` (the
+ * decrement that sees `k + 1`) joins the next round of the same level.
+ *
+ * Removed vertices are never decremented again (their degree is at most
+ * their level), so a vertex is removed exactly when its degree is below
+ * `floor`, one past the last finished level, and no flag is needed. One scan
+ * of the remaining vertices per level picks the level's vertices, counts the
+ * live ones and finds the smallest live degree above the level (the next
+ * level when this one is empty); the list is compacted once half of it is
+ * dead. Rounds too small to share are drained on the calling thread, as in
+ * a queue.
+ */
+template <typename vertex_t, typename adjacency_t, typename degree_t>
+void peel(vertex_t n,
+          adjacency_t const& G,
+          std::vector<degree_t>& degrees,
+          int* k_cores) {
+  const std::size_t num_vertices = n;
+  constexpr std::size_t grain = vertices_per_chunk;
+  std::vector<vertex_t> remaining(num_vertices), frontier, next;
+  util::parallel::for_each(std::size_t(0), num_vertices,
+                           [&](std::size_t v) { remaining[v] = vertex_t(v); });
+
+  degree_t floor = 0;
+  degree_t level = 0;
+
+  // Removes `v` at `level`, calling `push(u)` on the neighbors it brings down
+  // to the level. Decrements are atomic when `shared` (other threads may be
+  // removing neighbors of the same vertices).
+  auto remove = [&](auto shared, vertex_t v, auto&& push) {
+    k_cores[v] = int(level);
+    G.for_each_neighbor(v, [&](vertex_t u, auto) {
+      if constexpr (decltype(shared)::value) {
+        if (__atomic_load_n(&degrees[u], __ATOMIC_RELAXED) > level &&
+            __atomic_fetch_sub(&degrees[u], degree_t(1), __ATOMIC_RELAXED) ==
+                level + 1)
+          push(u);
+      } else {
+        // Branch-free: whether `u` is above the level is unpredictable.
+        degree_t d = degrees[u];
+        degrees[u] = d - degree_t(d > level);
+        if (d == level + 1)
+          push(u);
+      }
+    });
+  };
+
+  while (!remaining.empty()) {
+    std::size_t live = 0;
+    degree_t next_level = std::numeric_limits<degree_t>::max();
+    util::parallel::collect<vertex_t>(
+        std::size_t(0), remaining.size(),
+        [&](std::size_t first, std::size_t last,
+            std::vector<vertex_t>& local) {
+          std::size_t count = 0;
+          degree_t low = std::numeric_limits<degree_t>::max();
+          for (std::size_t i = first; i < last; ++i) {
+            degree_t d = degrees[remaining[i]];
+            if (d < floor)
+              continue;
+            ++count;
+            if (d <= level)
+              local.push_back(remaining[i]);
+            else
+              low = std::min(low, d);
+          }
+          __atomic_fetch_add(&live, count, __ATOMIC_RELAXED);
+          degree_t current = __atomic_load_n(&next_level, __ATOMIC_RELAXED);
+          while (low < current &&
+                 !__atomic_compare_exchange_n(&next_level, &current, low, true,
+                                              __ATOMIC_RELAXED,
+                                              __ATOMIC_RELAXED)) {
+          }
+        },
+        [&](std::size_t size) {
+          frontier.resize(size);
+          return frontier.data();
+        },
+        grain);
+
+    if (live == 0)
+      break;
+    if (frontier.empty()) {
+      level = next_level;
+      continue;
+    }
+
+    std::size_t removed = 0;
+    while (!frontier.empty()) {
+      if (frontier.size() < grain) {
+        // Small round: drain it as a queue while it stays small.
+        std::size_t head = 0;
+        while (head < frontier.size() && frontier.size() - head < grain)
+          remove(std::false_type(), frontier[head++],
+                 [&](vertex_t u) { frontier.push_back(u); });
+        removed += head;
+        frontier.erase(frontier.begin(), frontier.begin() + head);
+        continue;
+      }
+
+      removed += frontier.size();
+      bool shared = util::parallel::number_of_threads() > 1;
+      util::parallel::collect<vertex_t>(
+          std::size_t(0), frontier.size(),
+          [&](std::size_t first, std::size_t last,
+              std::vector<vertex_t>& local) {
+            auto push = [&](vertex_t u) { local.push_back(u); };
+            for (std::size_t i = first; i < last; ++i) {
+              if (shared)
+                remove(std::true_type(), frontier[i], push);
+              else
+                remove(std::false_type(), frontier[i], push);
+            }
+          },
+          [&](std::size_t size) {
+            next.resize(size);
+            return next.data();
+          },
+          grain);
+      // Back in vertex order: neighbor lists are then read in address order,
+      // which is worth much more than the sort on large rounds.
+      util::parallel::sort(next.begin(), next.end());
+      frontier.swap(next);
+    }
+
+    floor = level + 1;
+    level = floor;
+    if (2 * (live - removed) < remaining.size()) {
+      util::parallel::collect<vertex_t>(
+          std::size_t(0), remaining.size(),
+          [&](std::size_t first, std::size_t last,
+              std::vector<vertex_t>& local) {
+            for (std::size_t i = first; i < last; ++i)
+              if (degrees[remaining[i]] >= floor)
+                local.push_back(remaining[i]);
+          },
+          [&](std::size_t size) {
+            next.resize(size);
+            return next.data();
+          },
+          grain);
+      remaining.swap(next);
+    }
+  }
+}
+
+}  // namespace detail
+
+/**
+ * @brief Core number of every vertex, over neighbor lists (see
+ * host::csr_adjacency_t for the interface `G` provides).
+ *
+ * @par Overview
+ * The core number of a vertex is the largest `k` such that it belongs to a
+ * subgraph whose vertices all have at least `k` neighbors in it (isolated
+ * vertices: 0). Both algorithms remove vertices in order of their remaining
+ * degree and give the same result as gunrock::kcore and the CPU reference of
+ * the kcore example (on symmetric graphs). The bucket algorithm runs in
+ * `O(n + m)` on one thread; peeling scans the remaining vertices once per
+ * distinct level, but removes each level's vertices in parallel.
+ *
+ * @param n number of vertices.
+ * @param G neighbor lists (the graph should be symmetric).
+ * @param k_cores output, core number of each vertex.
+ * @param summary output, largest core number and number of vertices per core
+ * number. May be `nullptr`.
+ * @param param algorithm choice.
+ * @return float elapsed time in milliseconds (excluding initialization).
+ */
+template <typename vertex_t, typename adjacency_t>
+float run(vertex_t n,
+          adjacency_t const& G,
+          int* k_cores,
+          summary_t<vertex_t>* summary = nullptr,
+          param_t param = param_t()) {
+  using namespace std::chrono;
+  using edge_t = std::decay_t<decltype(G.get_number_of_neighbors(n))>;
+  const std::size_t num_vertices = n;
+
+  std::vector<edge_t> degrees(num_vertices);
+  util::parallel::for_each(std::size_t(0), num_vertices, [&](std::size_t v) {
+    degrees[v] = G.get_number_of_neighbors(vertex_t(v));
+  });
+
+  auto t_start = high_resolution_clock::now();
+
+  if (param.algorithm == algorithm_t::bucket)
+    detail::bucket(n, G, degrees, k_cores);
+  else
+    detail::peel(n, G, degrees, k_cores);
+
+  auto t_stop = high_resolution_clock::now();
+
+  if (summary) {
+    int max_core = 0;
+    for (std::size_t v = 0; v < num_vertices; ++v)
+      max_core = std::max(max_core, k_cores[v]);
+    summary->max_core = max_core;
+    summary->histogram.assign(std::size_t(max_core) + 1, vertex_t(0));
+    for (std::size_t v = 0; v < num_vertices; ++v)
+      ++summary->histogram[k_cores[v]];
+  }
+
+  return duration<float, std::milli>(t_stop - t_start).count();
+}
+
+/**
+ * @brief Core numbers over raw CSR arrays.
+ *
+ * @param n number of vertices.
+ * @param row_offsets CSR row offsets (size `n + 1`).
+ * @param column_indices CSR column indices.
+ * @param k_cores output, core number of each vertex.
+ * @param summary output, largest core number and vertices per core number
+ * (may be `nullptr`).
+ * @param param algorithm choice.
+ * @return float elapsed time in milliseconds.
+ */
+template <typename vertex_t, typename edge_t>
+float run(vertex_t n,
+          edge_t const* row_offsets,
+          vertex_t const* column_indices,
+          int* k_cores,
+          summary_t<vertex_t>* summary = nullptr,
+          param_t param = param_t()) {
+  csr_adjacency_t<vertex_t, edge_t> G{row_offsets, column_indices};
+  return run(n, G, k_cores, summary, param);
+}
+
+/**
+ * @brief Core numbers on a host graph, over its CSR view (or its compressed
+ * CSR view if it has no CSR view).
+ *
+ * @tparam graph_t graph type, must live in `memory_space_t::host` and contain
+ * a CSR or a compressed CSR view.
+ * @param G input graph.
+ * @param k_cores output, core number of each vertex.
+ * @param summary output, largest core number and vertices per core number
+ * (may be `nullptr`).
+ * @param param algorithm choice.
+ * @return float elapsed time in milliseconds.
+ */
+template <typename graph_t>
+float run(graph_t& G,
+          int* k_cores,
+          summary_t<typename graph_t::vertex_type>* summary = nullptr,
+          param_t param = param_t()) {
+  static_assert(graph_t::memory_space_v == memory_space_t::host,
+                "host::kcore requires a graph in host memory.");
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t = typename graph_t::edge_type;
+  using csr_view_t = typename graph_t::graph_csr_view_t;
+  using compressed_view_t = typename graph_t::graph_compressed_csr_view_t;
+
+  if constexpr (std::is_base_of_v<csr_view_t, graph_t>) {
+    auto& csr = static_cast<csr_view_t&>(G);
+    csr_adjacency_t<vertex_t, edge_t> out{csr.get_row_offsets(),
+                                          csr.get_column_indices()};
+    return run(G.get_number_of_vertices(), out, k_cores, summary, param);
+  } else {
+    return run(G.get_number_of_vertices(),
+               static_cast<compressed_view_t const&>(G), k_cores, summary,
+               param);
+  }
+}
+
+}  // namespace kcore
+}  // namespace host
+}  // namespace gunrock
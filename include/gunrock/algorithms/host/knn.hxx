@@ -0,0 +1,204 @@
+/**
+ * @file knn.hxx
+ * @brief k-nearest-neighbor and radius graphs of points on the host (CPU),
+ * built in parallel straight into a CSR from a spatial index.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include <gunrock/algorithms/host/spatial.hxx>
+#include <gunrock/formats/formats.hxx>
+#include <gunrock/util/parallel.hxx>
+
+namespace gunrock {
+namespace host {
+namespace spatial {
+
+namespace detail {
+
+/// Points per chunk of the parallel queries.
+constexpr std::size_t points_per_chunk = 256;
+
+template <typename vertex_t, typename weight_t>
+struct edge_t {
+  vertex_t source;
+  vertex_t destination;
+  weight_t weight;
+};
+
+/**
+ * @brief Edges found by the queries, as an entry stream of
+ * `format::builder::compress()`.
+ */
+template <typename vertex_t, typename weight_t>
+struct edge_list_t {
+  std::vector<edge_t<vertex_t, weight_t>> edges;
+
+  std::size_t size() const { return edges.size(); }
+
+  template <typename emit_t>
+  void operator()(std::size_t first, std::size_t last, emit_t&& emit) const {
+    for (std::size_t e = first; e < last; ++e)
+      emit(edges[e].source, edges[e].destination, edges[e].weight);
+  }
+};
+
+/**
+ * @brief Runs `query(u, scratch, emit)` for every indexed point, in parallel
+ * and in index order (nearby points one after another), and builds the CSR of
+ * the edges `emit(v, squared)` adds to `u`, weighted by their distance under
+ * `metric`.
+ */
+template <typename index_t, typename metric_t, typename csr_t, typename query_t>
+void build(index_t const& index,
+           metric_t const& metric,
+           csr_t& csr,
+           format::build_policy_t policy,
+           query_t query) {
+  using vertex_t =
+      typename std::decay_t<decltype(csr.column_indices)>::value_type;
+  using weight_t =
+      typename std::decay_t<decltype(csr.nonzero_values)>::value_type;
+  using entry_t = edge_t<vertex_t, weight_t>;
+
+  auto const& order = index.order();
+  edge_list_t<vertex_t, weight_t> list;
+  util::parallel::collect<entry_t>(
+      std::size_t(0), order.size(),
+      [&](std::size_t begin, std::size_t end, std::vector<entry_t>& local) {
+        std::vector<neighbor_t> scratch;
+        for (std::size_t p = begin; p < end; ++p) {
+          std::uint32_t u = order[p];
+          query(u, scratch, [&](std::uint32_t v, double d) {
+            local.push_back(
+                {vertex_t(u), vertex_t(v), weight_t(metric.distance(d))});
+          });
+        }
+      },
+      [&](std::size_t total) {
+        list.edges.resize(total);
+        return list.edges.data();
+      },
+      points_per_chunk);
+
+  vertex_t n = vertex_t(index.size());
+  csr.from_stream(n, n, list, policy);
+}
+
+}  // namespace detail
+
+/**
+ * @brief k-nearest-neighbor graph: an edge from every point to each of its
+ * `k` nearest other points (ties broken by ID), weighted by their distance.
+ * Points with missing coordinates have no edges.
+ *
+ * @tparam index_t spatial index (brute_force_t, kd_tree_t or grid_t).
+ * @tparam metric_t metric of the index's positions (euclidean_t or
+ * haversine_t).
+ * @tparam csr_t output CSR (host or device).
+ * @param index spatial index of the points.
+ * @param metric metric the positions were computed with.
+ * @param k neighbors per point.
+ * @param csr output graph, with the column indices of every row sorted.
+ * @param symmetric if true, the graph is undirected: `u - v` if either point
+ * is among the other's `k` nearest.
+ * @return float time elapsed in milliseconds (queries and CSR build).
+ */
+template <typename index_t, typename metric_t, typename csr_t>
+float knn_graph(index_t const& index,
+                metric_t const& metric,
+                std::size_t k,
+                csr_t& csr,
+                bool symmetric = false) {
+  auto t0 = std::chrono::high_resolution_clock::now();
+
+  format::build_policy_t policy;
+  if (symmetric) {
+    policy.symmetrize = true;
+    policy.duplicates = format::duplicate_policy_t::min;
+  }
+  detail::build(index, metric, csr, policy,
+                [&](std::uint32_t u, auto& scratch, auto&& emit) {
+                  index.nearest(index.position(u), k, scratch, u);
+                  for (neighbor_t const& v : scratch)
+                    emit(v.index, v.squared);
+                });
+
+  auto t1 = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration<float, std::milli>(t1 - t0).count();
+}
+
+/**
+ * @brief Radius graph: an edge between every two distinct points at most
+ * `radius` apart (in the units of the metric), weighted by their distance.
+ * The graph is undirected (both directions are present). Points with missing
+ * coordinates have no edges.
+ *
+ * @param index spatial index of the points.
+ * @param metric metric the positions were computed with.
+ * @param radius largest distance of an edge.
+ * @param csr output graph, with the column indices of every row sorted.
+ * @return float time elapsed in milliseconds (queries and CSR build).
+ */
+template <typename index_t, typename metric_t, typename csr_t>
+float radius_graph(index_t const& index,
+                   metric_t const& metric,
+                   double radius,
+                   csr_t& csr) {
+  auto t0 = std::chrono::high_resolution_clock::now();
+
+  double squared = metric.squared(radius);
+  detail::build(index, metric, csr, format::build_policy_t(),
+                [&](std::uint32_t u, auto&, auto&& emit) {
+                  index.within(index.position(u), squared,
+                               [&](std::uint32_t v, double d) {
+                                 if (v != u)
+                                   emit(v, d);
+                               });
+                });
+
+  auto t1 = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration<float, std::milli>(t1 - t0).count();
+}
+
+/**
+ * @brief k-nearest-neighbor graph of `n` points (planar points or
+ * coordinates, see the metrics), through a k-d tree.
+ */
+template <typename point_t, typename metric_t, typename csr_t>
+float knn_graph(point_t const* points,
+                std::size_t n,
+                metric_t const& metric,
+                std::size_t k,
+                csr_t& csr,
+                bool symmetric = false) {
+  kd_tree_t<metric_t::dimensions> tree(positions(points, n, metric));
+  return knn_graph(tree, metric, k, csr, symmetric);
+}
+
+/**
+ * @brief Radius graph of `n` points (planar points or coordinates, see the
+ * metrics), through a k-d tree.
+ */
+template <typename point_t, typename metric_t, typename csr_t>
+float radius_graph(point_t const* points,
+                   std::size_t n,
+                   metric_t const& metric,
+                   double radius,
+                   csr_t& csr) {
+  kd_tree_t<metric_t::dimensions> tree(positions(points, n, metric));
+  return radius_graph(tree, metric, radius, csr);
+}
+
+}  // namespace spatial
+}  // namespace host
+}  // namespace gunrock
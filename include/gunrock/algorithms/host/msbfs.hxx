@@ -0,0 +1,559 @@
+/**
+ * @file msbfs.hxx
+ * @brief Bit-parallel multi-source Breadth-First Search on the host (CPU):
+ * up to `max_sources` sources share one traversal.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <gunrock/algorithms/host/adjacency.hxx>
+#include <gunrock/error.hxx>
+#include <gunrock/graph/graph.hxx>
+#include <gunrock/util/parallel.hxx>
+
+namespace gunrock {
+namespace host {
+namespace msbfs {
+
+/// Largest number of sources traversed together; more are run in batches.
+constexpr std::size_t max_sources = 512;
+
+/**
+ * @brief Tuning parameters of the direction choice. Unlike a single-source
+ * bottom-up step, a multi-source one rarely stops early (a vertex must find
+ * every missing source), so it costs about the in-edges of the vertices not
+ * yet seen by all the sources.
+ */
+struct param_t {
+  /// Use a bottom-up step when the frontier's out-edges exceed the in-edges
+  /// of the vertices not seen by all the sources divided by `alpha`.
+  float alpha = 4;
+  /// Allow bottom-up steps (needs in-edges, see `run()`).
+  bool direction_optimizing = true;
+  /// Layout of the outputs of `run()`: one row of `n` per source (`true`),
+  /// or one row of `num_sources` per vertex (`false`). The latter is much
+  /// cheaper to write for large batches, a vertex's results for all the
+  /// sources sharing cache lines.
+  bool source_major = true;
+};
+
+namespace detail {
+
+/**
+ * @brief Fixed-width set of sources, one bit per source of a batch. The
+ * operations are plain loops over the words, which the compiler turns into
+ * SIMD instructions.
+ */
+template <std::size_t words>
+struct alignas(words * 8 < 64 ? words * 8 : 64) bitset_t {
+  std::uint64_t w[words];
+
+  bool any() const {
+    std::uint64_t bits = 0;
+    for (std::size_t i = 0; i < words; ++i)
+      bits |= w[i];
+    return bits != 0;
+  }
+
+  bool operator==(bitset_t const& rhs) const {
+    std::uint64_t diff = 0;
+    for (std::size_t i = 0; i < words; ++i)
+      diff |= w[i] ^ rhs.w[i];
+    return diff == 0;
+  }
+
+  void clear() {
+    for (std::size_t i = 0; i < words; ++i)
+      w[i] = 0;
+  }
+
+  void set(std::size_t b) { w[b >> 6] |= std::uint64_t(1) << (b & 63); }
+
+  bitset_t& operator|=(bitset_t const& rhs) {
+    for (std::size_t i = 0; i < words; ++i)
+      w[i] |= rhs.w[i];
+    return *this;
+  }
+
+  /// `*this & rhs`
+  bitset_t operator&(bitset_t const& rhs) const {
+    bitset_t r;
+    for (std::size_t i = 0; i < words; ++i)
+      r.w[i] = w[i] & rhs.w[i];
+    return r;
+  }
+
+  /// `*this & ~rhs`
+  bitset_t without(bitset_t const& rhs) const {
+    bitset_t r;
+    for (std::size_t i = 0; i < words; ++i)
+      r.w[i] = w[i] & ~rhs.w[i];
+    return r;
+  }
+
+  /// Calls `op(b)` on every set bit `b`, in increasing order.
+  template <typename func_t>
+  void for_each(func_t op) const {
+    for (std::size_t i = 0; i < words; ++i)
+      for (std::uint64_t bits = w[i]; bits; bits &= bits - 1)
+        op(i * 64 + __builtin_ctzll(bits));
+  }
+};
+
+/// Work items (edges) per chunk of a top-down step.
+constexpr std::size_t edges_per_chunk = 4096;
+/// Vertices per chunk of a bottom-up step or of a frontier pass.
+constexpr std::size_t vertices_per_chunk = 256;
+
+/**
+ * @brief Layout of a per-(source, vertex) output: element `(i, v)` lives at
+ * `i * source_stride + v * vertex_stride`.
+ */
+struct layout_t {
+  std::size_t source_stride;
+  std::size_t vertex_stride;
+  std::size_t operator()(std::size_t i, std::size_t v) const {
+    return i * source_stride + v * vertex_stride;
+  }
+};
+
+/**
+ * @brief One bit-parallel traversal from `num_sources <= 64 * words` sources.
+ *
+ * @par Overview
+ * MS-BFS (Then et al., "The More the Merrier: Efficient Multi-Source Graph
+ * Traversal", VLDB'15): every vertex keeps the set of sources that have
+ * `seen` it and the set whose frontier it is in (`visit`), so one scan of an
+ * edge advances all the sources at once. Top-down steps expand the frontier
+ * queue: the edge space is cut into equal chunks, `next` sets are merged with
+ * atomic ORs, and a vertex is queued by the OR that makes its set non-empty
+ * (or through an atomic flag for multi-word sets). Bottom-up steps let every
+ * vertex not yet seen by all sources OR the `visit` sets of its in-neighbors
+ * (no atomics, early exit once nothing is missing). The direction is chosen
+ * per level by comparing the frontier's out-edges with the in-edges of the
+ * unfinished vertices (see param_t). Depths and shortest-path counts of the
+ * newly reached (source, vertex) pairs are then written by the vertex owning
+ * them, the counts pulled from the in-neighbors at the previous depth.
+ *
+ * `on_level(depth, frontier, visit)` is called with each frontier before it is
+ * expanded (`visit[v]` holds the sources whose depth-`depth` frontier contains
+ * `v`).
+ */
+template <std::size_t words,
+          typename vertex_t,
+          typename out_adjacency_t,
+          typename in_adjacency_t,
+          typename sigma_t,
+          typename level_t>
+void search(vertex_t n,
+            out_adjacency_t const& out,
+            in_adjacency_t const* in,
+            vertex_t const* sources,
+            std::size_t num_sources,
+            vertex_t* distances,
+            sigma_t* sigmas,
+            layout_t layout,
+            param_t param,
+            level_t on_level) {
+  using edge_t = std::decay_t<decltype(out.get_starting_edge(n))>;
+  using set_t = bitset_t<words>;
+  const std::size_t num_vertices = n;
+
+  set_t all;
+  all.clear();
+  for (std::size_t i = 0; i < num_sources; ++i)
+    all.set(i);
+
+  std::vector<set_t> seen(num_vertices);
+  std::vector<set_t> visit(num_vertices);
+  std::vector<set_t> next(num_vertices);
+  std::vector<std::uint8_t> queued(num_vertices, 0);
+  util::parallel::for_each(
+      std::size_t(0), num_vertices,
+      [&](std::size_t v) {
+        seen[v].clear();
+        visit[v].clear();
+        next[v].clear();
+      },
+      std::size_t(1) << 12);
+
+  std::vector<vertex_t> frontier;
+  std::vector<vertex_t> next_frontier;
+  std::vector<std::size_t> offsets;
+
+  for (std::size_t i = 0; i < num_sources; ++i) {
+    vertex_t s = sources[i];
+    if (!visit[s].any())
+      frontier.push_back(s);
+    seen[s].set(i);
+    visit[s].set(i);
+    if (distances)
+      distances[layout(i, s)] = 0;
+    if (sigmas)
+      sigmas[layout(i, s)] = 1;
+  }
+
+  const bool bottom_up_enabled = param.direction_optimizing && in;
+  // In-edges of the vertices not seen by all the sources (bottom-up cost).
+  std::size_t unfinished_edges = 0;
+  auto in_degree = [&](vertex_t v) {
+    return bottom_up_enabled ? std::size_t(in->get_number_of_neighbors(v))
+                             : std::size_t(0);
+  };
+  if (bottom_up_enabled)
+    unfinished_edges = in->get_starting_edge(n) - in->get_starting_edge(0);
+  for (vertex_t s : frontier)
+    if (seen[s] == all)
+      unfinished_edges -= in_degree(s);
+  vertex_t depth = 0;
+
+  // Top-down step: merges `visit` of the frontier into `next` of its
+  // out-neighbors.
+  auto top_down = [&](std::size_t frontier_edges) {
+    util::parallel::collect<vertex_t>(
+        std::size_t(0), frontier_edges,
+        [&](std::size_t first, std::size_t last, std::vector<vertex_t>& local) {
+          std::size_t i =
+              std::upper_bound(offsets.begin(), offsets.end(), first) -
+              offsets.begin() - 1;
+          for (std::size_t item = first; item < last; ++i) {
+            std::size_t segment_end = std::min(offsets[i + 1], last);
+            vertex_t u = frontier[i];
+            set_t const reach = visit[u];
+            out.for_each_neighbor(
+                u, edge_t(item - offsets[i]), edge_t(segment_end - offsets[i]),
+                [&](vertex_t v, edge_t) {
+                  set_t add = reach.without(seen[v]);
+                  if (!add.any())
+                    return;
+                  std::uint64_t* word = next[v].w;
+                  if constexpr (words == 1) {
+                    // The OR that makes the set non-empty queues `v`.
+                    if ((add.w[0] & ~__atomic_load_n(word, __ATOMIC_RELAXED)) &&
+                        !__atomic_fetch_or(word, add.w[0], __ATOMIC_RELAXED))
+                      local.push_back(v);
+                  } else {
+                    for (std::size_t j = 0; j < words; ++j)
+                      if (add.w[j] &
+                          ~__atomic_load_n(word + j, __ATOMIC_RELAXED))
+                        __atomic_fetch_or(word + j, add.w[j],
+                                          __ATOMIC_RELAXED);
+                    if (!__atomic_load_n(&queued[v], __ATOMIC_RELAXED) &&
+                        !__atomic_exchange_n(&queued[v], std::uint8_t(1),
+                                             __ATOMIC_RELAXED))
+                      local.push_back(v);
+                  }
+                });
+            item = segment_end;
+          }
+        },
+        [&](std::size_t size) {
+          next_frontier.resize(size);
+          return next_frontier.data();
+        },
+        detail::edges_per_chunk);
+  };
+
+  // Bottom-up step: every vertex not seen by all the sources pulls the
+  // `visit` sets of its in-neighbors.
+  auto bottom_up = [&]() {
+    util::parallel::collect<vertex_t>(
+        vertex_t(0), n,
+        [&](vertex_t first, vertex_t last, std::vector<vertex_t>& local) {
+          for (vertex_t v = first; v < last; ++v) {
+            set_t missing = all.without(seen[v]);
+            if (!missing.any())
+              continue;
+            set_t found;
+            found.clear();
+            in->any_neighbor(v, [&](vertex_t u, auto) {
+              found |= visit[u] & missing;
+              return found == missing;
+            });
+            if (found.any()) {
+              next[v] = found;
+              local.push_back(v);
+            }
+          }
+        },
+        [&](std::size_t size) {
+          next_frontier.resize(size);
+          return next_frontier.data();
+        },
+        vertex_t(detail::vertices_per_chunk));
+  };
+
+  while (!frontier.empty()) {
+    on_level(depth, frontier, visit.data());
+
+    // Degree scan of the frontier: frontier[i] owns work items
+    // [offsets[i], offsets[i + 1]).
+    offsets.resize(frontier.size() + 1);
+    std::size_t frontier_edges = util::parallel::transform_exclusive_scan(
+        frontier.size(),
+        [&](std::size_t i) {
+          return std::size_t(out.get_number_of_neighbors(frontier[i]));
+        },
+        offsets.data());
+
+    if (bottom_up_enabled &&
+        frontier_edges > std::size_t(unfinished_edges / param.alpha))
+      bottom_up();
+    else
+      top_down(frontier_edges);
+    ++depth;
+
+    // Record the newly reached (source, vertex) pairs.
+    std::size_t finished_edges = 0;
+    util::parallel::for_each(
+        std::size_t(0), next_frontier.size(),
+        [&](std::size_t k) {
+          vertex_t v = next_frontier[k];
+          set_t reached = next[v];
+          seen[v] |= reached;
+          if (seen[v] == all)
+            __atomic_fetch_add(&finished_edges, in_degree(v),
+                               __ATOMIC_RELAXED);
+          if (distances)
+            reached.for_each(
+                [&](std::size_t i) { distances[layout(i, v)] = depth; });
+          if (sigmas)
+            in->for_each_neighbor(v, [&](vertex_t u, auto) {
+              (visit[u] & reached).for_each([&](std::size_t i) {
+                sigmas[layout(i, v)] += sigmas[layout(i, u)];
+              });
+            });
+        },
+        detail::vertices_per_chunk);
+    unfinished_edges -= finished_edges;
+
+    // Advance the frontier.
+    for (vertex_t u : frontier)
+      visit[u].clear();
+    util::parallel::for_each(
+        std::size_t(0), next_frontier.size(),
+        [&](std::size_t k) {
+          vertex_t v = next_frontier[k];
+          visit[v] = next[v];
+          next[v].clear();
+          queued[v] = 0;
+        },
+        detail::vertices_per_chunk);
+    std::swap(frontier, next_frontier);
+  }
+}
+
+/**
+ * @brief Calls `op(std::integral_constant<std::size_t, words>)` with the
+ * smallest supported bitset width holding `num_sources` sources.
+ */
+template <typename func_t>
+void dispatch(std::size_t num_sources, func_t op) {
+  if (num_sources <= 64)
+    op(std::integral_constant<std::size_t, 1>());
+  else if (num_sources <= 128)
+    op(std::integral_constant<std::size_t, 2>());
+  else if (num_sources <= 256)
+    op(std::integral_constant<std::size_t, 4>());
+  else
+    op(std::integral_constant<std::size_t, 8>());
+}
+
+}  // namespace detail
+
+/**
+ * @brief Multi-source BFS over neighbor lists (see host::csr_adjacency_t for
+ * the interface `out` and `in` provide).
+ *
+ * @par Overview
+ * Runs the sources `max_sources` at a time; within a batch all the sources
+ * advance together, each edge being scanned once per level for the whole
+ * batch instead of once per source (see detail::search). Results match
+ * host::bfs run from each source in turn. This pays off when the sources'
+ * frontiers overlap, as on small-world graphs; on high-diameter graphs (road
+ * networks, meshes) they rarely do, and separate runs are faster.
+ *
+ * @tparam sigma_t type of the shortest-path counts (e.g. `double`).
+ * @param n number of vertices.
+ * @param out out-neighbor lists.
+ * @param in in-neighbor lists, e.g. the CSC, or `&out` for a symmetric graph.
+ * `nullptr` disables bottom-up steps and shortest-path counts.
+ * @param sources source vertices (duplicates allowed).
+ * @param num_sources number of sources.
+ * @param distances output, `num_sources * n` depths, row `i` (at
+ * `distances + i * n`) for `sources[i]`, or row `v` (at
+ * `distances + v * num_sources`) for vertex `v` if `!param.source_major`
+ * (`std::numeric_limits<vertex_t>::max()` if unreachable). May be `nullptr`.
+ * @param sigmas output, `num_sources * n` numbers of shortest paths, same
+ * layout (0 if unreachable). May be `nullptr`; requires `in` otherwise.
+ * @param param tuning parameters.
+ * @return float elapsed time in milliseconds (excluding initialization).
+ */
+template <typename vertex_t,
+          typename out_adjacency_t,
+          typename in_adjacency_t,
+          typename sigma_t = double>
+float run(vertex_t n,
+          out_adjacency_t const& out,
+          in_adjacency_t const* in,
+          vertex_t const* sources,
+          std::size_t num_sources,
+          vertex_t* distances,
+          sigma_t* sigmas = nullptr,
+          param_t param = param_t()) {
+  using namespace std::chrono;
+  constexpr vertex_t unreached = std::numeric_limits<vertex_t>::max();
+  error::throw_if_exception(
+      sigmas && !in, "host::msbfs needs in-edges to count shortest paths.");
+  const std::size_t num_vertices = n;
+  if (num_vertices == 0 || num_sources == 0)
+    return 0;
+
+  util::parallel::for_each(
+      std::size_t(0), num_sources * num_vertices,
+      [=](std::size_t k) {
+        if (distances)
+          distances[k] = unreached;
+        if (sigmas)
+          sigmas[k] = 0;
+      },
+      std::size_t(1) << 14);
+
+  auto t_start = high_resolution_clock::now();
+
+  for (std::size_t first = 0; first < num_sources; first += max_sources) {
+    std::size_t batch = std::min(max_sources, num_sources - first);
+    // Rows per source, or per vertex.
+    detail::layout_t layout = param.source_major
+                                  ? detail::layout_t{num_vertices, 1}
+                                  : detail::layout_t{1, num_sources};
+    std::size_t offset = layout(first, 0);
+    detail::dispatch(batch, [&](auto words) {
+      detail::search<decltype(words)::value>(
+          n, out, in, sources + first, batch,
+          distances ? distances + offset : nullptr,
+          sigmas ? sigmas + offset : nullptr,
+          layout, param,
+          [](vertex_t, std::vector<vertex_t> const&, auto) {});
+    });
+  }
+
+  auto t_stop = high_resolution_clock::now();
+  return duration<float, std::milli>(t_stop - t_start).count();
+}
+
+/**
+ * @brief Multi-source BFS over raw CSR arrays.
+ *
+ * @param n number of vertices.
+ * @param row_offsets out-edge offsets (size `n + 1`).
+ * @param column_indices out-neighbors.
+ * @param in_offsets in-edge offsets (size `n + 1`), e.g. CSC column offsets,
+ * or the CSR offsets of a symmetric graph. `nullptr` disables bottom-up steps
+ * and shortest-path counts.
+ * @param in_indices in-neighbors (`nullptr` if `in_offsets` is).
+ * @param sources source vertices.
+ * @param num_sources number of sources.
+ * @param distances output, `num_sources * n` depths (layout: see
+ * `param_t::source_major`). May be `nullptr`.
+ * @param sigmas output, `num_sources * n` numbers of shortest paths. May be
+ * `nullptr`.
+ * @param param tuning parameters.
+ * @return float elapsed time in milliseconds (excluding initialization).
+ */
+template <typename vertex_t, typename edge_t, typename sigma_t = double>
+float run(vertex_t n,
+          edge_t const* row_offsets,
+          vertex_t const* column_indices,
+          edge_t const* in_offsets,
+          vertex_t const* in_indices,
+          vertex_t const* sources,
+          std::size_t num_sources,
+          vertex_t* distances,
+          sigma_t* sigmas = nullptr,
+          param_t param = param_t()) {
+  using adjacency_t = csr_adjacency_t<vertex_t, edge_t>;
+  adjacency_t out{row_offsets, column_indices};
+  adjacency_t in{in_offsets, in_indices};
+  return run(n, out, (in_offsets && in_indices) ? &in : nullptr, sources,
+             num_sources, distances, sigmas, param);
+}
+
+/**
+ * @brief Calls `op(out, in)` with the out-neighbor lists of a host graph (its
+ * CSR view, or its compressed CSR view) and a pointer to its in-neighbor
+ * lists (its CSC view, its out-neighbors if it is symmetric, else `nullptr`).
+ */
+template <typename graph_t, typename func_t>
+auto with_adjacency(graph_t& G, func_t op) {
+  static_assert(graph_t::memory_space_v == memory_space_t::host,
+                "Host traversals require a graph in host memory.");
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t = typename graph_t::edge_type;
+  using csr_view_t = typename graph_t::graph_csr_view_t;
+  using csc_view_t = typename graph_t::graph_csc_view_t;
+  using compressed_view_t = typename graph_t::graph_compressed_csr_view_t;
+  using adjacency_t = csr_adjacency_t<vertex_t, edge_t>;
+
+  auto with_in = [&](auto const& out) {
+    if constexpr (std::is_base_of_v<csc_view_t, graph_t>) {
+      auto& csc = static_cast<csc_view_t&>(G);
+      adjacency_t in{csc.get_column_offsets(), csc.get_row_indices()};
+      return op(out, &in);
+    } else {
+      return op(out, G.is_symmetric() ? &out : nullptr);
+    }
+  };
+
+  if constexpr (std::is_base_of_v<csr_view_t, graph_t>) {
+    auto& csr = static_cast<csr_view_t&>(G);
+    return with_in(
+        adjacency_t{csr.get_row_offsets(), csr.get_column_indices()});
+  } else {
+    return with_in(static_cast<compressed_view_t const&>(G));
+  }
+}
+
+/**
+ * @brief Multi-source BFS on a host graph (neighbor lists chosen as in
+ * host::bfs).
+ *
+ * @tparam graph_t graph type, must live in `memory_space_t::host` and contain
+ * a CSR or a compressed CSR view.
+ * @param G input graph.
+ * @param sources source vertices.
+ * @param num_sources number of sources.
+ * @param distances output, `num_sources * n` depths (layout: see
+ * `param_t::source_major`). May be `nullptr`.
+ * @param sigmas output, `num_sources * n` numbers of shortest paths (needs a
+ * CSC view or a symmetric graph). May be `nullptr`.
+ * @param param tuning parameters.
+ * @return float elapsed time in milliseconds.
+ */
+template <typename graph_t, typename sigma_t = double>
+float run(graph_t& G,
+          typename graph_t::vertex_type const* sources,
+          std::size_t num_sources,
+          typename graph_t::vertex_type* distances,
+          sigma_t* sigmas = nullptr,
+          param_t param = param_t()) {
+  return with_adjacency(G, [&](auto const& out, auto const* in) {
+    return run(G.get_number_of_vertices(), out, in, sources, num_sources,
+               distances, sigmas, param);
+  });
+}
+
+}  // namespace msbfs
+}  // namespace host
+}  // namespace gunrock
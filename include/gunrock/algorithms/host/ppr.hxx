@@ -0,0 +1,169 @@
+/**
+ * @file ppr.hxx
+ * @brief Batched, pull-based personalized PageRank on the host (CPU).
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <gunrock/algorithms/host/pr.hxx>
+
+namespace gunrock {
+namespace host {
+namespace ppr {
+
+/**
+ * @brief Same damping factor and convergence test as host::pr::param_t (and
+ * gunrock::pr::param_t), applied to every seed.
+ */
+template <typename weight_t>
+using param_t = pr::param_t<weight_t>;
+
+/**
+ * @brief Personalized PageRank of a batch of seeds over neighbor lists (see
+ * host::csr_adjacency_t for the interface `out` and `in` provide).
+ *
+ * @par Overview
+ * The PageRank iteration of host::pr with the teleport (and the mass of the
+ * dangling vertices) sent back to the seed instead of spread uniformly. Seeds
+ * are ranked 16 at a time: their ranks are stored vertex-major, so that each
+ * pass over the in-edges of a vertex updates all of them. Each seed stops
+ * on its own, after `total_iterations` iterations or once its largest rank
+ * change is below `tol`, as if it were ranked alone.
+ *
+ * @param n number of vertices.
+ * @param out out-neighbor lists (only their weights are read).
+ * @param in in-neighbor lists, e.g. the CSC, or `out` for a symmetric graph.
+ * @param seeds seed of each ranking.
+ * @param num_seeds number of seeds.
+ * @param p output, `num_seeds * n` ranks; those of `seeds[s]` start at
+ * `p + s * n` (as in gunrock::ppr::run_batch).
+ * @param param damping factor and convergence parameters.
+ * @return float elapsed time in milliseconds.
+ */
+template <typename vertex_t,
+          typename weight_t,
+          typename out_adjacency_t,
+          typename in_adjacency_t>
+float run_batch(vertex_t n,
+                out_adjacency_t const& out,
+                in_adjacency_t const& in,
+                vertex_t const* seeds,
+                std::size_t num_seeds,
+                weight_t* p,
+                param_t<weight_t> param = param_t<weight_t>()) {
+  using namespace std::chrono;
+  constexpr std::size_t max_batch = pr::detail::max_batch;
+  const std::size_t num_vertices = n;
+  if (num_vertices == 0 || num_seeds == 0)
+    return 0;
+  for (std::size_t s = 0; s < num_seeds; ++s)
+    error::throw_if_exception(seeds[s] < 0 || seeds[s] >= n,
+                              "host::ppr: seed out of range.");
+
+  auto t_start = high_resolution_clock::now();
+
+  std::vector<weight_t> iweights(num_vertices);
+  pr::detail::inverse_weights<vertex_t>(num_vertices, out, param.alpha,
+                                        iweights.data());
+  // Two rank buffers for the widest block.
+  std::size_t widest = 1;
+  while (widest < std::min(num_seeds, max_batch))
+    widest *= 2;
+  std::vector<weight_t> buffers(2 * num_vertices * widest);
+
+  for (std::size_t first = 0; first < num_seeds; first += max_batch) {
+    std::size_t k = std::min(max_batch, num_seeds - first);
+    pr::detail::dispatch_width(k, [&](auto width) {
+      constexpr std::size_t W = decltype(width)::value;
+      // Lanes past `k` repeat the last seed; their ranks are dropped.
+      std::array<vertex_t, W> lane_seeds;
+      for (std::size_t l = 0; l < W; ++l)
+        lane_seeds[l] = seeds[first + std::min(l, k - 1)];
+
+      weight_t* current = buffers.data();
+      weight_t* previous = current + num_vertices * W;
+      util::parallel::for_each(
+          std::size_t(0), num_vertices,
+          [&](std::size_t v) {
+            for (std::size_t l = 0; l < W; ++l)
+              current[v * W + l] = vertex_t(v) == lane_seeds[l] ? 1 : 0;
+          },
+          std::size_t(1) << 12);
+
+      pr::detail::iterate<W, vertex_t>(
+          num_vertices, in, iweights.data(),
+          [&](vertex_t v, std::size_t l, weight_t mass) {
+            return v == lane_seeds[l] ? mass : weight_t(0);
+          },
+          param, current, previous);
+
+      util::parallel::for_each(
+          std::size_t(0), num_vertices,
+          [&](std::size_t v) {
+            for (std::size_t l = 0; l < k; ++l)
+              p[(first + l) * num_vertices + v] = current[v * W + l];
+          },
+          std::size_t(1) << 12);
+    });
+  }
+
+  auto t_stop = high_resolution_clock::now();
+  return duration<float, std::milli>(t_stop - t_start).count();
+}
+
+/**
+ * @brief Personalized PageRank of a batch of seeds on a host graph. Out-edges
+ * come from the graph's CSR view, or from its compressed CSR view if it has
+ * no CSR view; in-edges from its CSC view, or from the out-edges if the graph
+ * is symmetric.
+ *
+ * @tparam graph_t graph type, must live in `memory_space_t::host` and contain
+ * a CSR or a compressed CSR view.
+ * @param G input graph.
+ * @param seeds seed of each ranking.
+ * @param num_seeds number of seeds.
+ * @param p output, `num_seeds * n` ranks; those of `seeds[s]` start at
+ * `p + s * n`.
+ * @param param damping factor and convergence parameters.
+ * @return float elapsed time in milliseconds.
+ */
+template <typename graph_t>
+float run_batch(graph_t& G,
+                typename graph_t::vertex_type const* seeds,
+                std::size_t num_seeds,
+                typename graph_t::weight_type* p,
+                param_t<typename graph_t::weight_type> param =
+                    param_t<typename graph_t::weight_type>()) {
+  return pr::detail::with_adjacency(G, "host::ppr", [&](auto const& out,
+                                                        auto const& in) {
+    return run_batch(G.get_number_of_vertices(), out, in, seeds, num_seeds, p,
+                     param);
+  });
+}
+
+/**
+ * @brief Personalized PageRank of a single seed on a host graph (see
+ * run_batch()).
+ *
+ * @param G input graph.
+ * @param seed seed vertex.
+ * @param p output, rank of each vertex.
+ * @param param damping factor and convergence parameters.
+ * @return float elapsed time in milliseconds.
+ */
+template <typename graph_t>
+float run(graph_t& G,
+          typename graph_t::vertex_type seed,
+          typename graph_t::weight_type* p,
+          param_t<typename graph_t::weight_type> param =
+              param_t<typename graph_t::weight_type>()) {
+  return run_batch(G, &seed, 1, p, param);
+}
+
+}  // namespace ppr
+}  // namespace host
+}  // namespace gunrock
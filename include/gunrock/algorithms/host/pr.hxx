@@ -0,0 +1,400 @@
+/**
+ * @file pr.hxx
+ * @brief Pull-based, multithreaded PageRank on the host (CPU), and the pull
+ * sweep and batched power iteration host::ppr and host::hits build on.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <gunrock/algorithms/host/adjacency.hxx>
+#include <gunrock/error.hxx>
+#include <gunrock/graph/graph.hxx>
+#include <gunrock/util/parallel.hxx>
+
+namespace gunrock {
+namespace host {
+namespace pr {
+
+/**
+ * @brief Same meaning as gunrock::pr::param_t.
+ */
+template <typename weight_t>
+struct param_t {
+  /// Damping factor.
+  weight_t alpha = 0.85;
+  /// Stop once no rank moves by `tol` or more in an iteration.
+  weight_t tol = 1e-6;
+  /// Upper bound on the number of iterations.
+  unsigned int total_iterations = 100;
+};
+
+namespace detail {
+
+/// Vertices per chunk.
+constexpr std::size_t vertices_per_chunk = 256;
+/// Most rank vectors one sweep carries: 16 floats, one cache line per vertex.
+constexpr std::size_t max_batch = 16;
+
+/**
+ * @brief Parallel `reduce(op(v))` over the vertices with `combine`, in a
+ * fixed order per chunk.
+ */
+template <typename type_t, typename func_t, typename combine_t>
+type_t reduce(std::size_t n, func_t op, combine_t combine) {
+  std::size_t chunks = (n + vertices_per_chunk - 1) / vertices_per_chunk;
+  std::vector<type_t> partial(chunks, type_t{});
+  util::parallel::for_each_chunk_id(chunks, [&](std::size_t, std::size_t c) {
+    std::size_t first = c * vertices_per_chunk;
+    std::size_t last = std::min(n, first + vertices_per_chunk);
+    type_t value{};
+    for (std::size_t v = first; v < last; ++v)
+      value = combine(value, op(v));
+    partial[c] = value;
+  });
+
+  type_t value{};
+  for (auto const& x : partial)
+    value = combine(value, x);
+  return value;
+}
+
+/**
+ * @brief Calls `op(std::integral_constant<std::size_t, W>())` with the
+ * smallest `W` of 1, 2, 4, 8 and 16 that is at least `k` (`k <= 16`).
+ */
+template <typename op_t>
+void dispatch_width(std::size_t k, op_t op) {
+  if (k <= 1)
+    op(std::integral_constant<std::size_t, 1>());
+  else if (k <= 2)
+    op(std::integral_constant<std::size_t, 2>());
+  else if (k <= 4)
+    op(std::integral_constant<std::size_t, 4>());
+  else if (k <= 8)
+    op(std::integral_constant<std::size_t, 8>());
+  else
+    op(std::integral_constant<std::size_t, 16>());
+}
+
+/**
+ * @brief The pull sweep: for every vertex `v`, in parallel,
+ * `store(v, sum)` with `sum[l]` the sum over the in-edges `(u, e)` of `v` of
+ * `coefficient(u, e) * x[u * W + l]`. The `W` values of a vertex are
+ * contiguous (vertex-major), so one pass over the in-edges serves all of
+ * them.
+ */
+template <std::size_t W,
+          typename vertex_t,
+          typename weight_t,
+          typename in_adjacency_t,
+          typename coefficient_t,
+          typename store_t>
+void pull(std::size_t n,
+          in_adjacency_t const& in,
+          weight_t const* x,
+          coefficient_t coefficient,
+          store_t store) {
+  using edge_t = std::decay_t<decltype(in.get_starting_edge(vertex_t(0)))>;
+  util::parallel::for_each(
+      std::size_t(0), n,
+      [&](std::size_t v) {
+        std::array<weight_t, W> sum{};
+        in.for_each_neighbor(vertex_t(v), [&](vertex_t u, edge_t e) {
+          weight_t c = coefficient(u, e);
+          weight_t const* xu = x + std::size_t(u) * W;
+          for (std::size_t l = 0; l < W; ++l)
+            sum[l] += c * xu[l];
+        });
+        store(v, sum);
+      },
+      vertices_per_chunk);
+}
+
+/**
+ * @brief `alpha / (sum of the out-weights of v)` for every vertex `v`, 0 for
+ * dangling vertices (no out-weight).
+ */
+template <typename vertex_t, typename weight_t, typename out_adjacency_t>
+void inverse_weights(std::size_t n,
+                     out_adjacency_t const& out,
+                     weight_t alpha,
+                     weight_t* iweights) {
+  using edge_t = std::decay_t<decltype(out.get_starting_edge(vertex_t(0)))>;
+  util::parallel::for_each(
+      std::size_t(0), n,
+      [&](std::size_t v) {
+        edge_t start = out.get_starting_edge(vertex_t(v));
+        edge_t end = start + out.get_number_of_neighbors(vertex_t(v));
+        weight_t sum = 0;
+        for (edge_t e = start; e < end; ++e)
+          sum += out.get_edge_weight(e);
+        iweights[v] = sum != 0 ? alpha / sum : 0;
+      },
+      std::size_t(1) << 12);
+}
+
+/**
+ * @brief Power iteration of `W` rank vectors at once (PageRank is `W = 1`).
+ *
+ * @par Overview
+ * Every iteration, each vector `l` gathers the mass of the dangling vertices,
+ * `dangling[l]`, gives `teleport(v, l, 1 - alpha + dangling[l])` to every
+ * vertex `v`, and pulls `p[u] * iweights[u] * w(u, v)` along the in-edges.
+ * A vector is frozen after the first iteration in which none of its ranks
+ * moves by `tol` or more, so its result does not depend on the other vectors
+ * of the batch; the iteration stops once all are frozen, or after
+ * `total_iterations` iterations.
+ *
+ * @param p in: initial ranks, `p[v * W + l]`; out: the final ranks (which
+ * may be either buffer, `plast` receives the other).
+ * @param plast scratch of the same size.
+ * @return unsigned int number of iterations.
+ */
+template <std::size_t W,
+          typename vertex_t,
+          typename weight_t,
+          typename in_adjacency_t,
+          typename teleport_t>
+unsigned int iterate(std::size_t n,
+                     in_adjacency_t const& in,
+                     weight_t const* iweights,
+                     teleport_t teleport,
+                     param_t<weight_t> const& param,
+                     weight_t*& p,
+                     weight_t*& plast) {
+  using edge_t = std::decay_t<decltype(in.get_starting_edge(vertex_t(0)))>;
+  using lanes_t = std::array<weight_t, W>;
+  const weight_t alpha = param.alpha;
+
+  auto plus = [](lanes_t a, lanes_t const& b) {
+    for (std::size_t l = 0; l < W; ++l)
+      a[l] += b[l];
+    return a;
+  };
+  auto maximum = [](lanes_t a, lanes_t const& b) {
+    for (std::size_t l = 0; l < W; ++l)
+      a[l] = std::max(a[l], b[l]);
+    return a;
+  };
+
+  std::array<bool, W> active;
+  active.fill(true);
+  unsigned int iteration = 0;
+  while (iteration < param.total_iterations) {
+    std::swap(p, plast);
+    weight_t const* x = plast;
+    weight_t* y = p;
+
+    lanes_t dangling = reduce<lanes_t>(
+        n,
+        [&](std::size_t v) {
+          lanes_t mass{};
+          if (iweights[v] == 0)
+            for (std::size_t l = 0; l < W; ++l)
+              mass[l] = alpha * x[v * W + l];
+          return mass;
+        },
+        plus);
+    lanes_t mass;
+    for (std::size_t l = 0; l < W; ++l)
+      mass[l] = 1 - alpha + dangling[l];
+
+    pull<W, vertex_t>(
+        n, in, x,
+        [&](vertex_t u, edge_t e) { return iweights[u] * in.get_edge_weight(e); },
+        [&](std::size_t v, lanes_t const& sum) {
+          for (std::size_t l = 0; l < W; ++l)
+            y[v * W + l] = active[l]
+                               ? teleport(vertex_t(v), l, mass[l]) + sum[l]
+                               : x[v * W + l];
+        });
+    ++iteration;
+
+    lanes_t err = reduce<lanes_t>(
+        n,
+        [&](std::size_t v) {
+          lanes_t diff;
+          for (std::size_t l = 0; l < W; ++l)
+            diff[l] = std::abs(y[v * W + l] - x[v * W + l]);
+          return diff;
+        },
+        maximum);
+    bool any_active = false;
+    for (std::size_t l = 0; l < W; ++l) {
+      active[l] = active[l] && !(err[l] < param.tol);
+      any_active = any_active || active[l];
+    }
+    if (!any_active)
+      break;
+  }
+  return iteration;
+}
+
+/**
+ * @brief Calls `op(out, in)` with the out-edges of a host graph (its CSR
+ * view, or its compressed CSR view if it has no CSR view) and its in-edges
+ * (its CSC view, or the out-edges if the graph is symmetric).
+ *
+ * @param algorithm name used in the error raised when there are no in-edges.
+ */
+template <typename graph_t, typename op_t>
+auto with_adjacency(graph_t& G, std::string const& algorithm, op_t op) {
+  static_assert(graph_t::memory_space_v == memory_space_t::host,
+                "host ranking requires a graph in host memory.");
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t = typename graph_t::edge_type;
+  using weight_t = typename graph_t::weight_type;
+  using csr_view_t = typename graph_t::graph_csr_view_t;
+  using csc_view_t = typename graph_t::graph_csc_view_t;
+  using compressed_view_t = typename graph_t::graph_compressed_csr_view_t;
+  using adjacency_t = csr_adjacency_t<vertex_t, edge_t, weight_t>;
+
+  auto with_in = [&](auto const& out) {
+    if constexpr (std::is_base_of_v<csc_view_t, graph_t>) {
+      auto& csc = static_cast<csc_view_t&>(G);
+      return op(out, adjacency_t{csc.get_column_offsets(),
+                                 csc.get_row_indices(),
+                                 csc.get_nonzero_values()});
+    } else {
+      error::throw_if_exception(
+          !G.is_symmetric(),
+          algorithm + " needs in-edges: a CSC view or a symmetric graph.");
+      return op(out, out);
+    }
+  };
+
+  if constexpr (std::is_base_of_v<csr_view_t, graph_t>) {
+    auto& csr = static_cast<csr_view_t&>(G);
+    return with_in(adjacency_t{csr.get_row_offsets(), csr.get_column_indices(),
+                               csr.get_nonzero_values()});
+  } else {
+    return with_in(static_cast<compressed_view_t const&>(G));
+  }
+}
+
+}  // namespace detail
+
+/**
+ * @brief PageRank over neighbor lists (see host::csr_adjacency_t for the
+ * interface `out` and `in` provide).
+ *
+ * @par Overview
+ * Same iteration and convergence test as gunrock::pr (whose push step
+ * scatters with atomics): every iteration, the mass of the dangling vertices
+ * (no out-weight) is spread uniformly, and each vertex then pulls
+ * `p[u] * alpha * w(u, v) / out_weight(u)` from its in-neighbors `u`, so no
+ * atomics are needed and the sums (hence the ranks) do not depend on the
+ * number of threads. Stops after `total_iterations` iterations, or once the
+ * largest rank change is below `tol`.
+ *
+ * @param n number of vertices.
+ * @param out out-neighbor lists (only their weights are read).
+ * @param in in-neighbor lists, e.g. the CSC, or `out` for a symmetric graph.
+ * @param p output, rank of each vertex.
+ * @param param damping factor and convergence parameters.
+ * @return float elapsed time in milliseconds (excluding initialization).
+ */
+template <typename vertex_t,
+          typename weight_t,
+          typename out_adjacency_t,
+          typename in_adjacency_t>
+float run(vertex_t n,
+          out_adjacency_t const& out,
+          in_adjacency_t const& in,
+          weight_t* p,
+          param_t<weight_t> param = param_t<weight_t>()) {
+  using namespace std::chrono;
+  const std::size_t num_vertices = n;
+  if (num_vertices == 0)
+    return 0;
+
+  std::vector<weight_t> plast(num_vertices);
+  std::vector<weight_t> iweights(num_vertices);
+
+  auto t_start = high_resolution_clock::now();
+
+  detail::inverse_weights<vertex_t>(num_vertices, out, param.alpha,
+                                    iweights.data());
+  std::fill_n(p, num_vertices, weight_t(1) / weight_t(n));
+
+  weight_t* current = p;
+  weight_t* previous = plast.data();
+  detail::iterate<1, vertex_t>(
+      num_vertices, in, iweights.data(),
+      [n](vertex_t, std::size_t, weight_t mass) { return mass / weight_t(n); },
+      param, current, previous);
+  if (current != p)
+    std::copy_n(current, num_vertices, p);
+
+  auto t_stop = high_resolution_clock::now();
+  return duration<float, std::milli>(t_stop - t_start).count();
+}
+
+/**
+ * @brief PageRank over raw CSR (out-edges) and CSC (in-edges) arrays.
+ *
+ * @param n number of vertices.
+ * @param row_offsets CSR row offsets (size `n + 1`).
+ * @param column_indices CSR column indices.
+ * @param values CSR edge weights (`nullptr`: unweighted).
+ * @param in_offsets CSC column offsets (size `n + 1`), or the CSR offsets of
+ * a symmetric graph.
+ * @param in_indices CSC row indices.
+ * @param in_values CSC edge weights (`nullptr`: unweighted).
+ * @param p output, rank of each vertex.
+ * @param param damping factor and convergence parameters.
+ * @return float elapsed time in milliseconds (excluding initialization).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+float run(vertex_t n,
+          edge_t const* row_offsets,
+          vertex_t const* column_indices,
+          weight_t const* values,
+          edge_t const* in_offsets,
+          vertex_t const* in_indices,
+          weight_t const* in_values,
+          weight_t* p,
+          param_t<weight_t> param = param_t<weight_t>()) {
+  using adjacency_t = csr_adjacency_t<vertex_t, edge_t, weight_t>;
+  return run(n, adjacency_t{row_offsets, column_indices, values},
+             adjacency_t{in_offsets, in_indices, in_values}, p, param);
+}
+
+/**
+ * @brief PageRank on a host graph. Out-edges come from the graph's CSR view,
+ * or from its compressed CSR view if it has no CSR view; in-edges from its
+ * CSC view, or from the out-edges if the graph is symmetric.
+ *
+ * @tparam graph_t graph type, must live in `memory_space_t::host` and contain
+ * a CSR or a compressed CSR view.
+ * @param G input graph.
+ * @param p output, rank of each vertex.
+ * @param param damping factor and convergence parameters.
+ * @return float elapsed time in milliseconds.
+ */
+template <typename graph_t>
+float run(graph_t& G,
+          typename graph_t::weight_type* p,
+          param_t<typename graph_t::weight_type> param =
+              param_t<typename graph_t::weight_type>()) {
+  return detail::with_adjacency(G, "host::pr", [&](auto const& out,
+                                                   auto const& in) {
+    return run(G.get_number_of_vertices(), out, in, p, param);
+  });
+}
+
+}  // namespace pr
+}  // namespace host
+}  // namespace gunrock
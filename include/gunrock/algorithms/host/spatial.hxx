@@ -0,0 +1,706 @@
+/**
+ * @file spatial.hxx
+ * @brief Spatial indices for nearest-neighbor and radius queries on the host
+ * (CPU): a k-d tree, a uniform grid and brute force, over planar points or
+ * latitude/longitude coordinates.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <gunrock/error.hxx>
+#include <gunrock/util/parallel.hxx>
+
+namespace gunrock {
+namespace host {
+namespace spatial {
+
+/// Position of a point in index space.
+template <std::size_t dimensions>
+using position_t = std::array<double, dimensions>;
+
+/**
+ * @brief A point found by a query and its squared distance (in index space)
+ * to the query. Neighbors are ordered by distance, then by index, so results
+ * do not depend on the index or on the traversal.
+ */
+struct neighbor_t {
+  double squared;
+  std::uint32_t index;
+
+  bool operator<(neighbor_t const& other) const {
+    return squared < other.squared ||
+           (squared == other.squared && index < other.index);
+  }
+};
+
+/**
+ * @brief Planar points (any type with `x` and `y` members, e.g.
+ * `io::point_t`) under the Euclidean distance.
+ */
+struct euclidean_t {
+  static constexpr std::size_t dimensions = 2;
+
+  template <typename point_t>
+  position_t<2> position(point_t const& p) const {
+    return {double(p.x), double(p.y)};
+  }
+
+  /// Distance of a squared index-space distance.
+  double distance(double squared) const { return std::sqrt(squared); }
+
+  /// Squared index-space distance of a distance.
+  double squared(double distance) const { return distance * distance; }
+};
+
+/**
+ * @brief Latitudes and longitudes in degrees (any type with `latitude` and
+ * `longitude` members, e.g. `geo::coordinates_t`) under the great-circle
+ * (haversine) distance, in the units of `radius` (km by default, as
+ * `geo::haversine()`). Points are indexed on the unit sphere, where the chord
+ * length orders points as the great-circle distance does.
+ */
+struct haversine_t {
+  static constexpr std::size_t dimensions = 3;
+  double radius = 6371;
+
+  template <typename coordinates_t>
+  position_t<3> position(coordinates_t const& c) const {
+    constexpr double to_radians = 3.141592653589793 / 180;
+    double latitude = double(c.latitude) * to_radians;
+    double longitude = double(c.longitude) * to_radians;
+    return {std::cos(latitude) * std::cos(longitude),
+            std::cos(latitude) * std::sin(longitude), std::sin(latitude)};
+  }
+
+  double distance(double squared) const {
+    return 2 * radius * std::asin(std::min(1.0, std::sqrt(squared) / 2));
+  }
+
+  double squared(double distance) const {
+    if (distance >= 3.141592653589793 * radius)
+      return 4;  // The whole sphere.
+    double chord = 2 * std::sin(distance / (2 * radius));
+    return chord * chord;
+  }
+};
+
+/**
+ * @brief Index-space positions of `n` points under a metric, in parallel.
+ * Points with missing (NaN) coordinates get non-finite positions, which the
+ * indices skip.
+ */
+template <typename point_t, typename metric_t>
+std::vector<position_t<metric_t::dimensions>>
+positions(point_t const* points, std::size_t n, metric_t const& metric) {
+  std::vector<position_t<metric_t::dimensions>> output(n);
+  util::parallel::for_each(std::size_t(0), n, [&](std::size_t i) {
+    output[i] = metric.position(points[i]);
+  });
+  return output;
+}
+
+namespace detail {
+
+constexpr double infinity = std::numeric_limits<double>::infinity();
+
+template <std::size_t dimensions>
+double squared_distance(position_t<dimensions> const& a,
+                        position_t<dimensions> const& b) {
+  double sum = 0;
+  for (std::size_t d = 0; d < dimensions; ++d)
+    sum += (a[d] - b[d]) * (a[d] - b[d]);
+  return sum;
+}
+
+/// Squared distance from `q` to the box `[lo, hi]` (infinite if empty).
+template <std::size_t dimensions>
+double box_distance(position_t<dimensions> const& q,
+                    position_t<dimensions> const& lo,
+                    position_t<dimensions> const& hi) {
+  double sum = 0;
+  for (std::size_t d = 0; d < dimensions; ++d) {
+    double gap = q[d] < lo[d]   ? lo[d] - q[d]
+                 : q[d] > hi[d] ? q[d] - hi[d]
+                                : 0;
+    sum += gap * gap;
+  }
+  return sum;
+}
+
+template <std::size_t dimensions>
+bool is_finite(position_t<dimensions> const& p) {
+  for (double x : p)
+    if (!std::isfinite(x))
+      return false;
+  return true;
+}
+
+/**
+ * @brief Indexable points: all positions, the IDs of the finite ones in index
+ * order, and their positions in that order (so that scanning a cell or a leaf
+ * reads contiguous memory).
+ */
+template <std::size_t dimensions>
+struct points_t {
+  std::vector<position_t<dimensions>> positions;
+  std::vector<std::uint32_t> order;
+  std::vector<position_t<dimensions>> sorted;
+
+  /// Fills `sorted` once `order` is final.
+  void arrange() {
+    sorted.resize(order.size());
+    util::parallel::for_each(
+        std::size_t(0), order.size(),
+        [&](std::size_t p) { sorted[p] = positions[order[p]]; });
+  }
+
+  points_t() = default;
+  explicit points_t(std::vector<position_t<dimensions>> _positions)
+      : positions(std::move(_positions)) {
+    error::throw_if_exception(positions.size() >= (std::size_t(1) << 32),
+                              "Spatial indices hold at most 2^32 - 1 points.");
+    order.reserve(positions.size());
+    for (std::size_t i = 0; i < positions.size(); ++i)
+      if (is_finite(positions[i]))
+        order.push_back(std::uint32_t(i));
+  }
+};
+
+/**
+ * @brief The `k` best neighbors seen so far, closest first, in `best`. An
+ * insertion into a short sorted array beats a heap for the usual `k`, and the
+ * result needs no final sort.
+ */
+struct nearest_t {
+  std::size_t k;
+  std::vector<neighbor_t>& best;
+
+  double worst() const {
+    return best.size() < k ? infinity : best.back().squared;
+  }
+
+  void offer(double squared, std::uint32_t index) {
+    neighbor_t candidate{squared, index};
+    if (best.size() < k)
+      best.push_back(candidate);
+    else if (candidate < best.back())
+      best.back() = candidate;
+    else
+      return;
+    for (std::size_t i = best.size() - 1; i > 0 && candidate < best[i - 1];
+         --i)
+      std::swap(best[i], best[i - 1]);
+  }
+};
+
+}  // namespace detail
+
+/**
+ * @brief Common interface of the indices below:
+ *
+ * - `size()`: number of points, including those with non-finite positions,
+ *   which are never returned;
+ * - `valid(i)` and `position(i)`;
+ * - `order()`: IDs of the points with finite positions, in index order;
+ * - `nearest(q, k, out, exclude)`: the `k` nearest points to `q` (fewer if
+ *   the index is smaller), other than `exclude`, into `out`, closest first;
+ * - `within(q, squared, op)`: `op(i, squared_distance)` for every point at
+ *   squared distance at most `squared` from `q`, in no particular order.
+ *
+ * Queries are const and can run concurrently.
+ */
+constexpr std::uint32_t no_exclude = ~std::uint32_t(0);
+
+/**
+ * @brief Brute force: every query scans every point. The reference of the
+ * other indices.
+ */
+template <std::size_t dimensions>
+class brute_force_t {
+ public:
+  using position_type = position_t<dimensions>;
+
+  brute_force_t() = default;
+  explicit brute_force_t(std::vector<position_type> positions)
+      : points(std::move(positions)) {
+    points.arrange();
+  }
+
+  std::size_t size() const { return points.positions.size(); }
+  bool valid(std::size_t i) const { return detail::is_finite(position(i)); }
+  position_type const& position(std::size_t i) const {
+    return points.positions[i];
+  }
+
+  void nearest(position_type const& q,
+               std::size_t k,
+               std::vector<neighbor_t>& out,
+               std::uint32_t exclude = no_exclude) const {
+    out.clear();
+    if (k == 0)
+      return;
+    detail::nearest_t best{k, out};
+    for (std::size_t p = 0; p < points.order.size(); ++p) {
+      double d = detail::squared_distance(q, points.sorted[p]);
+      if (d <= best.worst() && points.order[p] != exclude)
+        best.offer(d, points.order[p]);
+    }
+  }
+
+  template <typename op_t>
+  void within(position_type const& q, double squared, op_t op) const {
+    for (std::size_t p = 0; p < points.order.size(); ++p) {
+      double d = detail::squared_distance(q, points.sorted[p]);
+      if (d <= squared)
+        op(points.order[p], d);
+    }
+  }
+
+  /// IDs of the indexed points, in index order.
+  std::vector<std::uint32_t> const& order() const { return points.order; }
+
+ private:
+  detail::points_t<dimensions> points;
+};
+
+/**
+ * @brief Balanced k-d tree. Every node splits its points at the median of
+ * its widest dimension, so the tree is complete and stored implicitly
+ * (children of node `i` are `2i + 1` and `2i + 2`); nodes keep the bounding
+ * box of their points for pruning. Built level by level, the nodes of a
+ * level in parallel.
+ */
+template <std::size_t dimensions>
+class kd_tree_t {
+ public:
+  using position_type = position_t<dimensions>;
+
+  kd_tree_t() = default;
+
+  /**
+   * @param positions positions of the points (see `spatial::positions()`).
+   * @param leaf_size largest number of points in a leaf.
+   */
+  explicit kd_tree_t(std::vector<position_type> positions,
+                     std::size_t leaf_size = 16)
+      : points(std::move(positions)) {
+    auto& order = points.order;
+    std::size_t n = order.size();
+    leaf_size = std::max<std::size_t>(leaf_size, 1);
+    while (((n + (std::size_t(1) << depth) - 1) >> depth) > leaf_size)
+      ++depth;
+
+    nodes.resize((std::size_t(2) << depth) - 1);
+    nodes[0].begin = 0;
+    nodes[0].end = std::uint32_t(n);
+    for (std::size_t level = 0; level <= depth; ++level) {
+      std::size_t first = (std::size_t(1) << level) - 1;
+      util::parallel::for_each(
+          first, 2 * first + 1,
+          [&](std::size_t i) {
+            node_t& node = nodes[i];
+            node.lo.fill(detail::infinity);
+            node.hi.fill(-detail::infinity);
+            for (std::uint32_t p = node.begin; p < node.end; ++p)
+              for (std::size_t d = 0; d < dimensions; ++d) {
+                double x = points.positions[order[p]][d];
+                node.lo[d] = std::min(node.lo[d], x);
+                node.hi[d] = std::max(node.hi[d], x);
+              }
+            if (level == depth)
+              return;
+
+            std::size_t widest = 0;
+            for (std::size_t d = 1; d < dimensions; ++d)
+              if (node.hi[d] - node.lo[d] > node.hi[widest] - node.lo[widest])
+                widest = d;
+            std::uint32_t mid = node.begin + (node.end - node.begin) / 2;
+            auto const& P = points.positions;
+            std::nth_element(
+                order.begin() + node.begin, order.begin() + mid,
+                order.begin() + node.end,
+                [&](std::uint32_t a, std::uint32_t b) {
+                  return P[a][widest] < P[b][widest] ||
+                         (P[a][widest] == P[b][widest] && a < b);
+                });
+            node.dimension = std::uint32_t(widest);
+            node.split = mid < node.end ? P[order[mid]][widest] : 0;
+            nodes[2 * i + 1].begin = node.begin;
+            nodes[2 * i + 1].end = mid;
+            nodes[2 * i + 2].begin = mid;
+            nodes[2 * i + 2].end = node.end;
+          },
+          std::size_t(1));
+    }
+    points.arrange();
+  }
+
+  std::size_t size() const { return points.positions.size(); }
+  bool valid(std::size_t i) const { return detail::is_finite(position(i)); }
+  position_type const& position(std::size_t i) const {
+    return points.positions[i];
+  }
+
+  /// IDs of the indexed points, in index order.
+  std::vector<std::uint32_t> const& order() const { return points.order; }
+
+  void nearest(position_type const& q,
+               std::size_t k,
+               std::vector<neighbor_t>& out,
+               std::uint32_t exclude = no_exclude) const {
+    out.clear();
+    if (k == 0 || nodes.empty())
+      return;
+    detail::nearest_t best{k, out};
+    search(0, 0, q, exclude, best);
+  }
+
+  template <typename op_t>
+  void within(position_type const& q, double squared, op_t op) const {
+    if (!nodes.empty())
+      visit(0, 0, q, squared, op);
+  }
+
+ private:
+  struct node_t {
+    position_type lo, hi;
+    double split = 0;
+    std::uint32_t dimension = 0;
+    std::uint32_t begin = 0, end = 0;
+  };
+
+  void search(std::size_t i,
+              std::size_t level,
+              position_type const& q,
+              std::uint32_t exclude,
+              detail::nearest_t& best) const {
+    node_t const& node = nodes[i];
+    if (detail::box_distance(q, node.lo, node.hi) > best.worst())
+      return;
+    if (level == depth) {
+      for (std::uint32_t p = node.begin; p < node.end; ++p) {
+        double d = detail::squared_distance(q, points.sorted[p]);
+        if (d <= best.worst() && points.order[p] != exclude)
+          best.offer(d, points.order[p]);
+      }
+      return;
+    }
+    std::size_t near = q[node.dimension] < node.split ? 1 : 2;
+    search(2 * i + near, level + 1, q, exclude, best);
+    search(2 * i + 3 - near, level + 1, q, exclude, best);
+  }
+
+  template <typename op_t>
+  void visit(std::size_t i,
+             std::size_t level,
+             position_type const& q,
+             double squared,
+             op_t& op) const {
+    node_t const& node = nodes[i];
+    if (detail::box_distance(q, node.lo, node.hi) > squared)
+      return;
+    if (level == depth) {
+      for (std::uint32_t p = node.begin; p < node.end; ++p) {
+        double d = detail::squared_distance(q, points.sorted[p]);
+        if (d <= squared)
+          op(points.order[p], d);
+      }
+      return;
+    }
+    visit(2 * i + 1, level + 1, q, squared, op);
+    visit(2 * i + 2, level + 1, q, squared, op);
+  }
+
+  detail::points_t<dimensions> points;
+  std::vector<node_t> nodes;
+  std::size_t depth = 0;
+};
+
+/**
+ * @brief Uniform grid: the bounding box is cut into cubic cells holding about
+ * `points_per_cell` points each, and only the occupied cells are stored
+ * (points sorted by cell, cells found through a hash table). Nearest-neighbor
+ * queries visit rings of cells around the query's cell until no unvisited
+ * cell can hold a closer point. Best on evenly spread points; points on a
+ * surface (latitude/longitude on the sphere) fill few cells of a volume, so
+ * the cell size is then corrected once for the occupancy actually found.
+ */
+template <std::size_t dimensions>
+class grid_t {
+ public:
+  using position_type = position_t<dimensions>;
+
+  grid_t() = default;
+
+  /**
+   * @param positions positions of the points (see `spatial::positions()`).
+   * @param points_per_cell target occupancy of a cell.
+   */
+  explicit grid_t(std::vector<position_type> positions,
+                  double points_per_cell = 4)
+      : points(std::move(positions)) {
+    std::size_t n = points.order.size();
+    if (n == 0)
+      return;
+    lo.fill(detail::infinity);
+    position_type hi;
+    hi.fill(-detail::infinity);
+    for (std::uint32_t i : points.order)
+      for (std::size_t d = 0; d < dimensions; ++d) {
+        lo[d] = std::min(lo[d], points.positions[i][d]);
+        hi[d] = std::max(hi[d], points.positions[i][d]);
+      }
+
+    // Cell size of `points_per_cell` points per cell if the points filled
+    // the (non-flat dimensions of the) bounding box evenly.
+    points_per_cell = std::max(points_per_cell, 1.0);
+    double volume = 1;
+    std::size_t spread = 0;
+    for (std::size_t d = 0; d < dimensions; ++d)
+      if (hi[d] > lo[d]) {
+        volume *= hi[d] - lo[d];
+        ++spread;
+      }
+    cell = spread ? std::pow(volume * points_per_cell / n, 1.0 / spread) : 1;
+
+    bin(hi);
+    double occupancy = double(n) / keys.size();
+    if (spread > 1 && occupancy > 2 * points_per_cell) {
+      cell *= std::pow(points_per_cell / occupancy, 1.0 / (spread - 1));
+      bin(hi);
+    }
+  }
+
+  std::size_t size() const { return points.positions.size(); }
+  bool valid(std::size_t i) const { return detail::is_finite(position(i)); }
+  position_type const& position(std::size_t i) const {
+    return points.positions[i];
+  }
+
+  /// IDs of the indexed points, in index order.
+  std::vector<std::uint32_t> const& order() const { return points.order; }
+
+  void nearest(position_type const& q,
+               std::size_t k,
+               std::vector<neighbor_t>& out,
+               std::uint32_t exclude = no_exclude) const {
+    out.clear();
+    if (k == 0 || keys.empty())
+      return;
+    detail::nearest_t best{k, out};
+    cell_t center = cell_of(q);
+    std::int64_t rings = 0;
+    for (std::size_t d = 0; d < dimensions; ++d)
+      rings = std::max({rings, center[d], cells[d] - 1 - center[d]});
+
+    for (std::int64_t r = 0; r <= rings; ++r) {
+      // Unvisited cells are `r` cells away, so at least `(r - 1) * cell`.
+      double gap = std::max<std::int64_t>(r - 1, 0) * cell;
+      if (gap * gap > best.worst())
+        break;
+      cell_t first, last;
+      for (std::size_t d = 0; d < dimensions; ++d) {
+        first[d] = std::max<std::int64_t>(center[d] - r, 0);
+        last[d] = std::min<std::int64_t>(center[d] + r, cells[d] - 1);
+      }
+      for_each_cell(first, last, [&](cell_t const& c) {
+        std::int64_t ring = 0;
+        for (std::size_t d = 0; d < dimensions; ++d)
+          ring = std::max(ring, std::abs(c[d] - center[d]));
+        if (ring != r)
+          return;
+        scan(c, q, best.worst(), [&](std::uint32_t j, double d) {
+          if (j != exclude)
+            best.offer(d, j);
+        });
+      });
+    }
+  }
+
+  template <typename op_t>
+  void within(position_type const& q, double squared, op_t op) const {
+    if (keys.empty())
+      return;
+    double reach = std::sqrt(squared);
+    cell_t first, last;
+    double box = 1;
+    for (std::size_t d = 0; d < dimensions; ++d) {
+      first[d] = clamp(std::floor((q[d] - reach - lo[d]) / cell), d);
+      last[d] = clamp(std::floor((q[d] + reach - lo[d]) / cell), d);
+      box *= double(last[d] - first[d] + 1);
+    }
+    auto visit = [&](cell_t const& c) {
+      scan(c, q, squared, [&](std::uint32_t j, double d) {
+        if (d <= squared)
+          op(j, d);
+      });
+    };
+    if (box <= double(keys.size())) {
+      for_each_cell(first, last, visit);
+    } else {  // Fewer occupied cells than cells in range: visit those.
+      for (std::uint64_t key : keys) {
+        cell_t c = decode(key);
+        bool inside = true;
+        for (std::size_t d = 0; d < dimensions; ++d)
+          inside = inside && first[d] <= c[d] && c[d] <= last[d];
+        if (inside)
+          visit(c);
+      }
+    }
+  }
+
+ private:
+  using cell_t = std::array<std::int64_t, dimensions>;
+  static constexpr std::uint32_t empty = ~std::uint32_t(0);
+  /// Most cells along a dimension, so that cell keys fit in 64 bits.
+  static constexpr std::int64_t max_cells =
+      std::int64_t(1) << (63 / dimensions);
+
+  static std::uint64_t hash(std::uint64_t key) {
+    key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9ull;
+    key = (key ^ (key >> 27)) * 0x94d049bb133111ebull;
+    return key ^ (key >> 31);
+  }
+
+  std::int64_t clamp(double c, std::size_t d) const {
+    if (!(c > 0))
+      return 0;
+    return c >= double(cells[d] - 1) ? cells[d] - 1 : std::int64_t(c);
+  }
+
+  cell_t cell_of(position_type const& p) const {
+    cell_t c;
+    for (std::size_t d = 0; d < dimensions; ++d)
+      c[d] = clamp(std::floor((p[d] - lo[d]) / cell), d);
+    return c;
+  }
+
+  std::uint64_t encode(cell_t const& c) const {
+    std::uint64_t key = 0;
+    for (std::size_t d = 0; d < dimensions; ++d)
+      key = key * std::uint64_t(cells[d]) + std::uint64_t(c[d]);
+    return key;
+  }
+
+  cell_t decode(std::uint64_t key) const {
+    cell_t c;
+    for (std::size_t d = dimensions; d-- > 0;) {
+      c[d] = std::int64_t(key % std::uint64_t(cells[d]));
+      key /= std::uint64_t(cells[d]);
+    }
+    return c;
+  }
+
+  /// Calls `op(c)` for every cell `c` of the box `[first, last]`.
+  template <typename op_t>
+  void for_each_cell(cell_t const& first, cell_t const& last, op_t op) const {
+    cell_t c = first;
+    while (true) {
+      op(c);
+      std::size_t d = dimensions;
+      while (d-- > 0) {
+        if (c[d] < last[d]) {
+          ++c[d];
+          break;
+        }
+        c[d] = first[d];
+      }
+      if (d == std::size_t(-1))
+        return;
+    }
+  }
+
+  /// Calls `op(j, squared_distance)` for the points of cell `c`, unless the
+  /// cell is farther than `bound` from `q`.
+  template <typename op_t>
+  void scan(cell_t const& c,
+            position_type const& q,
+            double bound,
+            op_t op) const {
+    position_type box_lo, box_hi;
+    for (std::size_t d = 0; d < dimensions; ++d) {
+      box_lo[d] = lo[d] + c[d] * cell;
+      box_hi[d] = box_lo[d] + cell;
+    }
+    if (detail::box_distance(q, box_lo, box_hi) > bound)
+      return;
+    std::uint64_t key = encode(c);
+    std::size_t mask = table.size() - 1;
+    for (std::size_t h = hash(key) & mask; table[h] != empty;
+         h = (h + 1) & mask) {
+      std::uint32_t k = table[h];
+      if (keys[k] != key)
+        continue;
+      for (std::uint32_t p = starts[k]; p < starts[k + 1]; ++p)
+        op(points.order[p], detail::squared_distance(q, points.sorted[p]));
+      return;
+    }
+  }
+
+  /// Sorts the points by cell and builds the table of occupied cells.
+  void bin(position_type const& hi) {
+    auto& order = points.order;
+    std::size_t n = order.size();
+    for (std::size_t d = 0; d < dimensions; ++d) {
+      cell = std::max(cell, (hi[d] - lo[d]) / double(max_cells - 1));
+      if (!(cell > 0))
+        cell = 1;
+    }
+    for (std::size_t d = 0; d < dimensions; ++d)
+      cells[d] = std::int64_t((hi[d] - lo[d]) / cell) + 1;
+
+    std::vector<std::pair<std::uint64_t, std::uint32_t>> binned(n);
+    util::parallel::for_each(std::size_t(0), n, [&](std::size_t p) {
+      binned[p] = {encode(cell_of(points.positions[order[p]])), order[p]};
+    });
+    util::parallel::sort(binned.begin(), binned.end());
+
+    keys.clear();
+    starts.clear();
+    for (std::size_t p = 0; p < n; ++p) {
+      order[p] = binned[p].second;
+      if (p == 0 || binned[p].first != binned[p - 1].first) {
+        keys.push_back(binned[p].first);
+        starts.push_back(std::uint32_t(p));
+      }
+    }
+    starts.push_back(std::uint32_t(n));
+
+    points.arrange();
+
+    std::size_t capacity = 1;
+    while (capacity < 2 * keys.size())
+      capacity <<= 1;
+    table.assign(capacity, empty);
+    for (std::uint32_t k = 0; k < keys.size(); ++k) {
+      std::size_t h = hash(keys[k]) & (capacity - 1);
+      while (table[h] != empty)
+        h = (h + 1) & (capacity - 1);
+      table[h] = k;
+    }
+  }
+
+  detail::points_t<dimensions> points;
+  position_type lo{};
+  double cell = 1;
+  cell_t cells{};
+  std::vector<std::uint64_t> keys;
+  std::vector<std::uint32_t> starts;
+  std::vector<std::uint32_t> table;
+};
+
+}  // namespace spatial
+}  // namespace host
+}  // namespace gunrock
@@ -0,0 +1,453 @@
+/**
+ * @file spgemm.hxx
+ * @brief Row-wise (Gustavson) Sparse-Matrix-Matrix multiplication on the host
+ * (CPU), with symbolic and numeric phases and per-row hash or dense
+ * accumulators.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <gunrock/algorithms/host/adjacency.hxx>
+#include <gunrock/error.hxx>
+#include <gunrock/formats/formats.hxx>
+#include <gunrock/util/parallel.hxx>
+
+namespace gunrock {
+namespace host {
+namespace spgemm {
+
+enum class accumulator_t {
+  /// Per row: dense for rows with many products, hash otherwise.
+  automatic,
+  /// Open-addressing hash table sized after the row.
+  hash,
+  /// Array of `number_of_columns` entries per thread.
+  dense
+};
+
+struct param_t {
+  accumulator_t accumulator = accumulator_t::automatic;
+  /// `automatic`: rows with at least `number_of_columns / dense_ratio`
+  /// products use the dense accumulator.
+  std::size_t dense_ratio = 16;
+  /// Sort the column indices of every row of C; otherwise they are left in
+  /// order of first appearance.
+  bool sorted = true;
+};
+
+/**
+ * @brief Work and memory of a product, filled by `run()` on request.
+ */
+struct summary_t {
+  /// Multiply-adds, `sum(nnz(B(k, :)))` over the nonzeros `A(i, k)`.
+  std::size_t flops = 0;
+  /// Nonzeros of C.
+  std::size_t nonzeros = 0;
+  /// Rows of C computed with each accumulator (rows without products count
+  /// in neither).
+  std::size_t hash_rows = 0;
+  std::size_t dense_rows = 0;
+  /// Peak temporary memory (row work, row sizes, accumulators) and size of
+  /// C, in bytes.
+  std::size_t workspace_bytes = 0;
+  std::size_t output_bytes = 0;
+  /// Time of the symbolic phase (row work and sizes) and of the numeric one,
+  /// in milliseconds.
+  float symbolic_time = 0;
+  float numeric_time = 0;
+};
+
+namespace detail {
+
+/// Row chunks per thread; each holds about the same number of products.
+constexpr std::size_t chunks_per_thread = 16;
+
+/// Sorted dense rows with at least `number_of_columns / scan_ratio` columns
+/// are read back by scanning the accumulator instead of sorting.
+constexpr std::size_t scan_ratio = 32;
+
+/**
+ * @brief Set (or map to values) of the columns of one row of C, in an
+ * open-addressing table of `2^k >= 2 * size` slots with linear probing.
+ */
+template <typename vertex_t, typename weight_t>
+struct hash_t {
+  std::vector<vertex_t> keys;
+  std::vector<weight_t> values;
+  std::size_t mask = 0;
+  int shift = 0;
+
+  static constexpr vertex_t empty = std::numeric_limits<vertex_t>::max();
+
+  /// Clears the table, with room for `size` columns.
+  void reset(std::size_t size, bool with_values) {
+    std::size_t capacity = 16;
+    shift = 60;
+    while (capacity < 2 * size) {
+      capacity *= 2;
+      --shift;
+    }
+    if (keys.size() < capacity)
+      keys.resize(capacity);
+    if (with_values && values.size() < capacity)
+      values.resize(capacity);
+    mask = capacity - 1;
+    std::fill_n(keys.data(), capacity, empty);
+  }
+
+  std::size_t find(vertex_t column) const {
+    std::size_t slot =
+        ((std::uint64_t(column) * 0x9E3779B97F4A7C15ull) >> shift) & mask;
+    while (keys[slot] != column && keys[slot] != empty)
+      slot = (slot + 1) & mask;
+    return slot;
+  }
+
+  /// Inserts `column`; returns true if it was not there.
+  bool insert(vertex_t column) {
+    std::size_t slot = find(column);
+    if (keys[slot] == column)
+      return false;
+    keys[slot] = column;
+    return true;
+  }
+
+  /// Adds `value` to the entry of `column`; returns true if it was new.
+  bool add(vertex_t column, weight_t value) {
+    std::size_t slot = find(column);
+    if (keys[slot] == column) {
+      values[slot] += value;
+      return false;
+    }
+    keys[slot] = column;
+    values[slot] = value;
+    return true;
+  }
+
+  weight_t get(vertex_t column) const { return values[find(column)]; }
+
+  std::size_t bytes() const {
+    return keys.capacity() * sizeof(vertex_t) +
+           values.capacity() * sizeof(weight_t);
+  }
+};
+
+/**
+ * @brief Same interface over one entry per column of C. An entry belongs to
+ * the current row when its stamp is the row's, so rows never clear it.
+ */
+template <typename vertex_t, typename weight_t>
+struct dense_t {
+  std::vector<std::size_t> stamps;
+  std::vector<weight_t> values;
+  std::size_t stamp = 0;
+
+  void reset(std::size_t number_of_columns, bool with_values) {
+    if (stamps.size() < number_of_columns)
+      stamps.assign(number_of_columns, 0);
+    if (with_values && values.size() < number_of_columns)
+      values.resize(number_of_columns);
+    ++stamp;
+  }
+
+  bool insert(vertex_t column) {
+    if (stamps[column] == stamp)
+      return false;
+    stamps[column] = stamp;
+    return true;
+  }
+
+  bool add(vertex_t column, weight_t value) {
+    if (stamps[column] == stamp) {
+      values[column] += value;
+      return false;
+    }
+    stamps[column] = stamp;
+    values[column] = value;
+    return true;
+  }
+
+  weight_t get(vertex_t column) const { return values[column]; }
+
+  std::size_t bytes() const {
+    return stamps.capacity() * sizeof(std::size_t) +
+           values.capacity() * sizeof(weight_t);
+  }
+};
+
+}  // namespace detail
+
+/**
+ * @brief C = A * B over the row lists of A and B (see host::csr_adjacency_t
+ * for the interface they provide).
+ *
+ * @par Overview
+ * Gustavson's algorithm: row `i` of C is the sum of the rows `B(k, :)`
+ * scaled by the nonzeros `A(i, k)`. The symbolic phase counts the products
+ * of every row, splits the rows into chunks of about the same number of
+ * products (plus one per row) for load balance, and counts the distinct
+ * columns of each row exactly, so that C is allocated once and at its final
+ * size. The numeric phase recomputes every row into its slice of C. Each
+ * thread owns one hash and one dense accumulator, and each row uses the one
+ * its product count calls for: the hash table, sized after the row, stays in
+ * cache for light rows; the dense array, indexed by column, avoids probing
+ * for heavy ones. Rows with one product or none skip the accumulator.
+ *
+ * The result is the same for any thread count. Explicit zeros are kept (a
+ * column of C is a nonzero if any product reaches it), and duplicate columns
+ * within a row of A or B are summed.
+ *
+ * @param m number of rows of A (and C).
+ * @param n number of columns of B (and C).
+ * @param A row lists of A (columns in `[0, number of rows of B)`).
+ * @param B row lists of B (columns in `[0, n)`).
+ * @param c_offsets output, row offsets of C (resized to `m + 1`).
+ * @param c_indices output, column indices of C (resized).
+ * @param c_values output, nonzero values of C (resized).
+ * @param summary output, work and memory of the product. May be `nullptr`.
+ * @param param accumulator and ordering parameters.
+ * @return float elapsed time in milliseconds.
+ */
+template <typename vertex_t,
+          typename a_adjacency_t,
+          typename b_adjacency_t,
+          typename offsets_vector_t,
+          typename indices_vector_t,
+          typename values_vector_t>
+float run(vertex_t m,
+          vertex_t n,
+          a_adjacency_t const& A,
+          b_adjacency_t const& B,
+          offsets_vector_t& c_offsets,
+          indices_vector_t& c_indices,
+          values_vector_t& c_values,
+          summary_t* summary = nullptr,
+          param_t param = param_t()) {
+  using namespace std::chrono;
+  using edge_t = std::decay_t<decltype(c_offsets[0])>;
+  using weight_t = std::decay_t<decltype(c_values[0])>;
+  using hash_t = detail::hash_t<vertex_t, weight_t>;
+  using dense_t = detail::dense_t<vertex_t, weight_t>;
+  const std::size_t num_rows = m;
+  const std::size_t num_columns = n;
+
+  auto t_start = high_resolution_clock::now();
+
+  // Row work: products, plus one for the row itself.
+  std::vector<std::size_t> work(num_rows + 1);
+  std::size_t total_work = util::parallel::transform_exclusive_scan<
+      std::size_t>(
+      num_rows,
+      [&](std::size_t i) {
+        std::size_t products = 1;
+        A.for_each_neighbor(vertex_t(i), [&](vertex_t k, auto) {
+          products += B.get_number_of_neighbors(k);
+        });
+        return products;
+      },
+      work.data());
+  std::size_t flops = total_work - num_rows;
+  auto products = [&](std::size_t i) { return work[i + 1] - work[i] - 1; };
+
+  // Row chunks of about `target` work each.
+  std::size_t num_threads = util::parallel::number_of_threads();
+  std::size_t target = std::max<std::size_t>(
+      total_work / (num_threads * detail::chunks_per_thread), 1);
+  std::vector<std::size_t> bounds(1, 0);
+  while (bounds.back() < num_rows) {
+    std::size_t first = bounds.back();
+    auto last = std::lower_bound(work.begin() + first + 1, work.end(),
+                                 work[first] + target);
+    bounds.push_back(std::min<std::size_t>(last - work.begin(), num_rows));
+  }
+  std::size_t num_chunks = bounds.size() - 1;
+
+  auto use_dense = [&](std::size_t p) {
+    if (param.accumulator == accumulator_t::automatic)
+      return param.dense_ratio > 0 && p * param.dense_ratio >= num_columns;
+    return param.accumulator == accumulator_t::dense;
+  };
+
+  std::vector<hash_t> hashes(num_threads);
+  std::vector<dense_t> denses(num_threads);
+  std::vector<std::size_t> hash_rows(num_threads, 0);
+  std::vector<std::size_t> dense_rows(num_threads, 0);
+
+  // Symbolic: exact number of columns of each row.
+  std::vector<edge_t> sizes(num_rows);
+  auto count_row = [&](std::size_t i, auto& accumulator) {
+    edge_t count = 0;
+    A.for_each_neighbor(vertex_t(i), [&](vertex_t k, auto) {
+      B.for_each_neighbor(k, [&](vertex_t j, auto) {
+        count += accumulator.insert(j);
+      });
+    });
+    return count;
+  };
+
+  util::parallel::for_each_chunk_id(
+      num_chunks, [&](std::size_t tid, std::size_t c) {
+        for (std::size_t i = bounds[c]; i < bounds[c + 1]; ++i) {
+          std::size_t p = products(i);
+          if (p <= 1) {
+            sizes[i] = edge_t(p);
+          } else if (use_dense(p)) {
+            denses[tid].reset(num_columns, false);
+            sizes[i] = count_row(i, denses[tid]);
+            ++dense_rows[tid];
+          } else {
+            hashes[tid].reset(std::min(p, num_columns), false);
+            sizes[i] = count_row(i, hashes[tid]);
+            ++hash_rows[tid];
+          }
+        }
+      });
+
+  std::size_t nonzeros = 0;
+  for (std::size_t i = 0; i < num_rows; ++i)
+    nonzeros += sizes[i];
+  error::throw_if_exception(
+      nonzeros > std::size_t(std::numeric_limits<edge_t>::max()),
+      "host::spgemm: the product has more nonzeros than its offset type "
+      "holds.");
+
+  c_offsets.resize(num_rows + 1);
+  util::parallel::transform_exclusive_scan<edge_t>(
+      num_rows, [&](std::size_t i) { return sizes[i]; }, c_offsets.data());
+  c_indices.resize(nonzeros);
+  c_values.resize(nonzeros);
+
+  auto t_symbolic = high_resolution_clock::now();
+
+  // Numeric: the columns are written in order of first appearance (then
+  // sorted on request), the values gathered from the accumulator.
+  vertex_t* indices = c_indices.data();
+  weight_t* values = c_values.data();
+  auto fill_row = [&](std::size_t i, auto& accumulator) {
+    vertex_t* out = indices + c_offsets[i];
+    std::size_t count = 0;
+    A.for_each_neighbor(vertex_t(i), [&](vertex_t k, auto a) {
+      weight_t a_ik = A.get_edge_weight(a);
+      B.for_each_neighbor(k, [&](vertex_t j, auto b) {
+        if (accumulator.add(j, a_ik * B.get_edge_weight(b)))
+          out[count++] = j;
+      });
+    });
+    if (param.sorted) {
+      // Dense rows of many columns come out in order by scanning the stamps.
+      if constexpr (std::is_same_v<std::decay_t<decltype(accumulator)>,
+                                   dense_t>) {
+        if (count * detail::scan_ratio >= num_columns) {
+          count = 0;
+          for (std::size_t j = 0; j < num_columns; ++j)
+            if (accumulator.stamps[j] == accumulator.stamp)
+              out[count++] = vertex_t(j);
+        } else {
+          std::sort(out, out + count);
+        }
+      } else {
+        std::sort(out, out + count);
+      }
+    }
+    weight_t* out_values = values + c_offsets[i];
+    for (std::size_t l = 0; l < count; ++l)
+      out_values[l] = accumulator.get(out[l]);
+  };
+
+  util::parallel::for_each_chunk_id(
+      num_chunks, [&](std::size_t tid, std::size_t c) {
+        for (std::size_t i = bounds[c]; i < bounds[c + 1]; ++i) {
+          std::size_t p = products(i);
+          if (p == 0)
+            continue;
+          if (p == 1) {
+            A.for_each_neighbor(vertex_t(i), [&](vertex_t k, auto a) {
+              B.for_each_neighbor(k, [&](vertex_t j, auto b) {
+                indices[c_offsets[i]] = j;
+                values[c_offsets[i]] =
+                    A.get_edge_weight(a) * B.get_edge_weight(b);
+              });
+            });
+          } else if (use_dense(p)) {
+            denses[tid].reset(num_columns, true);
+            fill_row(i, denses[tid]);
+          } else {
+            hashes[tid].reset(std::size_t(sizes[i]), true);
+            fill_row(i, hashes[tid]);
+          }
+        }
+      });
+
+  auto t_stop = high_resolution_clock::now();
+
+  if (summary) {
+    summary->flops = flops;
+    summary->nonzeros = nonzeros;
+    summary->hash_rows = summary->dense_rows = 0;
+    summary->workspace_bytes = (work.size() + bounds.size()) *
+                                   sizeof(std::size_t) +
+                               sizes.size() * sizeof(edge_t);
+    for (std::size_t t = 0; t < num_threads; ++t) {
+      summary->hash_rows += hash_rows[t];
+      summary->dense_rows += dense_rows[t];
+      summary->workspace_bytes += hashes[t].bytes() + denses[t].bytes();
+    }
+    summary->output_bytes = (num_rows + 1) * sizeof(edge_t) +
+                            nonzeros * (sizeof(vertex_t) + sizeof(weight_t));
+    summary->symbolic_time =
+        duration<float, std::milli>(t_symbolic - t_start).count();
+    summary->numeric_time =
+        duration<float, std::milli>(t_stop - t_symbolic).count();
+  }
+
+  return duration<float, std::milli>(t_stop - t_start).count();
+}
+
+/**
+ * @brief C = A * B for host CSR matrices.
+ *
+ * @param A left operand.
+ * @param B right operand (`A.number_of_columns == B.number_of_rows`).
+ * @param C output, `A.number_of_rows x B.number_of_columns`.
+ * @param summary output, work and memory of the product. May be `nullptr`.
+ * @param param accumulator and ordering parameters.
+ * @return float elapsed time in milliseconds.
+ */
+template <typename index_t, typename offset_t, typename value_t>
+float run(format::csr_t<memory_space_t::host, index_t, offset_t, value_t> const&
+              A,
+          format::csr_t<memory_space_t::host, index_t, offset_t, value_t> const&
+              B,
+          format::csr_t<memory_space_t::host, index_t, offset_t, value_t>& C,
+          summary_t* summary = nullptr,
+          param_t param = param_t()) {
+  error::throw_if_exception(A.number_of_columns != B.number_of_rows,
+                            "host::spgemm: A's columns do not match B's rows.");
+  csr_adjacency_t<index_t, offset_t, value_t> a{
+      A.row_offsets.data(), A.column_indices.data(), A.nonzero_values.data()};
+  csr_adjacency_t<index_t, offset_t, value_t> b{
+      B.row_offsets.data(), B.column_indices.data(), B.nonzero_values.data()};
+
+  float elapsed = run(A.number_of_rows, B.number_of_columns, a, b,
+                      C.row_offsets, C.column_indices, C.nonzero_values,
+                      summary, param);
+  C.number_of_rows = A.number_of_rows;
+  C.number_of_columns = B.number_of_columns;
+  C.number_of_nonzeros = C.column_indices.size();
+  return elapsed;
+}
+
+}  // namespace spgemm
+}  // namespace host
+}  // namespace gunrock
@@ -0,0 +1,545 @@
+/**
+ * @file spmv.hxx
+ * @brief Sparse-Matrix Vector (and multi-vector) multiplication on the host
+ * (CPU): row-parallel CSR, merge-path CSR and SELL-C-sigma kernels over a
+ * matrix preprocessed once.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include <gunrock/error.hxx>
+#include <gunrock/formats/formats.hxx>
+#include <gunrock/util/parallel.hxx>
+
+namespace gunrock {
+namespace host {
+namespace spmv {
+
+enum class kernel_t {
+  /// SELL-C-sigma, or merge-path if the row lengths vary too much.
+  automatic,
+  /// One row at a time, rows split in work-stolen chunks.
+  csr,
+  /// Rows and nonzeros merged and split evenly (Merrill & Garland), for
+  /// very irregular rows.
+  merge_path,
+  /// Slices of `slice_height` rows stored column by column (padded to the
+  /// longest row), so that the rows of a slice are computed in SIMD lanes.
+  sell
+};
+
+struct param_t {
+  kernel_t kernel = kernel_t::automatic;
+  /// SELL sorting window (sigma): rows are sorted by length within windows of
+  /// this many rows (rounded up to a multiple of the slice height), which
+  /// bounds the padding while keeping nearby rows together. 1: no sorting.
+  std::size_t sort_window = 256;
+  /// `automatic`: merge-path once the coefficient of variation of the row
+  /// lengths (standard deviation / mean) reaches this.
+  double irregular_cv = 2;
+};
+
+/**
+ * @brief Shape of the matrix and of its preprocessed layout.
+ */
+struct summary_t {
+  std::size_t rows = 0;
+  std::size_t nonzeros = 0;
+  /// Row lengths: mean, coefficient of variation and maximum.
+  double mean_row_length = 0;
+  double row_length_cv = 0;
+  std::size_t max_row_length = 0;
+  /// Entries stored by the SELL layout, padding included (0 without one),
+  /// and their excess over the nonzeros, `padded / nonzeros - 1`.
+  std::size_t padded_nonzeros = 0;
+  double padding_ratio = 0;
+  /// Kernel chosen.
+  kernel_t kernel = kernel_t::csr;
+  /// Time of the preprocessing, in milliseconds.
+  float preprocessing_time = 0;
+};
+
+namespace detail {
+
+/// Rows of a SELL slice: one AVX2 register of floats (AVX-512 of doubles).
+constexpr std::size_t slice_height = 8;
+/// Rows per chunk of the CSR kernel, slices per chunk of the SELL kernel.
+constexpr std::size_t rows_per_chunk = 256;
+constexpr std::size_t slices_per_chunk = 32;
+/// Merge items (rows + nonzeros) per merge-path chunk.
+constexpr std::size_t items_per_chunk = 4096;
+
+/**
+ * @brief Calls `op(std::integral_constant<std::size_t, W>(), column)` for
+ * column blocks of widths 16, 8, 4, 2 and 1 covering `[0, k)`, so that every
+ * kernel keeps its `W` accumulators per row in registers.
+ */
+template <typename op_t>
+void for_each_block(std::size_t k, op_t op) {
+  std::size_t c = 0;
+  for (; c + 16 <= k; c += 16)
+    op(std::integral_constant<std::size_t, 16>(), c);
+  if (c + 8 <= k) {
+    op(std::integral_constant<std::size_t, 8>(), c);
+    c += 8;
+  }
+  if (c + 4 <= k) {
+    op(std::integral_constant<std::size_t, 4>(), c);
+    c += 4;
+  }
+  if (c + 2 <= k) {
+    op(std::integral_constant<std::size_t, 2>(), c);
+    c += 2;
+  }
+  if (c < k)
+    op(std::integral_constant<std::size_t, 1>(), c);
+}
+
+/// `sum[0 .. W) += A(row, :) * X[:, c .. c + W)` over `[first, last)`.
+template <std::size_t W,
+          typename vertex_t,
+          typename edge_t,
+          typename weight_t>
+inline void accumulate(edge_t first,
+                       edge_t last,
+                       vertex_t const* indices,
+                       weight_t const* values,
+                       weight_t const* X,
+                       std::size_t k,
+                       weight_t* sum) {
+  for (edge_t e = first; e < last; ++e) {
+    weight_t v = values[e];
+    weight_t const* x = X + std::size_t(indices[e]) * k;
+    for (std::size_t l = 0; l < W; ++l)
+      sum[l] += v * x[l];
+  }
+}
+
+/**
+ * @brief Merge-path search: the point of diagonal `d` on the merge of the
+ * row ends (`offsets[1 ..]`) and the nonzeros, as (rows consumed, nonzeros
+ * consumed).
+ */
+template <typename edge_t>
+std::pair<std::size_t, std::size_t> merge_path_search(std::size_t d,
+                                                      edge_t const* offsets,
+                                                      std::size_t rows,
+                                                      std::size_t nonzeros) {
+  std::size_t low = d > nonzeros ? d - nonzeros : 0;
+  std::size_t high = std::min(d, rows);
+  while (low < high) {
+    std::size_t pivot = low + (high - low) / 2;
+    if (std::size_t(offsets[pivot + 1]) <= d - pivot - 1)
+      low = pivot + 1;
+    else
+      high = pivot;
+  }
+  return {low, d - low};
+}
+
+}  // namespace detail
+
+/**
+ * @brief Host CSR matrix preprocessed for repeated products `Y = A X`.
+ *
+ * @par Overview
+ * The constructor measures the row lengths and, if the chosen kernel needs
+ * it, builds the SELL-C-sigma layout; every `multiply()` then reuses it, so
+ * the cost is paid once per matrix (iterative solvers, power iterations).
+ *
+ * - **csr**: each row is a dot product; the rows are split in fixed-size,
+ *   work-stolen chunks. Fine for regular rows.
+ * - **merge_path**: the row ends and the nonzeros are merged into one list,
+ *   split evenly between chunks, so every chunk does the same work however
+ *   long the rows. A row cut between chunks is finished by adding the
+ *   partial sums of the earlier chunks once all are done.
+ * - **sell**: rows are sorted by length within windows of `sort_window` rows
+ *   and grouped in slices of `slice_height`; a slice stores its `j`-th
+ *   nonzeros together, padded with zeros to its longest row. The rows of a
+ *   slice are computed in SIMD lanes (with AVX2 gathers for `float` and
+ *   32-bit indices).
+ * - **automatic**: merge-path once the coefficient of variation of the row
+ *   lengths reaches `irregular_cv` (power-law rows), SELL otherwise.
+ *
+ * Multi-vector products (SpMM) take `k` right-hand sides stored row-major
+ * (`X[j * k + l]`) and are computed in column blocks of up to 16 vectors,
+ * each block reading the matrix once. The CSR arrays are not copied: they
+ * must outlive the object. Results are the same for any thread count.
+ *
+ * @tparam vertex_t column index type.
+ * @tparam edge_t row offset type.
+ * @tparam weight_t value type.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+class matrix_t {
+ public:
+  /**
+   * @param rows number of rows.
+   * @param columns number of columns.
+   * @param row_offsets CSR row offsets (size `rows + 1`).
+   * @param column_indices CSR column indices.
+   * @param nonzero_values CSR nonzero values.
+   * @param param kernel choice and SELL parameters.
+   */
+  matrix_t(vertex_t rows,
+           vertex_t columns,
+           edge_t const* row_offsets,
+           vertex_t const* column_indices,
+           weight_t const* nonzero_values,
+           param_t param = param_t())
+      : number_of_rows(rows),
+        number_of_columns(columns),
+        offsets(row_offsets),
+        indices(column_indices),
+        values(nonzero_values) {
+    using namespace std::chrono;
+    auto t_start = high_resolution_clock::now();
+
+    const std::size_t m = rows;
+    summary.rows = m;
+    summary.nonzeros = m ? std::size_t(offsets[m]) : 0;
+    if (m > 0) {
+      double mean = double(summary.nonzeros) / m;
+      double squares = 0;
+      std::size_t longest = 0;
+      for (std::size_t i = 0; i < m; ++i) {
+        std::size_t length = offsets[i + 1] - offsets[i];
+        squares += (length - mean) * (length - mean);
+        longest = std::max(longest, length);
+      }
+      summary.mean_row_length = mean;
+      summary.row_length_cv = mean > 0 ? std::sqrt(squares / m) / mean : 0;
+      summary.max_row_length = longest;
+    }
+
+    summary.kernel = param.kernel;
+    if (param.kernel == kernel_t::automatic)
+      summary.kernel = (summary.row_length_cv >= param.irregular_cv)
+                           ? kernel_t::merge_path
+                           : kernel_t::sell;
+    if (summary.kernel == kernel_t::sell)
+      build_sell(param.sort_window);
+
+    auto t_stop = high_resolution_clock::now();
+    summary.preprocessing_time =
+        duration<float, std::milli>(t_stop - t_start).count();
+  }
+
+  /**
+   * @brief Preprocesses a host CSR matrix.
+   */
+  explicit matrix_t(
+      format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> const&
+          csr,
+      param_t param = param_t())
+      : matrix_t(csr.number_of_rows,
+                 csr.number_of_columns,
+                 csr.row_offsets.data(),
+                 csr.column_indices.data(),
+                 csr.nonzero_values.data(),
+                 param) {}
+
+  kernel_t kernel() const { return summary.kernel; }
+  summary_t const& get_summary() const { return summary; }
+  vertex_t get_number_of_rows() const { return number_of_rows; }
+  vertex_t get_number_of_columns() const { return number_of_columns; }
+
+  /**
+   * @brief y = A x.
+   *
+   * @param x input vector (size `number_of_columns`).
+   * @param y output vector (size `number_of_rows`).
+   * @return float elapsed time in milliseconds.
+   */
+  float multiply(weight_t const* x, weight_t* y) const {
+    return multiply(x, y, 1);
+  }
+
+  /**
+   * @brief Y = A X for `k` right-hand sides.
+   *
+   * @param X input vectors, row-major `number_of_columns x k`.
+   * @param Y output vectors, row-major `number_of_rows x k`.
+   * @param k number of vectors.
+   * @return float elapsed time in milliseconds.
+   */
+  float multiply(weight_t const* X, weight_t* Y, std::size_t k) const {
+    using namespace std::chrono;
+    auto t_start = high_resolution_clock::now();
+
+    detail::for_each_block(k, [&](auto width, std::size_t c) {
+      constexpr std::size_t W = decltype(width)::value;
+      switch (summary.kernel) {
+        case kernel_t::merge_path:
+          merge_path<W>(X + c, Y + c, k);
+          break;
+        case kernel_t::sell:
+          sell<W>(X + c, Y + c, k);
+          break;
+        default:
+          csr<W>(X + c, Y + c, k);
+      }
+    });
+
+    auto t_stop = high_resolution_clock::now();
+    return duration<float, std::milli>(t_stop - t_start).count();
+  }
+
+ private:
+  static constexpr std::size_t C = detail::slice_height;
+
+  /**
+   * @brief Builds the SELL-C-sigma layout: `rows` (position in slice order
+   * -> row, padded with `number_of_rows`), the slice offsets, and the
+   * columns and values of slice `s` at `slice_offsets[s] + j * C + lane`.
+   * Padding entries repeat the row's last column with a zero value; the
+   * kernel skips them (`0 * x` is NaN for an infinite or NaN `x`).
+   */
+  void build_sell(std::size_t sort_window) {
+    const std::size_t m = number_of_rows;
+    const std::size_t num_slices = (m + C - 1) / C;
+    std::size_t sigma = std::max<std::size_t>(sort_window, 1);
+    sigma = (sigma + C - 1) / C * C;
+
+    auto length = [&](std::size_t i) {
+      return std::size_t(offsets[i + 1] - offsets[i]);
+    };
+
+    sell_rows.resize(num_slices * C);
+    std::iota(sell_rows.begin(), sell_rows.begin() + m, vertex_t(0));
+    std::fill(sell_rows.begin() + m, sell_rows.end(), number_of_rows);
+    if (sigma > C) {
+      util::parallel::for_each(
+          std::size_t(0), (m + sigma - 1) / sigma,
+          [&](std::size_t w) {
+            auto first = sell_rows.begin() + w * sigma;
+            auto last = sell_rows.begin() + std::min(m, (w + 1) * sigma);
+            std::stable_sort(first, last, [&](vertex_t a, vertex_t b) {
+              return length(a) > length(b);
+            });
+          },
+          std::size_t(1));
+    }
+
+    slice_offsets.resize(num_slices + 1);
+    util::parallel::transform_exclusive_scan<std::size_t>(
+        num_slices,
+        [&](std::size_t s) {
+          std::size_t width = 0;
+          for (std::size_t lane = 0; lane < C; ++lane) {
+            vertex_t row = sell_rows[s * C + lane];
+            if (row < number_of_rows)
+              width = std::max(width, length(row));
+          }
+          return width * C;
+        },
+        slice_offsets.data());
+
+    std::size_t stored = slice_offsets[num_slices];
+    sell_indices.resize(stored);
+    sell_values.resize(stored);
+    util::parallel::for_each(std::size_t(0), num_slices, [&](std::size_t s) {
+      std::size_t width = (slice_offsets[s + 1] - slice_offsets[s]) / C;
+      for (std::size_t lane = 0; lane < C; ++lane) {
+        vertex_t row = sell_rows[s * C + lane];
+        std::size_t n = (row < number_of_rows) ? length(row) : 0;
+        edge_t first = (row < number_of_rows) ? offsets[row] : 0;
+        vertex_t pad = n ? indices[first + n - 1] : vertex_t(0);
+        for (std::size_t j = 0; j < width; ++j) {
+          std::size_t slot = slice_offsets[s] + j * C + lane;
+          sell_indices[slot] = j < n ? indices[first + j] : pad;
+          sell_values[slot] = j < n ? values[first + j] : weight_t(0);
+        }
+      }
+    });
+
+    summary.padded_nonzeros = stored;
+    summary.padding_ratio =
+        summary.nonzeros ? double(stored) / summary.nonzeros - 1 : 0;
+  }
+
+  template <std::size_t W>
+  void csr(weight_t const* X, weight_t* Y, std::size_t k) const {
+    util::parallel::for_each_chunk(
+        std::size_t(0), std::size_t(number_of_rows),
+        [&](std::size_t first, std::size_t last) {
+          for (std::size_t i = first; i < last; ++i) {
+            weight_t sum[W] = {};
+            detail::accumulate<W>(offsets[i], offsets[i + 1], indices, values,
+                                  X, k, sum);
+            for (std::size_t l = 0; l < W; ++l)
+              Y[i * k + l] = sum[l];
+          }
+        },
+        detail::rows_per_chunk);
+  }
+
+  template <std::size_t W>
+  void merge_path(weight_t const* X, weight_t* Y, std::size_t k) const {
+    const std::size_t m = number_of_rows;
+    const std::size_t nnz = summary.nonzeros;
+    const std::size_t items = m + nnz;
+    if (items == 0)
+      return;
+    // Fixed chunk size: the row splits, hence the sums, do not depend on the
+    // number of threads.
+    const std::size_t per_chunk = detail::items_per_chunk;
+    std::size_t num_chunks = (items + per_chunk - 1) / per_chunk;
+
+    // Partial sums of the row each chunk ends inside of (`m`: none).
+    std::vector<std::size_t> carry_rows(num_chunks);
+    std::vector<weight_t> carries(num_chunks * W);
+
+    util::parallel::for_each_chunk_id(
+        num_chunks, [&](std::size_t, std::size_t c) {
+          auto [row, nz] = detail::merge_path_search(
+              std::min(c * per_chunk, items), offsets, m, nnz);
+          auto [last_row, last_nz] = detail::merge_path_search(
+              std::min((c + 1) * per_chunk, items), offsets, m, nnz);
+
+          for (; row < last_row; ++row) {
+            weight_t sum[W] = {};
+            detail::accumulate<W>(edge_t(nz), offsets[row + 1], indices,
+                                  values, X, k, sum);
+            nz = offsets[row + 1];
+            for (std::size_t l = 0; l < W; ++l)
+              Y[row * k + l] = sum[l];
+          }
+
+          weight_t sum[W] = {};
+          detail::accumulate<W>(edge_t(nz), edge_t(last_nz), indices, values,
+                                X, k, sum);
+          carry_rows[c] = last_row;
+          for (std::size_t l = 0; l < W; ++l)
+            carries[c * W + l] = sum[l];
+        });
+
+    for (std::size_t c = 0; c < num_chunks; ++c)
+      if (carry_rows[c] < m)
+        for (std::size_t l = 0; l < W; ++l)
+          Y[carry_rows[c] * k + l] += carries[c * W + l];
+  }
+
+  template <std::size_t W>
+  void sell(weight_t const* X, weight_t* Y, std::size_t k) const {
+    const std::size_t num_slices = slice_offsets.size() - 1;
+    util::parallel::for_each_chunk(
+        std::size_t(0), num_slices,
+        [&](std::size_t first, std::size_t last) {
+          for (std::size_t s = first; s < last; ++s) {
+            std::size_t begin = slice_offsets[s];
+            std::size_t width = (slice_offsets[s + 1] - begin) / C;
+            vertex_t const* cols = sell_indices.data() + begin;
+            weight_t const* vals = sell_values.data() + begin;
+            std::size_t lengths[C];
+            for (std::size_t lane = 0; lane < C; ++lane) {
+              vertex_t row = sell_rows[s * C + lane];
+              lengths[lane] = (row < number_of_rows)
+                                  ? std::size_t(offsets[row + 1] - offsets[row])
+                                  : 0;
+            }
+            weight_t sum[C][W] = {};
+            if (!sell_simd<W>(cols, vals, lengths, width, X, k, sum)) {
+              for (std::size_t j = 0; j < width; ++j)
+                for (std::size_t lane = 0; lane < C; ++lane) {
+                  if (j >= lengths[lane])
+                    continue;
+                  weight_t v = vals[j * C + lane];
+                  weight_t const* x =
+                      X + std::size_t(cols[j * C + lane]) * k;
+                  for (std::size_t l = 0; l < W; ++l)
+                    sum[lane][l] += v * x[l];
+                }
+            }
+            for (std::size_t lane = 0; lane < C; ++lane) {
+              vertex_t row = sell_rows[s * C + lane];
+              if (row < number_of_rows)
+                for (std::size_t l = 0; l < W; ++l)
+                  Y[std::size_t(row) * k + l] = sum[lane][l];
+            }
+          }
+        },
+        detail::slices_per_chunk);
+  }
+
+  /// AVX2 slice kernel for one `float` vector and 32-bit indices; returns
+  /// false (nothing done) otherwise. Lanes past their row's length gather
+  /// nothing.
+  template <std::size_t W>
+  static bool sell_simd(vertex_t const* cols,
+                        weight_t const* vals,
+                        std::size_t const (&lengths)[C],
+                        std::size_t width,
+                        weight_t const* X,
+                        std::size_t k,
+                        weight_t (&sum)[C][W]) {
+#if defined(__AVX2__)
+    if constexpr (W == 1 && C == 8 && std::is_same_v<weight_t, float> &&
+                  sizeof(vertex_t) == 4) {
+      if (k != 1)
+        return false;
+      if (width > std::size_t(std::numeric_limits<int>::max()))
+        return false;
+      int length[C];
+      for (std::size_t lane = 0; lane < C; ++lane)
+        length[lane] = int(lengths[lane]);
+      __m256i len = _mm256_loadu_si256((__m256i const*)length);
+      __m256 acc = _mm256_setzero_ps();
+      for (std::size_t j = 0; j < width; ++j) {
+        __m256i idx = _mm256_loadu_si256((__m256i const*)(cols + j * C));
+        __m256 v = _mm256_loadu_ps(vals + j * C);
+        __m256 live = _mm256_castsi256_ps(
+            _mm256_cmpgt_epi32(len, _mm256_set1_epi32(int(j))));
+        __m256 x =
+            _mm256_mask_i32gather_ps(_mm256_setzero_ps(), X, idx, live, 4);
+#if defined(__FMA__)
+        acc = _mm256_fmadd_ps(v, x, acc);
+#else
+        acc = _mm256_add_ps(acc, _mm256_mul_ps(v, x));
+#endif
+      }
+      float out[C];
+      _mm256_storeu_ps(out, acc);
+      for (std::size_t lane = 0; lane < C; ++lane)
+        sum[lane][0] = out[lane];
+      return true;
+    }
+#endif
+    (void)cols, (void)vals, (void)lengths, (void)width, (void)X, (void)k,
+        (void)sum;
+    return false;
+  }
+
+  vertex_t number_of_rows;
+  vertex_t number_of_columns;
+  edge_t const* offsets;
+  vertex_t const* indices;
+  weight_t const* values;
+  summary_t summary;
+
+  std::vector<vertex_t> sell_rows;
+  std::vector<std::size_t> slice_offsets;
+  std::vector<vertex_t> sell_indices;
+  std::vector<weight_t> sell_values;
+};
+
+}  // namespace spmv
+}  // namespace host
+}  // namespace gunrock
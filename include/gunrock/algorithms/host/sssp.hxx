@@ -0,0 +1,379 @@
+/**
+ * @file sssp.hxx
+ * @brief Parallel delta-stepping Single-Source Shortest Path on the host
+ * (CPU). Used as the reference implementation for validation and as a
+ * host-side SSSP.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <gunrock/graph/graph.hxx>
+#include <gunrock/util/parallel.hxx>
+#include <gunrock/util/type_limits.hxx>
+
+namespace gunrock {
+namespace host {
+namespace sssp {
+
+template <typename weight_t>
+struct param_t {
+  /// Bucket width. `0` (default) picks it from the weight distribution, see
+  /// `default_delta()`.
+  weight_t delta = 0;
+};
+
+namespace detail {
+
+/// Frontier vertices per chunk.
+constexpr std::size_t vertices_per_chunk = 64;
+/// Sentinel of `settled`: vertex not in the current bucket's settled set.
+constexpr std::size_t not_settled = std::numeric_limits<std::size_t>::max();
+/// Upper bound on the cyclic bucket array, for very heavy edges.
+constexpr std::size_t max_buckets = std::size_t(1) << 14;
+
+template <typename type_t>
+type_t atomic_load(type_t const* address) {
+  type_t value;
+  __atomic_load(address, &value, __ATOMIC_RELAXED);
+  return value;
+}
+
+/**
+ * @brief Atomically lowers `*address` to `value`; returns true if it did.
+ */
+template <typename type_t>
+bool atomic_min(type_t* address, type_t value) {
+  type_t current = atomic_load(address);
+  while (value < current) {
+    if (__atomic_compare_exchange(address, &current, &value, true,
+                                  __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+      return true;
+  }
+  return false;
+}
+
+/**
+ * @brief Largest edge weight (1 without `values`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+weight_t max_weight(vertex_t n,
+                    edge_t const* row_offsets,
+                    weight_t const* values) {
+  std::size_t m = row_offsets[n] - row_offsets[0];
+  if (!values || m == 0)
+    return weight_t(1);
+
+  std::vector<weight_t> partial(util::parallel::number_of_threads(),
+                                values[row_offsets[0]]);
+  util::parallel::for_each_chunk_id(
+      (m + (1 << 16) - 1) >> 16, [&](std::size_t tid, std::size_t c) {
+        std::size_t first = row_offsets[0] + (c << 16);
+        std::size_t last = std::min<std::size_t>(first + (1 << 16),
+                                                 row_offsets[0] + m);
+        for (std::size_t e = first; e < last; ++e)
+          partial[tid] = std::max(partial[tid], values[e]);
+      });
+  return *std::max_element(partial.begin(), partial.end());
+}
+
+}  // namespace detail
+
+/**
+ * @brief Bucket width picked from the weight distribution: the mean edge
+ * weight scaled up for sparse graphs, `delta = mean_weight * max(1, 32 /
+ * average_degree)`. Low-degree graphs (e.g. road networks) get wide buckets,
+ * so the number of buckets (and of synchronizations) stays small; dense,
+ * scale-free graphs get narrow buckets, which limits re-relaxations.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+weight_t default_delta(vertex_t n,
+                       edge_t const* row_offsets,
+                       weight_t const* values) {
+  std::size_t m = row_offsets[n] - row_offsets[0];
+  if (n == 0 || m == 0)
+    return weight_t(1);
+
+  std::vector<double> partial(util::parallel::number_of_threads(), 0);
+  util::parallel::for_each_chunk_id(
+      (m + (1 << 16) - 1) >> 16, [&](std::size_t tid, std::size_t c) {
+        std::size_t first = row_offsets[0] + (c << 16);
+        std::size_t last = std::min<std::size_t>(first + (1 << 16),
+                                                 row_offsets[0] + m);
+        double sum = 0;
+        for (std::size_t e = first; e < last; ++e)
+          sum += values ? double(values[e]) : 1.0;
+        partial[tid] += sum;
+      });
+
+  double mean = 0;
+  for (auto sum : partial)
+    mean += sum;
+  mean /= double(m);
+  double average_degree = double(m) / double(n);
+  double delta = mean * std::max(1.0, 32.0 / average_degree);
+
+  if constexpr (std::is_integral_v<weight_t>)
+    return std::max(weight_t(1), weight_t(delta));
+  else
+    return delta > 0 ? weight_t(delta) : weight_t(1);
+}
+
+/**
+ * @brief Delta-stepping SSSP over raw, host-resident CSR arrays (no copies).
+ *
+ * @par Overview
+ * Tentative distances are kept in buckets of width `delta`. Buckets are
+ * processed in increasing order; within the current bucket, the light edges
+ * (`w < delta`) of its vertices are relaxed in parallel rounds until the
+ * bucket stays empty, after which the heavy edges (`w >= delta`) of every
+ * vertex settled in the bucket are relaxed once. Relaxations lower distances
+ * with an atomic min and push the improved vertex into the (thread-local)
+ * bucket of its new distance, so threads never share a bucket while
+ * relaxing.
+ *
+ * A relaxation from the current bucket `b` lands at most `max_weight / delta
+ * + 1` buckets ahead, so the buckets live in a cyclic array of
+ * `max_weight / delta + 2` slots (bucket `i` in slot `i % size`), which does
+ * not grow with the distances.
+ *
+ * The distances equal Dijkstra's (relaxations are monotone, so both reach the
+ * same fixpoint, bit for bit). Predecessors are made deterministic (and
+ * independent of the thread count) in a final pass: `predecessors[v]` is the
+ * smallest `u` with an edge `(u, v, w)` such that `distances[u] + w ==
+ * distances[v]`. For strictly positive weights this is a shortest-path tree.
+ *
+ * @note Weights must be non-negative.
+ *
+ * @param n number of vertices.
+ * @param row_offsets CSR row offsets (size `n + 1`).
+ * @param column_indices CSR column indices.
+ * @param values CSR edge weights (`nullptr`: unit weights).
+ * @param single_source source vertex.
+ * @param distances output, shortest distance of each vertex
+ * (`std::numeric_limits<weight_t>::max()` if unreachable).
+ * @param predecessors output, predecessor of each vertex (invalid for the
+ * source and unreachable vertices). May be `nullptr`.
+ * @param param parameters (bucket width).
+ * @return float elapsed time in milliseconds (excluding initialization).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+float run(vertex_t n,
+          edge_t const* row_offsets,
+          vertex_t const* column_indices,
+          weight_t const* values,
+          vertex_t single_source,
+          weight_t* distances,
+          vertex_t* predecessors,
+          param_t<weight_t> param = param_t<weight_t>()) {
+  using namespace std::chrono;
+  constexpr weight_t unreached = std::numeric_limits<weight_t>::max();
+  const vertex_t invalid = gunrock::numeric_limits<vertex_t>::invalid();
+  const std::size_t num_vertices = n;
+  if (num_vertices == 0)
+    return 0;
+
+  std::vector<std::size_t> settled(num_vertices);
+  util::parallel::for_each(
+      std::size_t(0), num_vertices,
+      [&](std::size_t v) {
+        distances[v] = unreached;
+        settled[v] = detail::not_settled;
+        if (predecessors)
+          predecessors[v] = invalid;
+      },
+      std::size_t(1) << 14);
+
+  auto t_start = high_resolution_clock::now();
+
+  const weight_t delta = (param.delta > 0)
+                             ? param.delta
+                             : default_delta(n, row_offsets, values);
+  auto bucket_of = [=](weight_t d) { return std::size_t(d / delta); };
+  auto weight = [=](edge_t e) { return values ? values[e] : weight_t(1); };
+
+  double span = double(detail::max_weight(n, row_offsets, values)) /
+                double(delta);
+  const std::size_t num_buckets =
+      (span < double(detail::max_buckets - 2)) ? std::size_t(span) + 2
+                                               : detail::max_buckets;
+  std::size_t bucket = 0;
+
+  // Per-thread cyclic buckets and settled lists.
+  std::size_t num_threads = util::parallel::number_of_threads();
+  std::vector<std::vector<std::vector<vertex_t>>> buckets(
+      num_threads, std::vector<std::vector<vertex_t>>(num_buckets));
+  std::vector<std::vector<vertex_t>> settled_lists(num_threads);
+
+  // A distance past the last slot (rounding, or weights above
+  // `max_buckets * delta`) goes to the last slot: the vertex is processed
+  // early, which is correct but may relax it again later.
+  auto push = [&](std::size_t tid, vertex_t v, weight_t d) {
+    std::size_t b = std::min(bucket_of(d), bucket + num_buckets - 1);
+    buckets[tid][b % num_buckets].push_back(v);
+  };
+
+  // Moves the current bucket's vertices into `frontier`.
+  auto take = [&](std::vector<vertex_t>& frontier) {
+    for (auto& local : buckets) {
+      auto& slot = local[bucket % num_buckets];
+      frontier.insert(frontier.end(), slot.begin(), slot.end());
+      slot.clear();
+    }
+  };
+
+  // Relax the light (`light == true`) or heavy edges of `u`.
+  auto relax = [&](std::size_t tid, vertex_t u, bool light) {
+    weight_t du = detail::atomic_load(&distances[u]);
+    for (edge_t e = row_offsets[u]; e < row_offsets[u + 1]; ++e) {
+      weight_t w = weight(e);
+      if ((w < delta) != light)
+        continue;
+      vertex_t v = column_indices[e];
+      weight_t nd = du + w;
+      if (detail::atomic_min(&distances[v], nd))
+        push(tid, v, nd);
+    }
+  };
+
+  // Runs `op(tid, first, last)` over chunks of `items`.
+  auto for_each_chunk = [](std::vector<vertex_t> const& items, auto op) {
+    std::size_t chunks =
+        (items.size() + detail::vertices_per_chunk - 1) /
+        detail::vertices_per_chunk;
+    util::parallel::for_each_chunk_id(chunks, [&](std::size_t tid,
+                                                  std::size_t c) {
+      std::size_t first = c * detail::vertices_per_chunk;
+      op(tid, first,
+         std::min(items.size(), first + detail::vertices_per_chunk));
+    });
+  };
+
+  distances[single_source] = 0;
+  std::vector<vertex_t> frontier{single_source};
+  std::vector<vertex_t> settled_vertices;
+
+  for (;;) {
+    // Light phase: process the current bucket until it stays empty.
+    while (!frontier.empty()) {
+      for_each_chunk(frontier, [&](std::size_t tid, std::size_t first,
+                                   std::size_t last) {
+        for (std::size_t i = first; i < last; ++i) {
+          vertex_t u = frontier[i];
+          // Stale entry: `u` improved into (and was processed in) an earlier
+          // bucket.
+          if (bucket_of(detail::atomic_load(&distances[u])) < bucket)
+            continue;
+          if (__atomic_exchange_n(&settled[u], bucket, __ATOMIC_RELAXED) !=
+              bucket)
+            settled_lists[tid].push_back(u);
+          relax(tid, u, true);
+        }
+      });
+
+      frontier.clear();
+      take(frontier);
+    }
+
+    // Heavy phase: the settled vertices' distances are final for this bucket.
+    settled_vertices.clear();
+    for (auto& local : settled_lists) {
+      settled_vertices.insert(settled_vertices.end(), local.begin(),
+                              local.end());
+      local.clear();
+    }
+    for_each_chunk(settled_vertices, [&](std::size_t tid, std::size_t first,
+                                         std::size_t last) {
+      for (std::size_t i = first; i < last; ++i) {
+        vertex_t u = settled_vertices[i];
+        settled[u] = detail::not_settled;
+        relax(tid, u, false);
+      }
+    });
+
+    // Next non-empty bucket, scanning the slots cyclically from the current
+    // one (which may be non-empty again if a heavy relaxation rounded into
+    // it).
+    std::size_t ahead = 0;
+    for (; ahead < num_buckets; ++ahead) {
+      std::size_t slot = (bucket + ahead) % num_buckets;
+      if (std::any_of(buckets.begin(), buckets.end(),
+                      [&](auto const& local) { return !local[slot].empty(); }))
+        break;
+    }
+    if (ahead == num_buckets)
+      break;
+
+    bucket += ahead;
+    take(frontier);
+  }
+
+  // Deterministic predecessors.
+  if (predecessors) {
+    util::parallel::for_each(
+        vertex_t(0), n,
+        [&](vertex_t u) {
+          weight_t du = distances[u];
+          if (du == unreached)
+            return;
+          for (edge_t e = row_offsets[u]; e < row_offsets[u + 1]; ++e) {
+            vertex_t v = column_indices[e];
+            if (v == single_source || du + weight(e) != distances[v])
+              continue;
+            vertex_t current = __atomic_load_n(&predecessors[v],
+                                               __ATOMIC_RELAXED);
+            while ((current == invalid || u < current) &&
+                   !__atomic_compare_exchange_n(&predecessors[v], &current, u,
+                                                true, __ATOMIC_RELAXED,
+                                                __ATOMIC_RELAXED)) {
+            }
+          }
+        },
+        vertex_t(256));
+  }
+
+  auto t_stop = high_resolution_clock::now();
+  return duration<float, std::milli>(t_stop - t_start).count();
+}
+
+/**
+ * @brief Delta-stepping SSSP on a host graph, directly on its CSR view.
+ *
+ * @tparam graph_t graph type, must live in `memory_space_t::host` and contain
+ * a CSR view.
+ * @param G input graph.
+ * @param single_source source vertex.
+ * @param distances output, shortest distance of each vertex.
+ * @param predecessors output, predecessor of each vertex (may be `nullptr`).
+ * @param param parameters (bucket width).
+ * @return float elapsed time in milliseconds.
+ */
+template <typename graph_t>
+float run(graph_t& G,
+          typename graph_t::vertex_type single_source,
+          typename graph_t::weight_type* distances,
+          typename graph_t::vertex_type* predecessors,
+          param_t<typename graph_t::weight_type> param =
+              param_t<typename graph_t::weight_type>()) {
+  static_assert(graph_t::memory_space_v == memory_space_t::host,
+                "host::sssp requires a graph in host memory.");
+  using csr_view_t = typename graph_t::graph_csr_view_t;
+  auto& csr = static_cast<csr_view_t&>(G);
+  return run(G.get_number_of_vertices(), csr.get_row_offsets(),
+             csr.get_column_indices(), csr.get_nonzero_values(), single_source,
+             distances, predecessors, param);
+}
+
+}  // namespace sssp
+}  // namespace host
+}  // namespace gunrock
@@ -0,0 +1,457 @@
+/**
+ * @file tc.hxx
+ * @brief Degree-ordered parallel Triangle Counting on the host (CPU), with
+ * SIMD, bitmap and galloping set intersections.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+#include <gunrock/algorithms/host/adjacency.hxx>
+#include <gunrock/error.hxx>
+#include <gunrock/graph/graph.hxx>
+#include <gunrock/util/parallel.hxx>
+
+namespace gunrock {
+namespace host {
+namespace tc {
+
+struct param_t {
+  /// Probe the shorter list into the longer one (bitmap or galloping
+  /// search) instead of merging them once their lengths differ by at least
+  /// this factor.
+  std::size_t skew_ratio = 16;
+  /// Mark the out-neighbors of a vertex in a bitmap when it has at least this
+  /// many, so that skewed intersections against them cost one bit test per
+  /// element of the other list.
+  std::size_t bitmap_degree = 256;
+  /// Merge with the widest SIMD kernel the compiler targets (AVX-512 or AVX2
+  /// for 32-bit vertex ids), or always with the scalar one.
+  bool simd = true;
+};
+
+namespace detail {
+
+/// Vertices per chunk of the counting loop (chunks are work-stolen).
+constexpr std::size_t vertices_per_chunk = 64;
+
+/**
+ * @brief Branchless scalar merge of two sorted lists, calling `emit(x)` on
+ * every common element.
+ *
+ * @return std::size_t number of common elements.
+ */
+template <typename vertex_t, typename emit_t>
+std::size_t merge(vertex_t const* a,
+                  std::size_t na,
+                  vertex_t const* b,
+                  std::size_t nb,
+                  emit_t emit) {
+  std::size_t i = 0, j = 0, count = 0;
+  while (i < na && j < nb) {
+    vertex_t x = a[i], y = b[j];
+    if (x == y) {
+      emit(x);
+      ++count;
+    }
+    i += (x <= y);
+    j += (y <= x);
+  }
+  return count;
+}
+
+/**
+ * @brief Block-wise SIMD merge (32-bit ids): a block of `a` is compared
+ * against every rotation of a block of `b`, the matches of `a` come out as a
+ * bit mask, and the block with the smaller last element is consumed. The
+ * tails are merged with the scalar kernel.
+ */
+template <typename vertex_t, typename emit_t>
+std::size_t merge_simd(vertex_t const* a,
+                       std::size_t na,
+                       vertex_t const* b,
+                       std::size_t nb,
+                       emit_t emit) {
+  std::size_t i = 0, j = 0, count = 0;
+  auto report = [&](std::uint64_t mask) {
+    count += __builtin_popcountll(mask);
+    for (; mask; mask &= mask - 1)
+      emit(a[i + __builtin_ctzll(mask)]);
+  };
+
+#if defined(__AVX512F__)
+  if constexpr (sizeof(vertex_t) == 4) {
+    const __m512i rotate = _mm512_set_epi32(0, 15, 14, 13, 12, 11, 10, 9, 8,
+                                            7, 6, 5, 4, 3, 2, 1);
+    while (i + 16 <= na && j + 16 <= nb) {
+      __m512i va = _mm512_loadu_si512(a + i);
+      __m512i vb = _mm512_loadu_si512(b + j);
+      __mmask16 mask = _mm512_cmpeq_epi32_mask(va, vb);
+      for (int r = 1; r < 16; ++r) {
+        vb = _mm512_permutexvar_epi32(rotate, vb);
+        mask |= _mm512_cmpeq_epi32_mask(va, vb);
+      }
+      report(mask);
+      vertex_t a_last = a[i + 15], b_last = b[j + 15];
+      i += (a_last <= b_last) ? 16 : 0;
+      j += (b_last <= a_last) ? 16 : 0;
+    }
+  }
+#elif defined(__AVX2__)
+  if constexpr (sizeof(vertex_t) == 4) {
+    const __m256i rotate = _mm256_set_epi32(0, 7, 6, 5, 4, 3, 2, 1);
+    while (i + 8 <= na && j + 8 <= nb) {
+      __m256i va = _mm256_loadu_si256((__m256i const*)(a + i));
+      __m256i vb = _mm256_loadu_si256((__m256i const*)(b + j));
+      __m256i eq = _mm256_cmpeq_epi32(va, vb);
+      for (int r = 1; r < 8; ++r) {
+        vb = _mm256_permutevar8x32_epi32(vb, rotate);
+        eq = _mm256_or_si256(eq, _mm256_cmpeq_epi32(va, vb));
+      }
+      report(std::uint64_t(_mm256_movemask_ps(_mm256_castsi256_ps(eq))));
+      vertex_t a_last = a[i + 7], b_last = b[j + 7];
+      i += (a_last <= b_last) ? 8 : 0;
+      j += (b_last <= a_last) ? 8 : 0;
+    }
+  }
+#else
+  (void)report;
+#endif
+
+  return count + merge(a + i, na - i, b + j, nb - j, emit);
+}
+
+/**
+ * @brief Galloping intersection: every element of the short list `a` is
+ * searched in the long list `b` (exponential then binary search from the
+ * previous match), in `O(na log(nb / na))`.
+ */
+template <typename vertex_t, typename emit_t>
+std::size_t gallop(vertex_t const* a,
+                   std::size_t na,
+                   vertex_t const* b,
+                   std::size_t nb,
+                   emit_t emit) {
+  std::size_t j = 0, count = 0;
+  for (std::size_t i = 0; i < na && j < nb; ++i) {
+    vertex_t x = a[i];
+    std::size_t step = 1, last = j;
+    while (last < nb && b[last] < x) {
+      j = last + 1;
+      last += step;
+      step <<= 1;
+    }
+    j = std::lower_bound(b + j, b + std::min(last + 1, nb), x) - b;
+    if (j < nb && b[j] == x) {
+      emit(x);
+      ++count;
+      ++j;
+    }
+  }
+  return count;
+}
+
+/// Set of vertices, one bit per vertex.
+struct bitmap_t {
+  std::vector<std::uint64_t> words;
+
+  template <typename vertex_t>
+  void set(vertex_t v) {
+    words[std::size_t(v) >> 6] |= std::uint64_t(1) << (std::size_t(v) & 63);
+  }
+
+  template <typename vertex_t>
+  void reset(vertex_t v) {
+    words[std::size_t(v) >> 6] = 0;
+  }
+
+  template <typename vertex_t>
+  bool test(vertex_t v) const {
+    return (words[std::size_t(v) >> 6] >> (std::size_t(v) & 63)) & 1;
+  }
+};
+
+/**
+ * @brief Degree-ordered orientation: the out-neighbors of `u` are its
+ * neighbors ranked after it by (degree, id), in their original (sorted)
+ * order. Every triangle then appears exactly once, as `w` in the
+ * intersection of the lists of `u` and `v` for its lowest-ranked vertex `u`
+ * and middle vertex `v`, and no list is longer than `sqrt(2m)`.
+ */
+template <typename vertex_t, typename edge_t, typename adjacency_t>
+void orient(vertex_t n,
+            adjacency_t const& G,
+            std::vector<edge_t>& offsets,
+            std::vector<vertex_t>& indices) {
+  const std::size_t num_vertices = n;
+  std::vector<edge_t> degrees(num_vertices);
+  util::parallel::for_each(std::size_t(0), num_vertices, [&](std::size_t v) {
+    degrees[v] = G.get_number_of_neighbors(vertex_t(v));
+  });
+  auto before = [&](vertex_t u, vertex_t v) {
+    return degrees[u] < degrees[v] || (degrees[u] == degrees[v] && u < v);
+  };
+
+  offsets.resize(num_vertices + 1);
+  util::parallel::transform_exclusive_scan<edge_t>(
+      num_vertices,
+      [&](std::size_t u) {
+        edge_t count = 0;
+        G.for_each_neighbor(vertex_t(u), [&](vertex_t v, auto) {
+          count += before(vertex_t(u), v);
+        });
+        return count;
+      },
+      offsets.data());
+
+  indices.resize(offsets[num_vertices]);
+  util::parallel::for_each(std::size_t(0), num_vertices, [&](std::size_t u) {
+    vertex_t* out = indices.data() + offsets[u];
+    G.for_each_neighbor(vertex_t(u), [&](vertex_t v, auto) {
+      if (before(vertex_t(u), v))
+        *out++ = v;
+    });
+  });
+}
+
+}  // namespace detail
+
+/**
+ * @brief Triangle counting over the neighbor lists of a symmetric graph (see
+ * host::csr_adjacency_t for the interface `G` provides; the lists must be
+ * sorted and free of duplicates).
+ *
+ * @par Overview
+ * The edges are first oriented from lower to higher (degree, id), which
+ * turns the graph into a DAG whose out-degrees are at most `sqrt(2m)`. Each
+ * vertex `u` then intersects its out-list with the out-list of each of its
+ * out-neighbors `v`; every common vertex `w` closes the triangle
+ * `(u, v, w)`, found exactly once. Lists of similar lengths are merged with
+ * SIMD block compares; skewed pairs probe the short list into a bitmap of
+ * `u`'s list (when it is long) or gallop through the long one. Vertices are
+ * processed in work-stolen chunks, and each thread counts into its own
+ * per-vertex array, summed at the end (no atomics). Self-loops are ignored.
+ *
+ * Same results as gunrock::tc and the CPU reference of the tc example: each
+ * vertex counts the triangles it belongs to, and the total is the sum of
+ * these counts (three times the number of triangles).
+ *
+ * @param n number of vertices.
+ * @param G neighbor lists.
+ * @param triangles_count output, number of triangles of each vertex (size
+ * `n`). May be `nullptr` when only the total is needed, which skips the
+ * per-vertex bookkeeping.
+ * @param total_triangles output, sum of the per-vertex counts. May be
+ * `nullptr`.
+ * @param param intersection parameters.
+ * @return float elapsed time in milliseconds.
+ */
+template <typename vertex_t, typename adjacency_t, typename count_t>
+float run(vertex_t n,
+          adjacency_t const& G,
+          count_t* triangles_count,
+          std::size_t* total_triangles,
+          param_t param = param_t()) {
+  using namespace std::chrono;
+  using edge_t = std::decay_t<decltype(G.get_starting_edge(vertex_t(0)))>;
+  const std::size_t num_vertices = n;
+
+  auto t_start = high_resolution_clock::now();
+
+  std::vector<edge_t> offsets;
+  std::vector<vertex_t> indices;
+  detail::orient(n, G, offsets, indices);
+
+  std::size_t num_threads = util::parallel::number_of_threads();
+  std::vector<std::vector<count_t>> local_counts(num_threads);
+  std::vector<detail::bitmap_t> bitmaps(num_threads);
+  std::vector<std::size_t> local_totals(num_threads, 0);
+  std::size_t skew = std::max<std::size_t>(param.skew_ratio, 1);
+  std::size_t num_chunks =
+      (num_vertices + detail::vertices_per_chunk - 1) /
+      detail::vertices_per_chunk;
+
+  auto count_chunk = [&](auto per_vertex, std::size_t tid, std::size_t c) {
+    constexpr bool report = decltype(per_vertex)::value;
+    auto& counts = local_counts[tid];
+    auto& bitmap = bitmaps[tid];
+    if (report && counts.empty())
+      counts.assign(num_vertices, count_t(0));
+
+    std::size_t first = c * detail::vertices_per_chunk;
+    std::size_t last =
+        std::min(num_vertices, first + detail::vertices_per_chunk);
+    std::size_t total = 0;
+    for (std::size_t u = first; u < last; ++u) {
+      vertex_t const* a = indices.data() + offsets[u];
+      std::size_t na = offsets[u + 1] - offsets[u];
+      if (na < 2)
+        continue;
+
+      bool marked = na >= param.bitmap_degree;
+      if (marked) {
+        if (bitmap.words.empty())
+          bitmap.words.assign((num_vertices + 63) / 64, 0);
+        for (std::size_t k = 0; k < na; ++k)
+          bitmap.set(a[k]);
+      }
+
+      std::size_t u_count = 0;
+      for (std::size_t k = 0; k < na; ++k) {
+        vertex_t v = a[k];
+        vertex_t const* b = indices.data() + offsets[v];
+        std::size_t nb = offsets[v + 1] - offsets[v];
+        if (nb == 0)
+          continue;
+
+        auto emit = [&](vertex_t w) {
+          if constexpr (report)
+            ++counts[w];
+        };
+        std::size_t found;
+        if (nb * skew <= na && marked) {
+          found = 0;
+          for (std::size_t l = 0; l < nb; ++l)
+            if (bitmap.test(b[l])) {
+              emit(b[l]);
+              ++found;
+            }
+        } else if (nb * skew <= na) {
+          found = detail::gallop(b, nb, a, na, emit);
+        } else if (na * skew <= nb) {
+          found = detail::gallop(a, na, b, nb, emit);
+        } else if (param.simd) {
+          found = detail::merge_simd(a, na, b, nb, emit);
+        } else {
+          found = detail::merge(a, na, b, nb, emit);
+        }
+
+        if constexpr (report)
+          counts[v] += count_t(found);
+        u_count += found;
+      }
+
+      if constexpr (report)
+        counts[u] += count_t(u_count);
+      total += u_count;
+
+      if (marked)
+        for (std::size_t k = 0; k < na; ++k)
+          bitmap.reset(a[k]);
+    }
+    local_totals[tid] += total;
+  };
+
+  if (triangles_count) {
+    util::parallel::for_each_chunk_id(
+        num_chunks, [&](std::size_t tid, std::size_t c) {
+          count_chunk(std::true_type(), tid, c);
+        });
+    util::parallel::for_each(
+        std::size_t(0), num_vertices, [&](std::size_t v) {
+          count_t sum = 0;
+          for (auto const& counts : local_counts)
+            if (!counts.empty())
+              sum += counts[v];
+          triangles_count[v] = sum;
+        });
+  } else {
+    util::parallel::for_each_chunk_id(
+        num_chunks, [&](std::size_t tid, std::size_t c) {
+          count_chunk(std::false_type(), tid, c);
+        });
+  }
+
+  if (total_triangles) {
+    std::size_t triangles = 0;
+    for (auto t : local_totals)
+      triangles += t;
+    *total_triangles = 3 * triangles;
+  }
+
+  auto t_stop = high_resolution_clock::now();
+  return duration<float, std::milli>(t_stop - t_start).count();
+}
+
+/**
+ * @brief Triangle counting over raw CSR arrays (sorted rows, symmetric
+ * graph).
+ *
+ * @param n number of vertices.
+ * @param row_offsets CSR row offsets (size `n + 1`).
+ * @param column_indices CSR column indices.
+ * @param triangles_count output, number of triangles of each vertex (may be
+ * `nullptr`).
+ * @param total_triangles output, sum of the per-vertex counts (may be
+ * `nullptr`).
+ * @param param intersection parameters.
+ * @return float elapsed time in milliseconds.
+ */
+template <typename vertex_t, typename edge_t, typename count_t>
+float run(vertex_t n,
+          edge_t const* row_offsets,
+          vertex_t const* column_indices,
+          count_t* triangles_count,
+          std::size_t* total_triangles,
+          param_t param = param_t()) {
+  csr_adjacency_t<vertex_t, edge_t> G{row_offsets, column_indices};
+  return run(n, G, triangles_count, total_triangles, param);
+}
+
+/**
+ * @brief Triangle counting on a symmetric host graph, over its CSR view (or
+ * its compressed CSR view if it has no CSR view).
+ *
+ * @tparam graph_t graph type, must live in `memory_space_t::host` and contain
+ * a CSR or a compressed CSR view.
+ * @param G input graph.
+ * @param triangles_count output, number of triangles of each vertex (may be
+ * `nullptr`).
+ * @param total_triangles output, sum of the per-vertex counts (may be
+ * `nullptr`).
+ * @param param intersection parameters.
+ * @return float elapsed time in milliseconds.
+ */
+template <typename graph_t>
+float run(graph_t& G,
+          typename graph_t::vertex_type* triangles_count,
+          std::size_t* total_triangles,
+          param_t param = param_t()) {
+  static_assert(graph_t::memory_space_v == memory_space_t::host,
+                "host::tc requires a graph in host memory.");
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t = typename graph_t::edge_type;
+  using csr_view_t = typename graph_t::graph_csr_view_t;
+  using compressed_view_t = typename graph_t::graph_compressed_csr_view_t;
+  error::throw_if_exception(!G.is_symmetric(),
+                            "host::tc requires a symmetric graph.");
+
+  if constexpr (std::is_base_of_v<csr_view_t, graph_t>) {
+    auto& csr = static_cast<csr_view_t&>(G);
+    csr_adjacency_t<vertex_t, edge_t> out{csr.get_row_offsets(),
+                                          csr.get_column_indices()};
+    return run(G.get_number_of_vertices(), out, triangles_count,
+               total_triangles, param);
+  } else {
+    return run(G.get_number_of_vertices(),
+               static_cast<compressed_view_t const&>(G), triangles_count,
+               total_triangles, param);
+  }
+}
+
+}  // namespace tc
+}  // namespace host
+}  // namespace gunrock
@@ -48,9 +48,9 @@ struct problem_t : gunrock::problem_t<graph_t> {
   using edge_t = typename graph_t::edge_type;
   using weight_t = typename graph_t::weight_type;
 
-  thrust::device_vector<weight_t>
+  vector_t<weight_t, graph_t::memory_space_v>
       plast;  // pagerank values from previous iteration
-  thrust::device_vector<weight_t>
+  vector_t<weight_t, graph_t::memory_space_v>
       iweights;  // alpha * 1 / (sum of outgoing weights) -- used to determine
                  // out of mass spread from src to dst
 
@@ -62,8 +62,8 @@ struct problem_t : gunrock::problem_t<graph_t> {
   }
 
   void reset() override {
-    // Execution policy for a given context (using single-gpu).
-    auto policy = this->context->get_context(0)->execution_policy();
+    // Execution policy for the graph's memory space (using single-gpu).
+    auto policy = this->execution_policy();
 
     auto g = this->get_graph();
 
@@ -111,11 +111,11 @@ struct enactor_t : gunrock::enactor_t<problem_t> {
 
     auto n_vertices = G.get_number_of_vertices();
     auto p = P->result.p;
-    auto plast = P->plast.data().get();
-    auto iweights = P->iweights.data().get();
+    auto plast = raw_pointer_cast(P->plast.data());
+    auto iweights = raw_pointer_cast(P->iweights.data());
     auto alpha = P->param.alpha;
 
-    auto policy = this->context->get_context(0)->execution_policy();
+    auto policy = P->execution_policy();
 
     thrust::copy_n(policy, p, n_vertices, plast);
 
@@ -182,12 +182,12 @@ struct enactor_t : gunrock::enactor_t<problem_t> {
 
     auto n_vertices = G.get_number_of_vertices();
     auto p = P->result.p;
-    auto plast = P->plast.data().get();
+    auto plast = raw_pointer_cast(P->plast.data());
 
     auto abs_diff = [=] __host__ __device__(const int& i)
         -> weight_t { return abs(p[i] - plast[i]); };
 
-    auto policy = this->context->get_context(0)->execution_policy();
+    auto policy = P->execution_policy();
     float err = thrust::transform_reduce(
         policy, thrust::counting_iterator<vertex_t>(0),
         thrust::counting_iterator<vertex_t>(n_vertices), abs_diff,
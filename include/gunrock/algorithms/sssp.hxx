@@ -45,7 +45,7 @@ struct problem_t : gunrock::problem_t<graph_t> {
   using edge_t = typename graph_t::edge_type;
   using weight_t = typename graph_t::weight_type;
 
-  thrust::device_vector<vertex_t> visited;
+  vector_t<vertex_t, graph_t::memory_space_v> visited;
 
   void init() override {
     auto g = this->get_graph();
@@ -53,7 +53,7 @@ struct problem_t : gunrock::problem_t<graph_t> {
     visited.resize(n_vertices);
 
     // Execution policy for a given context (using single-gpu).
-    auto policy = this->context->get_context(0)->execution_policy();
+    auto policy = this->execution_policy();
     thrust::fill(policy, visited.begin(), visited.end(), std::numeric_limits<vertex_t>::max());
   }
 
@@ -61,11 +61,10 @@ struct problem_t : gunrock::problem_t<graph_t> {
     auto g = this->get_graph();
     auto n_vertices = g.get_number_of_vertices();
 
-    auto context = this->get_single_context();
-    auto policy = context->execution_policy();
+    auto policy = this->execution_policy();
 
     auto single_source = this->param.single_source;
-    auto d_distances = thrust::device_pointer_cast(this->result.distances);
+    auto d_distances = this->result.distances;
     thrust::fill(policy, d_distances + 0, d_distances + n_vertices,
                  std::numeric_limits<weight_t>::max());
 
@@ -102,7 +101,7 @@ struct enactor_t : gunrock::enactor_t<problem_t> {
 
     auto single_source = P->param.single_source;
     auto distances = P->result.distances;
-    auto visited = P->visited.data().get();
+    auto visited = raw_pointer_cast(P->visited.data());
 
     auto iteration = this->iteration;
 
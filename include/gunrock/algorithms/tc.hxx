@@ -115,7 +115,7 @@ struct enactor_t : gunrock::enactor_t<problem_t> {
     auto G = P->get_graph();
 
     if (P->param.reduce_all_triangles) {
-      auto policy = this->context->get_context(0)->execution_policy();
+      auto policy = P->execution_policy();
       *P->result.total_triangles_count = thrust::transform_reduce(
           policy, P->result.vertex_triangles_count,
           P->result.vertex_triangles_count + G.get_number_of_vertices(),
@@ -23,12 +23,24 @@ namespace gunrock {
 
 using namespace memory;
 
+#if ESSENTIALS_POOL_ALLOCATOR
+/// Allocates through the caching memory pools (see memory_pool.hxx), so the
+/// frontiers and per-run buffers of repeated runs reuse freed blocks.
+template <typename type_t, memory_space_t space = memory_space_t::device>
+using vector_t = std::conditional_t<
+    space == memory_space_t::host,  // condition
+    thrust::host_vector<type_t,
+                        pool_allocator_t<type_t, memory_space_t::host>>,
+    thrust::device_vector<type_t,
+                          pool_allocator_t<type_t, memory_space_t::device>>>;
+#else
 template <typename type_t, memory_space_t space = memory_space_t::device>
 using vector_t =
     std::conditional_t<space == memory_space_t::host,  // condition
                        thrust::host_vector<type_t>,    // host_type
                        thrust::device_vector<type_t>   // device_type
                        >;
+#endif
 
 template <typename type_t>
 using host_vector_t = thrust::host_vector<type_t>;
@@ -0,0 +1,540 @@
+/**
+ * @file builder.hxx
+ * @brief Parallel host (CPU) construction of compressed sparse formats (CSR,
+ * CSC) from coordinate lists, with per-row sorting and configurable cleanup
+ * policies (self-loops, duplicates, symmetrization).
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <gunrock/error.hxx>
+#include <gunrock/memory.hxx>
+#include <gunrock/util/parallel.hxx>
+
+namespace gunrock {
+namespace format {
+
+/**
+ * @brief What to do with entries sharing the same (row, column) pair.
+ */
+enum class duplicate_policy_t {
+  keep,   ///< Keep every entry (multigraph).
+  sum,    ///< Merge into one entry, summing the values.
+  min,    ///< Merge into one entry, keeping the smallest value.
+  max,    ///< Merge into one entry, keeping the largest value.
+  first,  ///< Merge into one entry, keeping the value seen first in the input.
+};
+
+/**
+ * @brief Policies applied while building a compressed format from a
+ * coordinate list. The defaults reproduce the input exactly (up to the order
+ * of the entries within a row).
+ */
+struct build_policy_t {
+  /// Drop entries with `row == column`.
+  bool remove_self_loops = false;
+  /// Handling of duplicate entries, see `duplicate_policy_t`.
+  duplicate_policy_t duplicates = duplicate_policy_t::keep;
+  /// Add the transpose of every entry, `(column, row)`, to the input. Requires
+  /// a square matrix. An entry and its mirror become duplicates if both are
+  /// already present, so this is usually combined with a merging policy.
+  bool symmetrize = false;
+  /// Sort the entries of every row by column. Always done when duplicates are
+  /// merged.
+  bool sort = true;
+};
+
+namespace builder {
+
+namespace detail {
+
+/// Coordinate entries per histogram/scatter block.
+constexpr std::size_t entries_per_block = std::size_t(1) << 16;
+/// Per-block histograms over all the majors take at most this many counters
+/// per input entry (beyond a single block).
+constexpr std::size_t counters_per_entry = 2;
+/// Buckets of consecutive majors per thread, when the histograms would not.
+constexpr std::size_t buckets_per_thread = 64;
+/// Rows per chunk of the sort/merge pass.
+constexpr std::size_t rows_per_chunk = 1024;
+/// Rows at most this long are sorted in place with an insertion sort.
+constexpr std::size_t insertion_sort_threshold = 32;
+
+/**
+ * @brief Stable sort of one row by minor index (insertion sort for short rows,
+ * `std::stable_sort` on a scratch buffer otherwise). Already sorted rows, the
+ * common case for sorted inputs and transpositions, are only checked.
+ */
+template <typename index_t, typename value_t>
+void sort_row(index_t* indices,
+              value_t* values,
+              std::size_t length,
+              std::vector<std::pair<index_t, value_t>>& scratch) {
+  if (std::is_sorted(indices, indices + length))
+    return;
+
+  if (length <= insertion_sort_threshold) {
+    for (std::size_t i = 1; i < length; ++i) {
+      index_t key = indices[i];
+      value_t value = values[i];
+      std::size_t j = i;
+      for (; j > 0 && key < indices[j - 1]; --j) {
+        indices[j] = indices[j - 1];
+        values[j] = values[j - 1];
+      }
+      indices[j] = key;
+      values[j] = value;
+    }
+    return;
+  }
+
+  scratch.resize(length);
+  for (std::size_t i = 0; i < length; ++i)
+    scratch[i] = {indices[i], values[i]};
+  std::stable_sort(
+      scratch.begin(), scratch.end(),
+      [](auto const& a, auto const& b) { return a.first < b.first; });
+  for (std::size_t i = 0; i < length; ++i) {
+    indices[i] = scratch[i].first;
+    values[i] = scratch[i].second;
+  }
+}
+
+/**
+ * @brief Merges runs of equal minor indices of a sorted row in place;
+ * returns the new length.
+ */
+template <typename index_t, typename value_t>
+std::size_t merge_row(index_t* indices,
+                      value_t* values,
+                      std::size_t length,
+                      duplicate_policy_t policy) {
+  if (length == 0)
+    return 0;
+  std::size_t out = 0;
+  for (std::size_t i = 1; i < length; ++i) {
+    if (indices[i] != indices[out]) {
+      ++out;
+      indices[out] = indices[i];
+      values[out] = values[i];
+      continue;
+    }
+    switch (policy) {
+      case duplicate_policy_t::sum:
+        values[out] += values[i];
+        break;
+      case duplicate_policy_t::min:
+        values[out] = std::min(values[out], values[i]);
+        break;
+      case duplicate_policy_t::max:
+        values[out] = std::max(values[out], values[i]);
+        break;
+      default:  // first
+        break;
+    }
+  }
+  return out + 1;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Coordinate list as an entry stream of `compress()`, one unit per
+ * entry.
+ */
+template <typename index_t, typename value_t>
+struct coordinates_t {
+  std::size_t number_of_entries;
+  index_t const* majors;
+  index_t const* minors;
+  value_t const* values;
+
+  std::size_t size() const { return number_of_entries; }
+
+  template <typename emit_t>
+  void operator()(std::size_t first, std::size_t last, emit_t&& emit) const {
+    for (std::size_t k = first; k < last; ++k)
+      emit(majors[k], minors[k], values[k]);
+  }
+};
+
+/**
+ * @brief Builds a compressed (CSR-like) format from a stream of entries
+ * produced on the fly, e.g. by a graph generator, without materializing them
+ * as a coordinate list first.
+ *
+ * @par Overview
+ * Same construction and policies as the coordinate-list `compress()` below,
+ * which is this function over arrays. The source is a deterministic stream of
+ * entries cut into work units: `source.size()` is the number of units and
+ * `source(first, last, emit)` calls `emit(major, minor, value)` for every
+ * entry of the units `[first, last)`, in order. Each unit is produced twice
+ * (histogram, then scatter), from any thread, and must emit the same entries
+ * both times. With `symmetrize`, the mirrors are produced by a second pass
+ * over the units, after all the input entries.
+ *
+ * @tparam index_t index type.
+ * @tparam source_t entry stream, see above.
+ * @tparam offsets_vector_t host vector of offsets (`resize()`, `data()`).
+ * @tparam indices_vector_t host vector of indices.
+ * @tparam values_vector_t host vector of values.
+ * @param number_of_majors number of rows (CSR) or columns (CSC).
+ * @param source entry stream.
+ * @param policy cleanup policies.
+ * @param offsets output, offsets (size `number_of_majors + 1`).
+ * @param indices output, minor indices.
+ * @param nonzero_values output, values.
+ * @return std::size_t number of entries of the output.
+ */
+template <typename index_t,
+          typename source_t,
+          typename offsets_vector_t,
+          typename indices_vector_t,
+          typename values_vector_t>
+std::size_t compress(index_t number_of_majors,
+                     source_t const& source,
+                     build_policy_t const& policy,
+                     offsets_vector_t& offsets,
+                     indices_vector_t& indices,
+                     values_vector_t& nonzero_values) {
+  using offset_t = typename offsets_vector_t::value_type;
+  using value_t = typename values_vector_t::value_type;
+
+  const std::size_t n = number_of_majors;
+  const std::size_t units = source.size();
+  const std::size_t m = policy.symmetrize ? 2 * units : units;
+
+  // Unit k < units is an input unit, the others produce the mirrors
+  // (minor, major) of a symmetrized input.
+  auto stream = [&](std::size_t first, std::size_t last, auto&& emit) {
+    if (first < units)
+      source(first, std::min(last, units),
+             [&](index_t major, index_t minor, value_t const& value) {
+               if (major != minor || !policy.remove_self_loops)
+                 emit(major, minor, value);
+             });
+    if (last > units)
+      source(std::max(first, units) - units, last - units,
+             [&](index_t major, index_t minor, value_t const& value) {
+               // A self-loop is its own mirror.
+               if (major != minor)
+                 emit(minor, major, value);
+             });
+  };
+
+  // --
+  // Per-block histograms, one counter per major index, while they fit in a
+  // small multiple of the input; otherwise per-block histograms over buckets
+  // of consecutive majors.
+  const std::size_t num_blocks = std::max<std::size_t>(
+      1, std::min(util::parallel::number_of_threads(),
+                  (m + detail::entries_per_block - 1) /
+                      detail::entries_per_block));
+  std::vector<std::size_t> block_sizes(num_blocks);
+  auto block_begin = [=](std::size_t b) { return m * b / num_blocks; };
+  auto check_total = [&]() {
+    std::size_t total = 0;
+    for (std::size_t size : block_sizes)
+      total += size;
+    error::throw_if_exception(
+        total >= std::size_t(std::numeric_limits<offset_t>::max()),
+        "offset_t overflow");
+    return total;
+  };
+
+  offsets.resize(n + 1);
+  offset_t* Ap = memory::raw_pointer_cast(offsets.data());
+  index_t* Aj = nullptr;
+  value_t* Ax = nullptr;
+  std::size_t nnz = 0;
+
+  if (num_blocks == 1 || num_blocks * n <= detail::counters_per_entry * m) {
+    std::unique_ptr<offset_t[]> counters(new offset_t[num_blocks * n]);
+    util::parallel::for_each_chunk_id(num_blocks, [&](std::size_t,
+                                                      std::size_t b) {
+      offset_t* counts = counters.get() + b * n;
+      std::fill_n(counts, n, offset_t(0));
+      std::size_t size = 0;
+      stream(block_begin(b), block_begin(b + 1),
+             [&](index_t major, index_t, value_t const&) {
+               ++counts[major];
+               ++size;
+             });
+      block_sizes[b] = size;
+    });
+    check_total();
+
+    // --
+    // Offsets, then each block's write position within each group.
+    nnz = util::parallel::transform_exclusive_scan<offset_t>(
+        n,
+        [&](std::size_t i) {
+          offset_t total = 0;
+          for (std::size_t b = 0; b < num_blocks; ++b)
+            total += counters[b * n + i];
+          return total;
+        },
+        Ap);
+
+    util::parallel::for_each(
+        std::size_t(0), n,
+        [&](std::size_t i) {
+          offset_t position = Ap[i];
+          for (std::size_t b = 0; b < num_blocks; ++b) {
+            offset_t count = counters[b * n + i];
+            counters[b * n + i] = position;
+            position += count;
+          }
+        },
+        std::size_t(1) << 14);
+
+    // --
+    // Scatter.
+    indices.resize(nnz);
+    nonzero_values.resize(nnz);
+    Aj = memory::raw_pointer_cast(indices.data());
+    Ax = memory::raw_pointer_cast(nonzero_values.data());
+
+    util::parallel::for_each_chunk_id(num_blocks, [&](std::size_t,
+                                                      std::size_t b) {
+      offset_t* positions = counters.get() + b * n;
+      stream(block_begin(b), block_begin(b + 1),
+             [&](index_t major, index_t minor, value_t const& value) {
+               offset_t p = positions[major]++;
+               Aj[p] = minor;
+               Ax[p] = value;
+             });
+    });
+  } else {
+    // --
+    // Radix pass: the blocks move their entries, in order, into buckets of
+    // consecutive majors.
+    const std::size_t num_buckets = std::min(
+        n, util::parallel::number_of_threads() * detail::buckets_per_thread);
+    const std::size_t width = (n + num_buckets - 1) / num_buckets;
+    std::vector<std::size_t> positions(num_blocks * num_buckets, 0);
+    util::parallel::for_each_chunk_id(num_blocks, [&](std::size_t,
+                                                      std::size_t b) {
+      std::size_t* counts = positions.data() + b * num_buckets;
+      std::size_t size = 0;
+      stream(block_begin(b), block_begin(b + 1),
+             [&](index_t major, index_t, value_t const&) {
+               ++counts[major / width];
+               ++size;
+             });
+      block_sizes[b] = size;
+    });
+    const std::size_t total = check_total();
+
+    std::vector<std::size_t> bucket_begin(num_buckets + 1);
+    std::size_t position = 0;
+    for (std::size_t k = 0; k < num_buckets; ++k) {
+      bucket_begin[k] = position;
+      for (std::size_t b = 0; b < num_blocks; ++b) {
+        std::size_t count = positions[b * num_buckets + k];
+        positions[b * num_buckets + k] = position;
+        position += count;
+      }
+    }
+    bucket_begin[num_buckets] = position;
+
+    std::unique_ptr<index_t[]> bucket_majors(new index_t[total]);
+    std::unique_ptr<index_t[]> bucket_minors(new index_t[total]);
+    std::unique_ptr<value_t[]> bucket_values(new value_t[total]);
+    util::parallel::for_each_chunk_id(num_blocks, [&](std::size_t,
+                                                      std::size_t b) {
+      std::size_t* cursors = positions.data() + b * num_buckets;
+      stream(block_begin(b), block_begin(b + 1),
+             [&](index_t major, index_t minor, value_t const& value) {
+               std::size_t p = cursors[major / width]++;
+               bucket_majors[p] = major;
+               bucket_minors[p] = minor;
+               bucket_values[p] = value;
+             });
+    });
+
+    // --
+    // Each bucket is then counted and scattered on its own: its majors
+    // belong to no other bucket, so a single histogram over all the majors
+    // needs no atomics.
+    std::unique_ptr<offset_t[]> counters(new offset_t[n]);
+    auto for_each_bucket = [&](auto op) {
+      util::parallel::for_each_chunk_id(
+          num_buckets, [&](std::size_t, std::size_t k) {
+            op(k * width, std::min(n, (k + 1) * width), bucket_begin[k],
+               bucket_begin[k + 1]);
+          });
+    };
+    for_each_bucket([&](std::size_t first, std::size_t last, std::size_t begin,
+                        std::size_t end) {
+      std::fill(counters.get() + first, counters.get() + last, offset_t(0));
+      for (std::size_t e = begin; e < end; ++e)
+        ++counters[bucket_majors[e]];
+    });
+    nnz = util::parallel::transform_exclusive_scan<offset_t>(
+        n, [&](std::size_t i) { return counters[i]; }, Ap);
+
+    indices.resize(nnz);
+    nonzero_values.resize(nnz);
+    Aj = memory::raw_pointer_cast(indices.data());
+    Ax = memory::raw_pointer_cast(nonzero_values.data());
+
+    for_each_bucket([&](std::size_t first, std::size_t last, std::size_t begin,
+                        std::size_t end) {
+      std::copy(Ap + first, Ap + last, counters.get() + first);
+      for (std::size_t e = begin; e < end; ++e) {
+        offset_t p = counters[bucket_majors[e]]++;
+        Aj[p] = bucket_minors[e];
+        Ax[p] = bucket_values[e];
+      }
+    });
+  }
+
+  // --
+  // Sort the groups by minor index and merge their duplicates.
+  const bool merge = policy.duplicates != duplicate_policy_t::keep;
+  if (!policy.sort && !merge)
+    return nnz;
+
+  std::vector<offset_t> lengths(merge ? n : 0);
+  std::vector<std::vector<std::pair<index_t, value_t>>> scratch(
+      util::parallel::number_of_threads());
+  const std::size_t num_chunks =
+      (n + detail::rows_per_chunk - 1) / detail::rows_per_chunk;
+  util::parallel::for_each_chunk_id(num_chunks, [&](std::size_t tid,
+                                                    std::size_t c) {
+    std::size_t first = c * detail::rows_per_chunk;
+    std::size_t last = std::min(n, first + detail::rows_per_chunk);
+    for (std::size_t i = first; i < last; ++i) {
+      std::size_t length = Ap[i + 1] - Ap[i];
+      detail::sort_row(Aj + Ap[i], Ax + Ap[i], length, scratch[tid]);
+      if (merge)
+        lengths[i] = offset_t(detail::merge_row(Aj + Ap[i], Ax + Ap[i], length,
+                                                policy.duplicates));
+    }
+  });
+  scratch.clear();
+
+  if (!merge)
+    return nnz;
+
+  // --
+  // Compact the merged groups.
+  std::vector<offset_t> merged_offsets(n + 1);
+  std::size_t merged_nnz = util::parallel::transform_exclusive_scan<offset_t>(
+      n, [&](std::size_t i) { return lengths[i]; }, merged_offsets.data());
+  if (merged_nnz == nnz)
+    return nnz;
+
+  indices_vector_t merged_indices(merged_nnz);
+  values_vector_t merged_values(merged_nnz);
+  index_t* Bj = memory::raw_pointer_cast(merged_indices.data());
+  value_t* Bx = memory::raw_pointer_cast(merged_values.data());
+  util::parallel::for_each(
+      std::size_t(0), n,
+      [&](std::size_t i) {
+        std::copy_n(Aj + Ap[i], lengths[i], Bj + merged_offsets[i]);
+        std::copy_n(Ax + Ap[i], lengths[i], Bx + merged_offsets[i]);
+      },
+      std::size_t(256));
+  indices.swap(merged_indices);
+  nonzero_values.swap(merged_values);
+  util::parallel::for_each(
+      std::size_t(0), n + 1, [&](std::size_t i) { Ap[i] = merged_offsets[i]; },
+      std::size_t(1) << 14);
+
+  return merged_nnz;
+}
+
+
+/**
+ * @brief Builds a compressed (CSR-like) format from a coordinate list: the
+ * entries are grouped by their major index (row for CSR, column for CSC) and
+ * each group is sorted by minor index.
+ *
+ * @par Overview
+ * The input is cut into blocks, one per thread. Each block counts its entries
+ * per major index into a private histogram (no atomics); a parallel prefix sum
+ * over the major indices of the totals gives the offsets, and every block's
+ * counters are turned into its own write positions within each group. The
+ * blocks then scatter their entries in parallel. Because blocks write to
+ * disjoint, ordered slots, every group holds its entries in input order, so
+ * the result does not depend on the number of threads. When the private
+ * histograms would outgrow the input (many more major indices than entries
+ * per block), a stable radix pass first moves the entries into buckets of
+ * consecutive major indices, which are then counted and scattered one bucket
+ * per thread, with the same result. Finally the groups are
+ * sorted by minor index (stable, so `duplicate_policy_t::first` keeps the
+ * first entry of the input) and their duplicates merged in parallel; merged
+ * groups are compacted with a second prefix sum.
+ *
+ * @tparam index_t index type.
+ * @tparam value_t value type.
+ * @tparam offsets_vector_t host vector of offsets (`resize()`, `data()`).
+ * @tparam indices_vector_t host vector of indices.
+ * @tparam values_vector_t host vector of values.
+ * @param number_of_majors number of rows (CSR) or columns (CSC).
+ * @param number_of_entries number of input entries.
+ * @param majors major index of each entry.
+ * @param minors minor index of each entry.
+ * @param values value of each entry.
+ * @param policy cleanup policies.
+ * @param offsets output, offsets (size `number_of_majors + 1`).
+ * @param indices output, minor indices.
+ * @param nonzero_values output, values.
+ * @return std::size_t number of entries of the output.
+ */
+template <typename index_t,
+          typename value_t,
+          typename offsets_vector_t,
+          typename indices_vector_t,
+          typename values_vector_t>
+std::size_t compress(index_t number_of_majors,
+                     std::size_t number_of_entries,
+                     index_t const* majors,
+                     index_t const* minors,
+                     value_t const* values,
+                     build_policy_t const& policy,
+                     offsets_vector_t& offsets,
+                     indices_vector_t& indices,
+                     values_vector_t& nonzero_values) {
+  coordinates_t<index_t, value_t> source{number_of_entries, majors, minors,
+                                         values};
+  return compress(number_of_majors, source, policy, offsets, indices,
+                  nonzero_values);
+}
+
+/**
+ * @brief Expands compressed offsets into one major index per entry (the
+ * inverse of the grouping done by `compress()`), in parallel.
+ *
+ * @param number_of_majors number of rows (CSR) or columns (CSC).
+ * @param offsets offsets (size `number_of_majors + 1`).
+ * @param majors output, major index of each entry.
+ */
+template <typename index_t, typename offset_t>
+void expand(index_t number_of_majors,
+            offset_t const* offsets,
+            index_t* majors) {
+  util::parallel::for_each(
+      std::size_t(0), std::size_t(number_of_majors),
+      [=](std::size_t i) {
+        std::fill(majors + offsets[i], majors + offsets[i + 1], index_t(i));
+      },
+      std::size_t(256));
+}
+
+}  // namespace builder
+}  // namespace format
+}  // namespace gunrock
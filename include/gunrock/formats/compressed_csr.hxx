@@ -0,0 +1,530 @@
+/**
+ * @file compressed_csr.hxx
+ * @brief Compressed Sparse Row format with delta + variable-length encoded
+ * column indices and optional implicit unit values, for graphs whose CSR does
+ * not fit (or barely fits) in memory.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <gunrock/memory.hxx>
+#include <gunrock/error.hxx>
+
+#include <gunrock/container/vector.hxx>
+#include <gunrock/formats/formats.hxx>
+#include <gunrock/util/parallel.hxx>
+
+#include <thrust/host_vector.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace gunrock {
+namespace format {
+
+using namespace memory;
+
+/**
+ * @brief What `compressed_csr_t::from_csr()` does with the nonzero values.
+ */
+enum class value_policy_t {
+  keep,           ///< Store the values.
+  implicit_unit,  ///< Drop the values; every edge weighs 1.
+  detect          ///< Drop the values if they are all 1 (pattern matrices).
+};
+
+namespace compressed {
+
+/// Edges per block. Decoding can start at the beginning of any block (its
+/// byte offset is stored in `block_offsets`) or of any row.
+constexpr std::size_t block_size = 64;
+/// Values per group: one tag byte holds the size classes of 4 values.
+constexpr std::size_t group_size = 4;
+/// Zero bytes after the encoded stream, so every value can be read with an
+/// unaligned 8-byte load.
+constexpr std::size_t padding = 8;
+
+/**
+ * @brief Byte length of size class `c` (0 to 3): 1, 2, 3 or 4 bytes for
+ * 32-bit indices, 1, 2, 4 or 8 bytes for 64-bit indices.
+ */
+template <typename index_t>
+__host__ __device__ __forceinline__ unsigned class_bytes(unsigned c) {
+  if constexpr (sizeof(index_t) <= 4)
+    return c + 1;
+  else
+    return 1u << c;
+}
+
+/// Smallest size class holding `x`, or 4 if none does.
+template <typename index_t>
+__host__ __device__ __forceinline__ unsigned size_class(std::uint64_t x) {
+  unsigned c = 0;
+  for (; c < 4; ++c) {
+    unsigned bytes = class_bytes<index_t>(c);
+    if (bytes >= 8 || (x >> (8 * bytes)) == 0)
+      break;
+  }
+  return c;
+}
+
+/// Encoded size of the group `codes[0, count)` (`count <= group_size`).
+template <typename index_t>
+__host__ __device__ __forceinline__ std::size_t group_bytes(
+    std::uint64_t const* codes,
+    std::size_t count) {
+  std::size_t bytes = 1;
+  for (std::size_t i = 0; i < count; ++i)
+    bytes += class_bytes<index_t>(size_class<index_t>(codes[i]));
+  return bytes + (group_size - count);  // unused slots take 1 byte.
+}
+
+/**
+ * @brief Encodes the group `codes[0, count)`: a tag byte with the size class
+ * of each value (2 bits each, first value in the low bits), then the values,
+ * little-endian, in their class' number of bytes.
+ */
+template <typename index_t>
+__host__ __device__ __forceinline__ std::uint8_t* encode_group(
+    std::uint64_t const* codes,
+    std::size_t count,
+    std::uint8_t* p) {
+  std::uint8_t* tag = p++;
+  *tag = 0;
+  for (std::size_t i = 0; i < group_size; ++i) {
+    std::uint64_t x = i < count ? codes[i] : 0;
+    unsigned c = size_class<index_t>(x);
+    *tag |= std::uint8_t(c << (2 * i));
+    for (unsigned b = 0; b < class_bytes<index_t>(c); ++b, x >>= 8)
+      *p++ = std::uint8_t(x);
+  }
+  return p;
+}
+
+/**
+ * @brief Decodes the group at `p` into `codes` and returns the next group.
+ * The lengths come from the tag alone, so the four loads are independent.
+ */
+template <typename index_t>
+__host__ __device__ __forceinline__ std::uint8_t const* decode_group(
+    std::uint8_t const* p,
+    std::uint64_t* codes) {
+  unsigned tag = *p++;
+  for (std::size_t i = 0; i < group_size; ++i, tag >>= 2) {
+    unsigned bytes = class_bytes<index_t>(tag & 3);
+    std::uint64_t word;
+    memcpy(&word, p, sizeof(word));
+    codes[i] =
+        bytes >= 8 ? word : word & ((std::uint64_t(1) << (8 * bytes)) - 1);
+    p += bytes;
+  }
+  return p;
+}
+
+__host__ __device__ __forceinline__ std::uint64_t zigzag(std::int64_t x) {
+  return (std::uint64_t(x) << 1) ^ std::uint64_t(x >> 63);
+}
+
+__host__ __device__ __forceinline__ std::int64_t unzigzag(std::uint64_t x) {
+  return std::int64_t(x >> 1) ^ -std::int64_t(x & 1);
+}
+
+/**
+ * @brief Decoding position in the encoded stream: the current edge, its
+ * column, and the decoded group it belongs to.
+ */
+template <typename index_t>
+struct cursor_t {
+  std::uint8_t const* next_group;
+  std::uint64_t codes[group_size];
+  std::size_t slot;
+  std::size_t edge;
+  index_t row;
+  std::int64_t column;
+
+  /// Moves to the next edge of the stream (which must exist).
+  __host__ __device__ __forceinline__ void advance() {
+    ++edge;
+    if (++slot == group_size) {
+      next_group = decode_group<index_t>(next_group, codes);
+      slot = 0;
+    }
+    if (edge % block_size == 0)
+      column = std::int64_t(row) + unzigzag(codes[slot]);
+    else
+      column += std::int64_t(codes[slot]);
+  }
+};
+
+/**
+ * @brief Raw pointers to the arrays of a compressed CSR, and the decoder.
+ *
+ * @par Encoding
+ * The columns of a row are sorted. The first edge of every row and of every
+ * block is a restart point, stored as `zigzag(column - row)` (small for
+ * banded or reordered graphs); every other edge stores the gap to the
+ * previous column. The codes are stored as group varints (see
+ * `encode_group()`); blocks are whole groups, and `block_offsets` holds the
+ * byte offset of each. `row_group_offsets` holds, for each row, the byte
+ * offset (within its block) of the group of its first edge, so decoding a row
+ * starts right there; decoding from the middle of a row starts at the
+ * nearest restart point before it, at most one block away.
+ */
+template <typename index_t, typename offset_t>
+struct lists_t {
+  offset_t const* row_offsets;
+  std::uint64_t const* block_offsets;
+  std::uint16_t const* row_group_offsets;
+  std::uint8_t const* bytes;
+
+  /**
+   * @brief Cursor at position `position` (`< degree`) of `row`.
+   */
+  __host__ __device__ __forceinline__ cursor_t<index_t> seek(
+      index_t row,
+      offset_t position) const {
+    std::size_t row_start = row_offsets[row];
+    std::size_t target = row_start + position;
+    std::size_t block = target / block_size;
+    std::size_t block_start = block * block_size;
+
+    cursor_t<index_t> cursor;
+    cursor.row = row;
+    std::uint8_t const* group = bytes + block_offsets[block];
+    if (row_start >= block_start) {
+      group += row_group_offsets[row];
+      cursor.slot = (row_start - block_start) % group_size;
+      cursor.edge = row_start;
+    } else {
+      cursor.slot = 0;
+      cursor.edge = block_start;
+    }
+    cursor.next_group = decode_group<index_t>(group, cursor.codes);
+    cursor.column = std::int64_t(row) + unzigzag(cursor.codes[cursor.slot]);
+    while (cursor.edge < target)
+      cursor.advance();
+    return cursor;
+  }
+
+  /**
+   * @brief Decodes the neighbors at positions `[first, last)` of `row` and
+   * calls `pred(column, edge)` on each, stopping at the first `true`.
+   *
+   * @return true if `pred` returned true.
+   */
+  template <typename pred_t>
+  __host__ __device__ __forceinline__ bool decode_until(index_t row,
+                                                        offset_t first,
+                                                        offset_t last,
+                                                        pred_t pred) const {
+    if (first >= last)
+      return false;
+    const std::size_t end = std::size_t(row_offsets[row]) + last;
+    auto cursor = seek(row, first);
+    std::size_t e = cursor.edge;
+    std::int64_t column = cursor.column;
+    std::uint64_t* codes = cursor.codes;
+    if (pred(index_t(column), offset_t(e)))
+      return true;
+
+    // Rest of the current group (never the start of a block).
+    for (std::size_t slot = cursor.slot + 1; slot < group_size; ++slot) {
+      if (++e == end)
+        return false;
+      column += std::int64_t(codes[slot]);
+      if (pred(index_t(column), offset_t(e)))
+        return true;
+    }
+
+    // Then whole groups; only their first value may be a restart point.
+    std::uint8_t const* p = cursor.next_group;
+    for (++e; e < end; ++e) {
+      p = decode_group<index_t>(p, codes);
+      if (e % block_size == 0)
+        column = std::int64_t(row) + unzigzag(codes[0]);
+      else
+        column += std::int64_t(codes[0]);
+      if (pred(index_t(column), offset_t(e)))
+        return true;
+      for (std::size_t slot = 1; slot < group_size; ++slot) {
+        if (++e == end)
+          return false;
+        column += std::int64_t(codes[slot]);
+        if (pred(index_t(column), offset_t(e)))
+          return true;
+      }
+    }
+    return false;
+  }
+};
+
+}  // namespace compressed
+
+/**
+ * @brief Compressed Sparse Row format with delta + group-varint encoded column
+ * indices (see `compressed::lists_t` for the encoding).
+ *
+ * @par Overview
+ * Stores the CSR row offsets, one byte offset per block of
+ * `compressed::block_size` edges, a 16-bit in-block offset per row and the
+ * encoded column indices (1.25 to 5 bytes per edge instead of
+ * `sizeof(index_t)`); the values are stored as-is, or dropped entirely in
+ * implicit-unit mode (every edge weighs 1). Edge ids are the same as in the
+ * CSR it was built from, so per-edge data (values, edge frontiers) carries
+ * over unchanged. A random column lookup decodes at most one block; scanning
+ * a row decodes it sequentially.
+ *
+ * @tparam index_t
+ * @tparam offset_t
+ * @tparam value_t
+ */
+template <memory_space_t space,
+          typename index_t,
+          typename offset_t,
+          typename value_t>
+struct compressed_csr_t {
+  using index_type = index_t;
+  using offset_type = offset_t;
+  using value_type = value_t;
+
+  index_t number_of_rows;
+  index_t number_of_columns;
+  offset_t number_of_nonzeros;
+  /// Values are implicit (all 1) and `nonzero_values` is empty.
+  bool unit_values;
+
+  vector_t<offset_t, space> row_offsets;             // Ap
+  vector_t<std::uint64_t, space> block_offsets;      // byte offset per block
+  vector_t<std::uint16_t, space> row_group_offsets;  // see compressed::lists_t
+  vector_t<std::uint8_t, space> encoded_indices;     // encoded Aj
+  vector_t<value_t, space> nonzero_values;  // Ax (empty if unit_values)
+
+  compressed_csr_t()
+      : number_of_rows(0),
+        number_of_columns(0),
+        number_of_nonzeros(0),
+        unit_values(false),
+        row_offsets(),
+        block_offsets(),
+        row_group_offsets(),
+        encoded_indices(),
+        nonzero_values() {}
+
+  ~compressed_csr_t() {}
+
+  /**
+   * @brief Compress a (host) CSR, in parallel over blocks: the encoded size of
+   * every block is computed and scanned into `block_offsets`, then every
+   * block is encoded in place. The column indices of every row must be sorted
+   * (the default of `csr_t::from_coo()`).
+   *
+   * @param csr
+   * @param values what to do with the values (default drops them if they
+   * are all 1).
+   * @return compressed_csr_t<space, index_t, offset_t, value_t>&
+   */
+  compressed_csr_t<space, index_t, offset_t, value_t>& from_csr(
+      const csr_t<memory_space_t::host, index_t, offset_t, value_t>& csr,
+      value_policy_t values = value_policy_t::detect) {
+    using compressed::block_size;
+
+    number_of_rows = csr.number_of_rows;
+    number_of_columns = csr.number_of_columns;
+    number_of_nonzeros = csr.number_of_nonzeros;
+
+    const std::size_t n = csr.number_of_rows;
+    const std::size_t m = csr.number_of_nonzeros;
+    const std::size_t num_blocks = (m + block_size - 1) / block_size;
+    auto Ap = memory::raw_pointer_cast(csr.row_offsets.data());
+    auto Aj = memory::raw_pointer_cast(csr.column_indices.data());
+    auto Ax = memory::raw_pointer_cast(csr.nonzero_values.data());
+
+    // Codes of the edges of block `b` (see `compressed::lists_t`).
+    // Returns their number, or 0 if a row is not sorted or a code does not
+    // fit the largest size class.
+    auto block_codes = [=](std::size_t b, std::uint64_t* codes) {
+      std::size_t first = b * block_size;
+      std::size_t last = std::min(m, first + block_size);
+      std::size_t row =
+          std::upper_bound(Ap, Ap + n + 1, offset_t(first)) - Ap - 1;
+      for (std::size_t e = first; e < last; ++e) {
+        while (std::size_t(Ap[row + 1]) <= e)
+          ++row;
+        std::uint64_t code;
+        if (e == first || e == std::size_t(Ap[row])) {
+          code = compressed::zigzag(std::int64_t(Aj[e]) - std::int64_t(row));
+        } else {
+          if (Aj[e] < Aj[e - 1])
+            return std::size_t(0);
+          code = std::uint64_t(Aj[e] - Aj[e - 1]);
+        }
+        if (compressed::size_class<index_t>(code) > 3)
+          return std::size_t(0);
+        codes[e - first] = code;
+      }
+      return last - first;
+    };
+
+    auto for_each_group = [](std::uint64_t const* codes, std::size_t count,
+                             auto op) {
+      for (std::size_t g = 0; g < count; g += compressed::group_size)
+        op(codes + g, std::min(compressed::group_size, count - g));
+    };
+
+    thrust::host_vector<std::uint64_t> h_block_offsets(num_blocks + 1);
+    bool valid = true;
+    std::size_t total_bytes = util::parallel::transform_exclusive_scan(
+        num_blocks,
+        [&](std::size_t b) {
+          std::uint64_t codes[block_size];
+          std::size_t count = block_codes(b, codes);
+          if (count == 0)
+            __atomic_store_n(&valid, false, __ATOMIC_RELAXED);
+          std::uint64_t size = 0;
+          for_each_group(codes, count, [&](auto group, std::size_t length) {
+            size += compressed::group_bytes<index_t>(group, length);
+          });
+          return size;
+        },
+        h_block_offsets.data());
+    error::throw_if_exception(
+        !valid,
+        "compressed_csr_t requires the columns of every row sorted, and ids "
+        "below 2^31 for 32-bit indices.");
+
+    thrust::host_vector<std::uint8_t> h_encoded(
+        total_bytes + compressed::padding, 0);
+    thrust::host_vector<std::uint16_t> h_row_group_offsets(n, 0);
+    std::uint8_t* bytes = h_encoded.data();
+    std::uint16_t* row_groups = h_row_group_offsets.data();
+    std::uint64_t const* offsets = h_block_offsets.data();
+    util::parallel::for_each(
+        std::size_t(0), num_blocks,
+        [=](std::size_t b) {
+          std::uint64_t codes[block_size];
+          std::uint16_t group_offsets[block_size / compressed::group_size];
+          std::uint8_t* block = bytes + offsets[b];
+          std::uint8_t* p = block;
+          for_each_group(codes, block_codes(b, codes),
+                         [&](auto group, std::size_t length) {
+                           group_offsets[(group - codes) /
+                                         compressed::group_size] =
+                               std::uint16_t(p - block);
+                           p = compressed::encode_group<index_t>(group, length,
+                                                                 p);
+                         });
+
+          // Rows starting in this block.
+          std::size_t first = b * block_size;
+          std::size_t last = std::min(m, first + block_size);
+          for (std::size_t row =
+                   std::lower_bound(Ap, Ap + n, offset_t(first)) - Ap;
+               row < n && std::size_t(Ap[row]) < last; ++row)
+            row_groups[row] =
+                group_offsets[(Ap[row] - first) / compressed::group_size];
+        },
+        std::size_t(256));
+
+    if (values == value_policy_t::detect) {
+      bool all_ones = true;
+      util::parallel::for_each_chunk(
+          std::size_t(0), m,
+          [&](std::size_t first, std::size_t last) {
+            for (std::size_t e = first; e < last; ++e)
+              if (Ax[e] != value_t(1)) {
+                __atomic_store_n(&all_ones, false, __ATOMIC_RELAXED);
+                return;
+              }
+          },
+          std::size_t(1) << 16);
+      values = all_ones ? value_policy_t::implicit_unit : value_policy_t::keep;
+    }
+    unit_values = (values == value_policy_t::implicit_unit);
+
+    row_offsets = csr.row_offsets;
+    block_offsets = h_block_offsets;
+    row_group_offsets = h_row_group_offsets;
+    encoded_indices = h_encoded;
+    if (unit_values)
+      vector_t<value_t, space>().swap(nonzero_values);
+    else
+      nonzero_values = csr.nonzero_values;
+
+    return *this;  // Compressed CSR representation
+  }
+
+  /**
+   * @brief Decompress into a (host) CSR. Implicit unit values are
+   * materialized as 1.
+   *
+   * @param csr
+   */
+  void to_csr(csr_t<memory_space_t::host, index_t, offset_t, value_t>& csr)
+      const {
+    thrust::host_vector<offset_t> Ap(row_offsets);
+    thrust::host_vector<std::uint64_t> block_offs(block_offsets);
+    thrust::host_vector<std::uint16_t> row_groups(row_group_offsets);
+    thrust::host_vector<std::uint8_t> bytes(encoded_indices);
+    compressed::lists_t<index_t, offset_t> lists{
+        Ap.data(), block_offs.data(), row_groups.data(), bytes.data()};
+
+    csr.number_of_rows = number_of_rows;
+    csr.number_of_columns = number_of_columns;
+    csr.number_of_nonzeros = number_of_nonzeros;
+    csr.row_offsets = Ap;
+    csr.column_indices.resize(number_of_nonzeros);
+    if (unit_values)
+      csr.nonzero_values.assign(number_of_nonzeros, value_t(1));
+    else
+      csr.nonzero_values = nonzero_values;
+
+    auto Aj = csr.column_indices.data();
+    util::parallel::for_each(
+        index_t(0), number_of_rows,
+        [&](index_t row) {
+          lists.decode_until(row, offset_t(0), offset_t(Ap[row + 1] - Ap[row]),
+                             [=](index_t column, offset_t e) {
+                               Aj[e] = column;
+                               return false;
+                             });
+        },
+        index_t(256));
+  }
+
+  /**
+   * @brief Bytes held by the format (offsets, encoded indices and values).
+   */
+  std::size_t memory_footprint() const {
+    return row_offsets.size() * sizeof(offset_t) +
+           block_offsets.size() * sizeof(std::uint64_t) +
+           row_group_offsets.size() * sizeof(std::uint16_t) +
+           encoded_indices.size() * sizeof(std::uint8_t) +
+           nonzero_values.size() * sizeof(value_t);
+  }
+
+  /**
+   * @brief Bytes an uncompressed `csr_t` of the same matrix holds.
+   */
+  std::size_t uncompressed_footprint() const {
+    return (std::size_t(number_of_rows) + 1) * sizeof(offset_t) +
+           std::size_t(number_of_nonzeros) *
+               (sizeof(index_t) + sizeof(value_t));
+  }
+
+  /**
+   * @brief `uncompressed_footprint() / memory_footprint()`.
+   */
+  double compression_ratio() const {
+    std::size_t bytes = memory_footprint();
+    return bytes ? double(uncompressed_footprint()) / double(bytes) : 1.0;
+  }
+
+};  // struct compressed_csr_t
+
+}  // namespace format
+}  // namespace gunrock
@@ -2,6 +2,7 @@
 
 #include <gunrock/container/vector.hxx>
 #include <gunrock/memory.hxx>
+#include <gunrock/formats/builder.hxx>
 #include <thrust/sort.h>
 #include <thrust/execution_policy.h>
 
@@ -50,7 +51,8 @@ struct csc_t {
 
   /**
    * @brief Convert CSR format into CSC
-   * Format.
+   * Format. On the host, the transposition runs in parallel through
+   * `format::builder::compress()`; the row indices of every column are sorted.
    *
    * @tparam index_t
    * @tparam index_t
@@ -65,6 +67,21 @@ struct csc_t {
     number_of_columns = csr.number_of_columns;
     number_of_nonzeros = csr.number_of_nonzeros;
 
+    if constexpr (space == memory_space_t::host) {
+      // Each entry's row, then group the entries by column.
+      vector_t<index_t, space> rows(number_of_nonzeros);
+      builder::expand(csr.number_of_rows,
+                      memory::raw_pointer_cast(csr.row_offsets.data()),
+                      memory::raw_pointer_cast(rows.data()));
+      builder::compress(
+          number_of_columns, std::size_t(number_of_nonzeros),
+          memory::raw_pointer_cast(csr.column_indices.data()),
+          memory::raw_pointer_cast(rows.data()),
+          memory::raw_pointer_cast(csr.nonzero_values.data()),
+          build_policy_t(), column_offsets, row_indices, nonzero_values);
+      return *this;  // CSC representation
+    }
+
     // Column indices may get reordered below, so we need to make a copy
     vector_t<index_t, space> temp;
     temp.resize(number_of_nonzeros);
@@ -96,7 +113,7 @@ struct csc_t {
     gunrock::graph::convert::indices_to_offsets<space>(
         memory::raw_pointer_cast(temp.data()), number_of_nonzeros,
         memory::raw_pointer_cast(column_offsets.data()),
-        csr.number_of_rows + 1);
+        csr.number_of_columns + 1);
 
     return *this;  // CSC representation
   }
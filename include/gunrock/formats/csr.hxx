@@ -5,9 +5,15 @@
 
 #include <gunrock/container/vector.hxx>
 #include <gunrock/formats/formats.hxx>
+#include <gunrock/formats/builder.hxx>
+#include <gunrock/io/binary.hxx>
 
+#include <thrust/copy.h>
+#include <thrust/host_vector.h>
 #include <thrust/transform.h>
 
+#include <limits>
+
 namespace gunrock {
 namespace format {
 
@@ -70,77 +76,172 @@ struct csr_t {
 
   /**
    * @brief Convert a Coordinate Sparse Format into Compressed Sparse Row
-   * Format.
+   * Format, in parallel on the host (see `format::builder::compress()`). The
+   * column indices of every row are sorted; self-loops, duplicates and
+   * symmetrization are handled according to `policy`.
    *
    * @tparam index_t
    * @tparam offset_t
    * @tparam value_t
    * @param coo
+   * @param policy cleanup policies (default keeps every entry).
    * @return csr_t<space, index_t, offset_t, value_t>&
    */
   csr_t<space, index_t, offset_t, value_t> from_coo(
-      const coo_t<memory_space_t::host, index_t, offset_t, value_t>& coo) {
-    number_of_rows = coo.number_of_rows;
-    number_of_columns = coo.number_of_columns;
-    number_of_nonzeros = coo.number_of_nonzeros;
-
-    // Allocate space for vectors
-    vector_t<offset_t, memory_space_t::host> Ap;
-    vector_t<index_t, memory_space_t::host> Aj;
-    vector_t<value_t, memory_space_t::host> Ax;
-
-    // offset_t* Ap;
-    // index_t* Aj;
-    // value_t* Ax;
-
-    Ap.resize(number_of_rows + 1);
-    Aj.resize(number_of_nonzeros);
-    Ax.resize(number_of_nonzeros);
-
-    // Ap = _Ap.data();
-    // Aj = _Aj.data();
-    // Ax = _Ax.data();
-
-    // compute number of non-zero entries per row of A.
-    for (offset_t n = 0; n < number_of_nonzeros; ++n) {
-      ++Ap[coo.row_indices[n]];
-    }
+      const coo_t<memory_space_t::host, index_t, offset_t, value_t>& coo,
+      build_policy_t policy = build_policy_t()) {
+    return from_stream(
+        coo.number_of_rows, coo.number_of_columns,
+        builder::coordinates_t<index_t, value_t>{
+            std::size_t(coo.number_of_nonzeros),
+            memory::raw_pointer_cast(coo.row_indices.data()),
+            memory::raw_pointer_cast(coo.column_indices.data()),
+            memory::raw_pointer_cast(coo.nonzero_values.data())},
+        policy);
+  }
 
-    // cumulative sum the nnz per row to get row_offsets[].
-    for (index_t i = 0, sum = 0; i < number_of_rows; ++i) {
-      index_t temp = Ap[i];
-      Ap[i] = sum;
-      sum += temp;
+  /**
+   * @brief Build the CSR straight from a stream of (row, column, value)
+   * entries produced on the fly, e.g. by a graph generator (see
+   * `format::builder::compress()` for the `source_t` interface), without an
+   * intermediate coordinate list.
+   *
+   * @tparam source_t entry stream.
+   * @param rows number of rows.
+   * @param columns number of columns.
+   * @param source entry stream.
+   * @param policy cleanup policies (default keeps every entry).
+   * @return csr_t<space, index_t, offset_t, value_t>&
+   */
+  template <typename source_t>
+  csr_t<space, index_t, offset_t, value_t> from_stream(
+      index_t rows,
+      index_t columns,
+      source_t const& source,
+      build_policy_t policy = build_policy_t()) {
+    error::throw_if_exception(policy.symmetrize && (rows != columns),
+                              "Only square matrices can be symmetrized.");
+
+    number_of_rows = rows;
+    number_of_columns = columns;
+
+    auto build = [&](auto& Ap, auto& Aj, auto& Ax) {
+      return builder::compress(number_of_rows, source, policy, Ap, Aj, Ax);
+    };
+
+    if constexpr (space == memory_space_t::host) {
+      number_of_nonzeros = build(row_offsets, column_indices, nonzero_values);
+    } else {
+      vector_t<offset_t, memory_space_t::host> Ap;
+      vector_t<index_t, memory_space_t::host> Aj;
+      vector_t<value_t, memory_space_t::host> Ax;
+      number_of_nonzeros = build(Ap, Aj, Ax);
+
+      row_offsets = Ap;
+      column_indices = Aj;
+      nonzero_values = Ax;
     }
-    Ap[number_of_rows] = number_of_nonzeros;
-
-    // write coordinate column indices and nonzero values into CSR's
-    // column indices and nonzero values.
-    for (offset_t n = 0; n < number_of_nonzeros; ++n) {
-      index_t row = coo.row_indices[n];
-      index_t dest = Ap[row];
 
-      Aj[dest] = coo.column_indices[n];
-      Ax[dest] = coo.nonzero_values[n];
+    return *this;  // CSR representation
+  }
 
-      ++Ap[row];
+  /**
+   * @brief Read a binary CSR file (see io/binary.hxx). The sections are copied
+   * straight out of a read-only mapping of the file, converting element types
+   * if they differ from `index_t`, `offset_t` or `value_t`. Headerless files
+   * written by older versions of `write_binary()` are still accepted.
+   *
+   * @param filename binary file.
+   * @return graph::graph_properties_t properties stored in the file (defaults
+   * for legacy files).
+   */
+  graph::graph_properties_t read_binary(std::string filename) {
+    io::binary::file_t file(filename);
+    if (file.is_legacy()) {
+      read_legacy_binary(filename);
+      return graph::graph_properties_t();
     }
 
-    for (index_t i = 0, last = 0; i <= number_of_rows; ++i) {
-      index_t temp = Ap[i];
-      Ap[i] = last;
-      last = temp;
-    }
+    error::throw_if_exception(file.layout() != io::binary::layout_t::csr,
+                              "Binary graph is not stored as CSR: " + filename);
+    error::throw_if_exception(
+        file.get_number_of_rows() >= std::numeric_limits<index_t>::max() ||
+            file.get_number_of_columns() >=
+                std::numeric_limits<index_t>::max(),
+        "index_t overflow");
+    error::throw_if_exception(file.get_number_of_nonzeros() >=
+                                  std::numeric_limits<offset_t>::max(),
+                              "offset_t overflow");
+
+    number_of_rows = file.get_number_of_rows();
+    number_of_columns = file.get_number_of_columns();
+    number_of_nonzeros = file.get_number_of_nonzeros();
+
+    auto load = [&](std::size_t section, auto& v, std::size_t count) {
+      using type_t = typename std::decay_t<decltype(v)>::value_type;
+      v.resize(count);
+      if constexpr (space == memory_space_t::host) {
+        file.copy_section(section, memory::raw_pointer_cast(v.data()), count);
+      } else if (file.template holds<type_t>(section)) {
+        // Single copy from the mapping to the device.
+        const type_t* mapped = file.template section<type_t>(section);
+        thrust::copy(mapped, mapped + count, v.begin());
+      } else {
+        thrust::host_vector<type_t> h_v(count);
+        file.copy_section(section, h_v.data(), count);
+        v = h_v;
+      }
+    };
+
+    load(0, row_offsets, number_of_rows + 1);
+    load(1, column_indices, number_of_nonzeros);
+    load(2, nonzero_values, number_of_nonzeros);
+
+    return file.properties();
+  }
 
-    row_offsets = Ap;
-    column_indices = Aj;
-    nonzero_values = Ax;
+  /**
+   * @brief Write the matrix as a binary CSR file (see io/binary.hxx).
+   *
+   * @param filename output file.
+   * @param properties graph properties to store alongside the matrix.
+   * @param checksum store a checksum of the data in the header.
+   */
+  void write_binary(std::string filename,
+                    graph::graph_properties_t properties = {},
+                    bool checksum = true) {
+    auto write = [&](const offset_t* Ap, const index_t* Aj, const value_t* Ax) {
+      io::binary::section_t sections[] = {
+          io::binary::make_section(Ap, std::uint64_t(number_of_rows) + 1),
+          io::binary::make_section(Aj, std::uint64_t(number_of_nonzeros)),
+          io::binary::make_section(Ax, std::uint64_t(number_of_nonzeros))};
+      io::binary::write(filename, io::binary::layout_t::csr, number_of_rows,
+                        number_of_columns, number_of_nonzeros, properties,
+                        sections, checksum);
+    };
 
-    return *this;  // CSR representation (with possible duplicates)
+    if (space == memory_space_t::device) {
+      thrust::host_vector<offset_t> h_row_offsets(row_offsets);
+      thrust::host_vector<index_t> h_column_indices(column_indices);
+      thrust::host_vector<value_t> h_nonzero_values(nonzero_values);
+      write(h_row_offsets.data(), h_column_indices.data(),
+            h_nonzero_values.data());
+    } else {
+      write(memory::raw_pointer_cast(row_offsets.data()),
+            memory::raw_pointer_cast(column_indices.data()),
+            memory::raw_pointer_cast(nonzero_values.data()));
+    }
   }
 
-  void read_binary(std::string filename) {
+ private:
+  /**
+   * @brief Headerless format written by older versions: rows, columns and
+   * nonzeros followed by the three raw arrays, in the caller's types.
+   */
+  void read_legacy_binary(std::string filename) {
     FILE* file = fopen(filename.c_str(), "rb");
+    error::throw_if_exception(file == nullptr,
+                              "File could not be opened: " + filename);
 
     // Read metadata
     error::throw_if_exception(
@@ -150,81 +251,24 @@ struct csr_t {
     error::throw_if_exception(
         fread(&number_of_nonzeros, sizeof(offset_t), 1, file) == 0);
 
-    row_offsets.resize(number_of_rows + 1);
-    column_indices.resize(number_of_nonzeros);
-    nonzero_values.resize(number_of_nonzeros);
-
-    if (space == memory_space_t::device) {
-      assert(space == memory_space_t::device);
-
-      thrust::host_vector<offset_t> h_row_offsets(number_of_rows + 1);
-      thrust::host_vector<index_t> h_column_indices(number_of_nonzeros);
-      thrust::host_vector<value_t> h_nonzero_values(number_of_nonzeros);
-
-      error::throw_if_exception(
-          fread(memory::raw_pointer_cast(h_row_offsets.data()),
-                sizeof(offset_t), number_of_rows + 1, file) == 0);
-      error::throw_if_exception(
-          fread(memory::raw_pointer_cast(h_column_indices.data()),
-                sizeof(index_t), number_of_nonzeros, file) == 0);
-      error::throw_if_exception(
-          fread(memory::raw_pointer_cast(h_nonzero_values.data()),
-                sizeof(value_t), number_of_nonzeros, file) == 0);
-
-      // Copy data from host to device
-      row_offsets = h_row_offsets;
-      column_indices = h_column_indices;
-      nonzero_values = h_nonzero_values;
-
-    } else {
-      assert(space == memory_space_t::host);
-
-      error::throw_if_exception(
-          fread(memory::raw_pointer_cast(row_offsets.data()), sizeof(offset_t),
-                number_of_rows + 1, file) == 0);
-      error::throw_if_exception(
-          fread(memory::raw_pointer_cast(column_indices.data()),
-                sizeof(index_t), number_of_nonzeros, file) == 0);
-      error::throw_if_exception(
-          fread(memory::raw_pointer_cast(nonzero_values.data()),
-                sizeof(value_t), number_of_nonzeros, file) == 0);
-    }
-  }
-
-  void write_binary(std::string filename) {
-    FILE* file = fopen(filename.c_str(), "wb");
-
-    // Write metadata
-    fwrite(&number_of_rows, sizeof(index_t), 1, file);
-    fwrite(&number_of_columns, sizeof(index_t), 1, file);
-    fwrite(&number_of_nonzeros, sizeof(offset_t), 1, file);
-
-    // Write data
-    if (space == memory_space_t::device) {
-      assert(space == memory_space_t::device);
-
-      thrust::host_vector<offset_t> h_row_offsets(row_offsets);
-      thrust::host_vector<index_t> h_column_indices(column_indices);
-      thrust::host_vector<value_t> h_nonzero_values(nonzero_values);
-
-      fwrite(memory::raw_pointer_cast(h_row_offsets.data()), sizeof(offset_t),
-             number_of_rows + 1, file);
-      fwrite(memory::raw_pointer_cast(h_column_indices.data()), sizeof(index_t),
-             number_of_nonzeros, file);
-      fwrite(memory::raw_pointer_cast(h_nonzero_values.data()), sizeof(value_t),
-             number_of_nonzeros, file);
-    } else {
-      assert(space == memory_space_t::host);
-
-      fwrite(memory::raw_pointer_cast(row_offsets.data()), sizeof(offset_t),
-             number_of_rows + 1, file);
-      fwrite(memory::raw_pointer_cast(column_indices.data()), sizeof(index_t),
-             number_of_nonzeros, file);
-      fwrite(memory::raw_pointer_cast(nonzero_values.data()), sizeof(value_t),
-             number_of_nonzeros, file);
-    }
+    thrust::host_vector<offset_t> h_row_offsets(number_of_rows + 1);
+    thrust::host_vector<index_t> h_column_indices(number_of_nonzeros);
+    thrust::host_vector<value_t> h_nonzero_values(number_of_nonzeros);
 
+    error::throw_if_exception(
+        fread(memory::raw_pointer_cast(h_row_offsets.data()), sizeof(offset_t),
+              number_of_rows + 1, file) == 0);
+    error::throw_if_exception(
+        fread(memory::raw_pointer_cast(h_column_indices.data()),
+              sizeof(index_t), number_of_nonzeros, file) == 0);
+    error::throw_if_exception(
+        fread(memory::raw_pointer_cast(h_nonzero_values.data()),
+              sizeof(value_t), number_of_nonzeros, file) == 0);
     fclose(file);
+
+    row_offsets = h_row_offsets;
+    column_indices = h_column_indices;
+    nonzero_values = h_nonzero_values;
   }
 
 };  // struct csr_t
@@ -36,9 +36,16 @@ template <memory_space_t space,
           typename value_t>
 struct csc_t;
 
+template <memory_space_t space,
+          typename index_t,
+          typename offset_t,
+          typename value_t>
+struct compressed_csr_t;
+
 }  // namespace format
 }  // namespace gunrock
 
 #include <gunrock/formats/coo.hxx>
 #include <gunrock/formats/csc.hxx>
-#include <gunrock/formats/csr.hxx>
\ No newline at end of file
+#include <gunrock/formats/csr.hxx>
+#include <gunrock/formats/compressed_csr.hxx>
\ No newline at end of file
@@ -8,12 +8,15 @@
  *
  */
 
+#include <chrono>
 #include <vector>
 
 #include <gunrock/cuda/cuda.hxx>
+#include <gunrock/container/vector.hxx>
 
 #include <gunrock/framework/frontier/frontier.hxx>
 #include <gunrock/framework/problem.hxx>
+#include <gunrock/framework/profile.hxx>
 #if (ESSENTIALS_COLLECT_METRICS)
 #include <gunrock/framework/benchmark.hxx>
 #endif
@@ -56,6 +59,13 @@ struct enactor_properties_t {
 
   frontierInitSizeMode init_size_mode{frontierInitSizeMode::size};
 
+  /*!
+   * Trace recording the iterations and operators of `enact()` when enabled;
+   * `nullptr` (default) uses the process-wide `profile::session()`.
+   * @see gunrock/framework/profile.hxx
+   */
+  profile::trace_t* trace{nullptr};
+
   /**
    * @brief Construct a new enactor properties t object with default values.
    */
@@ -93,7 +103,15 @@ struct enactor_t {
   using vertex_t = typename algorithm_problem_t::vertex_t;
   using edge_t = typename algorithm_problem_t::edge_t;
 
-  using frontier_t = frontier::frontier_t<vertex_t, edge_t, frontier_kind>;
+  /*!
+   * Frontiers and scratch space live in the graph's memory space; host graphs
+   * run on the multithreaded host operators.
+   */
+  static constexpr memory_space_t memory_space_v =
+      algorithm_problem_t::graph_type::memory_space_v;
+
+  using frontier_t = frontier::
+      frontier_t<vertex_t, edge_t, frontier_kind, frontier_view, memory_space_v>;
 
   /*!
    * Enactor properties (frontier resizing factor, buffers, etc.)
@@ -123,7 +141,7 @@ struct enactor_t {
    * actually needs it is being run. Otherwise, it maybe a waste of memory space
    * to allocate this.
    */
-  thrust::device_vector<edge_t> scanned_work_domain;
+  vector_t<edge_t, memory_space_v> scanned_work_domain;
 
   /*!
    * Active frontier buffer, this pointer can be obtained by
@@ -260,16 +278,43 @@ struct enactor_t {
    * **the** time for performance measurements).
    */
   float enact() {
-    auto single_context = context->get_context(0);
+    profile::activate_t profiling(properties.trace ? *properties.trace
+                                                   : profile::session());
+    auto frontier_size = [&]() {
+      return active_frontier->get_number_of_elements();
+    };
+
     prepare_frontier(get_input_frontier(), *context);
-    auto timer = single_context->timer();
-    timer.begin();
-    while (!is_converged(*context)) {
-      loop(*context);
-      ++iteration;
+    auto iterate = [&]() {
+      while (!is_converged(*context)) {
+        profile::scope_t scope(profile::operator_t::loop, frontier_size);
+        if (scope.is_active())
+          profile::current()->set_iteration(iteration);
+        loop(*context);
+        if (scope.is_active()) {
+          if constexpr (memory_space_v == memory_space_t::device)
+            context->get_context(0)->synchronize();
+          scope.set_output_size(frontier_size());
+        }
+        ++iteration;
+      }
+      finalize(*context);
+    };
+
+    float runtime;
+    if constexpr (memory_space_v == memory_space_t::host) {
+      auto t_start = std::chrono::high_resolution_clock::now();
+      iterate();
+      auto t_stop = std::chrono::high_resolution_clock::now();
+      runtime = std::chrono::duration<float, std::milli>(t_stop - t_start)
+                    .count();
+    } else {
+      auto single_context = context->get_context(0);
+      auto timer = single_context->timer();
+      timer.begin();
+      iterate();
+      runtime = timer.end();
     }
-    finalize(*context);
-    auto runtime = timer.end();
 #if (ESSENTIALS_COLLECT_METRICS)
     benchmark::____.search_depth = iteration;
     benchmark::____.total_runtime = runtime;
@@ -32,8 +32,10 @@ using namespace memory;
 template <typename vertex_t,
           typename edge_t,
           frontier_kind_t _kind = frontier_kind_t::vertex_frontier,
-          frontier_view_t _view = frontier_view_t::vector>
-class frontier_t : public frontier::vector_frontier_t<vertex_t, edge_t, _kind> {
+          frontier_view_t _view = frontier_view_t::vector,
+          memory_space_t _space = memory_space_t::device>
+class frontier_t
+    : public frontier::vector_frontier_t<vertex_t, edge_t, _kind, _space> {
  public:
   using vertex_type = vertex_t;
   using edge_type = edge_t;
@@ -43,7 +45,7 @@ class frontier_t : public frontier::vector_frontier_t<vertex_t, edge_t, _kind> {
   using offset_t = std::conditional_t<_kind == frontier_kind_t::vertex_frontier,
                                       edge_t,
                                       vertex_t>;
-  using frontier_type = frontier_t<vertex_t, edge_t, _kind, _view>;
+  using frontier_type = frontier_t<vertex_t, edge_t, _kind, _view, _space>;
 
   /// TODO: This is a more permenant solution.
   // We can use std::conditional to figure out what type to use.
@@ -53,7 +55,7 @@ class frontier_t : public frontier::vector_frontier_t<vertex_t, edge_t, _kind> {
   //     experimental::frontier::boolmap_frontier_t<vertex_t, edge_t, _kind>>;
 
   using underlying_view_t =
-      frontier::vector_frontier_t<vertex_t, edge_t, _kind>;
+      frontier::vector_frontier_t<vertex_t, edge_t, _kind, _space>;
 
   /**
    * @brief Default constructor.
@@ -75,8 +77,8 @@ class frontier_t : public frontier::vector_frontier_t<vertex_t, edge_t, _kind> {
       float frontier_resizing_factor = 1.0,
       typename std::enable_if<std::is_same<
           U,
-          frontier::vector_frontier_t<vertex_t, edge_t, _kind>>::value>::type* =
-          nullptr)
+          frontier::vector_frontier_t<vertex_t, edge_t, _kind, _space>>::value>::
+          type* = nullptr)
       : underlying_view_t(size, frontier_resizing_factor) {}
 
   /**
@@ -17,20 +17,40 @@
 
 #include <gunrock/container/vector.hxx>
 #include <gunrock/algorithms/sort/radix_sort.hxx>
+#include <gunrock/util/parallel.hxx>
 
 #include <thrust/sequence.h>
 
+#include <numeric>
+
 namespace gunrock {
 namespace frontier {
 using namespace memory;
 
-template <typename vertex_t, typename edge_t, frontier_kind_t _kind>
+/**
+ * @brief Frontier stored as a contiguous vector of vertices or edges.
+ *
+ * @tparam vertex_t vertex type.
+ * @tparam edge_t edge type.
+ * @tparam _kind vertex or edge frontier.
+ * @tparam space memory space of the storage (device for the GPU operators,
+ * host for the multithreaded host operators).
+ */
+template <typename vertex_t,
+          typename edge_t,
+          frontier_kind_t _kind,
+          memory_space_t space = memory_space_t::device>
 class vector_frontier_t {
  public:
-  using vector_frontier_type = vector_frontier_t<vertex_t, edge_t, _kind>;
+  using vector_frontier_type =
+      vector_frontier_t<vertex_t, edge_t, _kind, space>;
   using type_t = std::conditional_t<_kind == frontier_kind_t::vertex_frontier,
                                     vertex_t,
                                     edge_t>;
+  using storage_t = vector_t<type_t, space>;
+
+  /// Memory space of the frontier's storage.
+  static constexpr memory_space_t memory_space_v = space;
 
   /**
    * @brief Default constructor.
@@ -39,8 +59,7 @@ class vector_frontier_t {
       : num_elements(0), raw_ptr(nullptr), resizing_factor(1.0f) {
     /// TODO: we are using a vector of size 1 to avoid the overhead of setting
     /// it up later. Check if this is valid to do.
-    p_storage = std::make_shared<vector_t<type_t, memory_space_t::device>>(
-        vector_t<type_t, memory_space_t::device>());
+    p_storage = std::make_shared<storage_t>(storage_t());
   }
 
   /**
@@ -52,9 +71,8 @@ class vector_frontier_t {
    */
   vector_frontier_t(std::size_t size, float frontier_resizing_factor = 1.0f)
       : num_elements(size), resizing_factor(frontier_resizing_factor) {
-    p_storage = std::make_shared<vector_t<type_t, memory_space_t::device>>(
-        vector_t<type_t, memory_space_t::device>(size));
-    raw_ptr = p_storage.get()->data().get();
+    p_storage = std::make_shared<storage_t>(storage_t(size));
+    raw_ptr = raw_pointer_cast(p_storage.get()->data());
   }
 
   /**
@@ -74,7 +92,7 @@ class vector_frontier_t {
     raw_ptr = rhs.raw_ptr;
 #else
     p_storage = rhs.p_storage;
-    raw_ptr = rhs.p_storage.get()->data().get();
+    raw_ptr = raw_pointer_cast(rhs.p_storage.get()->data());
 #endif
     num_elements = rhs.num_elements;
     resizing_factor = rhs.resizing_factor;
@@ -108,7 +126,7 @@ class vector_frontier_t {
    * @param idx the index at which the element should be returned.
    * @return const type_t element to return.
    */
-  __device__ __forceinline__ constexpr const type_t get_element_at(
+  __host__ __device__ __forceinline__ constexpr const type_t get_element_at(
       std::size_t const& idx) const noexcept {
     return thread::load(this->get() + idx);
   }
@@ -119,7 +137,7 @@ class vector_frontier_t {
    * @param idx the index at which the element should be returned.
    * @return type_t element to return.
    */
-  __device__ __forceinline__ constexpr type_t get_element_at(
+  __host__ __device__ __forceinline__ constexpr type_t get_element_at(
       std::size_t const& idx) noexcept {
     return thread::load(this->get() + idx);
   }
@@ -130,7 +148,7 @@ class vector_frontier_t {
    * @param idx index at which the new element is placed.
    * @param element element to place at a given index.
    */
-  __device__ __forceinline__ constexpr void set_element_at(
+  __host__ __device__ __forceinline__ constexpr void set_element_at(
       type_t const& element,
       std::size_t const& idx)
       const noexcept {  /// XXX: This should not be const
@@ -212,8 +230,11 @@ class vector_frontier_t {
    * @param stream GPU stream at which this operation should occur.
    */
   void fill(type_t const value, gcuda::stream_t stream = 0) {
-    thrust::fill(thrust::cuda::par_nosync.on(stream), this->begin(),
-                 this->end(), value);
+    if constexpr (space == memory_space_t::host)
+      std::fill(this->begin(), this->end(), value);
+    else
+      thrust::fill(thrust::cuda::par_nosync.on(stream), this->begin(),
+                   this->end(), value);
   }
 
   /**
@@ -236,8 +257,11 @@ class vector_frontier_t {
     // Set the new number of elements.
     this->set_number_of_elements(size);
 
-    thrust::sequence(thrust::cuda::par_nosync.on(stream), this->begin(),
-                     this->end(), initial_value);
+    if constexpr (space == memory_space_t::host)
+      std::iota(this->begin(), this->end(), initial_value);
+    else
+      thrust::sequence(thrust::cuda::par_nosync.on(stream), this->begin(),
+                       this->end(), initial_value);
   }
 
   /**
@@ -274,8 +298,16 @@ class vector_frontier_t {
    */
   void sort(sort::order_t order = sort::order_t::ascending,
             gcuda::stream_t stream = 0) {
-    sort::radix::sort_keys(p_storage.get()->data().get(),
-                           this->get_number_of_elements(), order, stream);
+    if constexpr (space == memory_space_t::host) {
+      if (order == sort::order_t::ascending)
+        util::parallel::sort(this->begin(), this->end(), std::less<type_t>());
+      else
+        util::parallel::sort(this->begin(), this->end(),
+                             std::greater<type_t>());
+    } else {
+      sort::radix::sort_keys(raw_pointer_cast(p_storage.get()->data()),
+                             this->get_number_of_elements(), order, stream);
+    }
   }
 
   /**
@@ -291,7 +323,7 @@ class vector_frontier_t {
   }
 
  private:
-  std::shared_ptr<vector_t<type_t, memory_space_t::device>> p_storage;
+  std::shared_ptr<storage_t> p_storage;
   type_t* raw_ptr;
   std::size_t num_elements;  // number of elements in the frontier.
   float resizing_factor;     // reserve size * factor.
@@ -15,6 +15,7 @@
 #include <gunrock/util/type_limits.hxx>
 
 #include <gunrock/framework/operators/configs.hxx>
+#include <gunrock/framework/profile.hxx>
 
 #include <gunrock/framework/operators/advance/helpers.hxx>
 #include <gunrock/framework/operators/advance/merge_path.hxx>
@@ -22,6 +23,7 @@
 #include <gunrock/framework/operators/advance/block_mapped.hxx>
 #include <gunrock/framework/operators/advance/bucketing.hxx>
 #include <gunrock/framework/operators/advance/merge_path_v2.hxx>
+#include <gunrock/framework/operators/advance/host.hxx>
 
 namespace gunrock {
 namespace operators {
@@ -86,6 +88,9 @@ namespace advance {
  * @param segments storaged space for scanned items (segment offsets).
  * @param context a `cuda::multi_context_t` that contains GPU contexts for the
  * available CUDA devices. Used to launch the advance kernels.
+ *
+ * @note For graphs in `memory_space_t::host` the advance runs on the host
+ * thread pool (see `advance/host.hxx`) and its output frontier is compacted.
  */
 template <load_balance_t lb,
           advance_direction_t direction,
@@ -101,7 +106,19 @@ void execute(graph_t& G,
              frontier_t* output,
              work_tiles_t& segments,
              gcuda::multi_context_t& context) {
-  if (context.size() == 1) {
+  profile::scope_t scope(profile::operator_t::advance, [&]() -> std::size_t {
+    return (input_type == advance_io_type_t::graph)
+               ? G.get_number_of_vertices()
+               : input->get_number_of_elements();
+  });
+
+  // Host graphs run on the host thread pool; `lb`, `segments` and `context`
+  // are not used.
+  if constexpr (graph_t::memory_space_v == memory_space_t::host) {
+    std::size_t edges =
+        host::execute<direction, input_type, output_type>(G, op, input, output);
+    scope.set_edges(edges);
+  } else if (context.size() == 1) {
     auto context0 = context.get_context(0);
 
     if (lb == load_balance_t::merge_path) {
@@ -121,10 +138,16 @@ void execute(graph_t& G,
                                 "Advance type not supported.");
     }
 
+    // Time the kernels, not only their launch.
+    if (scope.is_active())
+      context0->synchronize();
   } else {
     error::throw_if_exception(cudaErrorUnknown,
                               "`context.size() != 1` not supported");
   }
+
+  if (scope.is_active() && output_type != advance_io_type_t::none)
+    scope.set_output_size(output->get_number_of_elements());
 }
 
 /**
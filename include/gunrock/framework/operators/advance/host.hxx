@@ -0,0 +1,189 @@
+/**
+ * @file host.hxx
+ * @brief Multithreaded host (CPU) advance, used for graphs in
+ * `memory_space_t::host`.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <type_traits>
+#include <vector>
+
+#include <gunrock/framework/operators/configs.hxx>
+#include <gunrock/util/parallel.hxx>
+#include <gunrock/util/type_limits.hxx>
+
+namespace gunrock {
+namespace operators {
+namespace advance {
+namespace host {
+
+/// Work items (edges) per chunk for push-based advance.
+constexpr std::size_t edges_per_chunk = 4096;
+/// Vertices per chunk for pull-based advance.
+constexpr std::size_t vertices_per_chunk = 256;
+
+/**
+ * @brief Host advance.
+ *
+ * @par Overview
+ * Forward (push): the degrees of the input frontier are scanned and the
+ * resulting edge space is cut into equal-sized chunks, so a high-degree vertex
+ * is spread over several chunks (and threads) instead of serializing one
+ * thread. Chunks are scheduled on the host thread pool with work stealing.
+ * Neighbors for which `op` returns true are appended to thread-local buffers
+ * and concatenated in chunk order, so the output frontier holds only valid
+ * vertices, in the same order a sequential advance would produce them.
+ *
+ * Backward (pull): every vertex `v` of the input frontier (or of the graph)
+ * visits its in-neighbors `u` (CSC view if the graph has one, otherwise the
+ * graph is assumed symmetric) and calls `op(u, v, e, w)`. The first `true`
+ * adds `v` to the output and stops the scan of `v`'s in-edges (bottom-up
+ * early exit).
+ *
+ * @note The device advance keeps invalid placeholders in the output frontier
+ * instead of compacting it; the host output is always compacted.
+ *
+ * @return std::size_t number of edges visited.
+ */
+template <advance_direction_t direction,
+          advance_io_type_t input_type,
+          advance_io_type_t output_type,
+          typename graph_t,
+          typename operator_t,
+          typename frontier_t>
+std::size_t execute(graph_t& G,
+                    operator_t op,
+                    frontier_t* input,
+                    frontier_t* output) {
+  using type_t = typename frontier_t::type_t;
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t = typename graph_t::edge_type;
+
+  constexpr bool has_output = (output_type != advance_io_type_t::none);
+  constexpr bool graph_input = (input_type == advance_io_type_t::graph);
+
+  std::size_t num_inputs = graph_input ? G.get_number_of_vertices()
+                                       : input->get_number_of_elements();
+  const type_t* input_data = graph_input ? nullptr : input->data();
+
+  auto input_at = [=](std::size_t i) -> vertex_t {
+    return graph_input ? vertex_t(i) : vertex_t(input_data[i]);
+  };
+
+  auto allocate = [&](std::size_t size) -> type_t* {
+    if (output->get_capacity() < size)
+      output->reserve(size);
+    output->set_number_of_elements(size);
+    return output->data();
+  };
+
+  if constexpr (direction == advance_direction_t::backward) {
+    using csc_view_t = typename graph_t::graph_csc_view_t;
+    using in_view_t =
+        std::conditional_t<std::is_base_of_v<csc_view_t, graph_t>, csc_view_t,
+                           typename graph_t::graph_csr_view_t>;
+
+    std::atomic<std::size_t> visited{0};
+    auto pull = [&](std::size_t first, std::size_t last,
+                    std::vector<type_t>& local) {
+      std::size_t scanned = 0;
+      for (std::size_t i = first; i < last; ++i) {
+        auto v = input_at(i);
+        if (!gunrock::util::limits::is_valid(v))
+          continue;
+        edge_t start = G.template get_starting_edge<in_view_t>(v);
+        edge_t end = start + G.template get_number_of_neighbors<in_view_t>(v);
+        edge_t e = start;
+        for (; e < end; ++e) {
+          vertex_t u;
+          if constexpr (std::is_same_v<in_view_t, csc_view_t>)
+            u = G.template get_source_vertex<in_view_t>(e);
+          else
+            u = G.template get_destination_vertex<in_view_t>(e);
+          if (op(u, v, e, G.template get_edge_weight<in_view_t>(e))) {
+            if (has_output)
+              local.push_back(type_t(v));
+            ++e;
+            break;
+          }
+        }
+        scanned += std::size_t(e - start);
+      }
+      visited.fetch_add(scanned, std::memory_order_relaxed);
+    };
+
+    if constexpr (has_output) {
+      util::parallel::collect<type_t>(std::size_t(0), num_inputs, pull,
+                                      allocate, vertices_per_chunk);
+    } else {
+      util::parallel::for_each_chunk_id(
+          (num_inputs + vertices_per_chunk - 1) / vertices_per_chunk,
+          [&](std::size_t, std::size_t c) {
+            std::vector<type_t> unused;
+            std::size_t first = c * vertices_per_chunk;
+            pull(first, std::min(num_inputs, first + vertices_per_chunk),
+                 unused);
+          });
+    }
+    return visited.load();
+  } else {
+    // Degree scan of the input: segment i owns work items
+    // [offsets[i], offsets[i + 1]).
+    std::vector<std::size_t> offsets(num_inputs + 1);
+    std::size_t total_work = util::parallel::transform_exclusive_scan(
+        num_inputs,
+        [&](std::size_t i) -> std::size_t {
+          auto v = input_at(i);
+          return gunrock::util::limits::is_valid(v)
+                     ? std::size_t(G.get_number_of_neighbors(v))
+                     : std::size_t(0);
+        },
+        offsets.data());
+
+    // Visit work items [first, last) of the edge space.
+    auto push = [&](std::size_t first, std::size_t last,
+                    std::vector<type_t>& local) {
+      std::size_t i = std::upper_bound(offsets.begin(), offsets.end(), first) -
+                      offsets.begin() - 1;
+      for (std::size_t item = first; item < last; ++i) {
+        std::size_t segment_end = std::min(offsets[i + 1], last);
+        if (item == segment_end)
+          continue;  // zero-degree or invalid input.
+        auto v = input_at(i);
+        edge_t e = G.get_starting_edge(v) + edge_t(item - offsets[i]);
+        for (; item < segment_end; ++item, ++e) {
+          auto n = G.get_destination_vertex(e);
+          bool cond = op(v, n, e, G.get_edge_weight(e));
+          if (has_output && cond)
+            local.push_back(type_t(n));
+        }
+      }
+    };
+
+    if constexpr (has_output) {
+      util::parallel::collect<type_t>(std::size_t(0), total_work, push,
+                                      allocate, edges_per_chunk);
+    } else {
+      util::parallel::for_each_chunk_id(
+          (total_work + edges_per_chunk - 1) / edges_per_chunk,
+          [&](std::size_t, std::size_t c) {
+            std::vector<type_t> unused;
+            std::size_t first = c * edges_per_chunk;
+            push(first, std::min(total_work, first + edges_per_chunk), unused);
+          });
+    }
+    return total_work;
+  }
+}
+
+}  // namespace host
+}  // namespace advance
+}  // namespace operators
+}  // namespace gunrock
@@ -12,6 +12,7 @@
 
 #include <gunrock/cuda/context.hxx>
 #include <gunrock/framework/operators/configs.hxx>
+#include <gunrock/framework/profile.hxx>
 #include <gunrock/util/type_limits.hxx>
 #include <gunrock/util/type_traits.hxx>
 
@@ -19,6 +20,7 @@
 #include <gunrock/framework/operators/filter/predicated.hxx>
 #include <gunrock/framework/operators/filter/bypass.hxx>
 #include <gunrock/framework/operators/filter/remove.hxx>
+#include <gunrock/framework/operators/filter/host.hxx>
 
 #include <gunrock/framework/operators/uniquify/uniquify.hxx>
 
@@ -66,6 +68,9 @@ namespace filter {
  * @param context a `gcuda::multi_context_t` that contains GPU contexts for the
  * available CUDA devices. Used to launch the filter kernels.
  *
+ * @note For graphs in `memory_space_t::host` the filter runs on the host
+ * thread pool (see `filter/host.hxx`).
+ *
  * @see gunrock::operators::filter_algorithm_t
  */
 template <filter_algorithm_t alg_type,
@@ -77,7 +82,13 @@ void execute(graph_t& G,
              frontier_t* input,
              frontier_t* output,
              gcuda::multi_context_t& context) {
-  if (context.size() == 1) {
+  profile::scope_t scope(profile::operator_t::filter, [&]() -> std::size_t {
+    return input->get_number_of_elements();
+  });
+
+  if constexpr (graph_t::memory_space_v == memory_space_t::host) {
+    host::execute<alg_type>(G, op, input, output);
+  } else if (context.size() == 1) {
     auto single_context = context.get_context(0);
 
     if constexpr (alg_type == filter_algorithm_t::compact) {
@@ -91,10 +102,17 @@ void execute(graph_t& G,
     } else {
       error::throw_if_exception(cudaErrorUnknown, "Filter type not supported.");
     }
+
+    // Time the kernels, not only their launch.
+    if (scope.is_active())
+      single_context->synchronize();
   } else {
     error::throw_if_exception(cudaErrorUnknown,
                               "`context.size() != 1` not supported");
   }
+
+  if (scope.is_active())
+    scope.set_output_size(output->get_number_of_elements());
 }
 
 /**
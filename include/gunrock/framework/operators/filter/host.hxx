@@ -0,0 +1,84 @@
+/**
+ * @file host.hxx
+ * @brief Multithreaded host (CPU) filter, used for graphs in
+ * `memory_space_t::host`.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <gunrock/framework/operators/configs.hxx>
+#include <gunrock/util/parallel.hxx>
+#include <gunrock/util/type_limits.hxx>
+
+namespace gunrock {
+namespace operators {
+namespace filter {
+namespace host {
+
+/// Frontier elements per chunk.
+constexpr std::size_t elements_per_chunk = 4096;
+
+/**
+ * @brief Host filter. `compact`, `predicated` and `remove` keep the valid
+ * elements `x` with `op(x) == true`, in input order; `bypass` keeps the size
+ * of the input and replaces rejected elements with invalids. `input` and
+ * `output` may be the same frontier.
+ */
+template <filter_algorithm_t alg_type,
+          typename graph_t,
+          typename operator_t,
+          typename frontier_t>
+void execute(graph_t& G,
+             operator_t op,
+             frontier_t* input,
+             frontier_t* output) {
+  using type_t = typename frontier_t::type_t;
+
+  std::size_t size = input->get_number_of_elements();
+  const type_t* input_data = input->data();
+
+  if constexpr (alg_type == filter_algorithm_t::bypass) {
+    if ((output->data() != input_data) || (output->get_capacity() < size))
+      output->reserve(size);
+    output->set_number_of_elements(size);
+    type_t* output_data = output->data();
+
+    util::parallel::for_each(
+        std::size_t(0), size,
+        [=](std::size_t i) {
+          auto v = input_data[i];
+          output_data[i] = (gunrock::util::limits::is_valid(v) && op(v))
+                               ? v
+                               : gunrock::numeric_limits<type_t>::invalid();
+        },
+        elements_per_chunk);
+  } else {
+    util::parallel::collect<type_t>(
+        std::size_t(0), size,
+        [&](std::size_t first, std::size_t last, std::vector<type_t>& local) {
+          for (std::size_t i = first; i < last; ++i) {
+            auto v = input_data[i];
+            if (gunrock::util::limits::is_valid(v) && op(v))
+              local.push_back(v);
+          }
+        },
+        [&](std::size_t count) -> type_t* {
+          if (output->get_capacity() < count)
+            output->reserve(count);
+          output->set_number_of_elements(count);
+          return output->data();
+        },
+        elements_per_chunk);
+  }
+}
+
+}  // namespace host
+}  // namespace filter
+}  // namespace operators
+}  // namespace gunrock
@@ -4,6 +4,7 @@
 
 #include <gunrock/cuda/context.hxx>
 #include <gunrock/framework/operators/configs.hxx>
+#include <gunrock/util/parallel.hxx>
 
 #include <thrust/for_each.h>
 #include <thrust/iterator/counting_iterator.h>
@@ -11,6 +12,50 @@
 namespace gunrock {
 namespace operators {
 namespace parallel_for {
+namespace host {
+
+/// Items per chunk of a host parallel for.
+constexpr std::size_t items_per_chunk = 2048;
+
+/**
+ * @brief Host (CPU) version of the frontier-element parallel for.
+ */
+template <typename func_t, typename frontier_t>
+void execute(frontier_t& f, func_t op) {
+  auto data = f.data();
+  util::parallel::for_each(
+      std::size_t(0), std::size_t(f.get_number_of_elements()),
+      [&](std::size_t i) {
+        auto x = data[i];
+        if (gunrock::util::limits::is_valid(x))
+          op(x);
+      },
+      items_per_chunk);
+}
+
+/**
+ * @brief Host (CPU) version of the vertex, edge and weight parallel for.
+ */
+template <parallel_for_each_t type, typename func_t, typename graph_t>
+void execute(graph_t& G, func_t op) {
+  using index_t = std::conditional_t<type == parallel_for_each_t::vertex,
+                                     typename graph_t::vertex_type,
+                                     typename graph_t::edge_type>;
+  index_t size = (type == parallel_for_each_t::vertex)
+                     ? G.get_number_of_vertices()
+                     : G.get_number_of_edges();
+  util::parallel::for_each(
+      index_t(0), size,
+      [&](index_t x) {
+        if constexpr (type == parallel_for_each_t::weight)
+          op(G.get_edge_weight(x));
+        else
+          op(x);
+      },
+      index_t(items_per_chunk));
+}
+
+}  // namespace host
 
 /**
  * @brief For each element in the frontier, apply a user-defined function.
@@ -20,7 +65,8 @@ namespace parallel_for {
  * @tparam frontier_t Frontier type.
  * @param f Frontiers to apply user-defined function to.
  * @param op User-defined function.
- * @param context Device context (@see gcuda::multi_context_t).
+ * @param context Device context (@see gcuda::multi_context_t), unused for
+ * host frontiers and graphs, which run on the host thread pool.
  * @return bool ignore the output, limitation of `__device__` lambda functions
  * require a template parameter to be named (see
  * https://github.com/neoblizz/enable_if_bug).
@@ -30,6 +76,11 @@ std::enable_if_t<type == parallel_for_each_t::element>
 execute(frontier_t& f, func_t op, gcuda::multi_context_t& context) {
   static_assert(type == parallel_for_each_t::element);
   using type_t = typename frontier_t::type_t;
+  if constexpr (frontier_t::memory_space_v == memory_space_t::host) {
+    host::execute(f, op);
+    return;
+  }
+
   auto single_context = context.get_context(0);
   /// TODO: use get and set frontier elements instead.
   thrust::for_each(single_context->execution_policy(),
@@ -52,7 +103,8 @@ execute(frontier_t& f, func_t op, gcuda::multi_context_t& context) {
  * @tparam graph_t Graph type.
  * @param G Graph to apply user-defined function to.
  * @param op User-defined function.
- * @param context Device context (@see gcuda::multi_context_t).
+ * @param context Device context (@see gcuda::multi_context_t), unused for
+ * host frontiers and graphs, which run on the host thread pool.
  * @return bool ignore the output, limitation of `__device__` lambda functions
  * require a template parameter to be named (see
  * https://github.com/neoblizz/enable_if_bug).
@@ -66,6 +118,11 @@ execute(graph_t& G, func_t op, gcuda::multi_context_t& context) {
   using index_t = std::conditional_t<type == parallel_for_each_t::vertex,
                                      typename graph_t::vertex_type,
                                      typename graph_t::edge_type>;
+  if constexpr (graph_t::memory_space_v == memory_space_t::host) {
+    host::execute<type>(G, op);
+    return;
+  }
+
   auto single_context = context.get_context(0);
   std::size_t size = (type == parallel_for_each_t::vertex)
                          ? G.get_number_of_vertices()
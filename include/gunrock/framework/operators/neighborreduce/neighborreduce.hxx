@@ -12,6 +12,7 @@
 
 #include <gunrock/cuda/context.hxx>
 #include <gunrock/error.hxx>
+#include <gunrock/util/parallel.hxx>
 #include <gunrock/util/type_limits.hxx>
 
 #include <gunrock/framework/operators/configs.hxx>
@@ -23,6 +24,40 @@
 namespace gunrock {
 namespace operators {
 namespace neighborreduce {
+namespace host {
+
+/// Vertices (segments) per chunk of the host neighbor reduce.
+constexpr std::size_t vertices_per_chunk = 256;
+
+/**
+ * @brief Host (CPU) neighbor reduce: `output[v]` is `init_value` reduced with
+ * `op(e)` over the out-edges `e` of `v`, in edge order.
+ */
+template <typename graph_t,
+          typename output_t,
+          typename operator_t,
+          typename arithmetic_t>
+void execute(graph_t& G,
+             output_t* output,
+             operator_t op,
+             arithmetic_t arithmetic_op,
+             output_t init_value) {
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t = typename graph_t::edge_type;
+  util::parallel::for_each(
+      vertex_t(0), vertex_t(G.get_number_of_vertices()),
+      [&](vertex_t v) {
+        output_t result = init_value;
+        edge_t start = G.get_starting_edge(v);
+        edge_t end = start + G.get_number_of_neighbors(v);
+        for (edge_t e = start; e < end; ++e)
+          result = arithmetic_op(result, op(e));
+        output[v] = result;
+      },
+      vertex_t(vertices_per_chunk));
+}
+
+}  // namespace host
 
 /**
  * @brief Neighbor reduce is an operator that performs reduction on the segments
@@ -49,7 +84,8 @@ namespace neighborreduce {
  * @param op user-defined lambda function.
  * @param arithmetic_op arithmetic operator (binary).
  * @param init_value initial value for the reduction.
- * @param context cuda context (@see gcuda::multi_context_t).
+ * @param context cuda context (@see gcuda::multi_context_t), unused for host
+ * graphs, which run on the host thread pool.
  */
 template <advance_io_type_t input_t = advance_io_type_t::graph,
           typename graph_t,
@@ -64,16 +100,19 @@ void execute(graph_t& G,
              arithmetic_t arithmetic_op,
              output_t init_value,
              gcuda::multi_context_t& context) {
-  if (context.size() == 1) {
+  using find_csr_t = typename graph_t::graph_csr_view_t;
+  if (!(G.template contains_representation<find_csr_t>())) {
+    error::throw_if_exception(cudaErrorUnknown,
+                              "CSR sparse-matrix representation "
+                              "required for neighborreduce operator.");
+  }
+
+  if constexpr (graph_t::memory_space_v == memory_space_t::host) {
+    host::execute(G, output, op, arithmetic_op, init_value);
+  } else if (context.size() == 1) {
     auto context0 = context.get_context(0);
 
     using type_t = typename graph_t::vertex_type;
-    using find_csr_t = typename graph_t::graph_csr_view_t;
-    if (!(G.template contains_representation<find_csr_t>())) {
-      error::throw_if_exception(cudaErrorUnknown,
-                                "CSR sparse-matrix representation "
-                                "required for neighborreduce operator.");
-    }
 
 #ifndef LBS_SEGREDUCE
     // TODO: Throw an exception if input_t is not advance_io_type_t::graph.
@@ -2,9 +2,13 @@
 
 #include <gunrock/cuda/context.hxx>
 #include <gunrock/framework/operators/configs.hxx>
+#include <gunrock/framework/profile.hxx>
 #include <gunrock/util/type_limits.hxx>
 #include <gunrock/util/type_traits.hxx>
 
+#include <algorithm>
+#include <iterator>
+
 #include <gunrock/framework/operators/uniquify/unique.hxx>
 #include <gunrock/framework/operators/uniquify/unique_copy.hxx>
 
@@ -18,7 +22,27 @@ void execute(frontier_t* input,
              gcuda::multi_context_t& context,
              bool best_effort_uniquification = false,
              const float uniquification_percent = 100) {
-  if (context.size() == 1) {
+  profile::scope_t scope(profile::operator_t::uniquify, [&]() -> std::size_t {
+    return input->get_number_of_elements();
+  });
+
+  if constexpr (frontier_t::memory_space_v == memory_space_t::host) {
+    if (!best_effort_uniquification && (uniquification_percent == 100))
+      input->sort(sort::order_t::ascending);
+
+    if (type == uniquify_algorithm_t::unique) {
+      auto new_end = std::unique(input->begin(), input->end());
+      input->set_number_of_elements(std::distance(input->begin(), new_end));
+    } else if (type == uniquify_algorithm_t::unique_copy) {
+      if (output->get_capacity() < input->get_number_of_elements())
+        output->reserve(input->get_number_of_elements());
+      auto new_end =
+          std::unique_copy(input->begin(), input->end(), output->begin());
+      output->set_number_of_elements(std::distance(output->begin(), new_end));
+    } else {
+      error::throw_if_exception(cudaErrorUnknown, "Unqiue type not supported.");
+    }
+  } else if (context.size() == 1) {
     auto single_context = context.get_context(0);
 
     if (type == uniquify_algorithm_t::unique) {
@@ -32,6 +56,10 @@ void execute(frontier_t* input,
     } else {
       error::throw_if_exception(cudaErrorUnknown, "Unqiue type not supported.");
     }
+
+    // Time the kernels, not only their launch.
+    if (scope.is_active())
+      single_context->synchronize();
   }
 
   // Multi-GPU not supported.
@@ -39,6 +67,12 @@ void execute(frontier_t* input,
     error::throw_if_exception(cudaErrorUnknown,
                               "`context.size() != 1` not supported");
   }
+
+  // `unique` works in place.
+  if (scope.is_active())
+    scope.set_output_size(type == uniquify_algorithm_t::unique
+                              ? input->get_number_of_elements()
+                              : output->get_number_of_elements());
 }
 
 template <uniquify_algorithm_t type = uniquify_algorithm_t::unique,
@@ -12,6 +12,8 @@
 
 #include <gunrock/graph/graph.hxx>
 
+#include <thrust/execution_policy.h>
+
 namespace gunrock {
 /**
  * @brief Problem contains the data structure of the graph algorithms
@@ -27,6 +29,7 @@ namespace gunrock {
  */
 template <typename graph_t>
 struct problem_t {
+  using graph_type = graph_t;
   using vertex_t = typename graph_t::vertex_type;
   using edge_t = typename graph_t::edge_type;
   using weight_t = typename graph_t::weight_type;
@@ -45,6 +48,17 @@ struct problem_t {
     return context->get_context(device);
   }
 
+  /**
+   * @brief Thrust execution policy matching the memory space of the graph:
+   * the (single-gpu) context's stream for device graphs, the host otherwise.
+   */
+  auto execution_policy() {
+    if constexpr (graph_t::memory_space_v == memory_space_t::host)
+      return thrust::host;
+    else
+      return context->get_context(0)->execution_policy();
+  }
+
   virtual void init() = 0;
   virtual void reset() = 0;
 
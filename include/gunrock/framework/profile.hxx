@@ -0,0 +1,283 @@
+/**
+ * @file profile.hxx
+ * @brief Per-iteration, per-operator profiling of the enactor loop: frontier
+ * sizes, edges touched and wall time of every operator call, recorded in a
+ * thread-safe ring buffer that is enabled at runtime.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <gunrock/error.hxx>
+
+namespace gunrock {
+namespace profile {
+
+/**
+ * @brief Profiled unit of work.
+ */
+enum class operator_t : std::uint8_t {
+  loop,      ///< One iteration of the enactor's `loop()`.
+  advance,   ///< Advance operator.
+  filter,    ///< Filter operator.
+  uniquify,  ///< Uniquify operator.
+};
+
+inline char const* name(operator_t op) {
+  switch (op) {
+    case operator_t::loop:
+      return "loop";
+    case operator_t::advance:
+      return "advance";
+    case operator_t::filter:
+      return "filter";
+    default:
+      return "uniquify";
+  }
+}
+
+/**
+ * @brief One operator call (or loop iteration).
+ */
+struct record_t {
+  /// Index of the `enact()` call within the trace.
+  std::uint32_t run = 0;
+  /// Enactor iteration.
+  std::int32_t iteration = 0;
+  operator_t op = operator_t::loop;
+  /// Small id of the recording thread.
+  std::uint32_t thread = 0;
+  /// Input and output frontier sizes.
+  std::uint64_t input_size = 0;
+  std::uint64_t output_size = 0;
+  /// Edges visited by an advance (host path; 0 if unknown).
+  std::uint64_t edges = 0;
+  /// Start time since the trace was cleared, and wall time, in microseconds.
+  double start = 0;
+  double duration = 0;
+};
+
+/**
+ * @brief Ring buffer of records keeping the most recent `capacity()` ones.
+ *
+ * @par Overview
+ * Recording claims a slot with one atomic increment and writes the record
+ * into it, so any number of threads can record concurrently without locks.
+ * When the buffer is full the oldest records are overwritten (and counted in
+ * `dropped()`). A disabled trace allocates nothing and records nothing; the
+ * records are read (`records()`, `write_chrome_trace()`) once the profiled
+ * work is over.
+ */
+class trace_t {
+ public:
+  trace_t() : epoch(std::chrono::high_resolution_clock::now()) {}
+  trace_t(trace_t const&) = delete;
+  trace_t& operator=(trace_t const&) = delete;
+
+  /**
+   * @brief Starts recording, keeping up to `capacity` records (rounded up to
+   * a power of two). Clears the trace if the capacity changes.
+   */
+  void enable(std::size_t capacity = std::size_t(1) << 16) {
+    std::size_t size = 1;
+    while (size < capacity)
+      size *= 2;
+    if (size != buffer.size()) {
+      buffer.assign(size, record_t());
+      clear();
+    }
+    enabled = true;
+  }
+
+  /// Stops recording; the records are kept.
+  void disable() { enabled = false; }
+
+  bool is_enabled() const { return enabled; }
+  std::size_t capacity() const { return buffer.size(); }
+
+  /// Removes every record and restarts the clock and the run count.
+  void clear() {
+    next.store(0);
+    runs = 0;
+    epoch = std::chrono::high_resolution_clock::now();
+  }
+
+  /// Microseconds since the trace was cleared.
+  double now() const {
+    return std::chrono::duration<double, std::micro>(
+               std::chrono::high_resolution_clock::now() - epoch)
+        .count();
+  }
+
+  /// Starts a new run (one `enact()`); returns its index.
+  std::uint32_t begin_run() {
+    iteration = 0;
+    return current_run = runs++;
+  }
+
+  /// Sets the iteration stamped on the next records.
+  void set_iteration(int i) { iteration = i; }
+
+  /// Records `r` (stamped with the current run and iteration); thread-safe.
+  void push(record_t r) {
+    r.run = current_run;
+    r.iteration = iteration;
+    std::size_t k = next.fetch_add(1, std::memory_order_relaxed);
+    buffer[k & (buffer.size() - 1)] = r;
+  }
+
+  /// Number of records overwritten because the buffer was full.
+  std::size_t dropped() const {
+    std::size_t total = next.load();
+    return total > buffer.size() ? total - buffer.size() : 0;
+  }
+
+  /// Records kept, oldest first.
+  std::vector<record_t> records() const {
+    std::size_t total = next.load();
+    std::size_t size = std::min(total, buffer.size());
+    std::vector<record_t> out(size);
+    for (std::size_t i = 0; i < size; ++i)
+      out[i] = buffer[(total - size + i) & (buffer.size() - 1)];
+    return out;
+  }
+
+  /**
+   * @brief Writes the records as a Chrome trace-event file (complete "X"
+   * events; open it in chrome://tracing or Perfetto). Loop iterations enclose
+   * the operators they call.
+   *
+   * @param filename output file.
+   */
+  void write_chrome_trace(std::string const& filename) const {
+    std::ofstream file(filename);
+    error::throw_if_exception(!file, "cannot open " + filename);
+    file << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+    auto all = records();
+    for (std::size_t i = 0; i < all.size(); ++i) {
+      record_t const& r = all[i];
+      file << (i ? ",\n" : "\n") << "{\"name\": \"" << name(r.op)
+           << "\", \"cat\": \"" << (r.op == operator_t::loop ? "loop" : "op")
+           << "\", \"ph\": \"X\", \"pid\": 0, \"tid\": " << r.thread
+           << ", \"ts\": " << r.start << ", \"dur\": " << r.duration
+           << ", \"args\": {\"run\": " << r.run
+           << ", \"iteration\": " << r.iteration
+           << ", \"input_size\": " << r.input_size
+           << ", \"output_size\": " << r.output_size
+           << ", \"edges\": " << r.edges << "}}";
+    }
+    file << "\n]}\n";
+  }
+
+ private:
+  std::vector<record_t> buffer;
+  std::atomic<std::size_t> next{0};
+  std::chrono::high_resolution_clock::time_point epoch;
+  bool enabled = false;
+  std::uint32_t runs = 0;
+  std::uint32_t current_run = 0;
+  int iteration = 0;
+};
+
+/**
+ * @brief Process-wide trace, used by every enactor that is not given one
+ * (`enactor_properties_t::trace`). Disabled until `enable()`d.
+ */
+inline trace_t& session() {
+  static trace_t trace;
+  return trace;
+}
+
+/**
+ * @brief Trace the calling thread currently records into (set by
+ * `enactor_t::enact()`), `nullptr` when not profiling.
+ */
+inline trace_t*& current() {
+  thread_local trace_t* trace = nullptr;
+  return trace;
+}
+
+/// Small, stable id of the calling thread.
+inline std::uint32_t thread_id() {
+  static std::atomic<std::uint32_t> count{0};
+  thread_local std::uint32_t id = count++;
+  return id;
+}
+
+/**
+ * @brief Makes `trace` the calling thread's current trace for the lifetime of
+ * the object if it is enabled (and no trace otherwise), starting a new run.
+ */
+class activate_t {
+ public:
+  explicit activate_t(trace_t& trace) : previous(current()) {
+    current() = trace.is_enabled() ? &trace : nullptr;
+    if (current())
+      current()->begin_run();
+  }
+  ~activate_t() { current() = previous; }
+  activate_t(activate_t const&) = delete;
+  activate_t& operator=(activate_t const&) = delete;
+
+ private:
+  trace_t* previous;
+};
+
+/**
+ * @brief Times a scope and records it into the current trace, if any. Costs
+ * a thread-local load and a branch when profiling is off; the frontier sizes
+ * are only computed when profiling.
+ *
+ * Device work is asynchronous: the operators synchronize their stream before
+ * an active scope closes, so its duration covers the kernels.
+ */
+class scope_t {
+ public:
+  /**
+   * @param op profiled operator.
+   * @param input_size callable returning the input frontier size.
+   */
+  template <typename size_op_t>
+  scope_t(operator_t op, size_op_t input_size) : trace(current()) {
+    if (!trace)
+      return;
+    record.op = op;
+    record.thread = thread_id();
+    record.input_size = input_size();
+    record.start = trace->now();
+  }
+
+  ~scope_t() {
+    if (!trace)
+      return;
+    record.duration = trace->now() - record.start;
+    trace->push(record);
+  }
+
+  scope_t(scope_t const&) = delete;
+  scope_t& operator=(scope_t const&) = delete;
+
+  /// Is the scope being recorded?
+  bool is_active() const { return trace != nullptr; }
+
+  void set_output_size(std::size_t size) { record.output_size = size; }
+  void set_edges(std::size_t edges) { record.edges = edges; }
+
+ private:
+  trace_t* trace;
+  record_t record;
+};
+
+}  // namespace profile
+}  // namespace gunrock
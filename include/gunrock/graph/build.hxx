@@ -11,6 +11,7 @@
 #pragma once
 
 #include <gunrock/graph/detail/build.hxx>
+#include <gunrock/graph/reorder.hxx>
 
 namespace gunrock {
 namespace graph {
@@ -91,6 +92,52 @@ auto build(graph::graph_properties_t properties,
   return detail::builder<space>(properties, csc);
 }
 
+/**
+ * @brief Builds a graph using a compressed CSR object (see
+ * formats/compressed_csr.hxx).
+ *
+ * @tparam space memory space for the graph (host or device).
+ * @tparam edge_t Edge type of the graph.
+ * @tparam vertex_t Vertex type of the graph.
+ * @tparam weight_t Weight type of the graph.
+ * @param properties Graph properties.
+ * @param compressed compressed_csr_t format with graph's data.
+ * @return graph_t the graph itself.
+ */
+template <memory_space_t space,
+          typename edge_t,
+          typename vertex_t,
+          typename weight_t>
+auto build(
+    graph::graph_properties_t properties,
+    format::compressed_csr_t<space, vertex_t, edge_t, weight_t>& compressed) {
+  return detail::builder<space>(properties, compressed);
+}
+
+/**
+ * @brief Builds a graph that supports CSR and compressed CSR. CSR stays the
+ * default view.
+ *
+ * @tparam space memory space for the graph (host or device).
+ * @tparam edge_t Edge type of the graph.
+ * @tparam vertex_t Vertex type of the graph.
+ * @tparam weight_t Weight type of the graph.
+ * @param properties Graph properties.
+ * @param csr csr_t format with graph's data.
+ * @param compressed compressed_csr_t format with graph's data.
+ * @return graph_t the graph itself.
+ */
+template <memory_space_t space,
+          typename edge_t,
+          typename vertex_t,
+          typename weight_t>
+auto build(
+    graph::graph_properties_t properties,
+    format::csr_t<space, vertex_t, edge_t, weight_t>& csr,
+    format::compressed_csr_t<space, vertex_t, edge_t, weight_t>& compressed) {
+  return detail::builder<space>(properties, csr, compressed);
+}
+
 /**
  * @brief Builds a graph that supports COO and CSR.
  *
@@ -181,5 +228,175 @@ auto build(graph::graph_properties_t properties,
   return detail::builder<space>(properties, coo, csc, csr);
 }
 
+/**
+ * @brief Builds a graph that supports CSR from a (host) COO object. The COO is
+ * converted into `csr` in parallel on the host, applying the given cleanup
+ * policies (see formats/builder.hxx); `csr` must outlive the graph.
+ *
+ * @par Example
+ * \code
+ * format::build_policy_t policy;
+ * policy.remove_self_loops = true;
+ * policy.duplicates = format::duplicate_policy_t::min;
+ * auto G = graph::build<memory_space_t::device>(properties, coo, csr, policy);
+ * \endcode
+ *
+ * @tparam space memory space for the graph (host or device).
+ * @tparam edge_t Edge type of the graph.
+ * @tparam vertex_t Vertex type of the graph.
+ * @tparam weight_t Weight type of the graph.
+ * @param properties Graph properties (marked symmetric if `policy.symmetrize`).
+ * @param coo coo_t format with graph's data.
+ * @param csr csr_t format receiving the converted data.
+ * @param policy self-loop, duplicate and symmetrization policies.
+ * @return graph_t the graph itself.
+ */
+template <memory_space_t space,
+          typename edge_t,
+          typename vertex_t,
+          typename weight_t>
+auto build(
+    graph::graph_properties_t properties,
+    const format::coo_t<memory_space_t::host, vertex_t, edge_t, weight_t>& coo,
+    format::csr_t<space, vertex_t, edge_t, weight_t>& csr,
+    format::build_policy_t policy) {
+  csr.from_coo(coo, policy);
+  if (policy.symmetrize) {
+    properties.symmetric = true;
+    properties.directed = false;
+  }
+  return detail::builder<space>(properties, csr);
+}
+
+/**
+ * @brief Builds a graph that supports CSC and CSR from a (host) COO object.
+ * The COO is converted into `csr` in parallel on the host, applying the given
+ * cleanup policies (see formats/builder.hxx), and `csc` is transposed from
+ * it; both must outlive the graph.
+ *
+ * @tparam space memory space for the graph (host or device).
+ * @tparam edge_t Edge type of the graph.
+ * @tparam vertex_t Vertex type of the graph.
+ * @tparam weight_t Weight type of the graph.
+ * @param properties Graph properties (marked symmetric if `policy.symmetrize`).
+ * @param coo coo_t format with graph's data.
+ * @param csc csc_t format receiving the converted data.
+ * @param csr csr_t format receiving the converted data.
+ * @param policy self-loop, duplicate and symmetrization policies.
+ * @return graph_t the graph itself.
+ */
+template <memory_space_t space,
+          typename edge_t,
+          typename vertex_t,
+          typename weight_t>
+auto build(
+    graph::graph_properties_t properties,
+    const format::coo_t<memory_space_t::host, vertex_t, edge_t, weight_t>& coo,
+    format::csc_t<space, vertex_t, edge_t, weight_t>& csc,
+    format::csr_t<space, vertex_t, edge_t, weight_t>& csr,
+    format::build_policy_t policy) {
+  csr.from_coo(coo, policy);
+  csc.from_csr(csr);
+  if (policy.symmetrize) {
+    properties.symmetric = true;
+    properties.directed = false;
+  }
+  return detail::builder<space>(properties, csc, csr);
+}
+
+/**
+ * @brief Builds a graph that supports CSR with its vertices reordered: `csr`
+ * is renamed in place by `permutation` (see graph/reorder.hxx) and must
+ * outlive the graph. Vertex IDs of the graph are the new IDs; use
+ * `permutation.to_new()` for sources and `permutation.unpermute()` on the
+ * results to stay in the original IDs.
+ *
+ * @par Example
+ * \code
+ * auto permutation = graph::reorder::compute(graph::reorder::algorithm_t::rcm,
+ *                                            csr, properties.symmetric);
+ * auto G = graph::build<memory_space_t::device>(properties, csr, permutation);
+ * auto single_source = permutation.to_new(source);  // bfs::run takes a ref.
+ * bfs::run(G, single_source, distances.data().get(), ...);
+ * permutation.unpermute(distances);
+ * \endcode
+ *
+ * @tparam space memory space for the graph (host or device).
+ * @tparam edge_t Edge type of the graph.
+ * @tparam vertex_t Vertex type of the graph.
+ * @tparam weight_t Weight type of the graph.
+ * @param properties Graph properties.
+ * @param csr csr_t format with graph's data, reordered in place.
+ * @param permutation vertex permutation.
+ * @return graph_t the graph itself.
+ */
+template <memory_space_t space,
+          typename edge_t,
+          typename vertex_t,
+          typename weight_t>
+auto build(graph::graph_properties_t properties,
+           format::csr_t<space, vertex_t, edge_t, weight_t>& csr,
+           reorder::permutation_t<vertex_t> const& permutation) {
+  reorder::apply(permutation, csr);
+  return detail::builder<space>(properties, csr);
+}
+
+/**
+ * @brief Builds a graph that supports CSC and CSR with its vertices
+ * reordered: both formats are renamed in place by `permutation` (see
+ * graph/reorder.hxx) and must outlive the graph.
+ *
+ * @tparam space memory space for the graph (host or device).
+ * @tparam edge_t Edge type of the graph.
+ * @tparam vertex_t Vertex type of the graph.
+ * @tparam weight_t Weight type of the graph.
+ * @param properties Graph properties.
+ * @param csc csc_t format with graph's data, reordered in place.
+ * @param csr csr_t format with graph's data, reordered in place.
+ * @param permutation vertex permutation.
+ * @return graph_t the graph itself.
+ */
+template <memory_space_t space,
+          typename edge_t,
+          typename vertex_t,
+          typename weight_t>
+auto build(graph::graph_properties_t properties,
+           format::csc_t<space, vertex_t, edge_t, weight_t>& csc,
+           format::csr_t<space, vertex_t, edge_t, weight_t>& csr,
+           reorder::permutation_t<vertex_t> const& permutation) {
+  reorder::apply(permutation, csc);
+  reorder::apply(permutation, csr);
+  return detail::builder<space>(properties, csc, csr);
+}
+
+/**
+ * @brief Builds a host graph directly on top of a memory-mapped binary graph
+ * file (see io/binary.hxx), without copying. The file's layout must match
+ * `view`, and `mapped` must outlive the graph. A pattern graph (no values
+ * section) has unit edge weights.
+ *
+ * @par Example
+ * \code
+ * io::binary::mapped_t<int, int, float> mapped("graph.csr");
+ * auto G = graph::build<memory_space_t::host>(mapped);
+ * \endcode
+ *
+ * @tparam space memory space for the graph (must be host).
+ * @tparam view view of the graph (csr, csc or coo), must match the file.
+ * @tparam edge_t Edge type of the graph.
+ * @tparam vertex_t Vertex type of the graph.
+ * @tparam weight_t Weight type of the graph.
+ * @param mapped mapped binary graph file.
+ * @return graph_t the graph itself.
+ */
+template <memory_space_t space,
+          view_t view = view_t::csr,
+          typename edge_t,
+          typename vertex_t,
+          typename weight_t>
+auto build(io::binary::mapped_t<vertex_t, edge_t, weight_t>& mapped) {
+  return detail::builder<space, view>(mapped);
+}
+
 }  // namespace graph
 }  // namespace gunrock
\ No newline at end of file
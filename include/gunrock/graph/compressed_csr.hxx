@@ -0,0 +1,339 @@
+/**
+ * @file compressed_csr.hxx
+ * @brief Graph view over a compressed CSR (see formats/compressed_csr.hxx):
+ * neighbor lists are decoded on the fly.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <iterator>
+
+#include <gunrock/memory.hxx>
+#include <gunrock/util/type_limits.hxx>
+#include <gunrock/graph/vertex_pair.hxx>
+#include <gunrock/formats/formats.hxx>
+
+#include <thrust/binary_search.h>
+#include <thrust/execution_policy.h>
+
+namespace gunrock {
+namespace graph {
+
+using namespace memory;
+
+/**
+ * @brief Forward iterator over the neighbors of one vertex of a compressed
+ * CSR, decoding one group (of `format::compressed::group_size` values) at a
+ * time.
+ */
+template <typename vertex_t, typename edge_t>
+class compressed_neighbor_iterator_t {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = vertex_t;
+  using difference_type = std::ptrdiff_t;
+  using pointer = vertex_t const*;
+  using reference = vertex_t;
+
+  __host__ __device__ compressed_neighbor_iterator_t() : cursor(), end(0) {}
+
+  __host__ __device__ compressed_neighbor_iterator_t(
+      format::compressed::cursor_t<vertex_t> const& _cursor,
+      edge_t last)
+      : cursor(_cursor), end(last) {}
+
+  /// End iterator.
+  __host__ __device__ explicit compressed_neighbor_iterator_t(edge_t last)
+      : cursor(), end(last) {
+    cursor.edge = last;
+  }
+
+  __host__ __device__ __forceinline__ vertex_t operator*() const {
+    return vertex_t(cursor.column);
+  }
+
+  /// Edge id of the current neighbor.
+  __host__ __device__ __forceinline__ edge_t get_edge() const {
+    return edge_t(cursor.edge);
+  }
+
+  __host__ __device__ __forceinline__ compressed_neighbor_iterator_t&
+  operator++() {
+    if (cursor.edge + 1 < std::size_t(end))
+      cursor.advance();
+    else
+      ++cursor.edge;
+    return *this;
+  }
+
+  __host__ __device__ __forceinline__ compressed_neighbor_iterator_t
+  operator++(int) {
+    auto previous = *this;
+    ++(*this);
+    return previous;
+  }
+
+  __host__ __device__ __forceinline__ bool operator==(
+      compressed_neighbor_iterator_t const& rhs) const {
+    return cursor.edge == rhs.cursor.edge;
+  }
+
+  __host__ __device__ __forceinline__ bool operator!=(
+      compressed_neighbor_iterator_t const& rhs) const {
+    return cursor.edge != rhs.cursor.edge;
+  }
+
+ private:
+  format::compressed::cursor_t<vertex_t> cursor;
+  edge_t end;
+};
+
+/**
+ * @brief Compressed CSR view. Usable wherever a graph view is (alone or
+ * alongside graph_csr_t); every accessor works, but the column of an
+ * arbitrary edge (`get_destination_vertex()`) costs a block decode, so
+ * algorithms should scan neighbors with `for_each_neighbor()`,
+ * `any_neighbor()`, `decode()` or `neighbors()` instead.
+ */
+template <memory_space_t space,
+          typename vertex_t,
+          typename edge_t,
+          typename weight_t>
+class graph_compressed_csr_t {
+  using vertex_type = vertex_t;
+  using edge_type = edge_t;
+  using weight_type = weight_t;
+
+  using vertex_pair_type = vertex_pair_t<vertex_type>;
+
+ public:
+  using neighbor_iterator_t = compressed_neighbor_iterator_t<vertex_t, edge_t>;
+
+  /**
+   * @brief Neighbors of a vertex as a range, for range-based for loops.
+   */
+  struct neighbor_range_t {
+    neighbor_iterator_t first;
+    neighbor_iterator_t last;
+    __host__ __device__ neighbor_iterator_t begin() const { return first; }
+    __host__ __device__ neighbor_iterator_t end() const { return last; }
+  };
+
+  __host__ __device__ graph_compressed_csr_t()
+      : number_of_vertices(0),
+        number_of_edges(0),
+        unit_values(true),
+        offsets(nullptr),
+        lists{nullptr, nullptr, nullptr, nullptr},
+        values(nullptr) {}
+
+  __host__ __device__ __forceinline__ edge_type
+  get_number_of_neighbors(vertex_type const& v) const {
+    return (get_starting_edge(v + 1) - get_starting_edge(v));
+  }
+
+  __host__ __device__ __forceinline__ vertex_type
+  get_source_vertex(edge_type const& e) const {
+    auto keys = offsets;
+    auto it = thrust::lower_bound(
+        thrust::seq, thrust::counting_iterator<edge_t>(0),
+        thrust::counting_iterator<edge_t>(this->number_of_vertices), e,
+        [keys] __host__ __device__(const edge_t& pivot, const edge_t& key) {
+          return keys[pivot] <= key;
+        });
+
+    return (*it) - 1;
+  }
+
+  __host__ __device__ __forceinline__ vertex_type
+  get_destination_vertex(edge_type const& e) const {
+    auto v = get_source_vertex(e);
+    auto position = e - get_starting_edge(v);
+    vertex_type destination = 0;
+    any_neighbor(v, position, position + 1, [&](vertex_type u, edge_type) {
+      destination = u;
+      return true;
+    });
+    return destination;
+  }
+
+  __host__ __device__ __forceinline__ edge_type
+  get_starting_edge(vertex_type const& v) const {
+    return offsets[v];
+  }
+
+  __host__ __device__ __forceinline__ vertex_pair_type
+  get_source_and_destination_vertices(const edge_type& e) const {
+    return {get_source_vertex(e), get_destination_vertex(e)};
+  }
+
+  /**
+   * @brief Edge from `source` to `destination`, or an invalid edge if there is
+   * none. Decodes the row of `source` up to `destination`.
+   */
+  __host__ __device__ __forceinline__ edge_type
+  get_edge(const vertex_type& source, const vertex_type& destination) const {
+    edge_type found = gunrock::numeric_limits<edge_type>::invalid();
+    any_neighbor(source, [&](vertex_type u, edge_type e) {
+      if (u == destination)
+        found = e;
+      return u >= destination;
+    });
+    return found;
+  }
+
+  __host__ __device__ __forceinline__ weight_type
+  get_edge_weight(edge_type const& e) const {
+    return unit_values ? weight_type(1) : values[e];
+  }
+
+  /**
+   * @brief Calls `op(neighbor, edge)` on the neighbors of `v`.
+   */
+  template <typename operator_type>
+  __host__ __device__ __forceinline__ void for_each_neighbor(
+      vertex_type const& v,
+      operator_type op) const {
+    for_each_neighbor(v, edge_type(0), get_number_of_neighbors(v), op);
+  }
+
+  /**
+   * @brief Calls `op(neighbor, edge)` on the neighbors of `v` at positions
+   * `[first, last)` of its (sorted) neighbor list.
+   */
+  template <typename operator_type>
+  __host__ __device__ __forceinline__ void for_each_neighbor(
+      vertex_type const& v,
+      edge_type const& first,
+      edge_type const& last,
+      operator_type op) const {
+    any_neighbor(v, first, last, [&](vertex_type u, edge_type e) {
+      op(u, e);
+      return false;
+    });
+  }
+
+  /**
+   * @brief Calls `pred(neighbor, edge)` on the neighbors of `v` until it
+   * returns true (early exit, e.g. bottom-up BFS).
+   *
+   * @return true if `pred` returned true.
+   */
+  template <typename predicate_type>
+  __host__ __device__ __forceinline__ bool any_neighbor(
+      vertex_type const& v,
+      predicate_type pred) const {
+    return any_neighbor(v, edge_type(0), get_number_of_neighbors(v), pred);
+  }
+
+  template <typename predicate_type>
+  __host__ __device__ __forceinline__ bool any_neighbor(
+      vertex_type const& v,
+      edge_type const& first,
+      edge_type const& last,
+      predicate_type pred) const {
+    return lists.decode_until(v, first, last, pred);
+  }
+
+  /**
+   * @brief Block decoder: writes the neighbors of `v` to `output`.
+   *
+   * @return edge_type number of neighbors written.
+   */
+  __host__ __device__ __forceinline__ edge_type
+  decode(vertex_type const& v, vertex_type* output) const {
+    edge_type start = get_starting_edge(v);
+    for_each_neighbor(v, [=](vertex_type u, edge_type e) {
+      output[e - start] = u;
+    });
+    return get_number_of_neighbors(v);
+  }
+
+  /**
+   * @brief Neighbors of `v` as an iterator range.
+   */
+  __host__ __device__ __forceinline__ neighbor_range_t
+  neighbors(vertex_type const& v) const {
+    edge_type last = get_starting_edge(v + 1);
+    if (last == get_starting_edge(v))
+      return {neighbor_iterator_t(last), neighbor_iterator_t(last)};
+    return {neighbor_iterator_t(lists.seek(v, edge_type(0)), last),
+            neighbor_iterator_t(last)};
+  }
+
+  // Representation specific functions
+  // ...
+  __host__ __device__ __forceinline__ auto get_row_offsets() const {
+    return offsets;
+  }
+
+  /// Raw arrays and decoder of the encoded neighbor lists.
+  __host__ __device__ __forceinline__ auto const& get_neighbor_lists() const {
+    return lists;
+  }
+
+  /// `nullptr` in implicit-unit mode.
+  __host__ __device__ __forceinline__ auto get_nonzero_values() const {
+    return values;
+  }
+
+  __host__ __device__ __forceinline__ bool has_unit_weights() const {
+    return unit_values;
+  }
+
+  __host__ __device__ __forceinline__ auto get_number_of_rows() const {
+    return number_of_vertices;
+  }
+
+  __host__ __device__ __forceinline__ auto get_number_of_columns() const {
+    return number_of_vertices;
+  }
+
+  __host__ __device__ __forceinline__ auto get_number_of_nonzeros() const {
+    return number_of_edges;
+  }
+
+  __host__ __device__ __forceinline__ auto get_number_of_vertices() const {
+    return number_of_vertices;
+  }
+
+  __host__ __device__ __forceinline__ auto get_number_of_edges() const {
+    return number_of_edges;
+  }
+
+ protected:
+  __host__ void set(
+      gunrock::format::compressed_csr_t<space, vertex_t, edge_t, weight_t>&
+          compressed) {
+    this->number_of_vertices = compressed.number_of_rows;
+    this->number_of_edges = compressed.number_of_nonzeros;
+    this->unit_values = compressed.unit_values;
+    // Set raw pointers
+    offsets = raw_pointer_cast(compressed.row_offsets.data());
+    lists = {offsets, raw_pointer_cast(compressed.block_offsets.data()),
+             raw_pointer_cast(compressed.row_group_offsets.data()),
+             raw_pointer_cast(compressed.encoded_indices.data())};
+    values = unit_values ? nullptr
+                         : raw_pointer_cast(compressed.nonzero_values.data());
+  }
+
+ private:
+  // Underlying data storage
+  vertex_type number_of_vertices;
+  edge_type number_of_edges;
+  bool unit_values;
+
+  edge_type* offsets;
+  format::compressed::lists_t<vertex_type, edge_type> lists;
+  weight_type* values;
+
+};  // class graph_compressed_csr_t
+
+}  // namespace graph
+}  // namespace gunrock
@@ -91,7 +91,7 @@ class graph_coo_t {
 
   __host__ __device__ __forceinline__ weight_type
   get_edge_weight(edge_type const& e) const {
-    return values[e];
+    return values ? values[e] : weight_type(1);
   }
 
   // Representation specific functions
@@ -151,7 +151,7 @@ class graph_coo_t {
 
   vertex_type* row_indices;
   vertex_type* column_indices;
-  weight_type* values;
+  weight_type* values;  // nullptr: unit weights (pattern graphs)
 };  // struct graph_coo_t
 
 }  // namespace graph
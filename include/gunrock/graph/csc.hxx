@@ -94,7 +94,7 @@ class graph_csc_t {
 
   __host__ __device__ __forceinline__ weight_type
   get_edge_weight(edge_type const& e) const {
-    return values[e];
+    return values ? values[e] : weight_type(1);
   }
 
   // Representation specific functions
@@ -152,7 +152,7 @@ class graph_csc_t {
 
   edge_type* offsets;
   vertex_type* indices;
-  weight_type* values;
+  weight_type* values;  // nullptr: unit weights (pattern graphs)
 
 };  // struct graph_csc_t
 
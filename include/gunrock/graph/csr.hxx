@@ -174,7 +174,7 @@ class graph_csr_t {
 
   __host__ __device__ __forceinline__ weight_type
   get_edge_weight(edge_type const& e) const {
-    return thread::load(&values[e]);
+    return values ? thread::load(&values[e]) : weight_type(1);
   }
 
   // Representation specific functions
@@ -248,7 +248,7 @@ class graph_csr_t {
 
   edge_type* offsets;
   vertex_type* indices;
-  weight_type* values;
+  weight_type* values;  // nullptr: unit weights (pattern graphs)
 
 };  // struct graph_csr_t
 
@@ -10,6 +10,7 @@
 
 #include <gunrock/algorithms/algorithms.hxx>
 #include <gunrock/formats/formats.hxx>
+#include <gunrock/io/binary.hxx>
 
 namespace gunrock {
 namespace graph {
@@ -98,6 +99,54 @@ auto builder(graph::graph_properties_t properties,
   return G;
 }
 
+template <memory_space_t space,
+          typename edge_t,
+          typename vertex_t,
+          typename weight_t>
+auto builder(
+    graph::graph_properties_t properties,
+    format::compressed_csr_t<space, vertex_t, edge_t, weight_t>& compressed) {
+  // Enable compressed CSR.
+  using ccsr_v_t =
+      graph::graph_compressed_csr_t<space, vertex_t, edge_t, weight_t>;
+  using ccsr_f_t = format::compressed_csr_t<space, vertex_t, edge_t, weight_t>;
+
+  using graph_type =
+      graph::graph_t<space, vertex_t, edge_t, weight_t, ccsr_v_t>;
+  graph_type G(properties);
+
+  G.template set<ccsr_v_t, ccsr_f_t>(compressed);
+  return G;
+}
+
+template <memory_space_t space,
+          typename edge_t,
+          typename vertex_t,
+          typename weight_t>
+auto builder(
+    graph::graph_properties_t properties,
+    format::csr_t<space, vertex_t, edge_t, weight_t>& csr,
+    format::compressed_csr_t<space, vertex_t, edge_t, weight_t>& compressed) {
+  // Enable CSR.
+  using csr_v_t = graph::graph_csr_t<space, vertex_t, edge_t, weight_t>;
+  using csr_f_t = format::csr_t<space, vertex_t, edge_t, weight_t>;
+
+  // Enable compressed CSR.
+  using ccsr_v_t =
+      graph::graph_compressed_csr_t<space, vertex_t, edge_t, weight_t>;
+  using ccsr_f_t = format::compressed_csr_t<space, vertex_t, edge_t, weight_t>;
+
+  using graph_type =
+      graph::graph_t<space, vertex_t, edge_t, weight_t, csr_v_t, ccsr_v_t>;
+
+  graph_type G(properties);
+
+  G.template set<csr_v_t, csr_f_t>(csr);
+  G.template set<ccsr_v_t, ccsr_f_t>(compressed);
+
+  return G;
+}
+
 template <memory_space_t space,
           typename edge_t,
           typename vertex_t,
@@ -207,6 +256,47 @@ auto builder(graph::graph_properties_t properties,
 
   return G;
 }
+
+template <memory_space_t space,
+          view_t view,
+          typename edge_t,
+          typename vertex_t,
+          typename weight_t>
+auto builder(io::binary::mapped_t<vertex_t, edge_t, weight_t>& mapped) {
+  static_assert(space == memory_space_t::host,
+                "Mapped binary graphs live in host memory.");
+  static_assert(view == view_t::csr || view == view_t::csc ||
+                    view == view_t::coo,
+                "Mapped binary graphs support a single CSR, CSC or COO view.");
+
+  using view_type = std::conditional_t<
+      view == view_t::csr, graph::graph_csr_t<space, vertex_t, edge_t, weight_t>,
+      std::conditional_t<
+          view == view_t::csc,
+          graph::graph_csc_t<space, vertex_t, edge_t, weight_t>,
+          graph::graph_coo_t<space, vertex_t, edge_t, weight_t>>>;
+  using graph_type =
+      graph::graph_t<space, vertex_t, edge_t, weight_t, view_type>;
+
+  constexpr io::binary::layout_t layout =
+      (view == view_t::csr)   ? io::binary::layout_t::csr
+      : (view == view_t::csc) ? io::binary::layout_t::csc
+                              : io::binary::layout_t::coo;
+  error::throw_if_exception(mapped.layout() != layout,
+                            "Binary graph layout does not match the view.");
+
+  // The views never write through these pointers; the mapping is read-only.
+  void* v1 = const_cast<void*>(
+      (view == view_t::coo) ? static_cast<const void*>(mapped.row_indices())
+                            : static_cast<const void*>(mapped.offsets()));
+  void* v2 = const_cast<vertex_t*>(mapped.indices());
+  weight_t* v3 = const_cast<weight_t*>(mapped.values());
+
+  graph_type G(mapped.properties());
+  G.template set<view_type>(mapped.number_of_rows(),
+                            mapped.number_of_nonzeros(), v1, v2, v3);
+  return G;
+}
 }  // namespace detail
 }  // namespace graph
 }  // namespace gunrock
\ No newline at end of file
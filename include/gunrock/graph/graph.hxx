@@ -17,6 +17,7 @@
 #include <gunrock/graph/coo.hxx>
 #include <gunrock/graph/csc.hxx>
 #include <gunrock/graph/csr.hxx>
+#include <gunrock/graph/compressed_csr.hxx>
 #include <gunrock/formats/formats.hxx>
 
 namespace gunrock {
@@ -42,6 +43,9 @@ struct empty_graph_t {};
  * | insert edge   | O(1)             | O(1) | O(1) or O(d) | O(m+n)  |
  * | delete edge   | O(1)             | O(m) | O(d)         | O(m+n)  |
  *
+ * Graphs that change by batches of edges are better kept in a
+ * host::dynamic_graph_t (algorithms/host/dynamic_graph.hxx), which updates
+ * its lists in place and takes snapshots into a CSR.
  *
  * @tparam space memory space to use for the graph (device or host).
  * @tparam vertex_t index type of the vertices, must be integral type.
@@ -73,6 +77,10 @@ class graph_t : public graph_view_t... {
   using weight_type = weight_t;
   using vertex_pair_type = vertex_pair_t<vertex_type>;
 
+  /// Memory space of the graph (usable in constant expressions, e.g. to pick
+  /// the host or device implementation of an operator).
+  static constexpr memory_space_t memory_space_v = space;
+
   using vertex_pointer_t = vertex_t*;
   using edge_pointer_t = edge_type*;
   using weight_pointer_t = weight_t*;
@@ -87,6 +95,8 @@ class graph_t : public graph_view_t... {
       graph_csc_t<space, vertex_type, edge_type, weight_type>;
   using graph_coo_view_t =
       graph_coo_t<space, vertex_type, edge_type, weight_type>;
+  using graph_compressed_csr_view_t =
+      graph_compressed_csr_t<space, vertex_type, edge_type, weight_type>;
 
   /**
    * @brief Default constructor for the graph.
@@ -0,0 +1,699 @@
+/**
+ * @file reorder.hxx
+ * @brief Vertex reordering: computes a permutation of the vertices (degree
+ * sort, reverse Cuthill-McKee, hub sorting/clustering or a Gorder-style
+ * locality-greedy order), applies it to COO/CSR/CSC formats and maps results
+ * back to the original vertex IDs.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <gunrock/error.hxx>
+#include <gunrock/formats/formats.hxx>
+#include <gunrock/formats/builder.hxx>
+#include <gunrock/util/parallel.hxx>
+#include <gunrock/util/type_limits.hxx>
+
+#include <thrust/device_vector.h>
+#include <thrust/gather.h>
+#include <thrust/host_vector.h>
+
+namespace gunrock {
+namespace graph {
+namespace reorder {
+
+/**
+ * @brief Available vertex orderings.
+ */
+enum class algorithm_t {
+  none,         ///< Keep the input order.
+  degree,       ///< Degree-descending (ties by ID).
+  rcm,          ///< Reverse Cuthill-McKee (bandwidth reduction).
+  hub_sort,     ///< Hubs first, sorted by degree; others keep their order.
+  hub_cluster,  ///< Hubs first, then the others, both in input order.
+  gorder,       ///< Gorder-style greedy order maximizing neighbor locality.
+};
+
+/**
+ * @brief Parses an ordering name (`none`, `degree`, `rcm`, `hub_sort`,
+ * `hub_cluster` or `gorder`).
+ */
+inline algorithm_t from_string(std::string const& name) {
+  if (name == "none")
+    return algorithm_t::none;
+  if (name == "degree")
+    return algorithm_t::degree;
+  if (name == "rcm")
+    return algorithm_t::rcm;
+  if (name == "hub_sort")
+    return algorithm_t::hub_sort;
+  if (name == "hub_cluster")
+    return algorithm_t::hub_cluster;
+  if (name == "gorder")
+    return algorithm_t::gorder;
+  throw error::exception_t("Unknown vertex ordering: " + name);
+}
+
+inline std::string to_string(algorithm_t algorithm) {
+  switch (algorithm) {
+    case algorithm_t::degree:
+      return "degree";
+    case algorithm_t::rcm:
+      return "rcm";
+    case algorithm_t::hub_sort:
+      return "hub_sort";
+    case algorithm_t::hub_cluster:
+      return "hub_cluster";
+    case algorithm_t::gorder:
+      return "gorder";
+    default:
+      return "none";
+  }
+}
+
+struct param_t {
+  /// Hubs (hub_sort, hub_cluster) have a degree above this; `0` (default)
+  /// uses the average degree.
+  double hub_threshold = 0;
+  /// Gorder window: number of recently placed vertices a candidate's score is
+  /// computed against.
+  std::size_t gorder_window = 5;
+};
+
+/**
+ * @brief A vertex permutation and its inverse. An empty permutation is the
+ * identity.
+ *
+ * @tparam vertex_t vertex type.
+ */
+template <typename vertex_t>
+struct permutation_t {
+  /// `new_ids[v]`: new ID of original vertex `v`.
+  std::vector<vertex_t> new_ids;
+  /// `old_ids[v]`: original ID of new vertex `v`.
+  std::vector<vertex_t> old_ids;
+
+  bool is_identity() const { return new_ids.empty(); }
+
+  vertex_t to_new(vertex_t v) const { return is_identity() ? v : new_ids[v]; }
+  vertex_t to_old(vertex_t v) const { return is_identity() ? v : old_ids[v]; }
+
+  /**
+   * @brief Maps per-vertex values computed on the reordered graph back to the
+   * original IDs: `output[v] = input[new_ids[v]]`. `input` and `output` must
+   * not overlap.
+   */
+  template <typename type_t>
+  void unpermute(type_t const* input, type_t* output) const {
+    std::size_t n = new_ids.size();
+    util::parallel::for_each(
+        std::size_t(0), is_identity() ? std::size_t(0) : n,
+        [&](std::size_t v) { output[v] = input[new_ids[v]]; },
+        std::size_t(1) << 14);
+  }
+
+  /**
+   * @brief In-place `unpermute()` of a host vector of per-vertex values
+   * (distances, ranks, colors, ...).
+   */
+  template <typename type_t, typename allocator_t>
+  void unpermute(thrust::host_vector<type_t, allocator_t>& values) const {
+    if (is_identity())
+      return;
+    thrust::host_vector<type_t> input(values);
+    unpermute(input.data(), values.data());
+  }
+
+  /**
+   * @brief In-place `unpermute()` of a device vector of per-vertex values.
+   */
+  template <typename type_t, typename allocator_t>
+  void unpermute(thrust::device_vector<type_t, allocator_t>& values) const {
+    if (is_identity())
+      return;
+    thrust::device_vector<vertex_t> map(new_ids.begin(), new_ids.end());
+    thrust::device_vector<type_t> input(values);
+    thrust::gather(thrust::device, map.begin(), map.end(), input.begin(),
+                   values.begin());
+  }
+
+  /**
+   * @brief `unpermute()` for per-vertex values that are themselves vertex IDs
+   * (predecessors, labels): both the positions and the IDs are mapped back.
+   * Invalid IDs are kept.
+   */
+  template <typename vector_t>
+  void unpermute_ids(vector_t& ids) const {
+    if (is_identity())
+      return;
+    unpermute(ids);
+    thrust::host_vector<vertex_t> h_ids(ids);
+    util::parallel::for_each(
+        std::size_t(0), h_ids.size(),
+        [&](std::size_t v) {
+          if (gunrock::util::limits::is_valid(h_ids[v]))
+            h_ids[v] = old_ids[h_ids[v]];
+        },
+        std::size_t(1) << 14);
+    ids = h_ids;
+  }
+};
+
+namespace detail {
+
+template <typename vertex_t>
+void invert(permutation_t<vertex_t>& permutation) {
+  auto& old_ids = permutation.old_ids;
+  auto& new_ids = permutation.new_ids;
+  new_ids.resize(old_ids.size());
+  util::parallel::for_each(
+      std::size_t(0), old_ids.size(),
+      [&](std::size_t i) { new_ids[old_ids[i]] = vertex_t(i); },
+      std::size_t(1) << 14);
+}
+
+/**
+ * @brief Undirected view of a CSR: out-edges, plus in-edges (a transpose)
+ * unless the graph is symmetric.
+ */
+template <typename vertex_t, typename edge_t>
+struct adjacency_t {
+  vertex_t n;
+  edge_t const* out_offsets;
+  vertex_t const* out_indices;
+  std::vector<edge_t> in_offsets;
+  std::vector<vertex_t> in_indices;
+
+  adjacency_t(vertex_t _n,
+              edge_t const* row_offsets,
+              vertex_t const* column_indices,
+              bool symmetric)
+      : n(_n), out_offsets(row_offsets), out_indices(column_indices) {
+    if (symmetric)
+      return;
+    std::size_t m = row_offsets[n];
+    std::vector<vertex_t> rows(m);
+    std::vector<char> values(m), unused;
+    format::builder::expand(n, row_offsets, rows.data());
+    format::build_policy_t policy;
+    policy.sort = false;
+    format::builder::compress(n, m, column_indices, rows.data(), values.data(),
+                              policy, in_offsets, in_indices, unused);
+  }
+
+  std::size_t degree(vertex_t v) const {
+    std::size_t d = out_offsets[v + 1] - out_offsets[v];
+    if (!in_offsets.empty())
+      d += in_offsets[v + 1] - in_offsets[v];
+    return d;
+  }
+
+  /// Calls `op(w)` for every out- and in-neighbor `w` of `v`.
+  template <typename op_t>
+  void for_each_neighbor(vertex_t v, op_t op) const {
+    for (edge_t e = out_offsets[v]; e < out_offsets[v + 1]; ++e)
+      op(out_indices[e]);
+    if (!in_offsets.empty())
+      for (edge_t e = in_offsets[v]; e < in_offsets[v + 1]; ++e)
+        op(in_indices[e]);
+  }
+
+  /// Calls `op(w)` for every in-neighbor `w` of `v`.
+  template <typename op_t>
+  void for_each_in_neighbor(vertex_t v, op_t op) const {
+    if (in_offsets.empty()) {
+      for (edge_t e = out_offsets[v]; e < out_offsets[v + 1]; ++e)
+        op(out_indices[e]);
+    } else {
+      for (edge_t e = in_offsets[v]; e < in_offsets[v + 1]; ++e)
+        op(in_indices[e]);
+    }
+  }
+};
+
+/// Vertices sorted by `(degree descending, ID)`.
+template <typename vertex_t, typename degree_t>
+std::vector<vertex_t> sort_by_degree(vertex_t n, degree_t degree) {
+  std::vector<vertex_t> order(n);
+  std::vector<std::size_t> degrees(n);
+  util::parallel::for_each(
+      std::size_t(0), std::size_t(n),
+      [&](std::size_t v) {
+        order[v] = vertex_t(v);
+        degrees[v] = degree(vertex_t(v));
+      },
+      std::size_t(1) << 14);
+  util::parallel::sort(order.begin(), order.end(),
+                       [&](vertex_t a, vertex_t b) {
+                         return degrees[a] != degrees[b]
+                                    ? degrees[a] > degrees[b]
+                                    : a < b;
+                       });
+  return order;
+}
+
+template <typename vertex_t, typename edge_t>
+std::vector<vertex_t> hub_order(vertex_t n,
+                                edge_t const* row_offsets,
+                                bool sort_hubs,
+                                param_t const& param) {
+  auto degree = [=](vertex_t v) {
+    return std::size_t(row_offsets[v + 1] - row_offsets[v]);
+  };
+  double threshold = param.hub_threshold > 0
+                         ? param.hub_threshold
+                         : double(row_offsets[n] - row_offsets[0]) / n;
+
+  std::vector<vertex_t> hubs, others;
+  auto select = [&](bool hub, std::vector<vertex_t>& output) {
+    util::parallel::collect<vertex_t>(
+        vertex_t(0), n,
+        [&](vertex_t first, vertex_t last, std::vector<vertex_t>& local) {
+          for (vertex_t v = first; v < last; ++v)
+            if ((double(degree(v)) > threshold) == hub)
+              local.push_back(v);
+        },
+        [&](std::size_t size) {
+          output.resize(size);
+          return output.data();
+        },
+        vertex_t(1) << 14);
+  };
+  select(true, hubs);
+  select(false, others);
+
+  if (sort_hubs)
+    util::parallel::sort(hubs.begin(), hubs.end(), [&](vertex_t a, vertex_t b) {
+      return degree(a) != degree(b) ? degree(a) > degree(b) : a < b;
+    });
+
+  hubs.insert(hubs.end(), others.begin(), others.end());
+  return hubs;
+}
+
+/**
+ * @brief Reverse Cuthill-McKee. Every connected component is traversed
+ * breadth-first from a pseudo-peripheral vertex (George-Liu), visiting the
+ * neighbors of each vertex by increasing degree; the final order is reversed.
+ */
+template <typename vertex_t, typename edge_t>
+std::vector<vertex_t> rcm_order(adjacency_t<vertex_t, edge_t> const& A) {
+  const vertex_t n = A.n;
+  std::vector<vertex_t> order;
+  order.reserve(n);
+  std::vector<char> visited(n, 0);
+  std::vector<vertex_t> level(n, 0), neighbors;
+
+  // Candidate roots by increasing degree.
+  std::vector<vertex_t> roots =
+      sort_by_degree(n, [&](vertex_t v) { return A.degree(v); });
+  std::reverse(roots.begin(), roots.end());
+
+  // Plain BFS from `root` over unvisited vertices; returns the last level.
+  std::vector<vertex_t> queue;
+  std::vector<vertex_t> touched;
+  auto eccentricity = [&](vertex_t root, std::vector<vertex_t>& last) {
+    queue.assign(1, root);
+    touched.assign(1, root);
+    level[root] = 0;
+    visited[root] = 2;
+    for (std::size_t head = 0; head < queue.size(); ++head) {
+      vertex_t u = queue[head];
+      A.for_each_neighbor(u, [&](vertex_t w) {
+        if (!visited[w]) {
+          visited[w] = 2;
+          level[w] = level[u] + 1;
+          queue.push_back(w);
+          touched.push_back(w);
+        }
+      });
+    }
+    vertex_t depth = level[queue.back()];
+    last.clear();
+    for (auto v : touched) {
+      if (level[v] == depth)
+        last.push_back(v);
+      visited[v] = 0;
+    }
+    return depth;
+  };
+
+  std::vector<vertex_t> last;
+  for (vertex_t root : roots) {
+    if (visited[root])
+      continue;
+
+    // Pseudo-peripheral vertex: move to a minimum-degree vertex of the last
+    // level while the eccentricity grows.
+    vertex_t depth = eccentricity(root, last);
+    for (int round = 0; round < 8; ++round) {
+      vertex_t candidate = *std::min_element(
+          last.begin(), last.end(), [&](vertex_t a, vertex_t b) {
+            return A.degree(a) < A.degree(b);
+          });
+      std::vector<vertex_t> candidate_last;
+      vertex_t candidate_depth = eccentricity(candidate, candidate_last);
+      if (candidate_depth <= depth)
+        break;
+      root = candidate;
+      depth = candidate_depth;
+      last.swap(candidate_last);
+    }
+
+    // Cuthill-McKee traversal.
+    std::size_t head = order.size();
+    order.push_back(root);
+    visited[root] = 1;
+    for (; head < order.size(); ++head) {
+      vertex_t u = order[head];
+      neighbors.clear();
+      A.for_each_neighbor(u, [&](vertex_t w) {
+        if (!visited[w]) {
+          visited[w] = 1;
+          neighbors.push_back(w);
+        }
+      });
+      std::sort(neighbors.begin(), neighbors.end(),
+                [&](vertex_t a, vertex_t b) {
+                  return A.degree(a) != A.degree(b) ? A.degree(a) < A.degree(b)
+                                                    : a < b;
+                });
+      order.insert(order.end(), neighbors.begin(), neighbors.end());
+    }
+  }
+
+  std::reverse(order.begin(), order.end());
+  return order;
+}
+
+/**
+ * @brief Gorder-style greedy ordering (Wei et al., "Speedup Graph Processing
+ * by Graph Ordering", SIGMOD'16). Vertices are placed one at a time; the next
+ * one is the unplaced vertex with the highest score against the last `window`
+ * placed vertices, where a pair scores one per edge between them and one per
+ * common in-neighbor. Scores are kept up to date incrementally as vertices
+ * enter and leave the window, in lazily maintained score buckets (stale
+ * entries are dropped or moved when they reach the top). As in Gorder, hubs
+ * (in-neighbors with more than `sqrt(n)` out-edges) are not expanded for the
+ * common-neighbor term. Vertices with no score fall back to degree order.
+ */
+template <typename vertex_t, typename edge_t>
+std::vector<vertex_t> gorder_order(adjacency_t<vertex_t, edge_t> const& A,
+                                   std::size_t window) {
+  const vertex_t n = A.n;
+  const std::size_t hub_limit = std::size_t(std::sqrt(double(n))) + 1;
+  std::vector<vertex_t> fallback =
+      sort_by_degree(n, [&](vertex_t v) { return A.degree(v); });
+  std::vector<vertex_t> order;
+  order.reserve(n);
+  std::vector<char> placed(n, 0);
+  std::vector<std::size_t> score(n, 0);
+  std::vector<std::vector<vertex_t>> buckets(1);
+  std::size_t top = 0;
+  std::size_t next_fallback = 0;
+
+  auto update = [&](vertex_t v, bool increment) {
+    A.for_each_neighbor(v, [&](vertex_t w) {
+      if (placed[w])
+        return;
+      if (increment) {
+        std::size_t s = ++score[w];
+        if (buckets.size() <= s)
+          buckets.resize(s + 1);
+        buckets[s].push_back(w);
+        top = std::max(top, s);
+      } else {
+        --score[w];
+      }
+    });
+    A.for_each_in_neighbor(v, [&](vertex_t u) {
+      if (std::size_t(A.out_offsets[u + 1] - A.out_offsets[u]) > hub_limit)
+        return;
+      for (edge_t e = A.out_offsets[u]; e < A.out_offsets[u + 1]; ++e) {
+        vertex_t w = A.out_indices[e];
+        if (placed[w] || w == v)
+          continue;
+        if (increment) {
+          std::size_t s = ++score[w];
+          if (buckets.size() <= s)
+            buckets.resize(s + 1);
+          buckets[s].push_back(w);
+          top = std::max(top, s);
+        } else {
+          --score[w];
+        }
+      }
+    });
+  };
+
+  auto pop = [&]() -> vertex_t {
+    while (top > 0) {
+      auto& bucket = buckets[top];
+      if (bucket.empty()) {
+        --top;
+        continue;
+      }
+      vertex_t v = bucket.back();
+      bucket.pop_back();
+      if (placed[v] || score[v] > top)
+        continue;
+      if (score[v] < top) {
+        if (score[v] > 0)
+          buckets[score[v]].push_back(v);
+        continue;
+      }
+      return v;
+    }
+    while (placed[fallback[next_fallback]])
+      ++next_fallback;
+    return fallback[next_fallback];
+  };
+
+  for (vertex_t i = 0; i < n; ++i) {
+    vertex_t v = pop();
+    placed[v] = 1;
+    order.push_back(v);
+    if (order.size() > window)
+      update(order[order.size() - 1 - window], false);
+    update(v, true);
+  }
+  return order;
+}
+
+/**
+ * @brief Permutes a compressed format (CSR or CSC) of a square matrix: major
+ * `i` of the output is major `old_ids[i]` of the input, minor indices are
+ * renamed and re-sorted.
+ */
+template <typename vertex_t, typename offsets_t, typename indices_t,
+          typename values_t>
+void permute_compressed(permutation_t<vertex_t> const& permutation,
+                        offsets_t& offsets,
+                        indices_t& indices,
+                        values_t& values) {
+  using offset_t = typename offsets_t::value_type;
+  using value_t = typename values_t::value_type;
+
+  thrust::host_vector<offset_t> Ap(offsets);
+  thrust::host_vector<vertex_t> Aj(indices);
+  thrust::host_vector<value_t> Ax(values);
+  std::size_t n = Ap.size() - 1;
+  auto const& old_ids = permutation.old_ids;
+  auto const& new_ids = permutation.new_ids;
+
+  thrust::host_vector<offset_t> Bp(n + 1);
+  thrust::host_vector<vertex_t> Bj(Aj.size());
+  thrust::host_vector<value_t> Bx(Ax.size());
+  util::parallel::transform_exclusive_scan<offset_t>(
+      n,
+      [&](std::size_t i) {
+        vertex_t v = old_ids[i];
+        return offset_t(Ap[v + 1] - Ap[v]);
+      },
+      Bp.data());
+
+  std::vector<std::vector<std::pair<vertex_t, value_t>>> scratch(
+      util::parallel::number_of_threads());
+  util::parallel::for_each_chunk_id(
+      (n + 1023) / 1024, [&](std::size_t tid, std::size_t c) {
+        for (std::size_t i = c * 1024; i < std::min(n, (c + 1) * 1024); ++i) {
+          vertex_t v = old_ids[i];
+          offset_t out = Bp[i];
+          for (offset_t e = Ap[v]; e < Ap[v + 1]; ++e, ++out) {
+            Bj[out] = new_ids[Aj[e]];
+            Bx[out] = Ax[e];
+          }
+          format::builder::detail::sort_row(Bj.data() + Bp[i],
+                                            Bx.data() + Bp[i],
+                                            std::size_t(Bp[i + 1] - Bp[i]),
+                                            scratch[tid]);
+        }
+      });
+
+  offsets = Bp;
+  indices = Bj;
+  values = Bx;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Computes a vertex ordering from raw host CSR arrays.
+ *
+ * @par Overview
+ * `degree`, `hub_sort` and `hub_cluster` are computed in parallel. `rcm` and
+ * `gorder` are sequential traversals; they treat the graph as undirected (out-
+ * and in-edges, the latter built with `format::builder` unless `symmetric`).
+ * Every ordering is deterministic.
+ *
+ * @param algorithm ordering.
+ * @param n number of vertices.
+ * @param row_offsets CSR row offsets.
+ * @param column_indices CSR column indices.
+ * @param symmetric whether the CSR is symmetric (saves a transpose).
+ * @param param parameters.
+ * @return permutation_t<vertex_t> the permutation (identity for `none`).
+ */
+template <typename vertex_t, typename edge_t>
+permutation_t<vertex_t> compute(algorithm_t algorithm,
+                                vertex_t n,
+                                edge_t const* row_offsets,
+                                vertex_t const* column_indices,
+                                bool symmetric = false,
+                                param_t param = param_t()) {
+  permutation_t<vertex_t> permutation;
+  if (algorithm == algorithm_t::none || n == 0)
+    return permutation;
+
+  auto& order = permutation.old_ids;
+  switch (algorithm) {
+    case algorithm_t::degree:
+      order = detail::sort_by_degree(n, [=](vertex_t v) {
+        return std::size_t(row_offsets[v + 1] - row_offsets[v]);
+      });
+      break;
+    case algorithm_t::hub_sort:
+    case algorithm_t::hub_cluster:
+      order = detail::hub_order(n, row_offsets,
+                                algorithm == algorithm_t::hub_sort, param);
+      break;
+    case algorithm_t::rcm:
+      order = detail::rcm_order(detail::adjacency_t<vertex_t, edge_t>(
+          n, row_offsets, column_indices, symmetric));
+      break;
+    default:
+      order = detail::gorder_order(
+          detail::adjacency_t<vertex_t, edge_t>(n, row_offsets, column_indices,
+                                                symmetric),
+          std::max<std::size_t>(param.gorder_window, 1));
+      break;
+  }
+  detail::invert(permutation);
+  return permutation;
+}
+
+/**
+ * @brief Computes a vertex ordering of a CSR matrix (host or device).
+ */
+template <memory_space_t space,
+          typename vertex_t,
+          typename edge_t,
+          typename weight_t>
+permutation_t<vertex_t> compute(
+    algorithm_t algorithm,
+    format::csr_t<space, vertex_t, edge_t, weight_t> const& csr,
+    bool symmetric = false,
+    param_t param = param_t()) {
+  error::throw_if_exception(csr.number_of_rows != csr.number_of_columns,
+                            "Only square matrices can be reordered.");
+  if (algorithm == algorithm_t::none)
+    return permutation_t<vertex_t>();
+  thrust::host_vector<edge_t> row_offsets(csr.row_offsets);
+  thrust::host_vector<vertex_t> column_indices(csr.column_indices);
+  return compute(algorithm, csr.number_of_rows, row_offsets.data(),
+                 column_indices.data(), symmetric, param);
+}
+
+/**
+ * @brief Renames the vertices of a CSR matrix in place; the column indices of
+ * every row stay sorted.
+ */
+template <memory_space_t space,
+          typename vertex_t,
+          typename edge_t,
+          typename weight_t>
+void apply(permutation_t<vertex_t> const& permutation,
+           format::csr_t<space, vertex_t, edge_t, weight_t>& csr) {
+  if (permutation.is_identity())
+    return;
+  error::throw_if_exception(
+      permutation.new_ids.size() != std::size_t(csr.number_of_rows) ||
+          csr.number_of_rows != csr.number_of_columns,
+      "Permutation does not match the matrix.");
+  detail::permute_compressed(permutation, csr.row_offsets, csr.column_indices,
+                             csr.nonzero_values);
+}
+
+/**
+ * @brief Renames the vertices of a CSC matrix in place; the row indices of
+ * every column stay sorted.
+ */
+template <memory_space_t space,
+          typename vertex_t,
+          typename edge_t,
+          typename weight_t>
+void apply(permutation_t<vertex_t> const& permutation,
+           format::csc_t<space, vertex_t, edge_t, weight_t>& csc) {
+  if (permutation.is_identity())
+    return;
+  error::throw_if_exception(
+      permutation.new_ids.size() != std::size_t(csc.number_of_columns) ||
+          csc.number_of_rows != csc.number_of_columns,
+      "Permutation does not match the matrix.");
+  detail::permute_compressed(permutation, csc.column_offsets, csc.row_indices,
+                             csc.nonzero_values);
+}
+
+/**
+ * @brief Renames the vertices of a COO matrix in place (the order of the
+ * entries is kept).
+ */
+template <memory_space_t space,
+          typename vertex_t,
+          typename edge_t,
+          typename weight_t>
+void apply(permutation_t<vertex_t> const& permutation,
+           format::coo_t<space, vertex_t, edge_t, weight_t>& coo) {
+  if (permutation.is_identity())
+    return;
+  error::throw_if_exception(
+      permutation.new_ids.size() != std::size_t(coo.number_of_rows) ||
+          coo.number_of_rows != coo.number_of_columns,
+      "Permutation does not match the matrix.");
+  thrust::host_vector<vertex_t> I(coo.row_indices);
+  thrust::host_vector<vertex_t> J(coo.column_indices);
+  auto const& new_ids = permutation.new_ids;
+  util::parallel::for_each(
+      std::size_t(0), I.size(),
+      [&](std::size_t k) {
+        I[k] = new_ids[I[k]];
+        J[k] = new_ids[J[k]];
+      },
+      std::size_t(1) << 14);
+  coo.row_indices = I;
+  coo.column_indices = J;
+}
+
+}  // namespace reorder
+}  // namespace graph
+}  // namespace gunrock
@@ -0,0 +1,535 @@
+/**
+ * @file binary.hxx
+ * @brief Versioned, memory-mappable binary container for sparse graphs
+ * (CSR, CSC or COO). Files written by `format::csr_t::write_binary()` and by
+ * examples/tools/csr_binary use this layout.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <gunrock/error.hxx>
+#include <gunrock/graph/properties.hxx>
+#include <gunrock/io/detail/mapped_file.hxx>
+#include <gunrock/util/parallel.hxx>
+
+namespace gunrock {
+namespace io {
+namespace binary {
+
+/**
+ * @brief On-disk layout of a binary graph file.
+ *
+ * @par Overview
+ * \code
+ * +--------------------------------------+ 0
+ * | header_t (128 bytes)                 |
+ * +--------------------------------------+ section_offsets[0] (64B aligned)
+ * | section 0 (offsets or row indices)   |
+ * +--------------------------------------+ section_offsets[1] (64B aligned)
+ * | section 1 (indices)                  |
+ * +--------------------------------------+ section_offsets[2] (64B aligned)
+ * | section 2 (values, optional)         |
+ * +--------------------------------------+
+ * \endcode
+ *
+ * | Layout | Section 0      | Section 1      | Section 2 |
+ * |--------|----------------|----------------|-----------|
+ * | CSR    | row offsets    | column indices | values    |
+ * | CSC    | column offsets | row indices    | values    |
+ * | COO    | row indices    | column indices | values    |
+ *
+ * All integers are little-endian. Because sections are aligned, a host graph
+ * can point directly into a read-only mapping of the file (see `mapped_t`).
+ * Files that do not start with `magic` are treated as the legacy headerless
+ * CSR dump (rows, columns, nonzeros followed by the three raw arrays).
+ */
+constexpr char magic[8] = {'G', 'R', 'K', 'G', 'R', 'A', 'P', 'H'};
+constexpr std::uint32_t version = 1;
+constexpr std::uint32_t byte_order_mark = 0x01020304;
+constexpr std::size_t alignment = 64;
+constexpr std::size_t number_of_sections = 3;
+
+enum layout_t : std::uint8_t { csr = 1, csc = 2, coo = 3 };
+
+/**
+ * @brief Element type stored in a section, together with its width.
+ */
+enum element_kind_t : std::uint8_t {
+  none = 0,  ///< Section absent (e.g. pattern graph without values).
+  signed_integer = 1,
+  unsigned_integer = 2,
+  floating_point = 3
+};
+
+enum flag_t : std::uint32_t {
+  directed = 1 << 0,
+  symmetric = 1 << 1,
+  weighted = 1 << 2,
+  has_checksum = 1 << 3
+};
+
+struct header_t {
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t byte_order_mark;
+  std::uint32_t header_size;
+  std::uint32_t flags;
+  std::uint8_t layout;
+  std::uint8_t index_width;   ///< Bytes per row/column index.
+  std::uint8_t offset_width;  ///< Bytes per offset (CSR/CSC only).
+  std::uint8_t value_width;   ///< Bytes per value, 0 if no values stored.
+  std::uint8_t index_kind;
+  std::uint8_t offset_kind;
+  std::uint8_t value_kind;
+  std::uint8_t reserved0;
+  std::uint64_t number_of_rows;
+  std::uint64_t number_of_columns;
+  std::uint64_t number_of_nonzeros;
+  std::uint64_t section_offsets[number_of_sections];
+  std::uint64_t section_bytes[number_of_sections];
+  std::uint64_t checksum;  ///< `checksum()` over all sections.
+  std::uint64_t reserved1[2];
+};
+
+static_assert(sizeof(header_t) == 128, "binary::header_t must be 128 bytes");
+static_assert(std::is_trivially_copyable_v<header_t>);
+
+template <typename type_t>
+constexpr element_kind_t kind_of() {
+  if constexpr (std::is_floating_point_v<type_t>)
+    return element_kind_t::floating_point;
+  else if constexpr (std::is_signed_v<type_t>)
+    return element_kind_t::signed_integer;
+  else
+    return element_kind_t::unsigned_integer;
+}
+
+/**
+ * @brief A contiguous host array to be written as one section.
+ */
+struct section_t {
+  const void* data;
+  std::uint64_t count;
+  std::uint8_t width;
+  element_kind_t kind;
+};
+
+template <typename type_t>
+section_t make_section(const type_t* data, std::uint64_t count) {
+  return {data, count, sizeof(type_t), kind_of<type_t>()};
+}
+
+inline section_t empty_section() {
+  return {nullptr, 0, 0, element_kind_t::none};
+}
+
+/**
+ * @brief 64-bit checksum of a byte range. The range is hashed in independent
+ * 1MB blocks on all host threads and the block hashes are combined in order,
+ * so the result does not depend on the number of threads.
+ */
+inline std::uint64_t checksum(const void* data, std::size_t bytes) {
+  constexpr std::uint64_t prime = 0x100000001b3ull;
+  constexpr std::size_t block_bytes = 1 << 20;
+  auto mix = [](std::uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    return h;
+  };
+  auto hash_block = [&](const unsigned char* p, std::size_t n) {
+    std::uint64_t h = 0xcbf29ce484222325ull ^ n;
+    std::size_t words = n / sizeof(std::uint64_t);
+    for (std::size_t i = 0; i < words; ++i) {
+      std::uint64_t w;
+      std::memcpy(&w, p + i * sizeof(w), sizeof(w));
+      h = (h ^ w) * prime;
+      h = (h << 31) | (h >> 33);
+    }
+    for (std::size_t i = words * sizeof(std::uint64_t); i < n; ++i)
+      h = (h ^ p[i]) * prime;
+    return mix(h);
+  };
+
+  auto bytes_ptr = static_cast<const unsigned char*>(data);
+  std::size_t num_blocks = (bytes + block_bytes - 1) / block_bytes;
+  std::vector<std::uint64_t> block_hashes(num_blocks);
+  util::parallel::for_each<std::size_t>(
+      0, num_blocks,
+      [&](std::size_t b) {
+        std::size_t begin = b * block_bytes;
+        block_hashes[b] = hash_block(bytes_ptr + begin,
+                                     std::min(block_bytes, bytes - begin));
+      },
+      std::size_t(1));
+
+  std::uint64_t h = mix(bytes);
+  for (auto block_hash : block_hashes)
+    h = mix(h ^ (block_hash + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2)));
+  return h;
+}
+
+inline std::uint32_t to_flags(graph::graph_properties_t const& properties) {
+  return (properties.directed ? flag_t::directed : 0) |
+         (properties.symmetric ? flag_t::symmetric : 0) |
+         (properties.weighted ? flag_t::weighted : 0);
+}
+
+inline graph::graph_properties_t to_properties(std::uint32_t flags) {
+  graph::graph_properties_t properties;
+  properties.directed = flags & flag_t::directed;
+  properties.symmetric = flags & flag_t::symmetric;
+  properties.weighted = flags & flag_t::weighted;
+  return properties;
+}
+
+inline std::uint64_t align_up(std::uint64_t offset) {
+  return (offset + alignment - 1) / alignment * alignment;
+}
+
+/**
+ * @brief Write a graph in the binary container format.
+ *
+ * @param filename output file.
+ * @param layout CSR, CSC or COO.
+ * @param rows number of rows.
+ * @param columns number of columns.
+ * @param nonzeros number of nonzeros.
+ * @param properties graph properties stored as flags in the header.
+ * @param sections the three sections for `layout` (host memory).
+ * @param with_checksum compute and store a checksum over all sections.
+ */
+inline void write(std::string const& filename,
+                  layout_t layout,
+                  std::uint64_t rows,
+                  std::uint64_t columns,
+                  std::uint64_t nonzeros,
+                  graph::graph_properties_t const& properties,
+                  section_t const (&sections)[number_of_sections],
+                  bool with_checksum = true) {
+  header_t header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, magic, sizeof(magic));
+  header.version = version;
+  header.byte_order_mark = byte_order_mark;
+  header.header_size = sizeof(header_t);
+  header.flags = to_flags(properties);
+  header.layout = layout;
+  header.number_of_rows = rows;
+  header.number_of_columns = columns;
+  header.number_of_nonzeros = nonzeros;
+
+  // Index/offset/value widths, per layout.
+  auto const& index_section = (layout == layout_t::coo) ? sections[0]
+                                                        : sections[1];
+  header.index_width = index_section.width;
+  header.index_kind = index_section.kind;
+  if (layout != layout_t::coo) {
+    header.offset_width = sections[0].width;
+    header.offset_kind = sections[0].kind;
+  }
+  header.value_width = sections[2].width;
+  header.value_kind = sections[2].kind;
+
+  std::uint64_t offset = align_up(sizeof(header_t));
+  for (std::size_t s = 0; s < number_of_sections; ++s) {
+    header.section_offsets[s] = offset;
+    header.section_bytes[s] = sections[s].count * sections[s].width;
+    offset = align_up(offset + header.section_bytes[s]);
+  }
+
+  if (with_checksum) {
+    header.flags |= flag_t::has_checksum;
+    std::uint64_t h = 0;
+    for (auto const& section : sections)
+      h = h * 31 + checksum(section.data, section.count * section.width);
+    header.checksum = h;
+  }
+
+  FILE* file = fopen(filename.c_str(), "wb");
+  error::throw_if_exception(file == nullptr,
+                            "File could not be opened: " + filename);
+
+  static const char padding[alignment] = {0};
+  std::uint64_t position = 0;
+  auto put = [&](const void* data, std::uint64_t bytes) {
+    if (bytes && fwrite(data, 1, bytes, file) != bytes) {
+      fclose(file);
+      error::throw_if_exception(true, "Could not write to " + filename);
+    }
+    position += bytes;
+  };
+
+  put(&header, sizeof(header));
+  for (std::size_t s = 0; s < number_of_sections; ++s) {
+    put(padding, header.section_offsets[s] - position);
+    put(sections[s].data, header.section_bytes[s]);
+  }
+  fclose(file);
+}
+
+/**
+ * @brief A binary graph file opened through a read-only memory mapping.
+ * Gives access to the header and to the raw sections (zero-copy), and can copy
+ * or convert sections into user buffers.
+ */
+class file_t {
+ public:
+  file_t(std::string const& filename, bool verify_checksum = false)
+      : mapping(filename, false), name(filename), legacy(false) {
+    std::memset(&header, 0, sizeof(header));
+    legacy = mapping.size() < sizeof(header_t) ||
+             std::memcmp(mapping.data(), magic, sizeof(magic)) != 0;
+    if (legacy)
+      return;
+
+    std::memcpy(&header, mapping.data(), sizeof(header));
+    error::throw_if_exception(header.byte_order_mark != byte_order_mark,
+                              "Binary graph has a different byte order: " +
+                                  filename);
+    error::throw_if_exception(header.version > version,
+                              "Binary graph version " +
+                                  std::to_string(header.version) +
+                                  " is newer than supported: " + filename);
+    for (std::size_t s = 0; s < number_of_sections; ++s)
+      error::throw_if_exception(
+          header.section_offsets[s] + header.section_bytes[s] > mapping.size(),
+          "Binary graph is truncated: " + filename);
+    for (std::size_t s = 0; s < number_of_sections; ++s)
+      error::throw_if_exception(
+          header.section_bytes[s] != expected_count(s) * element_of(s).first,
+          "Binary graph section " + std::to_string(s) +
+              " has an unexpected size: " + filename);
+
+    if (verify_checksum)
+      error::throw_if_exception(!is_valid(), "Checksum mismatch: " + filename);
+  }
+
+  /**
+   * @brief True if the file is the headerless format written by older
+   * versions of `csr_t::write_binary()`.
+   */
+  bool is_legacy() const { return legacy; }
+
+  /**
+   * @brief Verify the stored checksum (true if the file has none).
+   */
+  bool is_valid() const {
+    if (legacy || !(header.flags & flag_t::has_checksum))
+      return true;
+    std::uint64_t h = 0;
+    for (std::size_t s = 0; s < number_of_sections; ++s)
+      h = h * 31 + checksum(mapping.data() + header.section_offsets[s],
+                            header.section_bytes[s]);
+    return h == header.checksum;
+  }
+
+  layout_t layout() const { return static_cast<layout_t>(header.layout); }
+  graph::graph_properties_t properties() const {
+    return to_properties(header.flags);
+  }
+  std::uint64_t get_number_of_rows() const { return header.number_of_rows; }
+  std::uint64_t get_number_of_columns() const {
+    return header.number_of_columns;
+  }
+  std::uint64_t get_number_of_nonzeros() const {
+    return header.number_of_nonzeros;
+  }
+  bool has_values() const { return header.value_kind != element_kind_t::none; }
+  header_t const& get_header() const { return header; }
+  detail::mapped_file_t const& get_mapping() const { return mapping; }
+
+  /**
+   * @brief True if section `s` stores elements of exactly `type_t`, i.e. it
+   * can be used in place without conversion.
+   */
+  template <typename type_t>
+  bool holds(std::size_t s) const {
+    auto [width, kind] = element_of(s);
+    return width == sizeof(type_t) && kind == kind_of<type_t>();
+  }
+
+  /**
+   * @brief Zero-copy pointer to a section; the element type must match the
+   * width and kind stored in the file exactly.
+   */
+  template <typename type_t>
+  const type_t* section(std::size_t s) const {
+    error::throw_if_exception(
+        !holds<type_t>(s),
+        "Binary graph section " + std::to_string(s) +
+            " does not match the requested type: " + name);
+    return reinterpret_cast<const type_t*>(mapping.data() +
+                                           header.section_offsets[s]);
+  }
+
+  /**
+   * @brief Copy section `s` into `output` (`count` elements), converting the
+   * element type if it differs from the one stored in the file. An absent
+   * section (pattern graph) is filled with 1.
+   */
+  template <typename type_t>
+  void copy_section(std::size_t s, type_t* output, std::size_t count) const {
+    auto [width, kind] = element_of(s);
+    if (kind == element_kind_t::none) {
+      std::fill(output, output + count, type_t(1));
+      return;
+    }
+    error::throw_if_exception(header.section_bytes[s] != count * width,
+                              "Binary graph section " + std::to_string(s) +
+                                  " has an unexpected size: " + name);
+
+    const char* input = mapping.data() + header.section_offsets[s];
+    if (holds<type_t>(s)) {
+      util::parallel::for_each_chunk<std::size_t>(
+          0, count,
+          [&](std::size_t begin, std::size_t end) {
+            std::memcpy(output + begin, input + begin * width,
+                        (end - begin) * width);
+          },
+          std::size_t(1) << 20);
+      return;
+    }
+
+    util::parallel::for_each<std::size_t>(0, count, [&](std::size_t i) {
+      output[i] = convert<type_t>(input + i * width, width, kind);
+    });
+  }
+
+ private:
+  /// Number of elements section `s` must hold, from the header counts.
+  std::uint64_t expected_count(std::size_t s) const {
+    if (s == 2 && !has_values())
+      return 0;
+    if (s == 0 && header.layout == layout_t::csr)
+      return header.number_of_rows + 1;
+    if (s == 0 && header.layout == layout_t::csc)
+      return header.number_of_columns + 1;
+    return header.number_of_nonzeros;
+  }
+
+  std::pair<std::uint8_t, element_kind_t> element_of(std::size_t s) const {
+    bool is_offsets = (s == 0) && (header.layout != layout_t::coo);
+    if (s == 2)
+      return {header.value_width, element_kind_t(header.value_kind)};
+    if (is_offsets)
+      return {header.offset_width, element_kind_t(header.offset_kind)};
+    return {header.index_width, element_kind_t(header.index_kind)};
+  }
+
+  template <typename type_t>
+  static type_t convert(const char* p, std::uint8_t width, element_kind_t kind) {
+    auto load = [p](auto value) {
+      std::memcpy(&value, p, sizeof(value));
+      return value;
+    };
+    if (kind == element_kind_t::floating_point)
+      return (width == 4) ? type_t(load(float(0))) : type_t(load(double(0)));
+    if (kind == element_kind_t::signed_integer) {
+      switch (width) {
+        case 1: return type_t(load(std::int8_t(0)));
+        case 2: return type_t(load(std::int16_t(0)));
+        case 4: return type_t(load(std::int32_t(0)));
+        default: return type_t(load(std::int64_t(0)));
+      }
+    }
+    switch (width) {
+      case 1: return type_t(load(std::uint8_t(0)));
+      case 2: return type_t(load(std::uint16_t(0)));
+      case 4: return type_t(load(std::uint32_t(0)));
+      default: return type_t(load(std::uint64_t(0)));
+    }
+  }
+
+  detail::mapped_file_t mapping;
+  std::string name;
+  header_t header;
+  bool legacy;
+};
+
+/**
+ * @brief Zero-copy, read-only host view of a binary graph file. Keeps the
+ * mapping alive and exposes raw pointers straight into it; pass them to
+ * `graph::build()` (see graph/build.hxx) to run host algorithms on a
+ * multi-GB graph without reading it into memory first.
+ *
+ * @tparam index_t row/column index type stored in the file.
+ * @tparam offset_t offset type stored in the file (CSR/CSC).
+ * @tparam value_t value type stored in the file.
+ */
+template <typename index_t, typename offset_t, typename value_t>
+struct mapped_t {
+  using index_type = index_t;
+  using offset_type = offset_t;
+  using value_type = value_t;
+
+  file_t file;
+
+  mapped_t(std::string const& filename, bool verify_checksum = false)
+      : file(filename, verify_checksum) {
+    error::throw_if_exception(
+        file.is_legacy(),
+        "Legacy binary graphs can not be mapped, re-export them with "
+        "csr_binary: " +
+            filename);
+    error::throw_if_exception(
+        file.get_number_of_rows() >= std::numeric_limits<index_t>::max() ||
+            file.get_number_of_columns() >=
+                std::numeric_limits<index_t>::max(),
+        "index_t overflow");
+  }
+
+  layout_t layout() const { return file.layout(); }
+  graph::graph_properties_t properties() const { return file.properties(); }
+
+  index_t number_of_rows() const { return file.get_number_of_rows(); }
+  index_t number_of_columns() const { return file.get_number_of_columns(); }
+  offset_t number_of_nonzeros() const {
+    return file.get_number_of_nonzeros();
+  }
+
+  /// CSR row offsets / CSC column offsets.
+  const offset_t* offsets() const { return file.section<offset_t>(0); }
+  /// CSR column indices / CSC row indices.
+  const index_t* indices() const { return file.section<index_t>(1); }
+  /// COO row and column indices.
+  const index_t* row_indices() const { return file.section<index_t>(0); }
+  const index_t* column_indices() const { return file.section<index_t>(1); }
+  /// Edge values; `nullptr` for a pattern graph (no values section).
+  const value_t* values() const {
+    return has_values() ? file.section<value_t>(2) : nullptr;
+  }
+  bool has_values() const { return file.has_values(); }
+};
+
+/**
+ * @brief Checks if a file starts with the binary graph magic.
+ */
+inline bool is_binary(std::string const& filename) {
+  char buffer[sizeof(magic)];
+  FILE* file = fopen(filename.c_str(), "rb");
+  if (!file)
+    return false;
+  bool match = fread(buffer, 1, sizeof(buffer), file) == sizeof(buffer) &&
+               std::memcmp(buffer, magic, sizeof(magic)) == 0;
+  fclose(file);
+  return match;
+}
+
+}  // namespace binary
+}  // namespace io
+}  // namespace gunrock
@@ -0,0 +1,103 @@
+/**
+ * @file mapped_file.hxx
+ * @brief Read-only memory-mapped file (POSIX mmap).
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <gunrock/error.hxx>
+
+namespace gunrock {
+namespace io {
+namespace detail {
+
+/**
+ * @brief Maps an entire file read-only into the address space of the process.
+ * The mapping is released when the object is destroyed.
+ */
+class mapped_file_t {
+ public:
+  mapped_file_t() : ptr(nullptr), length(0) {}
+
+  /**
+   * @brief Map `filename` into memory.
+   *
+   * @param filename path of the file to map.
+   * @param sequential hint the kernel that the file will be read front to back.
+   */
+  mapped_file_t(std::string const& filename, bool sequential = true)
+      : ptr(nullptr), length(0) {
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    error::throw_if_exception(fd < 0,
+                              "File could not be opened: " + filename);
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+      ::close(fd);
+      error::throw_if_exception(true, "Could not stat file: " + filename);
+    }
+
+    length = static_cast<std::size_t>(st.st_size);
+    if (length > 0) {
+      void* p = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (p == MAP_FAILED) {
+        ::close(fd);
+        error::throw_if_exception(true, "Could not mmap file: " + filename);
+      }
+      ptr = static_cast<char*>(p);
+      ::madvise(p, length, sequential ? MADV_SEQUENTIAL : MADV_WILLNEED);
+    }
+    ::close(fd);  // The mapping stays valid after the descriptor is closed.
+  }
+
+  ~mapped_file_t() { unmap(); }
+
+  mapped_file_t(mapped_file_t const&) = delete;
+  mapped_file_t& operator=(mapped_file_t const&) = delete;
+
+  mapped_file_t(mapped_file_t&& rhs) noexcept
+      : ptr(std::exchange(rhs.ptr, nullptr)),
+        length(std::exchange(rhs.length, 0)) {}
+
+  mapped_file_t& operator=(mapped_file_t&& rhs) noexcept {
+    if (this != &rhs) {
+      unmap();
+      ptr = std::exchange(rhs.ptr, nullptr);
+      length = std::exchange(rhs.length, 0);
+    }
+    return *this;
+  }
+
+  const char* data() const { return ptr; }
+  const char* begin() const { return ptr; }
+  const char* end() const { return ptr + length; }
+  std::size_t size() const { return length; }
+
+ private:
+  void unmap() {
+    if (ptr)
+      ::munmap(ptr, length);
+    ptr = nullptr;
+    length = 0;
+  }
+
+  char* ptr;
+  std::size_t length;
+};
+
+}  // namespace detail
+}  // namespace io
+}  // namespace gunrock
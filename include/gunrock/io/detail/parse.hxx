@@ -0,0 +1,217 @@
+/**
+ * @file parse.hxx
+ * @brief Hand-written, locale-independent text parsers for the graph loaders.
+ * All functions operate on a `[p, end)` character range (not necessarily
+ * null-terminated, e.g. a memory-mapped file) and advance `p` past what they
+ * consumed.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+namespace gunrock {
+namespace io {
+namespace detail {
+
+inline bool is_blank(char c) {
+  return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+inline bool is_digit(char c) {
+  return c >= '0' && c <= '9';
+}
+
+/**
+ * @brief Skip spaces and tabs (but not newlines).
+ */
+inline void skip_blanks(const char*& p, const char* end) {
+  while (p < end && is_blank(*p))
+    ++p;
+}
+
+/**
+ * @brief Move `p` to the first character of the next line (or `end`).
+ */
+inline void skip_line(const char*& p, const char* end) {
+  auto nl = static_cast<const char*>(std::memchr(p, '\n', end - p));
+  p = nl ? nl + 1 : end;
+}
+
+/**
+ * @brief Returns true if the line starting at `p` holds data, i.e. it is not
+ * blank and not a `%` comment. Leaves `p` at the first non-blank character.
+ */
+inline bool is_data_line(const char*& p, const char* end) {
+  skip_blanks(p, end);
+  return p < end && *p != '\n' && *p != '%';
+}
+
+/**
+ * @brief Parse an unsigned decimal integer.
+ *
+ * @return false if no digits were found or the value overflows 64 bits.
+ */
+inline bool parse_unsigned(const char*& p, const char* end, std::size_t& out) {
+  skip_blanks(p, end);
+  const char* start = p;
+  std::uint64_t value = 0;
+  while (p < end && is_digit(*p)) {
+    std::uint64_t digit = *p - '0';
+    if (value > (UINT64_MAX - digit) / 10)
+      return false;
+    value = value * 10 + digit;
+    ++p;
+  }
+  out = static_cast<std::size_t>(value);
+  return p != start;
+}
+
+/**
+ * @brief Parse a floating point number (`[+-]digits[.digits][(e|E)[+-]digits]`).
+ *
+ * @par Overview
+ * Uses the exact fast path (Clinger) when the decimal mantissa fits in 53 bits
+ * and the decimal exponent is within [-22, 22], which covers practically all
+ * weights found in Matrix Market files. Anything else (long mantissas, huge
+ * exponents, inf/nan) falls back to `std::strtod` on a local copy of the
+ * token, so results are always correctly rounded.
+ *
+ * @return false if the token is not a number.
+ */
+inline bool parse_double(const char*& p, const char* end, double& out) {
+  static constexpr double powers_of_ten[] = {
+      1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+      1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+  skip_blanks(p, end);
+  const char* start = p;
+
+  bool negative = false;
+  if (p < end && (*p == '-' || *p == '+'))
+    negative = (*p++ == '-');
+
+  std::uint64_t mantissa = 0;
+  int digits = 0;          // significant digits accumulated in mantissa.
+  int exponent = 0;        // decimal exponent adjustment.
+  bool any_digit = false;  // saw at least one digit in the mantissa.
+  bool exact = true;       // mantissa fits without truncation.
+
+  auto accumulate = [&](char c, bool fractional) {
+    any_digit = true;
+    if (mantissa == 0 && c == '0') {
+      if (fractional)
+        --exponent;
+      return;
+    }
+    if (digits < 19) {
+      mantissa = mantissa * 10 + (c - '0');
+      ++digits;
+      if (fractional)
+        --exponent;
+    } else {
+      exact = false;
+      if (!fractional)
+        ++exponent;
+    }
+  };
+
+  while (p < end && is_digit(*p))
+    accumulate(*p++, false);
+  if (p < end && *p == '.') {
+    ++p;
+    while (p < end && is_digit(*p))
+      accumulate(*p++, true);
+  }
+
+  if (p < end && (*p == 'e' || *p == 'E')) {
+    const char* e = p + 1;
+    bool negative_exponent = false;
+    if (e < end && (*e == '-' || *e == '+'))
+      negative_exponent = (*e++ == '-');
+    if (e < end && is_digit(*e)) {
+      int value = 0;
+      while (e < end && is_digit(*e)) {
+        if (value < 100000)
+          value = value * 10 + (*e - '0');
+        ++e;
+      }
+      exponent += negative_exponent ? -value : value;
+      p = e;
+    }
+  }
+
+  bool terminated = (p == end) || is_blank(*p) || *p == '\n';
+  if (any_digit && terminated && exact && mantissa < (std::uint64_t(1) << 53) &&
+      exponent >= -22 && exponent <= 22) {
+    double value = static_cast<double>(mantissa);
+    value = (exponent < 0) ? value / powers_of_ten[-exponent]
+                           : value * powers_of_ten[exponent];
+    out = negative ? -value : value;
+    return true;
+  }
+
+  // Slow path: hand the token to strtod.
+  const char* token_end = start;
+  while (token_end < end && !is_blank(*token_end) && *token_end != '\n')
+    ++token_end;
+  char buffer[128];
+  std::size_t length = token_end - start;
+  if (length == 0 || length >= sizeof(buffer))
+    return false;
+  std::memcpy(buffer, start, length);
+  buffer[length] = '\0';
+  char* parsed_end = nullptr;
+  out = std::strtod(buffer, &parsed_end);
+  p = token_end;
+  return parsed_end == buffer + length;
+}
+
+/**
+ * @brief Compare the first two whitespace-separated unsigned integer tokens of
+ * a line for numerical equality without converting them (leading zeros are
+ * ignored). Used to count diagonal entries ahead of parsing.
+ */
+inline bool first_two_tokens_equal(const char* p, const char* end) {
+  auto token = [&](const char*& q, std::size_t& length) -> const char* {
+    skip_blanks(q, end);
+    while (q < end && *q == '0' && (q + 1) < end && is_digit(q[1]))
+      ++q;
+    const char* s = q;
+    while (q < end && is_digit(*q))
+      ++q;
+    length = q - s;
+    return s;
+  };
+  std::size_t a_length, b_length;
+  const char* a = token(p, a_length);
+  const char* b = token(p, b_length);
+  return a_length == b_length && std::memcmp(a, b, a_length) == 0;
+}
+
+/**
+ * @brief Advance `p` to the first line that starts at or after `p`. A
+ * position already at the beginning of `[begin, end)` is considered aligned.
+ */
+inline const char* align_to_line(const char* p,
+                                 const char* begin,
+                                 const char* end) {
+  if (p <= begin)
+    return begin;
+  if (p >= end)
+    return end;
+  if (p[-1] == '\n')
+    return p;
+  skip_line(p, end);
+  return p;
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace gunrock
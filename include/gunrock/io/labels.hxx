@@ -0,0 +1,87 @@
+/**
+ * @file labels.hxx
+ * @brief Reader of labels (coordinates) files, e.g. the geolocation datasets.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <gunrock/error.hxx>
+#include <gunrock/util/type_limits.hxx>
+
+namespace gunrock {
+namespace io {
+
+/**
+ * @brief Reads the latitude and longitude of every node of a labels file.
+ *
+ * Here is an example of the labels file
+ * +-------------------------+
+ * |%%Labels Formatted File  | <-- header
+ * |% comments               | <-- comments
+ * |  N L L                  | <-- num_nodes, num_labels, num_labels
+ * |  I0 L1A L1B             | <-- node id, latitude, longitude
+ * |  I4                     | <-- coordinates missing
+ * |  . . .                  |
+ * +-------------------------+
+ *
+ * @note Node IDs are 0-based. Nodes whose line is missing or has no
+ * coordinates get invalid (NaN) coordinates.
+ *
+ * @tparam coordinates_t type with `latitude` and `longitude` members, e.g.
+ * `geo::coordinates_t`.
+ * @param filename labels file.
+ * @return std::vector<coordinates_t> coordinates of nodes 0 to N - 1.
+ */
+template <typename coordinates_t>
+std::vector<coordinates_t> read_labels(std::string const& filename) {
+  FILE* file = std::fopen(filename.c_str(), "r");
+  error::throw_if_exception(!file, "Could not open " + filename + ".");
+
+  using scalar_t = decltype(coordinates_t::latitude);
+  coordinates_t missing;
+  missing.latitude = gunrock::numeric_limits<scalar_t>::invalid();
+  missing.longitude = gunrock::numeric_limits<scalar_t>::invalid();
+
+  std::vector<coordinates_t> coordinates;
+  bool sized = false;
+  char line[1024];
+  while (std::fgets(line, sizeof(line), file)) {
+    if (line[0] == '%' || line[0] == '\n')
+      continue;
+    if (!sized) {  // Problem description: nodes and labels.
+      long long nodes = 0;
+      bool ok = std::sscanf(line, "%lld", &nodes) == 1 && nodes >= 0;
+      if (!ok)
+        std::fclose(file);
+      error::throw_if_exception(!ok, "Invalid labels file " + filename + ".");
+      coordinates.assign(nodes, missing);
+      sized = true;
+      continue;
+    }
+    long long node = -1;
+    double a = 0, b = 0;
+    int read = std::sscanf(line, "%lld %lf %lf", &node, &a, &b);
+    bool ok = (read == 1 || read == 3) && node >= 0 &&
+              node < (long long)coordinates.size();
+    if (!ok)
+      std::fclose(file);
+    error::throw_if_exception(!ok, "Invalid labels file " + filename + ".");
+    if (read == 3) {
+      coordinates[node].latitude = scalar_t(a);
+      coordinates[node].longitude = scalar_t(b);
+    }
+  }
+  std::fclose(file);
+  return coordinates;
+}
+
+}  // namespace io
+}  // namespace gunrock
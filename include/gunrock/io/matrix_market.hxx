@@ -12,14 +12,18 @@
 
 #include <string>
 #include <limits>
+#include <vector>
 
 #include <gunrock/io/detail/mmio.hxx>
+#include <gunrock/io/detail/mapped_file.hxx>
+#include <gunrock/io/detail/parse.hxx>
 
 #include <gunrock/util/filepath.hxx>
 #include <gunrock/formats/formats.hxx>
 #include <gunrock/memory.hxx>
 #include <gunrock/error.hxx>
 #include <gunrock/graph/properties.hxx>
+#include <gunrock/util/parallel.hxx>
 
 namespace gunrock {
 namespace io {
@@ -88,20 +92,203 @@ struct matrix_market_t {
   matrix_market_t() {}
   ~matrix_market_t() {}
 
+  using coo_type = format::coo_t<gunrock::memory::memory_space_t::host,
+                                 vertex_t,
+                                 edge_t,
+                                 weight_t>;
+
   /**
    * @brief Loads the given .mtx file into a coordinate format, and returns the
    * coordinate array. This needs to be further extended to support dense
    * arrays, those are the only two formats mtx are written in.
    *
+   * @par Overview
+   * The header (banner and size line) is read with mmio, the entries are then
+   * parsed from a read-only memory mapping of the file on all host threads
+   * (see `util::parallel`):
+   *  1. The body is split into line-aligned chunks, and each chunk counts its
+   * entries (and, for symmetric files, its diagonal entries, by comparing the
+   * index tokens textually).
+   *  2. An exclusive scan of those counts gives every chunk its position in
+   * the output, so each chunk parses its lines straight into the final COO
+   * arrays, writing the mirrored entry of a symmetric file right after the
+   * original one.
+   * The entry order is the same as `load_serial()`.
+   *
    * @param _filename input file name (.mtx)
    * @return coordinate sparse format
    */
-  std::tuple<gunrock::graph::graph_properties_t,
-             format::coo_t<gunrock::memory::memory_space_t::host,
-                           vertex_t,
-                           edge_t,
-                           weight_t>>
-  load(std::string _filename) {
+  std::tuple<gunrock::graph::graph_properties_t, coo_type> load(
+      std::string _filename) {
+    filename = _filename;
+    dataset = util::extract_dataset(util::extract_filename(filename));
+
+    std::size_t num_rows, num_columns, num_nonzeros;
+    auto header_size =
+        read_header(filename, &num_rows, &num_columns, &num_nonzeros);
+
+    gunrock::graph::graph_properties_t properties;
+    bool is_pattern = mm_is_pattern(code);
+    bool is_symmetric = mm_is_symmetric(code);
+
+    if (is_pattern) {
+      properties.weighted = false;
+      data = matrix_market_data_t::pattern;
+    } else if (mm_is_real(code) || mm_is_integer(code)) {
+      properties.weighted = true;
+      if (mm_is_real(code))
+        data = matrix_market_data_t::real;
+      else
+        data = matrix_market_data_t::integer;
+    } else {
+      std::cerr << "Unrecognized matrix market format type" << std::endl;
+      exit(1);
+    }
+
+    detail::mapped_file_t mapped(filename);
+    const char* body_begin = mapped.begin() + header_size;
+    const char* body_end = mapped.end();
+
+    // 1. Line-aligned chunks, sized so every thread gets a few of them.
+    struct chunk_t {
+      const char* begin;
+      const char* end;
+      std::size_t entries;    // data lines in the chunk.
+      std::size_t diagonals;  // data lines with row == column.
+      std::size_t first_entry;
+      std::size_t first_output;
+    };
+
+    constexpr std::size_t min_chunk_bytes = 1 << 20;
+    std::size_t body_size = body_end - body_begin;
+    std::size_t num_chunks = std::max<std::size_t>(
+        1, std::min(util::parallel::number_of_threads() * 8,
+                    body_size / min_chunk_bytes));
+
+    std::vector<chunk_t> chunks(num_chunks);
+    for (std::size_t c = 0; c < num_chunks; ++c) {
+      chunks[c].begin = detail::align_to_line(
+          body_begin + (body_size / num_chunks) * c, body_begin, body_end);
+    }
+    for (std::size_t c = 0; c < num_chunks; ++c)
+      chunks[c].end = (c + 1 < num_chunks) ? chunks[c + 1].begin : body_end;
+
+    util::parallel::for_each<std::size_t>(
+        0, num_chunks,
+        [&](std::size_t c) {
+          auto& chunk = chunks[c];
+          chunk.entries = 0;
+          chunk.diagonals = 0;
+          for (const char* p = chunk.begin; p < chunk.end;) {
+            const char* line = p;
+            if (detail::is_data_line(line, chunk.end)) {
+              ++chunk.entries;
+              if (is_symmetric &&
+                  detail::first_two_tokens_equal(line, chunk.end))
+                ++chunk.diagonals;
+            }
+            detail::skip_line(p, chunk.end);
+          }
+        },
+        std::size_t(1));
+
+    // 2. Exclusive scan of entry and output counts.
+    std::size_t total_entries = 0, total_output = 0;
+    for (auto& chunk : chunks) {
+      chunk.first_entry = total_entries;
+      chunk.first_output = total_output;
+      total_entries += chunk.entries;
+      total_output += is_symmetric ? (2 * chunk.entries - chunk.diagonals)
+                                   : chunk.entries;
+    }
+
+    error::throw_if_exception(total_entries < num_nonzeros,
+                              is_pattern
+                                  ? "Could not read edge from market file"
+                                  : "Could not read weighted edge from "
+                                    "market file");
+    error::throw_if_exception(total_entries > num_nonzeros,
+                              "Market file has more entries than declared");
+    error::throw_if_exception(
+        total_output >= (std::size_t)std::numeric_limits<edge_t>::max(),
+        "edge_t overflow");
+
+    coo_type coo((vertex_t)num_rows, (vertex_t)num_columns,
+                 (edge_t)total_output);
+
+    vertex_t* I = coo.row_indices.data();
+    vertex_t* J = coo.column_indices.data();
+    weight_t* V = coo.nonzero_values.data();
+
+    // 3. Parse every chunk into its slice of the output.
+    util::parallel::for_each<std::size_t>(
+        0, num_chunks,
+        [&](std::size_t c) {
+          auto& chunk = chunks[c];
+          std::size_t out = chunk.first_output;
+          for (const char* p = chunk.begin; p < chunk.end;) {
+            if (!detail::is_data_line(p, chunk.end)) {
+              detail::skip_line(p, chunk.end);
+              continue;
+            }
+
+            std::size_t row_index{0}, col_index{0};
+            double weight{1.0};  // use value 1.0 for all pattern entries.
+            bool assigned = detail::parse_unsigned(p, chunk.end, row_index) &&
+                            detail::parse_unsigned(p, chunk.end, col_index) &&
+                            (is_pattern ||
+                             detail::parse_double(p, chunk.end, weight));
+
+            error::throw_if_exception(
+                !assigned, is_pattern ? "Could not read edge from market file"
+                                      : "Could not read weighted edge from "
+                                        "market file");
+            error::throw_if_exception(row_index == 0,
+                                      "Market file is zero-indexed");
+            error::throw_if_exception(col_index == 0,
+                                      "Market file is zero-indexed");
+
+            // set and adjust from 1-based to 0-based indexing
+            I[out] = (vertex_t)row_index - 1;
+            J[out] = (vertex_t)col_index - 1;
+            V[out] = (weight_t)weight;
+            ++out;
+
+            // duplicate off diagonal entries
+            if (is_symmetric && row_index != col_index) {
+              I[out] = (vertex_t)col_index - 1;
+              J[out] = (vertex_t)row_index - 1;
+              V[out] = (weight_t)weight;
+              ++out;
+            }
+
+            detail::skip_line(p, chunk.end);
+          }
+        },
+        std::size_t(1));
+
+    if (is_symmetric) {
+      properties.symmetric = true;
+      properties.directed = false;
+      scheme = matrix_market_storage_scheme_t::symmetric;
+    } else {
+      properties.symmetric = false;
+      properties.directed = true;
+    }
+
+    return {properties, coo};
+  }
+
+  /**
+   * @brief Single-threaded `fscanf`-based loader. Produces exactly the same
+   * output as `load()`; kept as a reference implementation (and baseline for
+   * benchmarks/mtx_load_bench.cu).
+   *
+   * @param _filename input file name (.mtx)
+   * @return coordinate sparse format
+   */
+  std::tuple<gunrock::graph::graph_properties_t, coo_type> load_serial(
+      std::string _filename) {
     filename = _filename;
     dataset = util::extract_dataset(util::extract_filename(filename));
 
@@ -252,6 +439,59 @@ struct matrix_market_t {
 
     return {properties, coo};
   }
+
+ private:
+  /**
+   * @brief Read the banner and the size line, and validate them.
+   *
+   * @return std::size_t byte offset of the first entry line in the file.
+   */
+  std::size_t read_header(std::string const& _filename,
+                          std::size_t* num_rows,
+                          std::size_t* num_columns,
+                          std::size_t* num_nonzeros) {
+    file_t file;
+
+    // Load MTX information
+    if ((file = fopen(_filename.c_str(), "r")) == NULL) {
+      std::cerr << "File could not be opened: " << _filename << std::endl;
+      exit(1);
+    }
+
+    if (mm_read_banner(file, &code) != 0) {
+      std::cerr << "Could not process Matrix Market banner" << std::endl;
+      exit(1);
+    }
+
+    // Make sure we're actually reading a matrix, and not an array
+    if (mm_is_array(code)) {
+      std::cerr << "File is not a sparse matrix" << std::endl;
+      exit(1);
+    }
+
+    if ((mm_read_mtx_crd_size(file, num_rows, num_columns, num_nonzeros)) !=
+        0) {
+      std::cerr << "Could not read file info (M, N, NNZ)" << std::endl;
+      exit(1);
+    }
+
+    error::throw_if_exception(
+        *num_rows >= std::numeric_limits<vertex_t>::max() ||
+            *num_columns >= std::numeric_limits<vertex_t>::max(),
+        "vertex_t overflow");
+    error::throw_if_exception(
+        *num_nonzeros >= std::numeric_limits<edge_t>::max(),
+        "edge_t overflow");
+
+    if (mm_is_coordinate(code))
+      format = matrix_market_format_t::coordinate;
+    else
+      format = matrix_market_format_t::array;
+
+    std::size_t header_size = ftell(file);
+    fclose(file);
+    return header_size;
+  }
 };
 
 }  // namespace io
@@ -1,4 +1,6 @@
 #include <cxxopts.hpp>
+#include <gunrock/graph/reorder.hxx>
+#include <gunrock/framework/profile.hxx>
 
 namespace gunrock {
 namespace io {
@@ -13,8 +15,10 @@ struct parameters_t {
   int num_runs = 1;
   cxxopts::Options options;
   bool export_metrics = false;
+  bool profile = false;
   bool validate = false;
   bool binary = false;
+  graph::reorder::algorithm_t reorder = graph::reorder::algorithm_t::none;
 
   /**
    * @brief Construct a new parameters object and parse command line arguments.
@@ -28,13 +32,19 @@ struct parameters_t {
     options.add_options()("help", "Print help")  // help
         ("export_metrics",
          "export performance analysis metrics")  // performance evaluation
+        ("profile",
+         "Record per-iteration operator traces (exported with "
+         "--export_metrics)")  // operator profiling
         ("m,market", "Matrix file", cxxopts::value<std::string>())  // mtx file
         ("d,json_dir", "JSON output directory",
          cxxopts::value<std::string>())  // json output directory
         ("f,json_file", "JSON output file",
          cxxopts::value<std::string>())  // json output file
         ("t,tag", "Tags for the JSON output; comma-separated string of tags",
-         cxxopts::value<std::string>());  // tags
+         cxxopts::value<std::string>())  // tags
+        ("r,reorder",
+         "Vertex ordering: none, degree, rcm, hub_sort, hub_cluster or gorder",
+         cxxopts::value<std::string>());  // reorder
 
     // Algorithms with sources
     if (algorithm == "Betweenness Centrality" ||
@@ -42,14 +52,13 @@ struct parameters_t {
         algorithm == "Single Source Shortest Path" || algorithm == "DAWN") {
       options.add_options()("s,src",
                             "Source(s) (random if omitted); "
-                            "comma-separated string of ints",
+                            "comma-separated string of ints; BFS and BC run "
+                            "several sources (or runs) as one batch on the "
+                            "host",
                             cxxopts::value<std::string>())  // source
           ("n,num_runs", "Number of runs (ignored if multiple sources passed)",
-           cxxopts::value<int>());  // runs
-      if (algorithm == "Breadth First Search" ||
-          algorithm == "Single Source Shortest Path" || algorithm == "DAWN") {
-        options.add_options()("validate", "CPU validation");  // validate
-      }
+           cxxopts::value<int>())  // runs
+          ("validate", "CPU validation");  // validate
     } else {
       options.add_options()("n,num_runs", "Number of runs",
                             cxxopts::value<int>());  // runs
@@ -84,6 +93,11 @@ struct parameters_t {
       export_metrics = true;
     }
 
+    if (result.count("profile") == 1) {
+      profile = true;
+      gunrock::profile::session().enable();
+    }
+
     if (result.count("num_runs") == 1) {
       num_runs = result["num_runs"].as<int>();
     }
@@ -103,6 +117,17 @@ struct parameters_t {
     if (result.count("json_file") == 1) {
       json_file = result["json_file"].as<std::string>();
     }
+
+    if (result.count("reorder") == 1) {
+      try {
+        reorder =
+            graph::reorder::from_string(result["reorder"].as<std::string>());
+      } catch (error::exception_t const& e) {
+        std::cout << e.what() << std::endl;
+        std::cout << options.help({""}) << std::endl;
+        std::exit(0);
+      }
+    }
   }
 };
 
@@ -145,6 +170,15 @@ void parse_source_string(std::string source_str,
   }
 }
 
+/**
+ * @brief True if `source_vect` holds more than one source (repeats included);
+ * the examples then traverse all of them together as one batch (host
+ * multi-source BFS) instead of one run per source.
+ */
+bool has_multiple_sources(std::vector<int> const& source_vect) {
+  return source_vect.size() > 1;
+}
+
 void parse_tag_string(std::string tag_str, std::vector<std::string>* tag_vect) {
   std::stringstream ss(tag_str);
   while (ss.good()) {
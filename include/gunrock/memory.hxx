@@ -13,8 +13,10 @@
 #include <iostream>
 #include <memory>
 
+#include <thrust/device_malloc_allocator.h>
 #include <thrust/device_ptr.h>
 #include <gunrock/error.hxx>
+#include <gunrock/memory_pool.hxx>
 
 namespace gunrock {
 namespace memory {
@@ -32,6 +34,48 @@ namespace memory {
  */
 enum memory_space_t { device, host };
 
+/**
+ * @brief The process-wide pool of host memory (see pool_t). Never destroyed,
+ * so blocks can be returned to it until the process exits.
+ */
+inline pool_t<host_resource_t>& host_pool() {
+  static auto* pool = new pool_t<host_resource_t>();
+  return *pool;
+}
+
+/**
+ * @brief The process-wide pool of a device's memory (see pool_t). Never
+ * destroyed, so blocks can be returned to it until the process exits.
+ *
+ * @param device device ordinal.
+ */
+inline pool_t<device_resource_t>& device_pool(int device) {
+  static std::vector<pool_t<device_resource_t>*> pools = [] {
+    int count = 0;
+    if (cudaGetDeviceCount(&count) != cudaSuccess || count < 1)
+      count = 1;
+    std::vector<pool_t<device_resource_t>*> pools(count);
+    for (int d = 0; d < count; ++d)
+      pools[d] = new pool_t<device_resource_t>(device_resource_t{d});
+    return pools;
+  }();
+  return *pools[device];
+}
+
+/**
+ * @brief The pool of a memory space: host memory, or the current device.
+ */
+template <memory_space_t space>
+inline auto& pool() {
+  if constexpr (space == memory_space_t::host) {
+    return host_pool();
+  } else {
+    int device = 0;
+    cudaGetDevice(&device);
+    return device_pool(device);
+  }
+}
+
 /**
  * @brief allocate memory on defined memory space on a specific pointer.
  *
@@ -128,16 +172,26 @@ __host__ __device__ inline type_t* raw_pointer_cast(type_t* pointer) {
  */
 template <typename type_t>
 struct deleter_t {
+  /// Size of the allocator_t allocation, which goes back to the device pool;
+  /// 0 frees the memory right away.
+  std::size_t bytes = 0;
+
   /**
    * @brief Free memory on device.
    *
    * @param pointer
    */
-  void operator()(type_t* pointer) const { free(pointer); }
+  void operator()(type_t* pointer) const {
+    if (bytes)
+      pool<memory_space_t::device>().deallocate(pointer, bytes);
+    else
+      free(pointer);
+  }
 };
 
 /**
- * @brief Custom allocator supports allocation of memory on device.
+ * @brief Custom allocator supports allocation of memory on device, from the
+ * device pool; release it with `deleter_t<type_t>{bytes}`.
  *
  * @tparam type_t type of the pointer's memory to be allocated.
  */
@@ -149,7 +203,98 @@ struct allocator_t {
    * @param size size in bytes.
    * @return type_t* returns the allocated pointer.
    */
-  type_t* operator()(size_t bytes) const { allocate<type_t>(bytes); }
+  type_t* operator()(size_t bytes) const {
+    return static_cast<type_t*>(
+        pool<memory_space_t::device>().allocate(bytes));
+  }
+};
+
+/**
+ * @brief Container allocator drawing from the pool of its memory space; the
+ * default allocator of `vector_t` (see container/vector.hxx).
+ *
+ * @tparam type_t value type.
+ * @tparam space memory space.
+ */
+template <typename type_t, memory_space_t space>
+struct pool_allocator_t;
+
+template <typename type_t>
+struct pool_allocator_t<type_t, memory_space_t::host> {
+  using value_type = type_t;
+
+  template <typename other_t>
+  struct rebind {
+    using other = pool_allocator_t<other_t, memory_space_t::host>;
+  };
+
+  pool_allocator_t() = default;
+  template <typename other_t>
+  pool_allocator_t(pool_allocator_t<other_t, memory_space_t::host> const&) {}
+
+  type_t* allocate(std::size_t n) {
+    return static_cast<type_t*>(host_pool().allocate(n * sizeof(type_t)));
+  }
+
+  void deallocate(type_t* pointer, std::size_t n) {
+    host_pool().deallocate(pointer, n * sizeof(type_t));
+  }
+
+  template <typename other_t>
+  bool operator==(
+      pool_allocator_t<other_t, memory_space_t::host> const&) const {
+    return true;
+  }
+
+  template <typename other_t>
+  bool operator!=(
+      pool_allocator_t<other_t, memory_space_t::host> const&) const {
+    return false;
+  }
+};
+
+template <typename type_t>
+struct pool_allocator_t<type_t, memory_space_t::device>
+    : thrust::device_malloc_allocator<type_t> {
+  using base_t = thrust::device_malloc_allocator<type_t>;
+  using pointer = typename base_t::pointer;
+  using size_type = typename base_t::size_type;
+
+  template <typename other_t>
+  struct rebind {
+    using other = pool_allocator_t<other_t, memory_space_t::device>;
+  };
+
+  /// Device the allocator draws from: the current one when it is created.
+  /// Its blocks go back to the same pool, without asking the driver.
+  int device = 0;
+
+  pool_allocator_t() { cudaGetDevice(&device); }
+  template <typename other_t>
+  pool_allocator_t(
+      pool_allocator_t<other_t, memory_space_t::device> const& other)
+      : device(other.device) {}
+
+  pointer allocate(size_type n) {
+    return pointer(static_cast<type_t*>(
+        device_pool(device).allocate(n * sizeof(type_t))));
+  }
+
+  void deallocate(pointer p, size_type n) {
+    device_pool(device).deallocate(p.get(), n * sizeof(type_t));
+  }
+
+  template <typename other_t>
+  bool operator==(
+      pool_allocator_t<other_t, memory_space_t::device> const& other) const {
+    return device == other.device;
+  }
+
+  template <typename other_t>
+  bool operator!=(
+      pool_allocator_t<other_t, memory_space_t::device> const& other) const {
+    return device != other.device;
+  }
 };
 
 }  // namespace memory
@@ -0,0 +1,476 @@
+/**
+ * @file memory_pool.hxx
+ * @brief Size-class caching memory pool: freed blocks are kept and handed
+ * out again instead of going back to the system (or to the CUDA driver), so
+ * repeated runs and problem resets stop paying for fresh allocations.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#include <cuda_runtime_api.h>
+#include <gunrock/error.hxx>
+
+namespace gunrock {
+namespace memory {
+
+/**
+ * @brief Counters of a pool_t.
+ */
+struct pool_stats_t {
+  /// Allocations served from a cached block.
+  std::size_t hits = 0;
+  /// Allocations that went to the upstream allocator.
+  std::size_t misses = 0;
+  /// Bytes of the blocks handed out and not yet returned.
+  std::size_t in_use_bytes = 0;
+  /// Largest `in_use_bytes` since the last `reset_stats()`.
+  std::size_t high_water_bytes = 0;
+  /// Bytes of the cached (free) blocks, per-thread caches included.
+  std::size_t retained_bytes = 0;
+};
+
+namespace detail {
+
+/// Smallest block, and the alignment of host blocks.
+constexpr std::size_t min_block_bytes = 256;
+/// Size classes per doubling: a block is at most 25% larger than requested.
+constexpr std::size_t classes_per_doubling = 4;
+/// Classes up to 2^48 bytes; larger requests bypass the pool.
+constexpr std::size_t number_of_classes = 1 + (48 - 8) * classes_per_doubling;
+/// Classes small enough (up to 1 MiB) for the per-thread caches.
+constexpr std::size_t thread_cached_classes =
+    1 + (20 - 8) * classes_per_doubling;
+/// Blocks a thread keeps per class before returning them to the pool.
+constexpr std::size_t thread_cache_depth = 4;
+
+inline std::size_t floor_log2(std::size_t x) {
+  std::size_t k = 0;
+  while (x >>= 1)
+    ++k;
+  return k;
+}
+
+/// Size class of a request of `bytes`.
+inline std::size_t size_class(std::size_t bytes) {
+  if (bytes <= min_block_bytes)
+    return 0;
+  std::size_t k = floor_log2(bytes - 1);  // 2^k < bytes <= 2^(k + 1)
+  std::size_t step = std::size_t(1) << (k - 2);
+  std::size_t j = (bytes - (std::size_t(1) << k) + step - 1) / step;
+  return (k - 8) * classes_per_doubling + j;
+}
+
+/// Block size of size class `c`.
+inline std::size_t class_bytes(std::size_t c) {
+  if (c == 0)
+    return min_block_bytes;
+  std::size_t k = 8 + (c - 1) / classes_per_doubling;
+  std::size_t j = (c - 1) % classes_per_doubling + 1;
+  return (std::size_t(1) << k) + j * (std::size_t(1) << (k - 2));
+}
+
+}  // namespace detail
+
+/**
+ * @brief Upstream of host pools: aligned `operator new`.
+ */
+struct host_resource_t {
+  static constexpr bool thread_cached = true;
+  /// Nothing can still be using a host block once it is freed.
+  struct fence_t {};
+
+  void* allocate(std::size_t bytes) const {
+    return ::operator new(bytes, std::align_val_t(detail::min_block_bytes),
+                          std::nothrow);
+  }
+
+  void deallocate(void* pointer, std::size_t) const {
+    ::operator delete(pointer, std::align_val_t(detail::min_block_bytes));
+  }
+
+  fence_t release(void*) const { return {}; }
+  void acquire(fence_t) const {}
+  void discard(fence_t) const {}
+
+  [[noreturn]] void out_of_memory(std::size_t) const { throw std::bad_alloc(); }
+};
+
+/**
+ * @brief Upstream of device pools: `cudaMalloc` on one device.
+ *
+ * Cached blocks are reused in stream order, like `cudaFreeAsync()` blocks:
+ * freeing a block records an event on the device's legacy default stream,
+ * and handing it out again makes that stream wait for the event, without
+ * stalling the host. The legacy stream orders itself with the blocking
+ * streams; work on a non-blocking stream that uses a block must be ordered
+ * before the block is freed (the operators synchronize their context's
+ * stream).
+ */
+struct device_resource_t {
+  static constexpr bool thread_cached = false;
+  /// Completes once the work issued before the block was freed is done.
+  using fence_t = cudaEvent_t;
+  int device = 0;
+
+  void* allocate(std::size_t bytes) const {
+    void* pointer = nullptr;
+    on_device([&] {
+      if (cudaMalloc(&pointer, bytes) != cudaSuccess) {
+        cudaGetLastError();  // Clear the allocation error.
+        pointer = nullptr;
+      }
+    });
+    return pointer;
+  }
+
+  void deallocate(void* pointer, std::size_t) const {
+    error::throw_if_exception(cudaFree(pointer));
+  }
+
+  fence_t release(void*) const {
+    fence_t event = nullptr;
+    on_device([&] {
+      error::throw_if_exception(
+          cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+      error::throw_if_exception(cudaEventRecord(event, cudaStreamLegacy));
+    });
+    return event;
+  }
+
+  /// The event is released once it completes, even if still waited on.
+  void acquire(fence_t event) const {
+    on_device([&] {
+      error::throw_if_exception(
+          cudaStreamWaitEvent(cudaStreamLegacy, event, 0));
+    });
+    discard(event);
+  }
+
+  void discard(fence_t event) const {
+    error::throw_if_exception(cudaEventDestroy(event));
+  }
+
+  [[noreturn]] void out_of_memory(std::size_t) const {
+    error::throw_if_exception(cudaErrorMemoryAllocation,
+                              "memory pool: device out of memory.");
+    throw std::bad_alloc();
+  }
+
+ private:
+  /// Runs `op` with `device` current.
+  template <typename op_t>
+  void on_device(op_t&& op) const {
+    int current = 0;
+    cudaGetDevice(&current);
+    cudaSetDevice(device);
+    op();
+    cudaSetDevice(current);
+  }
+};
+
+/**
+ * @brief Caching allocator over size classes (four per doubling, from 256
+ * bytes): a request is rounded up to its class, served from the class's free
+ * list when possible, and the block goes back to that list when freed.
+ *
+ * @par Overview
+ * Free lists are shared under a lock; on host pools each thread also keeps
+ * up to four blocks per class of at most 1 MiB, reused without locking (one
+ * such cache per thread and pool, handed back to the pool when the thread
+ * exits, and taken back by the pool when it is destroyed). The
+ * bytes the pool keeps can be capped (`set_limit()`: blocks freed beyond the
+ * cap go upstream) or released (`trim()`), and an upstream allocation that
+ * fails is retried once after releasing everything cached. Disabling the pool
+ * (`set_enabled(false)`) sends every allocation and free upstream, which is
+ * how to compare against the plain allocator. Device blocks are reused in
+ * stream order (see device_resource_t). Use it through memory::pool(), whose
+ * pools live for the whole process.
+ *
+ * @tparam resource_t upstream allocator (host_resource_t or
+ * device_resource_t).
+ */
+template <typename resource_t>
+class pool_t {
+ public:
+  explicit pool_t(resource_t _resource = resource_t()) : resource(_resource) {}
+  pool_t(pool_t const&) = delete;
+  pool_t& operator=(pool_t const&) = delete;
+  ~pool_t() {
+    if constexpr (resource_t::thread_cached) {
+      // Takes the blocks back from every thread's cache of this pool and
+      // frees the caches for other pools.
+      std::lock_guard<std::mutex> registry(registry_mutex());
+      for (thread_cache_t* cache : caches) {
+        flush(*cache);
+        cache->owner.store(nullptr, std::memory_order_release);
+      }
+      caches.clear();
+    }
+    trim();
+  }
+
+  /**
+   * @brief Allocates a block of at least `bytes` bytes (none for 0).
+   */
+  void* allocate(std::size_t bytes) {
+    if (bytes == 0)
+      return nullptr;
+    std::size_t c = detail::size_class(bytes);
+    std::size_t block = c < detail::number_of_classes ? detail::class_bytes(c)
+                                                      : bytes;
+    void* pointer = enabled ? take(c) : nullptr;
+    if (pointer) {
+      ++hits;
+    } else {
+      ++misses;
+      pointer = resource.allocate(block);
+      if (!pointer) {
+        trim();
+        pointer = resource.allocate(block);
+      }
+      if (!pointer)
+        resource.out_of_memory(block);
+    }
+
+    std::size_t in_use = (in_use_bytes += block);
+    std::size_t peak = high_water_bytes.load();
+    while (in_use > peak &&
+           !high_water_bytes.compare_exchange_weak(peak, in_use))
+      ;
+    return pointer;
+  }
+
+  /**
+   * @brief Returns a block from `allocate(bytes)`, with the same `bytes`.
+   */
+  void deallocate(void* pointer, std::size_t bytes) {
+    if (!pointer)
+      return;
+    std::size_t c = detail::size_class(bytes);
+    std::size_t block = c < detail::number_of_classes ? detail::class_bytes(c)
+                                                      : bytes;
+    in_use_bytes -= block;
+    if (!enabled || c >= detail::number_of_classes || !reserve(block)) {
+      resource.deallocate(pointer, block);
+      return;
+    }
+
+    if constexpr (resource_t::thread_cached) {
+      thread_cache_t* cache = local_cache();
+      if (cache && c < detail::thread_cached_classes &&
+          cache->count[c] < detail::thread_cache_depth) {
+        cache->blocks[c][cache->count[c]++] = pointer;
+        return;
+      }
+    }
+    block_t cached{pointer, resource.release(pointer)};
+    std::lock_guard<std::mutex> lock(mutex);
+    free_lists[c].push_back(cached);
+  }
+
+  pool_stats_t stats() const {
+    pool_stats_t s;
+    s.hits = hits;
+    s.misses = misses;
+    s.in_use_bytes = in_use_bytes;
+    s.high_water_bytes = high_water_bytes;
+    s.retained_bytes = retained_bytes;
+    return s;
+  }
+
+  /// Zeroes the hit and miss counts; the high-water mark restarts from the
+  /// bytes in use.
+  void reset_stats() {
+    hits = 0;
+    misses = 0;
+    high_water_bytes = in_use_bytes.load();
+  }
+
+  /**
+   * @brief Releases cached blocks, largest first, until at most `keep` bytes
+   * are retained. Blocks in other threads' caches are not released.
+   */
+  void trim(std::size_t keep = 0) {
+    if constexpr (resource_t::thread_cached) {
+      if (thread_cache_t* cache = local_cache(false))
+        flush(*cache);
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    for (std::size_t c = detail::number_of_classes; c-- > 0;) {
+      auto& list = free_lists[c];
+      while (!list.empty() && retained_bytes > keep) {
+        resource.discard(list.back().fence);
+        resource.deallocate(list.back().pointer, detail::class_bytes(c));
+        retained_bytes -= detail::class_bytes(c);
+        list.pop_back();
+      }
+    }
+  }
+
+  /**
+   * @brief Caps the bytes the pool retains (default: no cap), releasing
+   * cached blocks down to the cap now.
+   */
+  void set_limit(std::size_t bytes) {
+    limit = bytes;
+    trim(bytes);
+  }
+
+  std::size_t get_limit() const { return limit; }
+
+  /**
+   * @brief Turns caching on (default) or off; off releases everything cached.
+   */
+  void set_enabled(bool _enabled) {
+    enabled = _enabled;
+    if (!enabled)
+      trim();
+  }
+
+  bool is_enabled() const { return enabled; }
+
+ private:
+  using fence_t = typename resource_t::fence_t;
+
+  /// A cached block, and the point after which it may be reused.
+  struct block_t {
+    void* pointer;
+    fence_t fence;
+  };
+
+  /// Adds `block` bytes to the retained ones unless that would exceed the
+  /// limit. Reserving first keeps concurrent frees from overshooting it.
+  bool reserve(std::size_t block) {
+    if (retained_bytes.fetch_add(block) + block <= limit)
+      return true;
+    retained_bytes.fetch_sub(block);
+    return false;
+  }
+
+  /// A thread's blocks for one pool (`owner`; `nullptr` once the pool is
+  /// gone, and the cache can serve another pool). Only host pools have
+  /// thread caches, and host blocks need no fence.
+  struct thread_cache_t {
+    std::atomic<pool_t*> owner{nullptr};
+    std::array<std::array<void*, detail::thread_cache_depth>,
+               detail::thread_cached_classes>
+        blocks;
+    std::array<std::size_t, detail::thread_cached_classes> count{};
+  };
+
+  /// A thread's caches, one per pool it has used; on thread exit, their
+  /// blocks go back to the pools still alive.
+  struct thread_caches_t {
+    std::vector<std::unique_ptr<thread_cache_t>> caches;
+
+    ~thread_caches_t() {
+      std::lock_guard<std::mutex> registry(registry_mutex());
+      for (auto& cache : caches) {
+        if (pool_t* owner = cache->owner.load(std::memory_order_relaxed)) {
+          owner->flush(*cache);
+          auto& list = owner->caches;
+          list.erase(std::find(list.begin(), list.end(), cache.get()));
+        }
+      }
+    }
+  };
+
+  /// Guards the owners of the thread caches of all the pools of this
+  /// resource type (taken before a pool's `mutex`). Never destroyed, as
+  /// threads may exit during static destruction.
+  static std::mutex& registry_mutex() {
+    static auto* registry = new std::mutex();
+    return *registry;
+  }
+
+  /// The calling thread's cache for this pool, created (or taken over from a
+  /// destroyed pool) on first use when `claim`, else `nullptr`.
+  thread_cache_t* local_cache(bool claim = true) {
+    thread_local thread_caches_t local;
+    thread_cache_t* vacant = nullptr;
+    for (auto& cache : local.caches) {
+      pool_t* owner = cache->owner.load(std::memory_order_acquire);
+      if (owner == this)
+        return cache.get();
+      if (!owner && !vacant)
+        vacant = cache.get();
+    }
+    if (!claim)
+      return nullptr;
+    if (!vacant) {
+      local.caches.push_back(std::make_unique<thread_cache_t>());
+      vacant = local.caches.back().get();
+    }
+    std::lock_guard<std::mutex> registry(registry_mutex());
+    caches.push_back(vacant);
+    vacant->owner.store(this, std::memory_order_release);
+    return vacant;
+  }
+
+  /// Moves a thread's cached blocks to the shared free lists.
+  void flush(thread_cache_t& cache) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (std::size_t c = 0; c < detail::thread_cached_classes; ++c) {
+      for (std::size_t i = 0; i < cache.count[c]; ++i)
+        free_lists[c].push_back({cache.blocks[c][i], fence_t()});
+      cache.count[c] = 0;
+    }
+  }
+
+  /// A cached block of class `c`, or `nullptr`.
+  void* take(std::size_t c) {
+    if (c >= detail::number_of_classes)
+      return nullptr;
+    void* pointer = nullptr;
+    if constexpr (resource_t::thread_cached) {
+      thread_cache_t* cache = local_cache();
+      if (cache && c < detail::thread_cached_classes && cache->count[c] > 0)
+        pointer = cache->blocks[c][--cache->count[c]];
+    }
+    if (!pointer) {
+      block_t cached{nullptr, fence_t()};
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!free_lists[c].empty()) {
+          cached = free_lists[c].back();
+          free_lists[c].pop_back();
+        }
+      }
+      if (cached.pointer)
+        resource.acquire(cached.fence);
+      pointer = cached.pointer;
+    }
+    if (pointer)
+      retained_bytes -= detail::class_bytes(c);
+    return pointer;
+  }
+
+  resource_t resource;
+  std::mutex mutex;
+  std::array<std::vector<block_t>, detail::number_of_classes> free_lists;
+  std::atomic<bool> enabled{true};
+  std::atomic<std::size_t> limit{~std::size_t(0)};
+  std::atomic<std::size_t> hits{0};
+  std::atomic<std::size_t> misses{0};
+  std::atomic<std::size_t> in_use_bytes{0};
+  std::atomic<std::size_t> high_water_bytes{0};
+  std::atomic<std::size_t> retained_bytes{0};
+  /// Thread caches owned by this pool (under `registry_mutex()`).
+  std::vector<thread_cache_t*> caches;
+};
+
+}  // namespace memory
+}  // namespace gunrock
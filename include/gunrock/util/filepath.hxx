@@ -2,6 +2,8 @@
 
 #include <string>
 
+#include <gunrock/io/binary.hxx>
+
 namespace gunrock {
 namespace util {
 
@@ -20,8 +22,14 @@ static bool is_market(std::string filename) {
           (filename.substr(filename.size() - 5) == ".mmio"));
 }
 
+/**
+ * @brief A binary graph (see io/binary.hxx) is recognized by its `.csr`
+ * extension or, for any other name, by the magic at the start of the file.
+ */
 static bool is_binary_csr(std::string filename) {
-  return filename.substr(filename.size() - 4) == ".csr";
+  return (filename.size() >= 4 &&
+          filename.substr(filename.size() - 4) == ".csr") ||
+         io::binary::is_binary(filename);
 }
 
 }  // namespace util
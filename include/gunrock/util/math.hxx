@@ -10,6 +10,7 @@
 #include <cmath>
 #include <cstdlib>
 #include <functional>
+#include <type_traits>
 
 #include <gunrock/cuda/atomic_functions.hxx>
 
@@ -74,15 +75,34 @@ constexpr const type_t& min(const type_t& a, const type_t& b) {
  */
 namespace atomic {
 
+/**
+ * @brief Host-side atomics use the GCC/Clang `__atomic` builtins with relaxed
+ * ordering (the same guarantees as CUDA's atomics); operations the hardware
+ * lacks (e.g. floating-point add/min/max) are compare-and-swap loops.
+ */
+namespace host {
+template <typename type_t, typename update_t>
+type_t fetch_update(type_t* address, update_t update) {
+  type_t old_value;
+  __atomic_load(address, &old_value, __ATOMIC_RELAXED);
+  type_t new_value = update(old_value);
+  while (!__atomic_compare_exchange(address, &old_value, &new_value, true,
+                                    __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    new_value = update(old_value);
+  return old_value;
+}
+}  // namespace host
+
 template <typename type_t>
 __host__ __device__ __forceinline__ type_t add(type_t* address, type_t value) {
 #ifdef __CUDA_ARCH__
   return atomicAdd(address, value);
 #else
-  // use std::atomic::fetch_add();
-  auto old_value = *address;
-  *address += value;
-  return old_value;
+  if constexpr (std::is_integral_v<type_t>)
+    return __atomic_fetch_add(address, value, __ATOMIC_RELAXED);
+  else
+    return host::fetch_update(address,
+                              [value](type_t old) { return old + value; });
 #endif
 }
 
@@ -91,7 +111,13 @@ __host__ __device__ __forceinline__ type_t min(type_t* address, type_t value) {
 #ifdef __CUDA_ARCH__
   return gcuda::atomicMin(address, value);
 #else
-  return std::min<type_t>(*address, value);  // use std::atomic;
+  type_t old_value;
+  __atomic_load(address, &old_value, __ATOMIC_RELAXED);
+  while (value < old_value &&
+         !__atomic_compare_exchange(address, &old_value, &value, true,
+                                    __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    ;
+  return old_value;
 #endif
 }
 
@@ -100,7 +126,13 @@ __host__ __device__ __forceinline__ type_t max(type_t* address, type_t value) {
 #ifdef __CUDA_ARCH__
   return gcuda::atomicMax(address, value);
 #else
-  return std::max<type_t>(*address, value);  // use std::atomic;
+  type_t old_value;
+  __atomic_load(address, &old_value, __ATOMIC_RELAXED);
+  while (old_value < value &&
+         !__atomic_compare_exchange(address, &old_value, &value, true,
+                                    __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    ;
+  return old_value;
 #endif
 }
 
@@ -111,9 +143,9 @@ __host__ __device__ __forceinline__ type_t cas(type_t* address,
 #ifdef __CUDA_ARCH__
   return atomicCAS(address, compare, value);
 #else
-  type_t old = *address;
-  *address = (old == compare) ? value : old;  // use std::atomic;
-  return old;
+  __atomic_compare_exchange(address, &compare, &value, false,
+                            __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+  return compare;  // holds the previous value either way.
 #endif
 }
 
@@ -122,9 +154,9 @@ __host__ __device__ __forceinline__ type_t exch(type_t* address, type_t value) {
 #ifdef __CUDA_ARCH__
   return atomicExch(address, value);
 #else
-  type_t old = *address;
-  *address = value;  // use std::atomic;
-  return old;
+  type_t old_value;
+  __atomic_exchange(address, &value, &old_value, __ATOMIC_RELAXED);
+  return old_value;
 #endif
 }
 
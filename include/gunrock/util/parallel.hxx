@@ -0,0 +1,370 @@
+/**
+ * @file parallel.hxx
+ * @brief Host-side (CPU) parallel execution helpers built on a persistent,
+ * work-stealing thread pool (see util/thread_pool.hxx).
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <gunrock/util/thread_pool.hxx>
+
+namespace gunrock {
+namespace util {
+namespace parallel {
+
+namespace detail {
+inline std::size_t& requested_threads() {
+  static std::size_t n = 0;  // 0 = use all hardware threads.
+  return n;
+}
+
+/**
+ * @brief A range of chunk ids `[begin, end)` owned by one thread. The owner
+ * takes chunks from the front, idle threads steal from the back. Both ends are
+ * packed into one 64-bit word so that either side is a single CAS.
+ */
+struct alignas(64) work_range_t {
+  std::atomic<std::uint64_t> range{0};
+
+  static constexpr std::uint64_t pack(std::uint64_t b, std::uint64_t e) {
+    return (b << 32) | e;
+  }
+
+  void assign(std::uint64_t b, std::uint64_t e) {
+    range.store(pack(b, e), std::memory_order_relaxed);
+  }
+
+  bool pop_front(std::size_t& chunk) {
+    auto r = range.load(std::memory_order_relaxed);
+    for (;;) {
+      std::uint64_t b = r >> 32, e = r & 0xffffffffu;
+      if (b >= e)
+        return false;
+      if (range.compare_exchange_weak(r, pack(b + 1, e),
+                                      std::memory_order_relaxed)) {
+        chunk = b;
+        return true;
+      }
+    }
+  }
+
+  bool pop_back(std::size_t& chunk) {
+    auto r = range.load(std::memory_order_relaxed);
+    for (;;) {
+      std::uint64_t b = r >> 32, e = r & 0xffffffffu;
+      if (b >= e)
+        return false;
+      if (range.compare_exchange_weak(r, pack(b, e - 1),
+                                      std::memory_order_relaxed)) {
+        chunk = e - 1;
+        return true;
+      }
+    }
+  }
+};
+}  // namespace detail
+
+/**
+ * @brief Number of host threads used by the parallel helpers.
+ *
+ * @return std::size_t number of threads (always >= 1).
+ */
+inline std::size_t number_of_threads() {
+  auto n = detail::requested_threads();
+  if (n == 0)
+    n = std::thread::hardware_concurrency();
+  return std::max<std::size_t>(n, 1);
+}
+
+/**
+ * @brief Override the number of host threads, 0 restores the default (all
+ * hardware threads).
+ *
+ * @param n number of threads.
+ */
+inline void set_number_of_threads(std::size_t n) {
+  detail::requested_threads() = n;
+}
+
+/**
+ * @brief Run `op(thread_id, num_threads)` once on each of `num_threads`
+ * threads and wait for all of them. The calling thread participates as thread
+ * 0. The first exception thrown by any thread is rethrown on the caller.
+ *
+ * @tparam func_t type of the operator.
+ * @param op operator to run on every thread.
+ * @param num_threads number of threads (default = `number_of_threads()`).
+ */
+template <typename func_t>
+void for_each_thread(func_t op, std::size_t num_threads = number_of_threads()) {
+  thread_pool_t::get().run(op, std::max<std::size_t>(num_threads, 1));
+}
+
+/**
+ * @brief Process chunks `0 .. num_chunks - 1` on the pool with work stealing,
+ * calling `op(thread_id, chunk)`. Each thread starts with a contiguous block
+ * of chunks (good locality for the common, balanced case) and, once it runs
+ * dry, steals chunks one at a time from the back of the other threads' blocks.
+ *
+ * @tparam func_t type of the operator.
+ * @param num_chunks number of chunks.
+ * @param op operator to call on each chunk.
+ * @return std::size_t number of threads that participated.
+ */
+template <typename func_t>
+std::size_t for_each_chunk_id(std::size_t num_chunks, func_t op) {
+  std::size_t num_threads = std::min(number_of_threads(), num_chunks);
+  if (num_threads <= 1 || thread_pool_t::is_worker()) {
+    for (std::size_t c = 0; c < num_chunks; ++c)
+      op(std::size_t(0), c);
+    return 1;
+  }
+
+  std::vector<detail::work_range_t> ranges(num_threads);
+  for (std::size_t t = 0; t < num_threads; ++t)
+    ranges[t].assign(num_chunks * t / num_threads,
+                     num_chunks * (t + 1) / num_threads);
+
+  for_each_thread(
+      [&](std::size_t tid, std::size_t nthreads) {
+        std::size_t c;
+        while (ranges[tid].pop_front(c))
+          op(tid, c);
+        for (std::size_t i = 1; i < nthreads; ++i) {
+          auto& victim = ranges[(tid + i) % nthreads];
+          while (victim.pop_back(c))
+            op(tid, c);
+        }
+      },
+      num_threads);
+  return num_threads;
+}
+
+/**
+ * @brief Parallel loop over `[begin, end)`, split into `grain`-sized chunks
+ * that are balanced across threads with work stealing. `op` is called as
+ * `op(chunk_begin, chunk_end)`.
+ *
+ * @tparam index_t index type.
+ * @tparam func_t type of the operator.
+ * @param begin first index.
+ * @param end one past the last index.
+ * @param op operator to call on each chunk.
+ * @param grain number of indices per chunk.
+ */
+template <typename index_t, typename func_t>
+void for_each_chunk(index_t begin, index_t end, func_t op, index_t grain = 1) {
+  if (end <= begin)
+    return;
+  std::uint64_t length = end - begin;
+  std::uint64_t g = std::max<std::uint64_t>(grain, 1);
+  // Chunk ids must fit in 32 bits (see work_range_t).
+  g = std::max<std::uint64_t>(g, (length + 0xfffffffeu) / 0xffffffffu);
+  std::size_t num_chunks = (length + g - 1) / g;
+
+  for_each_chunk_id(num_chunks, [&](std::size_t, std::size_t c) {
+    index_t chunk_begin = begin + (index_t)(c * g);
+    index_t chunk_end = (c + 1 == num_chunks) ? end : (index_t)(chunk_begin + g);
+    op(chunk_begin, chunk_end);
+  });
+}
+
+/**
+ * @brief Parallel loop over `[begin, end)`, calling `op(i)` for every index.
+ *
+ * @tparam index_t index type.
+ * @tparam func_t type of the operator.
+ * @param begin first index.
+ * @param end one past the last index.
+ * @param op operator to call on each index.
+ * @param grain number of indices per chunk (default = 1024).
+ */
+template <typename index_t, typename func_t>
+void for_each(index_t begin, index_t end, func_t op, index_t grain = 1024) {
+  for_each_chunk(
+      begin, end,
+      [&](index_t chunk_begin, index_t chunk_end) {
+        for (index_t i = chunk_begin; i < chunk_end; ++i)
+          op(i);
+      },
+      grain);
+}
+
+/**
+ * @brief Parallel exclusive scan of `op(i)` for `i` in `[0, n)` into
+ * `output[0 .. n]`; `output[n]` receives the total, which is also returned.
+ *
+ * @tparam type_t value type of the scan.
+ * @tparam func_t type of the operator.
+ * @param n number of items.
+ * @param op unary operator producing the item at index `i`.
+ * @param output output array of at least `n + 1` elements.
+ * @return type_t sum of all items.
+ */
+template <typename type_t, typename func_t>
+type_t transform_exclusive_scan(std::size_t n, func_t op, type_t* output) {
+  constexpr std::size_t block = 1 << 14;
+  std::size_t num_blocks = (n + block - 1) / block;
+  if (num_blocks <= 1 || number_of_threads() == 1) {
+    type_t sum = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+      output[i] = sum;
+      sum += op(i);
+    }
+    output[n] = sum;
+    return sum;
+  }
+
+  // Upsweep: local scans; downsweep: add block offsets.
+  std::vector<type_t> block_sums(num_blocks + 1, 0);
+  for_each_chunk_id(num_blocks, [&](std::size_t, std::size_t b) {
+    std::size_t first = b * block, last = std::min(n, first + block);
+    type_t sum = 0;
+    for (std::size_t i = first; i < last; ++i) {
+      output[i] = sum;
+      sum += op(i);
+    }
+    block_sums[b + 1] = sum;
+  });
+  for (std::size_t b = 0; b < num_blocks; ++b)
+    block_sums[b + 1] += block_sums[b];
+  for_each_chunk_id(num_blocks, [&](std::size_t, std::size_t b) {
+    if (b == 0)
+      return;
+    std::size_t first = b * block, last = std::min(n, first + block);
+    for (std::size_t i = first; i < last; ++i)
+      output[i] += block_sums[b];
+  });
+  output[n] = block_sums[num_blocks];
+  return output[n];
+}
+
+/**
+ * @brief Parallel loop whose chunks produce a variable number of outputs.
+ *
+ * @par Overview
+ * Each chunk appends its outputs to the running thread's local buffer (no
+ * sharing, no atomics). Once every chunk has run, `allocate(total)` is called
+ * for the destination and the buffers are copied out in chunk order, so the
+ * result is the same as a sequential loop regardless of the thread count.
+ *
+ * @tparam type_t output element type.
+ * @tparam index_t index type.
+ * @tparam func_t chunk operator, `op(chunk_begin, chunk_end, std::vector<type_t>&)`.
+ * @tparam allocate_t `type_t* allocate(std::size_t total)`.
+ * @param begin first index.
+ * @param end one past the last index.
+ * @param op operator to call on each chunk.
+ * @param allocate returns a destination with room for `total` elements.
+ * @param grain number of indices per chunk.
+ * @return std::size_t total number of outputs.
+ */
+template <typename type_t, typename index_t, typename func_t, typename allocate_t>
+std::size_t collect(index_t begin,
+                    index_t end,
+                    func_t op,
+                    allocate_t allocate,
+                    index_t grain) {
+  struct record_t {
+    std::size_t thread;
+    std::size_t offset;
+    std::size_t count;
+  };
+
+  if (end <= begin) {
+    allocate(0);
+    return 0;
+  }
+
+  std::size_t length = end - begin;
+  std::size_t g = std::max<std::size_t>(grain, 1);
+  std::size_t num_chunks = (length + g - 1) / g;
+  std::vector<record_t> records(num_chunks);
+  std::vector<std::vector<type_t>> locals(
+      std::min(number_of_threads(), num_chunks));
+
+  for_each_chunk_id(num_chunks, [&](std::size_t tid, std::size_t c) {
+    auto& local = locals[tid];
+    std::size_t offset = local.size();
+    index_t chunk_begin = begin + (index_t)(c * g);
+    index_t chunk_end =
+        (c + 1 == num_chunks) ? end : (index_t)(chunk_begin + g);
+    op(chunk_begin, chunk_end, local);
+    records[c] = {tid, offset, local.size() - offset};
+  });
+
+  std::vector<std::size_t> positions(num_chunks + 1);
+  std::size_t total = transform_exclusive_scan<std::size_t>(
+      num_chunks, [&](std::size_t c) { return records[c].count; },
+      positions.data());
+
+  type_t* output = allocate(total);
+  for_each_chunk_id(num_chunks, [&](std::size_t, std::size_t c) {
+    auto const& r = records[c];
+    std::copy_n(locals[r.thread].data() + r.offset, r.count,
+                output + positions[c]);
+  });
+  return total;
+}
+
+/**
+ * @brief Parallel sort: sorts `number_of_threads()` blocks independently and
+ * merges them pairwise in parallel rounds.
+ *
+ * @tparam iterator_t random access iterator.
+ * @tparam compare_t comparator.
+ * @param first begin of the range.
+ * @param last end of the range.
+ * @param comp comparator (default = `std::less`).
+ */
+template <typename iterator_t,
+          typename compare_t =
+              std::less<typename std::iterator_traits<iterator_t>::value_type>>
+void sort(iterator_t first, iterator_t last, compare_t comp = compare_t()) {
+  std::size_t n = std::distance(first, last);
+  std::size_t num_blocks = std::min(number_of_threads(), n / (1 << 14));
+  if (num_blocks <= 1) {
+    std::sort(first, last, comp);
+    return;
+  }
+
+  std::vector<std::size_t> bounds(num_blocks + 1);
+  for (std::size_t b = 0; b <= num_blocks; ++b)
+    bounds[b] = n * b / num_blocks;
+
+  for_each_chunk_id(num_blocks, [&](std::size_t, std::size_t b) {
+    std::sort(first + bounds[b], first + bounds[b + 1], comp);
+  });
+
+  for (std::size_t width = 1; width < num_blocks; width *= 2) {
+    std::size_t num_merges = (num_blocks + 2 * width - 1) / (2 * width);
+    for_each_chunk_id(num_merges, [&](std::size_t, std::size_t m) {
+      std::size_t lo = m * 2 * width;
+      std::size_t mid = std::min(lo + width, num_blocks);
+      std::size_t hi = std::min(lo + 2 * width, num_blocks);
+      if (mid < hi)
+        std::inplace_merge(first + bounds[lo], first + bounds[mid],
+                           first + bounds[hi], comp);
+    });
+  }
+}
+
+}  // namespace parallel
+}  // namespace util
+}  // namespace gunrock
@@ -12,6 +12,7 @@
 #include <gunrock/cuda/device_properties.hxx>
 #include <gunrock/util/compiler.hxx>
 #include <gunrock/io/git.hxx>
+#include <gunrock/framework/profile.hxx>
 
 namespace gunrock {
 namespace util {
@@ -21,7 +22,7 @@ using vertex_t = int;
 using edge_t = int;
 
 // Date JSON schema was last updated
-std::string schema_version = "2022-10-28";
+std::string schema_version = "2026-10-17";
 
 class system_info_t {
  private:
@@ -79,6 +80,37 @@ void get_gpu_info(nlohmann::json* jsn) {
   jsn->push_back(nlohmann::json::object_t::value_type("gpuinfo", gpuinfo));
 }
 
+/**
+ * @brief Adds the operator trace (`--profile`) as a "profile" object: one
+ * entry per operator call or loop iteration, and the total time per operator.
+ */
+void get_profile_info(nlohmann::json* jsn, profile::trace_t const& trace) {
+  auto records = trace.records();
+  if (records.empty())
+    return;
+
+  nlohmann::json iterations = nlohmann::json::array();
+  std::map<std::string, double> total_times;
+  for (auto const& r : records) {
+    iterations.push_back({{"run", r.run},
+                          {"iteration", r.iteration},
+                          {"operator", profile::name(r.op)},
+                          {"thread", r.thread},
+                          {"input_size", r.input_size},
+                          {"output_size", r.output_size},
+                          {"edges", r.edges},
+                          {"start_us", r.start},
+                          {"time_us", r.duration}});
+    total_times[profile::name(r.op)] += r.duration;
+  }
+
+  nlohmann::json profile_info;
+  profile_info["iterations"] = iterations;
+  profile_info["total_time_us"] = total_times;
+  profile_info["dropped"] = trace.dropped();
+  jsn->push_back(nlohmann::json::object_t::value_type("profile", profile_info));
+}
+
 void export_performance_stats(
     std::vector<benchmark::host_benchmark_t>& benchmark_metrics,
     size_t edges,
@@ -258,6 +290,9 @@ void export_performance_stats(
   system_info_t sys;
   sys.get_sys_info(&jsn);
 
+  // Get operator trace
+  get_profile_info(&jsn, profile::session());
+
   // Write JSON to file
   if (json_file == "") {
     std::string time_str_filename = time_s.substr(0, time_s.size() - 4) +
@@ -280,6 +315,15 @@ void export_performance_stats(
   std::ofstream outfile(json_dir_file);
   outfile << jsn.dump(4);
   outfile.close();
+
+  // Operator trace, also as a Chrome trace-event file next to the JSON
+  if (!profile::session().records().empty()) {
+    std::string trace_file = json_dir_file;
+    if (trace_file.size() >= 5 &&
+        trace_file.compare(trace_file.size() - 5, 5, ".json") == 0)
+      trace_file.resize(trace_file.size() - 5);
+    profile::session().write_chrome_trace(trace_file + ".trace.json");
+  }
 }
 
 }  // namespace stats
@@ -0,0 +1,188 @@
+/**
+ * @file thread_pool.hxx
+ * @brief Persistent pool of host worker threads used by the host (CPU)
+ * execution path. See util/parallel.hxx for the loops built on top of it.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace gunrock {
+namespace util {
+
+/**
+ * @brief A fixed set of worker threads that sleep between parallel regions.
+ *
+ * @par Overview
+ * `run(op, n)` executes `op(thread_id, n)` on `n` threads: the caller acts as
+ * thread 0 and `n - 1` pooled workers take ids `1 .. n - 1`. Workers are
+ * created lazily the first time more threads are requested, so the cost of a
+ * parallel region is a wake-up instead of thread creation. Calling `run()`
+ * from inside a parallel region executes the nested region on the calling
+ * thread only (`op(0, 1)`), which keeps nested loops correct and avoids
+ * oversubscription.
+ */
+class thread_pool_t {
+ public:
+  thread_pool_t() : invoke(nullptr), context(nullptr) {}
+
+  ~thread_pool_t() {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stopping = true;
+    }
+    wake.notify_all();
+    for (auto& worker : workers)
+      worker.join();
+  }
+
+  thread_pool_t(thread_pool_t const&) = delete;
+  thread_pool_t& operator=(thread_pool_t const&) = delete;
+
+  /**
+   * @brief Process-wide pool shared by all host operators.
+   */
+  static thread_pool_t& get() {
+    static thread_pool_t pool;
+    return pool;
+  }
+
+  /**
+   * @brief True when called from within a parallel region of any pool.
+   */
+  static bool is_worker() { return inside_region(); }
+
+  /**
+   * @brief Number of pooled worker threads (excluding callers).
+   */
+  std::size_t size() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return workers.size();
+  }
+
+  /**
+   * @brief Run `op(thread_id, num_threads)` on `num_threads` threads and wait
+   * for all of them. The first exception thrown is rethrown on the caller.
+   */
+  template <typename func_t>
+  void run(func_t& op, std::size_t num_threads) {
+    if (num_threads <= 1 || inside_region()) {
+      region_guard_t guard;
+      op(std::size_t(0), std::size_t(1));
+      return;
+    }
+
+    // One parallel region at a time; concurrent callers queue up here.
+    std::lock_guard<std::mutex> submit(submit_mutex);
+    grow(num_threads - 1);
+
+    struct job_t {
+      func_t* op;
+      std::size_t num_threads;
+    } job{&op, num_threads};
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      invoke = [](void* ctx, std::size_t tid) {
+        auto j = static_cast<job_t*>(ctx);
+        (*j->op)(tid, j->num_threads);
+      };
+      context = &job;
+      participants = num_threads - 1;
+      pending = num_threads - 1;
+      error = nullptr;
+      ++generation;
+    }
+    wake.notify_all();
+
+    execute(0);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    done.wait(lock, [this] { return pending == 0; });
+    invoke = nullptr;
+    context = nullptr;
+    participants = 0;
+    if (error)
+      std::rethrow_exception(std::exchange(error, nullptr));
+  }
+
+ private:
+  struct region_guard_t {
+    bool previous;
+    region_guard_t() : previous(inside_region()) { inside_region() = true; }
+    ~region_guard_t() { inside_region() = previous; }
+  };
+
+  static bool& inside_region() {
+    static thread_local bool flag = false;
+    return flag;
+  }
+
+  void grow(std::size_t num_workers) {
+    std::lock_guard<std::mutex> lock(mutex);
+    while (workers.size() < num_workers) {
+      std::size_t index = workers.size();
+      workers.emplace_back([this, index] { worker(index); });
+    }
+  }
+
+  void execute(std::size_t tid) {
+    region_guard_t guard;
+    try {
+      invoke(context, tid);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (!error)
+        error = std::current_exception();
+    }
+  }
+
+  void worker(std::size_t index) {
+    std::size_t seen = 0;
+    for (;;) {
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        wake.wait(lock, [&] {
+          return stopping || (generation != seen && index < participants);
+        });
+        if (stopping)
+          return;
+        seen = generation;
+      }
+
+      execute(index + 1);
+
+      std::lock_guard<std::mutex> lock(mutex);
+      if (--pending == 0)
+        done.notify_all();
+    }
+  }
+
+  mutable std::mutex mutex;
+  std::mutex submit_mutex;
+  std::condition_variable wake;
+  std::condition_variable done;
+  std::vector<std::thread> workers;
+
+  void (*invoke)(void*, std::size_t);
+  void* context;
+  std::size_t participants = 0;
+  std::size_t pending = 0;
+  std::size_t generation = 0;
+  std::exception_ptr error = nullptr;
+  bool stopping = false;
+};
+
+}  // namespace util
+}  // namespace gunrock
@@ -0,0 +1,154 @@
+/**
+ * @file generate_graphs.cuh
+ * @brief Unit test for the synthetic graph generators.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <gunrock/algorithms/algorithms.hxx>
+#include <gunrock/algorithms/generate/graphs.hxx>
+#include <gunrock/util/parallel.hxx>
+
+#include <gtest/gtest.h>
+
+TEST(algorithm, generate_graphs) {
+  using namespace gunrock;
+  using namespace memory;
+  using vertex_t = int;
+  using edge_t = int;
+  using weight_t = float;
+  using csr_t = format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t>;
+  using coo_t = format::coo_t<memory_space_t::host, vertex_t, edge_t, weight_t>;
+  namespace gen = generate::graphs;
+
+  // Simple graph: sorted rows, no self-loops or parallel edges, and every
+  // edge mirrored with the same weight when undirected.
+  auto check_simple = [](csr_t const& csr, bool symmetric) {
+    for (vertex_t u = 0; u < csr.number_of_rows; ++u) {
+      for (edge_t e = csr.row_offsets[u]; e < csr.row_offsets[u + 1]; ++e) {
+        vertex_t v = csr.column_indices[e];
+        EXPECT_NE(u, v);
+        if (e > csr.row_offsets[u])
+          EXPECT_LT(csr.column_indices[e - 1], v);
+        if (!symmetric)
+          continue;
+        auto first = csr.column_indices.begin() + csr.row_offsets[v];
+        auto last = csr.column_indices.begin() + csr.row_offsets[v + 1];
+        auto mirror = std::lower_bound(first, last, u);
+        ASSERT_TRUE(mirror != last && *mirror == u);
+        EXPECT_EQ(csr.nonzero_values[mirror - csr.column_indices.begin()],
+                  csr.nonzero_values[e]);
+      }
+    }
+  };
+
+  // R-MAT: same graph for any number of threads, another one for another
+  // seed; the raw stream has exactly edge_factor * 2^scale edges.
+  gen::rmat_t<vertex_t, weight_t> rmat;
+  rmat.scale = 10;
+  rmat.edge_factor = 8;
+  rmat.min_weight = 1;
+  rmat.max_weight = 4;
+
+  csr_t expected;
+  coo_t expected_coo;
+  util::parallel::set_number_of_threads(1);
+  auto properties = gen::to_csr(rmat, expected);
+  gen::to_coo(rmat, expected_coo);
+  EXPECT_TRUE(properties.symmetric);
+  EXPECT_EQ(expected.number_of_rows, 1 << 10);
+  EXPECT_EQ(expected_coo.number_of_nonzeros, 8 << 10);
+  check_simple(expected, true);
+
+  util::parallel::set_number_of_threads(4);
+  csr_t csr;
+  coo_t coo;
+  gen::to_csr(rmat, csr);
+  gen::to_coo(rmat, coo);
+  EXPECT_EQ(csr.row_offsets, expected.row_offsets);
+  EXPECT_EQ(csr.column_indices, expected.column_indices);
+  EXPECT_EQ(csr.nonzero_values, expected.nonzero_values);
+  EXPECT_EQ(coo.row_indices, expected_coo.row_indices);
+  EXPECT_EQ(coo.column_indices, expected_coo.column_indices);
+
+  rmat.seed = 2;
+  gen::to_csr(rmat, csr);
+  EXPECT_NE(csr.column_indices, expected.column_indices);
+
+  // Skewed degrees: the largest is far above the average.
+  edge_t max_degree = 0;
+  for (vertex_t v = 0; v < expected.number_of_rows; ++v)
+    max_degree = std::max(
+        max_degree, expected.row_offsets[v + 1] - expected.row_offsets[v]);
+  EXPECT_GT(max_degree, 8 * expected.number_of_nonzeros / (1 << 10));
+
+  // G(n, p): complete graph for p = 1, about p * n * (n - 1) edges otherwise.
+  gen::gnp_t<vertex_t, weight_t> gnp;
+  gnp.n = 20;
+  gnp.p = 1;
+  gen::to_csr(gnp, csr);
+  EXPECT_EQ(csr.number_of_nonzeros, 20 * 19);
+  gnp.directed = true;
+  properties = gen::to_csr(gnp, csr);
+  EXPECT_FALSE(properties.symmetric);
+  EXPECT_EQ(csr.number_of_nonzeros, 20 * 19);
+
+  gnp.n = 2000;
+  gnp.p = 0.01;
+  gnp.directed = false;
+  gen::to_csr(gnp, csr);
+  check_simple(csr, true);
+  double expected_edges = 0.01 * 2000 * 1999;
+  EXPECT_NEAR(csr.number_of_nonzeros, expected_edges, 0.05 * expected_edges);
+
+  // G(n, m): m raw edges, few of them merged.
+  gen::gnm_t<vertex_t, weight_t> gnm;
+  gnm.n = 1000;
+  gnm.m = 5000;
+  gen::to_coo(gnm, coo);
+  EXPECT_EQ(coo.number_of_nonzeros, 5000);
+  gen::to_csr(gnm, csr);
+  check_simple(csr, true);
+  EXPECT_LE(csr.number_of_nonzeros, 2 * 5000);
+  EXPECT_GE(csr.number_of_nonzeros, 2 * 4900);
+
+  // Grid: 4-neighbor (8 with the diagonals) mesh; road-like sparsification
+  // keeps a subset of its edges with the same weights.
+  gen::grid_t<vertex_t, weight_t> grid;
+  grid.rows = 7;
+  grid.columns = 10;
+  grid.min_weight = 1;
+  grid.max_weight = 100;
+  csr_t mesh;
+  gen::to_csr(grid, mesh);
+  check_simple(mesh, true);
+  EXPECT_EQ(mesh.number_of_nonzeros, 2 * (7 * 9 + 6 * 10));
+  for (weight_t w : mesh.nonzero_values) {
+    EXPECT_GE(w, 1);
+    EXPECT_LT(w, 100);
+  }
+
+  grid.keep = 0.5;
+  gen::to_csr(grid, csr);
+  check_simple(csr, true);
+  EXPECT_LT(csr.number_of_nonzeros, mesh.number_of_nonzeros);
+  for (vertex_t u = 0; u < csr.number_of_rows; ++u)
+    for (edge_t e = csr.row_offsets[u]; e < csr.row_offsets[u + 1]; ++e) {
+      auto first = mesh.column_indices.begin() + mesh.row_offsets[u];
+      auto last = mesh.column_indices.begin() + mesh.row_offsets[u + 1];
+      auto k = std::lower_bound(first, last, csr.column_indices[e]);
+      ASSERT_TRUE(k != last && *k == csr.column_indices[e]);
+      EXPECT_EQ(mesh.nonzero_values[k - mesh.column_indices.begin()],
+                csr.nonzero_values[e]);
+    }
+
+  grid.keep = 1;
+  grid.diagonals = true;
+  gen::to_csr(grid, csr);
+  check_simple(csr, true);
+  EXPECT_EQ(csr.number_of_nonzeros, 2 * (7 * 9 + 6 * 10 + 2 * 6 * 9));
+
+  util::parallel::set_number_of_threads(0);
+}
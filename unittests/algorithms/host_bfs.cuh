@@ -0,0 +1,51 @@
+/**
+ * @file host_bfs.cuh
+ * @brief Unit test for the direction-optimizing host BFS.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <gunrock/algorithms/host/bfs.hxx>
+
+using namespace gunrock;
+using namespace memory;
+
+TEST(algorithm, host_bfs) {
+  // Symmetric CSR
+  // ROW_OFFSETS  = [ 0 3 5 8 10 ]
+  // COL_INDEX    = [ 1 2 3 | 0 2 | 0 1 3 | 0 2]
+
+  using vertex_t = int;
+  using edge_t = int;
+
+  std::vector<edge_t> Ap = {0, 3, 5, 8, 10};
+  std::vector<vertex_t> Aj = {1, 2, 3, 0, 2, 0, 1, 3, 0, 2};
+  std::vector<vertex_t> reference_distances = {1, 2, 1, 0};
+
+  // Large alpha forces bottom-up steps, direction_optimizing = false keeps
+  // the search top-down.
+  host::bfs::param_t bottom_up;
+  bottom_up.alpha = 1e9;
+  host::bfs::param_t top_down;
+  top_down.direction_optimizing = false;
+
+  for (auto param : {bottom_up, top_down}) {
+    vertex_t source = 3;
+    std::vector<vertex_t> distances(4), predecessors(4);
+    host::bfs::run(vertex_t(4), Ap.data(), Aj.data(), Ap.data(), Aj.data(),
+                   source, distances.data(), predecessors.data(), param);
+
+    for (vertex_t v = 0; v < 4; v++) {
+      EXPECT_EQ(distances[v], reference_distances[v]);
+      if (v == source)
+        continue;
+      // The predecessor is a neighbor one level closer to the source.
+      auto p = predecessors[v];
+      EXPECT_EQ(distances[p] + 1, distances[v]);
+      EXPECT_NE(std::find(Aj.begin() + Ap[p], Aj.begin() + Ap[p + 1], v),
+                Aj.begin() + Ap[p + 1]);
+    }
+  }
+}
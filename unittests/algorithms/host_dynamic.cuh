@@ -0,0 +1,209 @@
+/**
+ * @file host_dynamic.cuh
+ * @brief Unit test for the host dynamic graph and the incremental BFS,
+ * connected components and PageRank.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <gunrock/algorithms/algorithms.hxx>
+#include <gunrock/algorithms/host/bfs.hxx>
+#include <gunrock/algorithms/host/incremental.hxx>
+#include <gunrock/util/parallel.hxx>
+
+#include <cmath>
+#include <map>
+#include <random>
+
+#include <gtest/gtest.h>
+
+TEST(algorithm, host_dynamic) {
+  using namespace gunrock;
+  using vertex_t = int;
+  using edge_t = int;
+  using weight_t = float;
+  using graph_t = host::dynamic_graph_t<vertex_t, edge_t, weight_t>;
+  using update_t = graph_t::update_type;
+  using csr_t =
+      format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t>;
+
+  const vertex_t n = 700;
+  std::mt19937 rng(11);
+  // Small-world-ish edges (mostly short range, so deletions split
+  // components), with a few hubs that overflow their slots.
+  auto random_edge = [&]() -> update_t {
+    vertex_t u = rng() % n;
+    vertex_t v = (rng() % 8 == 0) ? vertex_t(rng() % 5)
+                                   : vertex_t((u + 1 + rng() % 6) % n);
+    return {u, v, weight_t(1 + rng() % 4)};
+  };
+
+  for (bool symmetric : {false, true}) {
+    util::parallel::set_number_of_threads(symmetric ? 4 : 1);
+    graph_t G(n, symmetric);
+    std::map<std::pair<vertex_t, vertex_t>, weight_t> reference;
+    auto add = [&](update_t const& x) {
+      reference[{x.source, x.destination}] = x.weight;
+      if (symmetric)
+        reference[{x.destination, x.source}] = x.weight;
+    };
+    auto remove = [&](update_t const& x) {
+      reference.erase({x.source, x.destination});
+      if (symmetric)
+        reference.erase({x.destination, x.source});
+    };
+
+    // Matches the reference, through the snapshot and the in-lists.
+    auto check = [&]() {
+      csr_t csr;
+      G.snapshot(csr);
+      ASSERT_EQ(csr.number_of_nonzeros, edge_t(reference.size()));
+      ASSERT_EQ(G.get_number_of_edges(), edge_t(reference.size()));
+      edge_t e = 0;
+      for (auto const& [edge, weight] : reference) {
+        EXPECT_EQ(csr.column_indices[e], edge.second);
+        EXPECT_EQ(csr.nonzero_values[e], weight);
+        edge_t position = G.get_edge(edge.first, edge.second);
+        EXPECT_EQ(G.get_destination_vertex(position), edge.second);
+        ++e;
+      }
+      for (vertex_t u = 0; u < n; ++u)
+        EXPECT_EQ(csr.row_offsets[u + 1] - csr.row_offsets[u],
+                  G.get_number_of_neighbors(u));
+      edge_t in_edges = 0;
+      auto in = G.in();
+      for (vertex_t v = 0; v < n; ++v)
+        in.for_each_neighbor(v, [&](vertex_t u, edge_t e) {
+          ++in_edges;
+          auto edge = reference.find({u, v});
+          ASSERT_TRUE(edge != reference.end());
+          EXPECT_EQ(in.get_edge_weight(e), edge->second);
+        });
+      EXPECT_EQ(in_edges, edge_t(reference.size()));
+    };
+
+    // Initial graph; results computed from scratch.
+    std::vector<update_t> batch;
+    for (int i = 0; i < 1500; ++i)
+      batch.push_back(random_edge());
+    G.insert(batch);
+    for (auto const& x : batch)
+      add(x);
+    check();
+
+    const vertex_t source = 3;
+    std::vector<vertex_t> distances(n), expected_distances(n);
+    auto in = G.in();
+    host::bfs::run(n, G.out(), &in, source, distances.data(),
+                   (vertex_t*)nullptr);
+    std::vector<vertex_t> labels(n), expected_labels(n);
+    host::incremental::cc::forest_t<vertex_t> forest;
+    host::incremental::cc::run(G, labels.data(), forest);
+    host::cc::run(n, G.out(), expected_labels.data());
+    EXPECT_EQ(labels, expected_labels);
+    std::vector<weight_t> ranks(n), expected_ranks(n);
+    host::pr::param_t<weight_t> param;
+    param.tol = 1e-7;
+    param.total_iterations = 1000;
+    host::pr::run(n, G.out(), G.in(), ranks.data(), param);
+
+    // Batches of mixed insertions and deletions (existing and missing
+    // edges, repeats), some large enough to relayout the whole graph.
+    for (int round = 0; round < 12; ++round) {
+      std::vector<update_t> insertions, deletions;
+      std::size_t size = (round % 4 == 3) ? 1200 : 60;
+      for (std::size_t i = 0; i < size; ++i)
+        insertions.push_back(random_edge());
+      auto it = reference.begin();
+      for (std::size_t i = 0; i < size + 80 && it != reference.end(); ++i) {
+        std::advance(it, rng() % 3);
+        if (it == reference.end())
+          break;
+        deletions.push_back({it->first.first, it->first.second});
+      }
+      deletions.push_back(random_edge());
+      if (round == 5)
+        deletions.insert(deletions.end(), insertions.begin(),
+                         insertions.begin() + 10);
+
+      G.update(insertions, deletions);
+      for (auto const& x : deletions)
+        remove(x);
+      for (auto const& x : insertions)
+        add(x);
+      check();
+
+      host::incremental::bfs::update(G, source, distances.data(), insertions,
+                                     deletions);
+      csr_t csr;
+      G.snapshot(csr);
+      host::bfs::run(n, csr.row_offsets.data(), csr.column_indices.data(),
+                     (edge_t const*)nullptr, (vertex_t const*)nullptr, source,
+                     expected_distances.data(), (vertex_t*)nullptr);
+      EXPECT_EQ(distances, expected_distances);
+
+      host::incremental::cc::param_t budget;
+      budget.search_budget = round % 2 ? 2 : 4096;
+      host::incremental::cc::update(G, labels.data(), forest, insertions,
+                                    deletions, budget);
+      if (symmetric) {
+        host::cc::run(n, G.out(), expected_labels.data());
+      } else {  // Weak components: the edges both ways.
+        graph_t undirected(n, true);
+        std::vector<update_t> edges;
+        for (auto const& [edge, weight] : reference)
+          edges.push_back({edge.first, edge.second});
+        undirected.insert(edges);
+        host::cc::run(n, undirected.out(), expected_labels.data());
+      }
+      EXPECT_EQ(labels, expected_labels);
+      // The forest spans the components with edges of the graph.
+      std::size_t tree_edges = 0, components = 0;
+      for (vertex_t u = 0; u < n; ++u) {
+        components += labels[u] == u;
+        for (vertex_t w : forest.neighbors[u]) {
+          ++tree_edges;
+          EXPECT_TRUE(reference.count({u, w}) + reference.count({w, u}) > 0);
+        }
+      }
+      EXPECT_EQ(tree_edges, 2 * (n - components));
+
+      host::incremental::pr::update(G, ranks.data(), insertions, deletions,
+                                    param);
+      host::pr::run(n, G.out(), G.in(), expected_ranks.data(), param);
+      for (vertex_t v = 0; v < n; ++v)
+        EXPECT_NEAR(ranks[v], expected_ranks[v], 1e-5);
+    }
+
+    // Single-edge batches: PageRank through its dynamic frontier.
+    for (int round = 0; round < 4; ++round) {
+      std::vector<update_t> insertions(1, random_edge()), deletions;
+      deletions.push_back({reference.begin()->first.first,
+                           reference.begin()->first.second});
+      G.update(insertions, deletions);
+      remove(deletions[0]);
+      add(insertions[0]);
+      host::incremental::pr::update(G, ranks.data(), insertions, deletions,
+                                    param);
+      host::pr::run(n, G.out(), G.in(), expected_ranks.data(), param);
+      for (vertex_t v = 0; v < n; ++v)
+        EXPECT_NEAR(ranks[v], expected_ranks[v], 1e-5);
+    }
+
+    // Deleting everything leaves an empty graph.
+    std::vector<update_t> all;
+    for (auto const& [edge, weight] : reference)
+      all.push_back({edge.first, edge.second});
+    EXPECT_EQ(G.erase(all), edge_t(reference.size()));
+    reference.clear();
+    check();
+  }
+
+  // Out-of-range updates are rejected.
+  graph_t G(4);
+  std::vector<update_t> invalid(1, update_t{0, 4});
+  EXPECT_THROW(G.insert(invalid), error::exception_t);
+  util::parallel::set_number_of_threads(0);
+}
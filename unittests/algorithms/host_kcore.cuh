@@ -0,0 +1,48 @@
+/**
+ * @file host_kcore.cuh
+ * @brief Unit test for the host k-core decompositions.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <gunrock/algorithms/host/kcore.hxx>
+
+using namespace gunrock;
+using namespace memory;
+
+TEST(algorithm, host_kcore) {
+  // Symmetric graph: clique 0 - 1 - 2 - 3, triangle 4 - 5 - 6 hanging off 3,
+  // path 6 - 7 - 8 and the isolated vertex 9.
+  using vertex_t = int;
+  using edge_t = int;
+  constexpr vertex_t n = 10;
+
+  std::vector<std::vector<vertex_t>> lists = {
+      {1, 2, 3}, {0, 2, 3}, {0, 1, 3}, {0, 1, 2, 4}, {3, 5, 6},
+      {4, 6},    {4, 5, 7}, {6, 8},    {7},          {}};
+  std::vector<edge_t> Ap = {0};
+  std::vector<vertex_t> Aj;
+  for (auto const& list : lists) {
+    Aj.insert(Aj.end(), list.begin(), list.end());
+    Ap.push_back(Aj.size());
+  }
+
+  std::vector<int> reference_k_cores = {3, 3, 3, 3, 2, 2, 2, 1, 1, 0};
+  std::vector<vertex_t> reference_histogram = {1, 2, 3, 4};
+
+  for (auto algorithm :
+       {host::kcore::algorithm_t::bucket, host::kcore::algorithm_t::peeling}) {
+    host::kcore::param_t param;
+    param.algorithm = algorithm;
+    std::vector<int> k_cores(n, -1);
+    host::kcore::summary_t<vertex_t> summary;
+    host::kcore::run(n, Ap.data(), Aj.data(), k_cores.data(), &summary,
+                     param);
+
+    EXPECT_EQ(k_cores, reference_k_cores);
+    EXPECT_EQ(summary.max_core, 3);
+    EXPECT_EQ(summary.histogram, reference_histogram);
+  }
+}
@@ -0,0 +1,193 @@
+/**
+ * @file host_knn.cuh
+ * @brief Unit test for the host spatial indices and k-NN/radius graphs.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <gunrock/algorithms/algorithms.hxx>
+#include <gunrock/algorithms/host/knn.hxx>
+#include <gunrock/util/parallel.hxx>
+
+#include <cmath>
+#include <limits>
+#include <random>
+
+#include <gtest/gtest.h>
+
+TEST(algorithm, host_knn) {
+  using namespace gunrock;
+  using namespace gunrock::host::spatial;
+  using vertex_t = int;
+  using edge_t = int;
+  using weight_t = float;
+
+  struct point_t {
+    double x, y;
+  };
+  struct coordinates_t {
+    float latitude, longitude;
+  };
+
+  // Uniform points, a dense cluster, exact duplicates and a missing point.
+  std::mt19937 rng(7);
+  std::uniform_real_distribution<double> uniform(0, 100);
+  std::normal_distribution<double> cluster(20, 0.05);
+  std::vector<point_t> points;
+  for (int i = 0; i < 1500; ++i)
+    points.push_back({uniform(rng), uniform(rng)});
+  for (int i = 0; i < 400; ++i)
+    points.push_back({cluster(rng), cluster(rng)});
+  for (int i = 0; i < 20; ++i)
+    points.push_back(points[i * 13]);
+  points.push_back({std::numeric_limits<double>::quiet_NaN(), 1});
+  const std::size_t n = points.size();
+
+  euclidean_t planar;
+  brute_force_t<2> brute(positions(points.data(), n, planar));
+  kd_tree_t<2> tree(positions(points.data(), n, planar), 8);
+  grid_t<2> grid(positions(points.data(), n, planar));
+  EXPECT_FALSE(tree.valid(n - 1));
+
+  // Queries match brute force exactly (ties are broken by index).
+  auto same = [](std::vector<neighbor_t> const& a,
+                 std::vector<neighbor_t> const& b) {
+    if (a.size() != b.size())
+      return false;
+    for (std::size_t i = 0; i < a.size(); ++i)
+      if (a[i].index != b[i].index || a[i].squared != b[i].squared)
+        return false;
+    return true;
+  };
+  auto sorted_within = [](auto const& index, auto const& q, double squared) {
+    std::vector<std::uint32_t> found;
+    index.within(q, squared, [&](std::uint32_t j, double) {
+      found.push_back(j);
+    });
+    std::sort(found.begin(), found.end());
+    return found;
+  };
+  std::vector<neighbor_t> expected, found;
+  for (std::size_t q = 0; q + 1 < n; q += 7) {
+    for (std::size_t k : {1, 6, 17}) {
+      brute.nearest(brute.position(q), k, expected, std::uint32_t(q));
+      ASSERT_EQ(expected.size(), k);
+      tree.nearest(tree.position(q), k, found, std::uint32_t(q));
+      EXPECT_TRUE(same(found, expected));
+      grid.nearest(grid.position(q), k, found, std::uint32_t(q));
+      EXPECT_TRUE(same(found, expected));
+    }
+    for (double r : {0.0, 0.1, 4.0}) {
+      auto all = sorted_within(brute, brute.position(q), r * r);
+      EXPECT_EQ(sorted_within(tree, tree.position(q), r * r), all);
+      EXPECT_EQ(sorted_within(grid, grid.position(q), r * r), all);
+    }
+  }
+  // A query outside the points, and more neighbors than points.
+  position_t<2> far = {-500, 250};
+  brute.nearest(far, 3, expected);
+  tree.nearest(far, 3, found);
+  EXPECT_TRUE(same(found, expected));
+  grid.nearest(far, 3, found);
+  EXPECT_TRUE(same(found, expected));
+  grid.nearest(far, n + 5, found);
+  EXPECT_EQ(found.size(), n - 1);
+
+  // Latitude/longitude: great-circle order, distances in km.
+  std::vector<coordinates_t> places;
+  std::uniform_real_distribution<float> latitude(-89, 89);
+  std::uniform_real_distribution<float> longitude(-180, 180);
+  for (int i = 0; i < 800; ++i)
+    places.push_back({latitude(rng), longitude(rng)});
+  places.push_back({38.5f, -121.7f});
+  places.push_back({37.8f, -122.4f});
+  haversine_t sphere;
+  auto on_sphere = positions(places.data(), places.size(), sphere);
+  brute_force_t<3> brute_sphere(on_sphere);
+  kd_tree_t<3> tree_sphere(on_sphere);
+  grid_t<3> grid_sphere(on_sphere);
+  for (std::size_t q = 0; q < places.size(); q += 5) {
+    brute_sphere.nearest(brute_sphere.position(q), 5, expected,
+                         std::uint32_t(q));
+    tree_sphere.nearest(tree_sphere.position(q), 5, found, std::uint32_t(q));
+    EXPECT_TRUE(same(found, expected));
+    grid_sphere.nearest(grid_sphere.position(q), 5, found, std::uint32_t(q));
+    EXPECT_TRUE(same(found, expected));
+  }
+  // Davis - San Francisco, about 99 km.
+  double chord = detail::squared_distance(tree_sphere.position(800),
+                                          tree_sphere.position(801));
+  EXPECT_NEAR(sphere.distance(chord), 99.0, 0.5);
+  EXPECT_NEAR(sphere.distance(sphere.squared(250)), 250, 1e-6);
+
+  // k-NN graph: k sorted neighbors per point, weighted by distance.
+  util::parallel::set_number_of_threads(4);
+  format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> csr;
+  const std::size_t k = 6;
+  knn_graph(grid, planar, k, csr);
+  EXPECT_EQ(csr.number_of_rows, vertex_t(n));
+  EXPECT_EQ(csr.number_of_nonzeros, edge_t((n - 1) * k));
+  EXPECT_EQ(csr.row_offsets[n - 1], csr.row_offsets[n]);
+  for (std::size_t u = 0; u + 1 < n; u += 11) {
+    brute.nearest(brute.position(u), k, expected, std::uint32_t(u));
+    std::vector<vertex_t> columns;
+    for (auto v : expected)
+      columns.push_back(vertex_t(v.index));
+    std::sort(columns.begin(), columns.end());
+    ASSERT_EQ(csr.row_offsets[u + 1] - csr.row_offsets[u], edge_t(k));
+    for (std::size_t i = 0; i < k; ++i) {
+      edge_t e = csr.row_offsets[u] + edge_t(i);
+      EXPECT_EQ(csr.column_indices[e], columns[i]);
+      double dx = points[u].x - points[columns[i]].x;
+      double dy = points[u].y - points[columns[i]].y;
+      EXPECT_NEAR(csr.nonzero_values[e], std::sqrt(dx * dx + dy * dy), 1e-4);
+    }
+  }
+
+  // Same graph from the k-d tree (through the points overload) and on one
+  // thread; the symmetric graph holds every edge both ways.
+  format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> other;
+  util::parallel::set_number_of_threads(1);
+  knn_graph(points.data(), n, planar, k, other);
+  EXPECT_EQ(other.row_offsets, csr.row_offsets);
+  EXPECT_EQ(other.column_indices, csr.column_indices);
+  EXPECT_EQ(other.nonzero_values, csr.nonzero_values);
+
+  auto has_edge = [](auto const& g, vertex_t u, vertex_t v) {
+    auto first = g.column_indices.begin() + g.row_offsets[u];
+    auto last = g.column_indices.begin() + g.row_offsets[u + 1];
+    return std::binary_search(first, last, v);
+  };
+  knn_graph(tree, planar, k, other, true);
+  EXPECT_GE(other.number_of_nonzeros, csr.number_of_nonzeros);
+  for (vertex_t u = 0; u < vertex_t(n); ++u)
+    for (edge_t e = csr.row_offsets[u]; e < csr.row_offsets[u + 1]; ++e) {
+      EXPECT_TRUE(has_edge(other, u, csr.column_indices[e]));
+      EXPECT_TRUE(has_edge(other, csr.column_indices[e], u));
+    }
+
+  // Radius graph: symmetric, and the same from every index.
+  util::parallel::set_number_of_threads(0);
+  format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> by_tree,
+      by_grid, by_brute;
+  radius_graph(tree, planar, 2.5, by_tree);
+  radius_graph(grid, planar, 2.5, by_grid);
+  radius_graph(brute, planar, 2.5, by_brute);
+  EXPECT_EQ(by_tree.column_indices, by_brute.column_indices);
+  EXPECT_EQ(by_grid.column_indices, by_brute.column_indices);
+  EXPECT_EQ(by_grid.row_offsets, by_brute.row_offsets);
+  EXPECT_GT(by_tree.number_of_nonzeros, edge_t(0));
+  for (vertex_t u = 0; u < vertex_t(n); u += 3)
+    for (edge_t e = by_tree.row_offsets[u]; e < by_tree.row_offsets[u + 1];
+         ++e) {
+      EXPECT_NE(by_tree.column_indices[e], u);
+      EXPECT_LE(by_tree.nonzero_values[e], 2.5f);
+      EXPECT_TRUE(has_edge(by_tree, by_tree.column_indices[e], u));
+    }
+
+  // Great-circle radius graph: edges within 250 km.
+  radius_graph(places.data(), places.size(), sphere, 250.0, by_tree);
+  EXPECT_TRUE(has_edge(by_tree, 800, 801));
+}
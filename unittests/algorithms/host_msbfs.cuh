@@ -0,0 +1,90 @@
+/**
+ * @file host_msbfs.cuh
+ * @brief Unit test for the bit-parallel multi-source host BFS and the
+ * batched host BC built on it.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <gunrock/algorithms/host/bc.hxx>
+#include <gunrock/algorithms/host/msbfs.hxx>
+
+using namespace gunrock;
+using namespace memory;
+
+TEST(algorithm, host_msbfs) {
+  // Symmetric CSR, a 4-cycle 0 - 1 - 2 - 3 - 0 plus the pendant vertex 4 on 2
+  // ROW_OFFSETS  = [ 0 2 4 7 9 10 ]
+  // COL_INDEX    = [ 1 3 | 0 2 | 1 3 4 | 0 2 | 2 ]
+
+  using vertex_t = int;
+  using edge_t = int;
+  using weight_t = float;
+  constexpr vertex_t n = 5;
+  constexpr vertex_t x = std::numeric_limits<vertex_t>::max();
+
+  std::vector<edge_t> Ap = {0, 2, 4, 7, 9, 10};
+  std::vector<vertex_t> Aj = {1, 3, 0, 2, 1, 3, 4, 0, 2, 2};
+
+  // Sources 0, 4, 0 (duplicate) and 130 times 1 (multi-word batches).
+  std::vector<vertex_t> sources = {0, 4, 0};
+  sources.insert(sources.end(), 130, 1);
+  std::size_t k = sources.size();
+
+  std::vector<vertex_t> reference_distances[] = {
+      {0, 1, 2, 1, 3}, {3, 2, 1, 2, 0}, {1, 0, 1, 2, 2}};
+  std::vector<double> reference_sigmas[] = {
+      {1, 1, 2, 1, 2}, {2, 1, 1, 1, 1}, {1, 1, 1, 2, 1}};
+  auto reference = [&](std::size_t i) { return i < 2 ? i : i == 2 ? 0 : 2; };
+
+  // Large alpha forces bottom-up steps, direction_optimizing = false keeps
+  // the search top-down.
+  host::msbfs::param_t bottom_up;
+  bottom_up.alpha = 1e9;
+  host::msbfs::param_t top_down;
+  top_down.direction_optimizing = false;
+  host::msbfs::param_t vertex_major;
+  vertex_major.source_major = false;
+
+  for (auto param : {bottom_up, top_down, vertex_major}) {
+    std::vector<vertex_t> distances(k * n, x);
+    std::vector<double> sigmas(k * n);
+    host::msbfs::run(n, Ap.data(), Aj.data(), Ap.data(), Aj.data(),
+                     sources.data(), k, distances.data(), sigmas.data(),
+                     param);
+
+    for (std::size_t i = 0; i < k; i++) {
+      for (vertex_t v = 0; v < n; v++) {
+        std::size_t at = param.source_major ? i * n + v : v * k + i;
+        EXPECT_EQ(distances[at], reference_distances[reference(i)][v]);
+        EXPECT_EQ(sigmas[at], reference_sigmas[reference(i)][v]);
+      }
+    }
+  }
+
+  // Directed path 0 -> 1 -> 2, out-edges only: vertex 0 is unreachable from 2.
+  std::vector<edge_t> Bp = {0, 1, 2, 2};
+  std::vector<vertex_t> Bj = {1, 2};
+  std::vector<vertex_t> path_sources = {0, 2};
+  std::vector<vertex_t> path_distances(2 * 3);
+  host::msbfs::run(vertex_t(3), Bp.data(), Bj.data(), (edge_t*)nullptr,
+                   (vertex_t*)nullptr, path_sources.data(), 2,
+                   path_distances.data());
+  EXPECT_EQ(path_distances, (std::vector<vertex_t>{0, 1, 2, x, x, 0}));
+
+  // Batched BC from every vertex: only 2 (between 4 and the rest) and the
+  // cycle vertices 1 and 3 (on one of two paths between 0 and 2) are between
+  // other vertices.
+  std::vector<vertex_t> all = {0, 1, 2, 3, 4};
+  host::csr_adjacency_t<vertex_t, edge_t> adjacency{Ap.data(), Aj.data()};
+  for (std::size_t batch_size : {1, 2, 64}) {
+    std::vector<weight_t> bc_values(n);
+    host::bc::param_t param;
+    param.batch_size = batch_size;
+    host::bc::run(n, adjacency, &adjacency, all.data(), all.size(),
+                  bc_values.data(), param);
+    EXPECT_EQ(bc_values, (std::vector<weight_t>{1, 2, 7, 2, 0}));
+  }
+}
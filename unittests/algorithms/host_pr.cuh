@@ -0,0 +1,170 @@
+/**
+ * @file host_pr.cuh
+ * @brief Unit test for the host PageRank, batched PPR and HITS engines.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <gunrock/algorithms/algorithms.hxx>
+#include <gunrock/algorithms/host/hits.hxx>
+#include <gunrock/algorithms/host/ppr.hxx>
+#include <gunrock/util/parallel.hxx>
+
+#include <cmath>
+#include <random>
+
+#include <gtest/gtest.h>
+
+TEST(algorithm, host_pr) {
+  using namespace gunrock;
+  using vertex_t = int;
+  using edge_t = int;
+  using weight_t = float;
+  using adjacency_t = host::csr_adjacency_t<vertex_t, edge_t, weight_t>;
+
+  // Random weighted digraph; every fifth vertex is dangling.
+  const vertex_t n = 300;
+  std::mt19937 rng(3);
+  std::vector<std::vector<std::pair<vertex_t, weight_t>>> lists(n);
+  for (vertex_t u = 0; u < n; ++u)
+    if (u % 5 != 0)
+      for (int k = rng() % 9; k >= 0; --k)
+        lists[u].push_back({vertex_t(rng() % n), weight_t(1 + rng() % 3)});
+
+  std::vector<edge_t> offsets(1, 0), in_offsets(n + 1, 0);
+  std::vector<vertex_t> indices;
+  std::vector<weight_t> values;
+  for (vertex_t u = 0; u < n; ++u) {
+    for (auto [v, w] : lists[u]) {
+      indices.push_back(v);
+      values.push_back(w);
+      ++in_offsets[v + 1];
+    }
+    offsets.push_back(edge_t(indices.size()));
+  }
+  for (vertex_t v = 0; v < n; ++v)
+    in_offsets[v + 1] += in_offsets[v];
+  std::vector<vertex_t> in_indices(indices.size());
+  std::vector<weight_t> in_values(indices.size());
+  std::vector<edge_t> fill(in_offsets.begin(), in_offsets.end() - 1);
+  for (vertex_t u = 0; u < n; ++u)
+    for (auto [v, w] : lists[u]) {
+      in_indices[fill[v]] = u;
+      in_values[fill[v]++] = w;
+    }
+  adjacency_t out{offsets.data(), indices.data(), values.data()};
+  adjacency_t in{in_offsets.data(), in_indices.data(), in_values.data()};
+
+  // Serial push reference; the teleport goes to `seed`, or everywhere (-1).
+  host::pr::param_t<weight_t> param;
+  auto reference = [&](vertex_t seed) {
+    std::vector<double> p(n, seed < 0 ? 1.0 / n : 0), next(n);
+    if (seed >= 0)
+      p[seed] = 1;
+    for (unsigned int i = 0; i < param.total_iterations; ++i) {
+      double mass = 1 - param.alpha;
+      for (vertex_t u = 0; u < n; ++u)
+        if (lists[u].empty())
+          mass += param.alpha * p[u];
+      std::fill(next.begin(), next.end(), seed < 0 ? mass / n : 0);
+      if (seed >= 0)
+        next[seed] = mass;
+      for (vertex_t u = 0; u < n; ++u) {
+        double weight = 0;
+        for (auto [v, w] : lists[u])
+          weight += w;
+        for (auto [v, w] : lists[u])
+          next[v] += param.alpha * p[u] * w / weight;
+      }
+      double err = 0;
+      for (vertex_t v = 0; v < n; ++v)
+        err = std::max(err, std::abs(next[v] - p[v]));
+      p.swap(next);
+      if (err < param.tol)
+        break;
+    }
+    return p;
+  };
+
+  // PageRank: thread-count independent, and matches the reference.
+  std::vector<weight_t> ranks(n), expected_ranks(n);
+  util::parallel::set_number_of_threads(1);
+  host::pr::run(n, out, in, expected_ranks.data(), param);
+  util::parallel::set_number_of_threads(4);
+  host::pr::run(n, out, in, ranks.data(), param);
+  EXPECT_EQ(ranks, expected_ranks);
+  auto pr_reference = reference(-1);
+  for (vertex_t v = 0; v < n; ++v)
+    EXPECT_NEAR(ranks[v], pr_reference[v], 1e-5);
+
+  // Batched PPR: 21 seeds (a block of 16, then one of 8 with 3 unused
+  // lanes), with repeats. Every seed converges as it does alone (up to
+  // rounding: batches and single seeds may be vectorized differently).
+  std::vector<vertex_t> seeds;
+  for (int s = 0; s < 21; ++s)
+    seeds.push_back(vertex_t((s * 37) % n));
+  seeds.push_back(seeds[2]);
+  std::vector<weight_t> p(seeds.size() * n);
+  host::ppr::run_batch(n, out, in, seeds.data(), seeds.size(), p.data(),
+                       param);
+  for (std::size_t s = 0; s < seeds.size(); ++s) {
+    std::vector<weight_t> alone(n);
+    host::ppr::run_batch(n, out, in, &seeds[s], 1, alone.data(), param);
+    for (vertex_t v = 0; v < n; ++v)
+      EXPECT_NEAR(p[s * n + v], alone[v], 1e-7);
+    if (s % 7 == 0) {
+      auto expected = reference(seeds[s]);
+      for (vertex_t v = 0; v < n; ++v)
+        EXPECT_NEAR(alone[v], expected[v], 1e-5);
+    }
+  }
+
+  EXPECT_THROW(
+      host::ppr::run_batch(n, out, in, &n, 1, p.data(), param),
+      error::exception_t);
+
+  // HITS against a serial reference.
+  host::hits::param_t hits_param;
+  hits_param.max_iterations = 20;
+  std::vector<weight_t> authority(n), hub(n);
+  host::hits::run(n, out, in, authority.data(), hub.data(), hits_param);
+  std::vector<double> a(n, 1), h(n, 1);
+  for (unsigned int i = 0; i < hits_param.max_iterations; ++i) {
+    std::vector<double> a_next(n, 0), h_next(n, 0);
+    for (vertex_t u = 0; u < n; ++u)
+      for (auto [v, w] : lists[u]) {
+        a_next[v] += h[u];
+        h_next[u] += a[v];
+      }
+    for (auto* x : {&a_next, &h_next}) {
+      double sum = 0;
+      for (auto y : *x)
+        sum += y * y;
+      for (auto& y : *x)
+        y /= std::sqrt(sum);
+    }
+    a.swap(a_next);
+    h.swap(h_next);
+  }
+  for (vertex_t v = 0; v < n; ++v) {
+    EXPECT_NEAR(authority[v], a[v], 1e-5);
+    EXPECT_NEAR(hub[v], h[v], 1e-5);
+  }
+
+  // Directed star 0 -> {1, 2, 3, 4}: one hub, four equal authorities.
+  std::vector<edge_t> star_offsets = {0, 4, 4, 4, 4, 4};
+  std::vector<vertex_t> star_indices = {1, 2, 3, 4};
+  std::vector<edge_t> star_in_offsets = {0, 0, 1, 2, 3, 4};
+  std::vector<vertex_t> star_in_indices = {0, 0, 0, 0};
+  std::vector<weight_t> star_authority(5), star_hub(5);
+  host::hits::run(
+      vertex_t(5), adjacency_t{star_offsets.data(), star_indices.data()},
+      adjacency_t{star_in_offsets.data(), star_in_indices.data()},
+      star_authority.data(), star_hub.data());
+  EXPECT_EQ(star_authority, (std::vector<weight_t>{0, 0.5, 0.5, 0.5, 0.5}));
+  EXPECT_EQ(star_hub, (std::vector<weight_t>{1, 0, 0, 0, 0}));
+
+  util::parallel::set_number_of_threads(0);
+}
@@ -0,0 +1,130 @@
+/**
+ * @file host_spgemm.cuh
+ * @brief Unit test for the host Gustavson SpGEMM.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <gunrock/algorithms/algorithms.hxx>
+#include <gunrock/algorithms/host/spgemm.hxx>
+#include <gunrock/util/parallel.hxx>
+
+#include <map>
+#include <random>
+
+#include <gtest/gtest.h>
+
+TEST(algorithm, host_spgemm) {
+  using namespace gunrock;
+  using namespace memory;
+  using vertex_t = int;
+  using edge_t = int;
+  using weight_t = float;
+  using csr_t = format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t>;
+  namespace spgemm = host::spgemm;
+
+  // datasets/spgemm: A = [0 1 1; 0 0 1; 0 0 0], B = [0 0 0; 1 0 0; 1 1 0].
+  csr_t A, B, C;
+  A.number_of_rows = A.number_of_columns = 3;
+  A.row_offsets = std::vector<edge_t>{0, 2, 3, 3};
+  A.column_indices = std::vector<vertex_t>{1, 2, 2};
+  A.nonzero_values = std::vector<weight_t>{1, 1, 1};
+  B.number_of_rows = B.number_of_columns = 3;
+  B.row_offsets = std::vector<edge_t>{0, 0, 1, 3};
+  B.column_indices = std::vector<vertex_t>{0, 0, 1};
+  B.nonzero_values = std::vector<weight_t>{1, 1, 1};
+
+  spgemm::summary_t summary;
+  spgemm::run(A, B, C, &summary);
+  EXPECT_EQ(C.number_of_rows, 3);
+  EXPECT_EQ(C.number_of_columns, 3);
+  EXPECT_EQ(C.number_of_nonzeros, 4);
+  EXPECT_EQ(summary.flops, 5);
+  EXPECT_EQ(C.row_offsets, (std::vector<edge_t>{0, 2, 4, 4}));
+  EXPECT_EQ(C.column_indices, (std::vector<vertex_t>{0, 1, 0, 1}));
+  EXPECT_EQ(C.nonzero_values, (std::vector<weight_t>{2, 1, 1, 1}));
+
+  // Random operands with a few heavy rows, unsorted rows and duplicate
+  // columns, against a map-based product, for every accumulator and
+  // ordering and several thread counts. Integer values: exact sums.
+  auto random = [](vertex_t rows, vertex_t columns, double density,
+                   unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> uniform(0, 1);
+    csr_t M;
+    M.number_of_rows = rows;
+    M.number_of_columns = columns;
+    std::vector<edge_t> offsets(1, 0);
+    std::vector<vertex_t> indices;
+    std::vector<weight_t> values;
+    for (vertex_t i = 0; i < rows; ++i) {
+      double p = (i % 7 == 0) ? 20 * density : density;
+      for (vertex_t j = columns - 1; j >= 0; --j)
+        if (uniform(rng) < p) {
+          indices.push_back(j);
+          values.push_back(weight_t(int(uniform(rng) * 8) - 3));
+          if (uniform(rng) < 0.1) {
+            indices.push_back(j);
+            values.push_back(1);
+          }
+        }
+      offsets.push_back(edge_t(indices.size()));
+    }
+    M.row_offsets = offsets;
+    M.column_indices = indices;
+    M.nonzero_values = values;
+    M.number_of_nonzeros = edge_t(indices.size());
+    return M;
+  };
+
+  A = random(300, 200, 0.03, 1);
+  B = random(200, 500, 0.04, 2);
+  std::vector<std::map<vertex_t, weight_t>> expected(300);
+  for (vertex_t i = 0; i < 300; ++i)
+    for (edge_t a = A.row_offsets[i]; a < A.row_offsets[i + 1]; ++a) {
+      vertex_t k = A.column_indices[a];
+      for (edge_t b = B.row_offsets[k]; b < B.row_offsets[k + 1]; ++b)
+        expected[i][B.column_indices[b]] +=
+            A.nonzero_values[a] * B.nonzero_values[b];
+    }
+
+  for (auto accumulator :
+       {spgemm::accumulator_t::automatic, spgemm::accumulator_t::hash,
+        spgemm::accumulator_t::dense}) {
+    for (bool sorted : {true, false}) {
+      for (std::size_t threads : {1, 4}) {
+        util::parallel::set_number_of_threads(threads);
+        spgemm::param_t param;
+        param.accumulator = accumulator;
+        param.sorted = sorted;
+        spgemm::run(A, B, C, &summary, param);
+
+        EXPECT_EQ(C.number_of_rows, 300);
+        EXPECT_EQ(C.number_of_columns, 500);
+        EXPECT_EQ(summary.nonzeros, std::size_t(C.number_of_nonzeros));
+        if (accumulator == spgemm::accumulator_t::hash)
+          EXPECT_EQ(summary.dense_rows, 0);
+        if (accumulator == spgemm::accumulator_t::dense)
+          EXPECT_EQ(summary.hash_rows, 0);
+
+        for (vertex_t i = 0; i < 300; ++i) {
+          std::map<vertex_t, weight_t> row;
+          for (edge_t e = C.row_offsets[i]; e < C.row_offsets[i + 1]; ++e) {
+            EXPECT_EQ(row.count(C.column_indices[e]), 0);
+            row[C.column_indices[e]] = C.nonzero_values[e];
+            if (sorted && e > C.row_offsets[i])
+              EXPECT_LT(C.column_indices[e - 1], C.column_indices[e]);
+          }
+          EXPECT_EQ(row, expected[i]);
+        }
+      }
+    }
+  }
+
+  // Mismatched shapes.
+  EXPECT_THROW(spgemm::run(B, B, C), error::exception_t);
+
+  util::parallel::set_number_of_threads(0);
+}
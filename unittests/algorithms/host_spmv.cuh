@@ -0,0 +1,131 @@
+/**
+ * @file host_spmv.cuh
+ * @brief Unit test for the host SpMV / SpMM kernels.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <gunrock/algorithms/algorithms.hxx>
+#include <gunrock/algorithms/host/spmv.hxx>
+#include <gunrock/util/parallel.hxx>
+
+#include <limits>
+#include <random>
+
+#include <gtest/gtest.h>
+
+TEST(algorithm, host_spmv) {
+  using namespace gunrock;
+  using namespace memory;
+  using vertex_t = int;
+  using edge_t = int;
+  using weight_t = float;
+  namespace spmv = host::spmv;
+
+  // Regular rows (0 .. 11 nonzeros) and power-law-like rows (mostly short, a
+  // few longer than the matrix is wide), with integer values: exact sums.
+  std::mt19937 rng(7);
+  for (bool irregular : {false, true}) {
+    vertex_t m = irregular ? 1500 : 2100, n = 400;
+    std::vector<edge_t> offsets(1, 0);
+    std::vector<vertex_t> indices;
+    std::vector<weight_t> values;
+    for (vertex_t i = 0; i < m; ++i) {
+      std::size_t length = irregular ? ((rng() % 50 == 0) ? rng() % (3 * n)
+                                                          : rng() % 4)
+                                     : rng() % 12;
+      for (std::size_t j = 0; j < length; ++j) {
+        indices.push_back(vertex_t(rng() % n));
+        values.push_back(weight_t(int(rng() % 7) - 3));
+      }
+      offsets.push_back(edge_t(indices.size()));
+    }
+
+    spmv::matrix_t<vertex_t, edge_t, weight_t> automatic(
+        m, n, offsets.data(), indices.data(), values.data());
+    EXPECT_TRUE(automatic.kernel() == (irregular ? spmv::kernel_t::merge_path
+                                                 : spmv::kernel_t::sell));
+
+    for (std::size_t k : {1, 3, 16, 21}) {
+      std::vector<weight_t> X(n * k);
+      for (auto& x : X)
+        x = weight_t(int(rng() % 5) - 2);
+      std::vector<weight_t> expected(m * k, 0);
+      for (vertex_t i = 0; i < m; ++i)
+        for (edge_t e = offsets[i]; e < offsets[i + 1]; ++e)
+          for (std::size_t l = 0; l < k; ++l)
+            expected[i * k + l] += values[e] * X[indices[e] * k + l];
+
+      for (auto kernel : {spmv::kernel_t::csr, spmv::kernel_t::merge_path,
+                          spmv::kernel_t::sell}) {
+        for (std::size_t sort_window : {1, 256}) {
+          spmv::param_t param;
+          param.kernel = kernel;
+          param.sort_window = sort_window;
+          spmv::matrix_t<vertex_t, edge_t, weight_t> A(
+              m, n, offsets.data(), indices.data(), values.data(), param);
+          EXPECT_TRUE(A.kernel() == kernel);
+
+          for (std::size_t threads : {1, 4}) {
+            util::parallel::set_number_of_threads(threads);
+            std::vector<weight_t> Y(m * k, -1);
+            if (k == 1)
+              A.multiply(X.data(), Y.data());
+            else
+              A.multiply(X.data(), Y.data(), k);
+            EXPECT_EQ(Y, expected);
+          }
+        }
+      }
+    }
+  }
+
+  // SELL padding: sorting within windows packs rows of equal length.
+  std::vector<edge_t> offsets = {0};
+  std::vector<vertex_t> indices;
+  for (vertex_t i = 0; i < 64; ++i) {
+    for (vertex_t j = 0; j < ((i % 2) ? 8 : 1); ++j)
+      indices.push_back(j);
+    offsets.push_back(edge_t(indices.size()));
+  }
+  std::vector<weight_t> values(indices.size(), 1);
+  spmv::param_t param;
+  param.kernel = spmv::kernel_t::sell;
+  param.sort_window = 1;
+  spmv::matrix_t<vertex_t, edge_t, weight_t> unsorted(
+      64, 8, offsets.data(), indices.data(), values.data(), param);
+  EXPECT_EQ(unsorted.get_summary().padded_nonzeros, 64 * 8);
+  param.sort_window = 64;
+  spmv::matrix_t<vertex_t, edge_t, weight_t> sorted(
+      64, 8, offsets.data(), indices.data(), values.data(), param);
+  EXPECT_EQ(sorted.get_summary().padded_nonzeros, 32 * 8 + 32);
+  EXPECT_EQ(sorted.get_summary().nonzeros, 32 * 8 + 32);
+  EXPECT_NEAR(sorted.get_summary().padding_ratio, 0, 1e-12);
+
+  // Padded slots are skipped: an infinite or NaN x entry only reaches the
+  // rows that store its column (empty rows pad with column 0).
+  std::vector<weight_t> X = {std::numeric_limits<weight_t>::infinity(),
+                             std::numeric_limits<weight_t>::quiet_NaN(), 1, 1,
+                             1, 1, 1, 2};
+  offsets = {0};
+  indices.clear();
+  for (vertex_t i = 0; i < 64; ++i) {
+    for (vertex_t j = 0; j < ((i % 2) ? i % 7 : 0); ++j)
+      indices.push_back(7 - j);
+    offsets.push_back(edge_t(indices.size()));
+  }
+  values.assign(indices.size(), 1);
+  for (std::size_t sort_window : {1, 64}) {
+    param.sort_window = sort_window;
+    spmv::matrix_t<vertex_t, edge_t, weight_t> A(
+        64, 8, offsets.data(), indices.data(), values.data(), param);
+    std::vector<weight_t> Y(64, -1);
+    A.multiply(X.data(), Y.data());
+    for (vertex_t i = 0; i < 64; ++i)
+      EXPECT_EQ(Y[i], (i % 2 && i % 7) ? weight_t(i % 7 + 1) : weight_t(0));
+  }
+
+  util::parallel::set_number_of_threads(0);
+}
@@ -0,0 +1,73 @@
+/**
+ * @file host_sssp.cuh
+ * @brief Unit test for the delta-stepping host SSSP.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <gunrock/algorithms/host/sssp.hxx>
+
+using namespace gunrock;
+using namespace memory;
+
+TEST(algorithm, host_sssp) {
+  // Directed, weighted CSR
+  // ROW_OFFSETS  = [ 0 2 4 5 6 6 ]
+  // COL_INDEX    = [ 1 2 | 2 3 | 3 | 4 | ]
+  // VALUES       = [ 4 1 | 1 5 | 8 | 3 | ]
+
+  using vertex_t = int;
+  using edge_t = int;
+  using weight_t = float;
+
+  std::vector<edge_t> Ap = {0, 2, 4, 5, 6, 6};
+  std::vector<vertex_t> Aj = {1, 2, 2, 3, 3, 4};
+  std::vector<weight_t> Ax = {4, 1, 1, 5, 8, 3};
+
+  // Dijkstra from 0: 0 -> 2 (1), 0 -> 1 (4), 1 -> 3 (9), 3 -> 4 (12).
+  std::vector<weight_t> reference_distances = {0, 4, 1, 9, 12};
+  std::vector<vertex_t> reference_predecessors = {-1, 0, 0, 1, 3};
+
+  // Auto-tuned, narrow (all edges heavy) and wide (all edges light) buckets.
+  for (weight_t delta : {0.f, 0.5f, 100.f}) {
+    host::sssp::param_t<weight_t> param;
+    param.delta = delta;
+
+    std::vector<weight_t> distances(5);
+    std::vector<vertex_t> predecessors(5);
+    host::sssp::run(vertex_t(5), Ap.data(), Aj.data(), Ax.data(), vertex_t(0),
+                    distances.data(), predecessors.data(), param);
+
+    for (vertex_t v = 0; v < 5; v++) {
+      EXPECT_EQ(distances[v], reference_distances[v]);
+      EXPECT_EQ(predecessors[v], reference_predecessors[v]);
+    }
+  }
+
+  // Path 0 -> 1 -> ... with weights 10 and 25 and narrow buckets: distances
+  // reach thousands of buckets, kept in a cyclic array of 25 / 0.5 + 2 slots.
+  vertex_t n = 1000;
+  Ap.assign(1, 0);
+  Aj.clear();
+  Ax.clear();
+  for (vertex_t v = 0; v < n; ++v) {
+    if (v + 1 < n) {
+      Aj.push_back(v + 1);
+      Ax.push_back((v % 3) ? 10 : 25);
+    }
+    Ap.push_back(edge_t(Aj.size()));
+  }
+  host::sssp::param_t<weight_t> param;
+  param.delta = 0.5;
+  std::vector<weight_t> distances(n);
+  host::sssp::run(n, Ap.data(), Aj.data(), Ax.data(), vertex_t(0),
+                  distances.data(), (vertex_t*)nullptr, param);
+  weight_t expected = 0;
+  for (vertex_t v = 0; v < n; ++v) {
+    EXPECT_EQ(distances[v], expected);
+    if (v + 1 < n)
+      expected += Ax[v];
+  }
+}
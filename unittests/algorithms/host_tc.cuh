@@ -0,0 +1,72 @@
+/**
+ * @file host_tc.cuh
+ * @brief Unit test for the degree-ordered host triangle counting.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <gunrock/algorithms/host/tc.hxx>
+
+using namespace gunrock;
+using namespace memory;
+
+TEST(algorithm, host_tc) {
+  using vertex_t = int;
+  using edge_t = int;
+
+  // Same graphs as the device test, without and with self-loops.
+  // ROW_OFFSETS  = [ 0 3 5 8 10 ]
+  // COL_INDEX    = [ 1 2 3 | 0 2 | 0 1 3 | 0 2]
+  std::vector<edge_t> Ap = {0, 3, 5, 8, 10};
+  std::vector<vertex_t> Aj = {1, 2, 3, 0, 2, 0, 1, 3, 0, 2};
+  std::vector<edge_t> Lp = {0, 4, 7, 10, 12};
+  std::vector<vertex_t> Lj = {0, 1, 2, 3, 0, 1, 2, 0, 1, 3, 0, 2};
+  std::vector<vertex_t> reference_triangles_count = {2, 1, 2, 1};
+
+  for (auto* A : {&Ap, &Lp}) {
+    auto const& Jx = (A == &Ap) ? Aj : Lj;
+    std::vector<vertex_t> triangles_count(4, -1);
+    std::size_t total_triangles = 0;
+    host::tc::run(vertex_t(4), A->data(), Jx.data(), triangles_count.data(),
+                  &total_triangles);
+    EXPECT_EQ(triangles_count, reference_triangles_count);
+    EXPECT_EQ(total_triangles, std::size_t(6));
+  }
+
+  // Complete graph on 40 vertices: long enough lists for the SIMD kernels,
+  // and out-degrees from 39 down to 0 for the bitmap and galloping ones.
+  constexpr vertex_t n = 40;
+  std::vector<edge_t> Kp = {0};
+  std::vector<vertex_t> Kj;
+  for (vertex_t u = 0; u < n; ++u) {
+    for (vertex_t v = 0; v < n; ++v)
+      if (u != v)
+        Kj.push_back(v);
+    Kp.push_back(Kj.size());
+  }
+
+  host::tc::param_t params[4];
+  params[1].simd = false;
+  params[2].bitmap_degree = 1;
+  params[2].skew_ratio = 2;
+  params[3].bitmap_degree = n;
+  params[3].skew_ratio = 2;
+
+  for (auto const& param : params) {
+    std::vector<vertex_t> triangles_count(n, -1);
+    std::size_t total_triangles = 0;
+    host::tc::run(n, Kp.data(), Kj.data(), triangles_count.data(),
+                  &total_triangles, param);
+    for (vertex_t v = 0; v < n; ++v)
+      EXPECT_EQ(triangles_count[v], (n - 1) * (n - 2) / 2);
+    EXPECT_EQ(total_triangles, std::size_t(n * (n - 1) * (n - 2) / 2));
+
+    // Total only.
+    total_triangles = 0;
+    host::tc::run(n, Kp.data(), Kj.data(), (vertex_t*)nullptr,
+                  &total_triangles, param);
+    EXPECT_EQ(total_triangles, std::size_t(n * (n - 1) * (n - 2) / 2));
+  }
+}
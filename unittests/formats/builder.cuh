@@ -0,0 +1,119 @@
+/**
+ * @file builder.cuh
+ * @brief Unit test for the parallel COO -> CSR/CSC builder and its policies.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <gunrock/algorithms/algorithms.hxx>
+#include <gunrock/util/parallel.hxx>
+
+#include <gtest/gtest.h>
+
+TEST(formats, builder) {
+  using namespace gunrock;
+  using namespace memory;
+  using vertex_t = int;
+  using edge_t = int;
+  using weight_t = float;
+
+  // 3 x 3, unsorted, with a self-loop (1, 1) and a duplicate (0, 2).
+  format::coo_t<memory_space_t::host, vertex_t, edge_t, weight_t> coo(3, 3, 6);
+  vertex_t I[] = {0, 2, 0, 1, 0, 1};
+  vertex_t J[] = {2, 0, 1, 1, 2, 2};
+  weight_t V[] = {5, 1, 2, 3, 4, 6};
+  for (int k = 0; k < 6; ++k) {
+    coo.row_indices[k] = I[k];
+    coo.column_indices[k] = J[k];
+    coo.nonzero_values[k] = V[k];
+  }
+
+  using csr_t = format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t>;
+  using csc_t = format::csc_t<memory_space_t::host, vertex_t, edge_t, weight_t>;
+
+  for (std::size_t threads : {1, 4}) {
+    util::parallel::set_number_of_threads(threads);
+
+    // Default: every entry kept, rows sorted (stable).
+    csr_t csr;
+    csr.from_coo(coo);
+    EXPECT_EQ(csr.number_of_nonzeros, 6);
+    EXPECT_EQ(csr.row_offsets, (thrust::host_vector<edge_t>{0, 3, 5, 6}));
+    EXPECT_EQ(csr.column_indices,
+              (thrust::host_vector<vertex_t>{1, 2, 2, 1, 2, 0}));
+    EXPECT_EQ(csr.nonzero_values,
+              (thrust::host_vector<weight_t>{2, 5, 4, 3, 6, 1}));
+
+    // Merging policies.
+    format::build_policy_t policy;
+    policy.remove_self_loops = true;
+    std::pair<format::duplicate_policy_t, weight_t> merges[] = {
+        {format::duplicate_policy_t::sum, 9},
+        {format::duplicate_policy_t::min, 4},
+        {format::duplicate_policy_t::max, 5},
+        {format::duplicate_policy_t::first, 5}};
+    for (auto [duplicates, merged] : merges) {
+      policy.duplicates = duplicates;
+      csr.from_coo(coo, policy);
+      EXPECT_EQ(csr.number_of_nonzeros, 4);
+      EXPECT_EQ(csr.row_offsets, (thrust::host_vector<edge_t>{0, 2, 3, 4}));
+      EXPECT_EQ(csr.column_indices,
+                (thrust::host_vector<vertex_t>{1, 2, 2, 0}));
+      EXPECT_EQ(csr.nonzero_values,
+                (thrust::host_vector<weight_t>{2, merged, 6, 1}));
+    }
+
+    // Symmetrize: adds (1, 0) and (2, 1); (0, 2) and (2, 0) already mirror
+    // each other.
+    policy.duplicates = format::duplicate_policy_t::first;
+    policy.symmetrize = true;
+    csr.from_coo(coo, policy);
+    EXPECT_EQ(csr.row_offsets, (thrust::host_vector<edge_t>{0, 2, 4, 6}));
+    EXPECT_EQ(csr.column_indices,
+              (thrust::host_vector<vertex_t>{1, 2, 0, 2, 0, 1}));
+
+    // Transposition.
+    policy = format::build_policy_t();
+    csr.from_coo(coo, policy);
+    csc_t csc;
+    csc.from_csr(csr);
+    EXPECT_EQ(csc.column_offsets, (thrust::host_vector<vertex_t>{0, 1, 3, 6}));
+    EXPECT_EQ(csc.row_indices,
+              (thrust::host_vector<vertex_t>{2, 0, 1, 0, 0, 1}));
+    EXPECT_EQ(csc.nonzero_values,
+              (thrust::host_vector<weight_t>{1, 2, 3, 5, 4, 6}));
+  }
+
+  // Far more rows than entries: the threads bucket the rows instead of
+  // keeping a histogram of all of them each; same result as one thread.
+  const vertex_t rows = 1 << 20;
+  const std::size_t entries = 200000;
+  std::vector<vertex_t> majors(entries), minors(entries);
+  std::vector<weight_t> values(entries);
+  for (std::size_t k = 0; k < entries; ++k) {
+    majors[k] = vertex_t((k * 2654435761u) % (rows / 8)) * 8;
+    minors[k] = vertex_t(k % 7);
+    values[k] = weight_t(k);
+  }
+  format::build_policy_t policy;
+  policy.duplicates = format::duplicate_policy_t::first;
+  std::vector<edge_t> offsets[2];
+  std::vector<vertex_t> indices[2];
+  std::vector<weight_t> nonzeros[2];
+  std::size_t nnz[2];
+  for (int t = 0; t < 2; ++t) {
+    util::parallel::set_number_of_threads(t == 0 ? 1 : 4);
+    nnz[t] = format::builder::compress(rows, entries, majors.data(),
+                                       minors.data(), values.data(), policy,
+                                       offsets[t], indices[t], nonzeros[t]);
+  }
+  EXPECT_EQ(nnz[0], nnz[1]);
+  EXPECT_EQ(offsets[0], offsets[1]);
+  EXPECT_EQ(indices[0], indices[1]);
+  EXPECT_EQ(nonzeros[0], nonzeros[1]);
+  EXPECT_EQ(offsets[0][rows], edge_t(nnz[0]));
+
+  util::parallel::set_number_of_threads(0);
+}
@@ -0,0 +1,122 @@
+/**
+ * @file compressed_csr.cuh
+ * @brief Unit test for the compressed CSR format and its graph view.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <gunrock/algorithms/algorithms.hxx>
+#include <gunrock/algorithms/host/bfs.hxx>
+#include <gunrock/algorithms/host/pr.hxx>
+
+#include <gtest/gtest.h>
+
+TEST(formats, compressed_csr) {
+  using namespace gunrock;
+  using namespace memory;
+  using vertex_t = int;
+  using edge_t = int;
+  using weight_t = float;
+
+  // Symmetric ring of 300 vertices plus chords from 0 to every 3rd vertex:
+  // rows longer than a block, small and large gaps.
+  const vertex_t n = 300;
+  std::vector<vertex_t> I, J;
+  for (vertex_t v = 0; v < n; ++v) {
+    I.push_back(v);
+    J.push_back((v + 1) % n);
+  }
+  for (vertex_t v = 3; v < n; v += 3) {
+    I.push_back(0);
+    J.push_back(v);
+  }
+  format::coo_t<memory_space_t::host, vertex_t, edge_t, weight_t> coo(
+      n, n, I.size());
+  for (std::size_t k = 0; k < I.size(); ++k) {
+    coo.row_indices[k] = I[k];
+    coo.column_indices[k] = J[k];
+    coo.nonzero_values[k] = 1;
+  }
+  format::build_policy_t policy;
+  policy.symmetrize = true;
+  policy.duplicates = format::duplicate_policy_t::first;
+
+  using csr_t = format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t>;
+  using compressed_csr_t =
+      format::compressed_csr_t<memory_space_t::host, vertex_t, edge_t,
+                               weight_t>;
+  csr_t csr;
+  csr.from_coo(coo, policy);
+
+  // Unit weights are detected and dropped; the round trip is exact.
+  compressed_csr_t compressed;
+  compressed.from_csr(csr);
+  EXPECT_TRUE(compressed.unit_values);
+  EXPECT_TRUE(compressed.nonzero_values.empty());
+  EXPECT_LT(compressed.memory_footprint(), compressed.uncompressed_footprint());
+
+  csr_t decoded;
+  compressed.to_csr(decoded);
+  EXPECT_EQ(decoded.row_offsets, csr.row_offsets);
+  EXPECT_EQ(decoded.column_indices, csr.column_indices);
+  EXPECT_EQ(decoded.nonzero_values, csr.nonzero_values);
+
+  // Stored values are kept as-is.
+  csr.nonzero_values[5] = 2;
+  compressed.from_csr(csr);
+  EXPECT_FALSE(compressed.unit_values);
+  compressed.to_csr(decoded);
+  EXPECT_EQ(decoded.nonzero_values, csr.nonzero_values);
+  csr.nonzero_values[5] = 1;
+  compressed.from_csr(csr, format::value_policy_t::implicit_unit);
+  EXPECT_TRUE(compressed.unit_values);
+
+  // Graph view: random access, iteration and neighbor scans agree with CSR.
+  graph::graph_properties_t properties;
+  properties.symmetric = true;
+  auto G = graph::build<memory_space_t::host>(properties, csr, compressed);
+  auto& C = static_cast<
+      graph::graph_compressed_csr_t<memory_space_t::host, vertex_t, edge_t,
+                                    weight_t>&>(G);
+
+  std::vector<vertex_t> row(n);
+  for (vertex_t v = 0; v < n; ++v) {
+    edge_t start = csr.row_offsets[v];
+    edge_t degree = C.decode(v, row.data());
+    EXPECT_EQ(degree, csr.row_offsets[v + 1] - start);
+
+    edge_t k = 0;
+    for (vertex_t u : C.neighbors(v)) {
+      EXPECT_EQ(u, csr.column_indices[start + k]);
+      EXPECT_EQ(row[k], u);
+      EXPECT_EQ(C.get_destination_vertex(start + k), u);
+      EXPECT_EQ(C.get_source_vertex(start + k), v);
+      EXPECT_EQ(C.get_edge(v, u), start + k);
+      ++k;
+    }
+    EXPECT_EQ(k, degree);
+    EXPECT_EQ(C.get_edge(v, v), gunrock::numeric_limits<edge_t>::invalid());
+
+    C.for_each_neighbor(v, degree / 2, degree, [&](vertex_t u, edge_t e) {
+      EXPECT_EQ(u, csr.column_indices[e]);
+    });
+  }
+
+  // Host BFS and PR give the same results on either view.
+  auto H = graph::build<memory_space_t::host>(properties, compressed);
+  thrust::host_vector<vertex_t> distances(n), expected_distances(n);
+  host::bfs::run(G, 1, expected_distances.data(), (vertex_t*)nullptr);
+  host::bfs::run(H, 1, distances.data(), (vertex_t*)nullptr);
+  EXPECT_EQ(distances, expected_distances);
+
+  thrust::host_vector<weight_t> ranks(n), expected_ranks(n);
+  host::pr::run(G, expected_ranks.data());
+  host::pr::run(H, ranks.data());
+  EXPECT_EQ(ranks, expected_ranks);
+
+  // Unsorted rows are rejected.
+  std::swap(csr.column_indices[0], csr.column_indices[1]);
+  EXPECT_THROW(compressed.from_csr(csr), error::exception_t);
+}
@@ -0,0 +1,65 @@
+/**
+ * @file host.cuh
+ * @brief Unit test for the multithreaded host operator backend.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <gunrock/algorithms/bfs.hxx>
+#include <gunrock/io/sample.hxx>
+#include <gunrock/util/parallel.hxx>
+
+#include <gtest/gtest.h>
+
+/// Extended `__device__` lambdas cannot be defined within TEST().
+struct is_odd_t {
+  __host__ __device__ bool operator()(const int& v) const { return v % 2 == 1; }
+};
+
+TEST(operators, host_backend) {
+  using namespace gunrock;
+  using namespace memory;
+  using vertex_t = int;
+
+  // Sample graph: 1 -> {0, 1}, 2 -> {2}, 3 -> {1}; kept on the host.
+  auto csr = io::sample::csr<memory_space_t::host>();
+  graph::graph_properties_t properties;
+  auto G = graph::build<memory_space_t::host>(properties, csr);
+
+  auto context = std::make_shared<gcuda::multi_context_t>(0);
+
+  for (std::size_t threads : {1, 4}) {
+    util::parallel::set_number_of_threads(threads);
+
+    vertex_t source = 3;
+    thrust::host_vector<vertex_t> distances(G.get_number_of_vertices());
+    thrust::host_vector<vertex_t> predecessors(G.get_number_of_vertices());
+    bfs::run(G, source, distances.data(), predecessors.data(), context);
+
+    auto unreached = std::numeric_limits<vertex_t>::max();
+    EXPECT_EQ(distances[0], 2);
+    EXPECT_EQ(distances[1], 1);
+    EXPECT_EQ(distances[2], unreached);
+    EXPECT_EQ(distances[3], 0);
+
+    // Filter a host frontier: keeps odd vertices, drops invalids.
+    frontier::frontier_t<vertex_t, int,
+                         frontier::frontier_kind_t::vertex_frontier,
+                         frontier::frontier_view_t::vector,
+                         memory_space_t::host>
+        in, out;
+    in.push_back(1);
+    in.push_back(gunrock::numeric_limits<vertex_t>::invalid());
+    in.push_back(2);
+    in.push_back(3);
+    operators::filter::execute<operators::filter_algorithm_t::compact>(
+        G, is_odd_t(), &in, &out, *context);
+    ASSERT_EQ(out.get_number_of_elements(), 2);
+    EXPECT_EQ(out.get_element_at(0), 1);
+    EXPECT_EQ(out.get_element_at(1), 3);
+  }
+
+  util::parallel::set_number_of_threads(0);
+}
@@ -0,0 +1,104 @@
+/**
+ * @file profile.cuh
+ * @brief Unit test for the per-iteration operator trace.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+
+#include <gunrock/algorithms/bfs.hxx>
+#include <gunrock/framework/profile.hxx>
+#include <gunrock/io/sample.hxx>
+
+#include <gtest/gtest.h>
+
+TEST(framework, profile_trace) {
+  using namespace gunrock;
+  using namespace memory;
+  using vertex_t = int;
+
+  // Ring buffer: keeps the most recent records, oldest first.
+  profile::trace_t trace;
+  EXPECT_FALSE(trace.is_enabled());
+  trace.enable(5);
+  EXPECT_EQ(trace.capacity(), 8);
+
+  {
+    profile::activate_t profiling(trace);
+    for (int i = 0; i < 10; ++i) {
+      trace.set_iteration(i);
+      profile::scope_t scope(profile::operator_t::filter,
+                             [&]() -> std::size_t { return i; });
+      EXPECT_TRUE(scope.is_active());
+      scope.set_output_size(2 * i);
+    }
+  }
+  EXPECT_TRUE(profile::current() == nullptr);
+  EXPECT_EQ(trace.dropped(), 2);
+  auto records = trace.records();
+  ASSERT_EQ(records.size(), 8);
+  for (std::size_t i = 0; i < records.size(); ++i) {
+    EXPECT_EQ(records[i].iteration, int(i + 2));
+    EXPECT_EQ(records[i].input_size, i + 2);
+    EXPECT_EQ(records[i].output_size, 2 * (i + 2));
+    EXPECT_TRUE(records[i].op == profile::operator_t::filter);
+    EXPECT_GE(records[i].duration, 0);
+  }
+
+  // Disabled: nothing is recorded.
+  trace.clear();
+  trace.disable();
+  {
+    profile::activate_t profiling(trace);
+    profile::scope_t scope(profile::operator_t::advance,
+                           []() -> std::size_t { return 1; });
+    EXPECT_FALSE(scope.is_active());
+  }
+  EXPECT_EQ(trace.records().size(), 0);
+
+  // Host BFS from 3 on the sample graph (1 -> {0, 1}, 2 -> {2}, 3 -> {1}):
+  // frontiers {3}, {1}, {0} visit 1 + 2 + 0 edges, each advance nested in
+  // its loop iteration.
+  auto csr = io::sample::csr<memory_space_t::host>();
+  graph::graph_properties_t properties;
+  auto G = graph::build<memory_space_t::host>(properties, csr);
+  auto context = std::make_shared<gcuda::multi_context_t>(0);
+
+  thrust::host_vector<vertex_t> distances(G.get_number_of_vertices());
+  thrust::host_vector<vertex_t> predecessors(G.get_number_of_vertices());
+  profile::session().enable();
+  bfs::run(G, vertex_t(3), distances.data(), predecessors.data(), context);
+  profile::session().disable();
+
+  std::size_t loops = 0, edges = 0;
+  for (auto const& r : profile::session().records()) {
+    if (r.op == profile::operator_t::loop) {
+      EXPECT_EQ(r.iteration, int(loops));
+      ++loops;
+    } else if (r.op == profile::operator_t::advance) {
+      edges += r.edges;
+    }
+  }
+  EXPECT_EQ(loops, 3);
+  EXPECT_EQ(edges, 3);
+
+  std::string filename =
+      (std::filesystem::temp_directory_path() / "gunrock_profile.trace.json")
+          .string();
+  profile::session().write_chrome_trace(filename);
+  std::string contents;
+  {
+    std::ifstream file(filename);
+    contents.assign(std::istreambuf_iterator<char>(file),
+                    std::istreambuf_iterator<char>());
+  }
+  std::remove(filename.c_str());
+  EXPECT_NE(contents.find("\"traceEvents\""), std::string::npos);
+  EXPECT_NE(contents.find("\"name\": \"advance\""), std::string::npos);
+  profile::session().clear();
+}
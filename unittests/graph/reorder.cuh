@@ -0,0 +1,68 @@
+/**
+ * @file reorder.cuh
+ * @brief Unit test for vertex reordering and result un-permutation.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <gunrock/algorithms/algorithms.hxx>
+#include <gunrock/algorithms/host/bfs.hxx>
+#include <gunrock/graph/reorder.hxx>
+
+#include <gtest/gtest.h>
+
+TEST(graph, reorder) {
+  using namespace gunrock;
+  using namespace memory;
+  using vertex_t = int;
+  using edge_t = int;
+  using weight_t = float;
+
+  // Symmetric path 0 - 4 - 1 - 3 - 2 with scrambled IDs.
+  format::coo_t<memory_space_t::host, vertex_t, edge_t, weight_t> coo(5, 5, 4);
+  vertex_t I[] = {0, 4, 1, 3};
+  vertex_t J[] = {4, 1, 3, 2};
+  for (int k = 0; k < 4; ++k) {
+    coo.row_indices[k] = I[k];
+    coo.column_indices[k] = J[k];
+    coo.nonzero_values[k] = 1;
+  }
+  format::build_policy_t policy;
+  policy.symmetrize = true;
+
+  for (auto ordering : {"none", "degree", "rcm", "hub_sort", "hub_cluster",
+                        "gorder"}) {
+    format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> csr;
+    csr.from_coo(coo, policy);
+
+    auto permutation = graph::reorder::compute(
+        graph::reorder::from_string(ordering), csr, true);
+    for (vertex_t v = 0; v < 5; ++v)
+      EXPECT_EQ(permutation.to_old(permutation.to_new(v)), v);
+
+    graph::graph_properties_t properties;
+    auto G = graph::build<memory_space_t::host>(properties, csr, permutation);
+
+    // BFS from original vertex 0, results mapped back to original IDs.
+    thrust::host_vector<vertex_t> distances(5), predecessors(5);
+    host::bfs::run(G, permutation.to_new(0), distances.data(),
+                   predecessors.data());
+    permutation.unpermute(distances);
+    permutation.unpermute_ids(predecessors);
+
+    EXPECT_EQ(distances, (thrust::host_vector<vertex_t>{0, 2, 4, 3, 1}));
+    EXPECT_EQ(predecessors, (thrust::host_vector<vertex_t>{-1, 4, 3, 1, 0}));
+  }
+
+  // RCM turns the path into a band of width 1.
+  format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> csr;
+  csr.from_coo(coo, policy);
+  auto permutation =
+      graph::reorder::compute(graph::reorder::algorithm_t::rcm, csr, true);
+  graph::reorder::apply(permutation, csr);
+  for (vertex_t v = 0; v < 5; ++v)
+    for (edge_t e = csr.row_offsets[v]; e < csr.row_offsets[v + 1]; ++e)
+      EXPECT_EQ(std::abs(csr.column_indices[e] - v), 1);
+}
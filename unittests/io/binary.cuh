@@ -0,0 +1,107 @@
+/**
+ * @file binary.cuh
+ * @brief Unit test for the binary graph container (io/binary.hxx).
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <cstdio>
+
+#include <gunrock/algorithms/host/sssp.hxx>
+#include <gunrock/error.hxx>        // error checking
+#include <gunrock/formats/formats.hxx>
+#include <gunrock/graph/build.hxx>  // graph builders
+#include <gunrock/io/binary.hxx>    // binary graph support
+
+#include <gtest/gtest.h>
+
+TEST(io, binary) {
+  using namespace gunrock;
+  using namespace memory;
+
+  using vertex_t = int;
+  using edge_t = int;
+  using weight_t = float;
+
+  format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> csr(3, 3, 5);
+  csr.row_offsets = std::vector<edge_t>{0, 2, 3, 5};
+  csr.column_indices = std::vector<vertex_t>{1, 2, 0, 0, 1};
+  csr.nonzero_values = std::vector<weight_t>{1.5, 2, 3, 4, 5};
+
+  graph::graph_properties_t properties;
+  properties.directed = true;
+  properties.symmetric = false;
+
+  std::string filename = "binary_test.csr";
+  csr.write_binary(filename, properties);
+  EXPECT_TRUE(io::binary::is_binary(filename));
+
+  // Read back into a CSR with wider types (converting copy).
+  format::csr_t<memory_space_t::host, vertex_t, long long, double> wide;
+  auto read_properties = wide.read_binary(filename);
+  EXPECT_TRUE(read_properties.directed);
+  EXPECT_FALSE(read_properties.symmetric);
+  EXPECT_EQ(wide.number_of_nonzeros, 5);
+  for (int i = 0; i < 5; ++i)
+    EXPECT_EQ(wide.nonzero_values[i], csr.nonzero_values[i]);
+
+  // Zero-copy host graph on top of the mapping.
+  {
+    io::binary::mapped_t<vertex_t, edge_t, weight_t> mapped(filename, true);
+    auto G = graph::build<memory_space_t::host>(mapped);
+    EXPECT_EQ(G.get_number_of_vertices(), 3);
+    EXPECT_EQ(G.get_number_of_edges(), 5);
+    EXPECT_EQ(G.get_number_of_neighbors(2), 2);
+    EXPECT_EQ(G.get_edge_weight(4), 5);
+  }
+
+  // A pattern graph (no values section) maps too, without values.
+  std::string pattern = "binary_test_pattern.csr";
+  io::binary::section_t pattern_sections[] = {
+      io::binary::make_section(csr.row_offsets.data(), 4),
+      io::binary::make_section(csr.column_indices.data(), 5),
+      io::binary::empty_section()};
+  io::binary::write(pattern, io::binary::layout_t::csr, 3, 3, 5, properties,
+                    pattern_sections);
+  {
+    io::binary::mapped_t<vertex_t, edge_t, weight_t> mapped(pattern, true);
+    EXPECT_FALSE(mapped.has_values());
+    EXPECT_EQ(mapped.values(), nullptr);
+    EXPECT_EQ(mapped.indices()[4], 1);
+
+    // Unit weights.
+    auto G = graph::build<memory_space_t::host>(mapped);
+    EXPECT_EQ(G.get_edge_weight(4), 1);
+    std::vector<weight_t> distances(3);
+    host::sssp::run(G, 0, distances.data(), (vertex_t*)nullptr);
+    EXPECT_EQ(distances, (std::vector<weight_t>{0, 1, 1}));
+  }
+
+  // Sections whose sizes disagree with the header counts are rejected.
+  pattern_sections[0] = io::binary::make_section(csr.row_offsets.data(), 3);
+  io::binary::write(pattern, io::binary::layout_t::csr, 3, 3, 5, properties,
+                    pattern_sections);
+  EXPECT_THROW(io::binary::file_t{pattern}, error::exception_t);
+
+  // Legacy (headerless) files are still readable.
+  std::string legacy = "binary_test_legacy.csr";
+  FILE* file = fopen(legacy.c_str(), "wb");
+  int meta[3] = {3, 3, 5};
+  fwrite(meta, sizeof(int), 3, file);
+  fwrite(csr.row_offsets.data(), sizeof(edge_t), 4, file);
+  fwrite(csr.column_indices.data(), sizeof(vertex_t), 5, file);
+  fwrite(csr.nonzero_values.data(), sizeof(weight_t), 5, file);
+  fclose(file);
+
+  format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> old;
+  old.read_binary(legacy);
+  EXPECT_EQ(old.number_of_rows, 3);
+  for (int i = 0; i < 5; ++i)
+    EXPECT_EQ(old.column_indices[i], csr.column_indices[i]);
+
+  std::remove(filename.c_str());
+  std::remove(legacy.c_str());
+  std::remove(pattern.c_str());
+}
@@ -0,0 +1,54 @@
+/**
+ * @file matrix_market_parallel.cuh
+ * @brief Unit test for the parallel (mmap) matrix market loader.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <cstdio>
+#include <fstream>
+
+#include <gunrock/error.hxx>             // error checking
+#include <gunrock/io/matrix_market.hxx>  // matrix_market support
+
+#include <gtest/gtest.h>
+
+TEST(io, matrix_market_parallel) {
+  using namespace gunrock;
+
+  using vertex_t = int;
+  using edge_t = int;
+  using weight_t = float;
+
+  // Symmetric file with a comment, a blank line, tabs, CRLF and a diagonal.
+  std::string filename = "matrix_market_parallel_test.mtx";
+  std::ofstream file(filename);
+  file << "%%MatrixMarket matrix coordinate real symmetric\n"
+       << "% comment\n"
+       << "4 4 5\n"
+       << "2 1 0.5\n"
+       << "3\t1\t-2e1\r\n"
+       << "\n"
+       << "3 3 7\n"
+       << "4 2 1.25\n"
+       << "04 3 3";
+  file.close();
+
+  io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
+  auto [properties, coo] = mm.load(filename);
+  auto [serial_properties, serial_coo] = mm.load_serial(filename);
+  std::remove(filename.c_str());
+
+  EXPECT_TRUE(properties.symmetric);
+  EXPECT_FALSE(properties.directed);
+  EXPECT_EQ(coo.number_of_nonzeros, 9);
+  EXPECT_EQ(coo.number_of_nonzeros, serial_coo.number_of_nonzeros);
+
+  for (edge_t i = 0; i < coo.number_of_nonzeros; ++i) {
+    EXPECT_EQ(coo.row_indices[i], serial_coo.row_indices[i]);
+    EXPECT_EQ(coo.column_indices[i], serial_coo.column_indices[i]);
+    EXPECT_EQ(coo.nonzero_values[i], serial_coo.nonzero_values[i]);
+  }
+}
@@ -0,0 +1,153 @@
+/**
+ * @file pool.cuh
+ * @brief Unit test for the size-class caching memory pool.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <gunrock/container/vector.hxx>
+#include <gunrock/memory.hxx>
+#include <gunrock/util/parallel.hxx>
+
+#include <future>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+TEST(memory, pool) {
+  using namespace gunrock;
+  using namespace memory;
+
+  // Size classes: four per doubling from 256 bytes.
+  EXPECT_EQ(detail::class_bytes(detail::size_class(1)), 256u);
+  EXPECT_EQ(detail::class_bytes(detail::size_class(256)), 256u);
+  EXPECT_EQ(detail::class_bytes(detail::size_class(257)), 320u);
+  EXPECT_EQ(detail::class_bytes(detail::size_class(512)), 512u);
+  EXPECT_EQ(detail::class_bytes(detail::size_class(513)), 640u);
+  for (std::size_t bytes = 1; bytes < (1 << 16); bytes += 97) {
+    std::size_t block = detail::class_bytes(detail::size_class(bytes));
+    EXPECT_GE(block, bytes);
+    EXPECT_LE(block, std::max<std::size_t>(256, bytes + bytes / 4));
+  }
+
+  // Hits, misses, high water and retained bytes.
+  pool_t<host_resource_t> pool;
+  void* a = pool.allocate(1000);  // 1024-byte block
+  void* b = pool.allocate(3000);  // 3072-byte block
+  EXPECT_EQ(pool.allocate(0), nullptr);
+  pool.deallocate(a, 1000);
+  void* c = pool.allocate(1001);  // Same class: reuses `a`.
+  EXPECT_EQ(c, a);
+  auto s = pool.stats();
+  EXPECT_EQ(s.hits, 1u);
+  EXPECT_EQ(s.misses, 2u);
+  EXPECT_EQ(s.in_use_bytes, 1024u + 3072u);
+  EXPECT_EQ(s.high_water_bytes, 1024u + 3072u);
+  EXPECT_EQ(s.retained_bytes, 0u);
+
+  pool.deallocate(b, 3000);
+  pool.deallocate(c, 1001);
+  s = pool.stats();
+  EXPECT_EQ(s.in_use_bytes, 0u);
+  EXPECT_EQ(s.retained_bytes, 1024u + 3072u);
+
+  // Trim releases the largest blocks first; the cap sends blocks upstream.
+  pool.trim(2000);
+  EXPECT_EQ(pool.stats().retained_bytes, 1024u);
+  pool.set_limit(0);
+  EXPECT_EQ(pool.stats().retained_bytes, 0u);
+  pool.deallocate(pool.allocate(100), 100);
+  EXPECT_EQ(pool.stats().retained_bytes, 0u);
+  pool.set_limit(~std::size_t(0));
+
+  // Concurrent frees stay within the cap.
+  pool.set_limit(4096);
+  util::parallel::set_number_of_threads(4);
+  util::parallel::for_each(
+      std::size_t(0), std::size_t(64),
+      [&](std::size_t) {
+        void* blocks[8];
+        for (auto& block : blocks)
+          block = pool.allocate(512);
+        for (auto& block : blocks)
+          pool.deallocate(block, 512);
+        EXPECT_LE(pool.stats().retained_bytes, 4096u);
+      },
+      std::size_t(1));
+  util::parallel::set_number_of_threads(0);
+  pool.set_limit(~std::size_t(0));
+
+  // Device blocks are reused once freed (in stream order).
+  pool_t<device_resource_t> device;
+  void* d = device.allocate(1000);
+  device.deallocate(d, 1000);
+  EXPECT_EQ(device.allocate(1000), d);
+  device.deallocate(d, 1000);
+  EXPECT_EQ(device.stats().hits, 1u);
+
+  // Disabled: every allocation is a miss and nothing is kept.
+  pool.reset_stats();
+  pool.set_enabled(false);
+  for (int i = 0; i < 3; ++i)
+    pool.deallocate(pool.allocate(5000), 5000);
+  s = pool.stats();
+  EXPECT_EQ(s.hits, 0u);
+  EXPECT_EQ(s.misses, 3u);
+  EXPECT_EQ(s.retained_bytes, 0u);
+  pool.set_enabled(true);
+
+  // Threads allocating and freeing concurrently through the host pool.
+  using host_vector_t =
+      thrust::host_vector<int, pool_allocator_t<int, memory_space_t::host>>;
+  auto& host = memory::pool<memory_space_t::host>();
+  std::size_t in_use = host.stats().in_use_bytes;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t)
+    threads.emplace_back([t] {
+      for (int i = 0; i < 200; ++i) {
+        host_vector_t x(64 + (i * 37 + t) % 4096, t);
+        ASSERT_EQ(x[x.size() - 1], t);
+      }
+    });
+  for (auto& thread : threads)
+    thread.join();
+  EXPECT_EQ(host.stats().in_use_bytes, in_use);
+  EXPECT_GT(host.stats().hits, 0u);
+
+  // A pool destroyed while other threads still hold cached blocks of it: it
+  // takes them back, and those threads' caches serve the next pools.
+  util::parallel::set_number_of_threads(4);
+  std::promise<void> destroyed;
+  std::promise<void> cached;
+  std::thread survivor;
+  {
+    pool_t<host_resource_t> scratch;
+    util::parallel::for_each(
+        std::size_t(0), std::size_t(64),
+        [&](std::size_t) { scratch.deallocate(scratch.allocate(512), 512); },
+        std::size_t(1));
+    survivor = std::thread([&] {
+      scratch.deallocate(scratch.allocate(2048), 2048);
+      cached.set_value();
+      destroyed.get_future().wait();
+      host_vector_t x(100, 1);  // Outlives `scratch`.
+    });
+    cached.get_future().wait();
+    EXPECT_EQ(scratch.stats().in_use_bytes, 0u);
+    EXPECT_GT(scratch.stats().retained_bytes, 0u);
+  }
+  destroyed.set_value();
+  survivor.join();
+
+  pool_t<host_resource_t> next;
+  util::parallel::for_each(
+      std::size_t(0), std::size_t(64),
+      [&](std::size_t) { next.deallocate(next.allocate(512), 512); },
+      std::size_t(1));
+  EXPECT_GT(next.stats().hits, 0u);
+  EXPECT_EQ(next.stats().in_use_bytes, 0u);
+  util::parallel::set_number_of_threads(0);
+}
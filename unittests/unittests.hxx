@@ -14,6 +14,8 @@
 // #include "experiments/shared_ptr.cuh"
 
 // #include "formats/format.cuh"
+// #include "formats/builder.cuh"
+// #include "formats/compressed_csr.cuh"
 // #include "formats/coo.cuh"
 // #include "formats/coocsc.cuh"
 #include "formats/coocsccsr.cuh"
@@ -25,12 +27,16 @@
 // #include "graph/src_vertex.cuh"
 // #include "graph/graph_load.cuh"
 // #include "graph/graph.cuh"
+// #include "graph/reorder.cuh"
 
 // #include "memory/virtual_memory.cuh"
 // #include "memory/memory.cuh"
+// #include "memory/pool.cuh"
 
 // #include "framework/problem.cuh"
+// #include "framework/profile.cuh"
 // #include "framework/operators/for.cuh"
+// #include "framework/operators/host.cuh"
 
 // #include "utils/type_limits.cuh"
 
@@ -41,7 +47,20 @@
 // #include "containers/array.cuh"
 
 // #include "io/matrix_market.cuh"
+// #include "io/matrix_market_parallel.cuh"
+// #include "io/binary.cuh"
 // #include "io/smtx.cuh"
 // #include "io/mtxbin.cuh"
 
 // #include "algorithms/tc.cuh"
+// #include "algorithms/generate_graphs.cuh"
+// #include "algorithms/host_bfs.cuh"
+// #include "algorithms/host_dynamic.cuh"
+// #include "algorithms/host_kcore.cuh"
+// #include "algorithms/host_knn.cuh"
+// #include "algorithms/host_msbfs.cuh"
+// #include "algorithms/host_pr.cuh"
+// #include "algorithms/host_spgemm.cuh"
+// #include "algorithms/host_spmv.cuh"
+// #include "algorithms/host_sssp.cuh"
+// #include "algorithms/host_tc.cuh"